@@ -0,0 +1,19 @@
+/*
+ * jQuery JavaScript Library v1.3.3pre
+ * http://jquery.com/
+ *
+ * Copyright (c) 2009 John Resig
+ * Dual licensed under the MIT and GPL licenses.
+ * http://docs.jquery.com/License
+ *
+ * Date: 2009-06-24 04:14:57 +1000 (Wed, 24 Jun 2009)
+ * Revision: 6414
+ */
+(function(j,g){var q=function(G,H){return arguments.length===0?p:new q.fn.init(G,H)},A=j.jQuery,r=j.$,p,F=/^[^<]*(<(.|\s)+>)[^>]*$|^#([\w-]+)$/,f=/^.[^:#\[\.,]*$/,E=navigator.userAgent.toLowerCase(),t=Object.prototype.toString;j.jQuery=j.$=q;q.fn=q.prototype={init:function(G,J){var I,K,H;if(!G){this.length=0;return this}if(G.nodeType){this[0]=G;this.length=1;this.context=G;return this}if(typeof G==="string"){I=F.exec(G);if(I&&(I[1]||!J)){if(I[1]){G=q.clean([I[1]],J)}else{K=document.getElementById(I[3]);if(K&&K.id!==I[3]){return p.find(G)}H=q(K||null);H.context=document;H.selector=G;return H}}else{if(!J||J.jquery){return(J||p).find(G)}else{return q(J).find(G)}}}else{if(q.isFunction(G)){return p.ready(G)}}if(G.selector&&G.context){this.selector=G.selector;this.context=G.context}return this.setArray(q.isArray(G)?G:q.makeArray(G))},selector:"",jquery:"1.3.3pre",size:function(){return this.length},get:function(G){return G==null?Array.prototype.slice.call(this):this[G]},pushStack:function(H,J,G){var I=q(H||null);I.prevObject=this;I.context=this.context;if(J==="find"){I.selector=this.selector+(this.selector?" ":"")+G}else{if(J){I.selector=this.selector+"."+J+"("+G+")"}}return I},setArray:function(G){this.length=0;Array.prototype.push.apply(this,G);return this},each:function(H,G){return q.each(this,H,G)},index:function(G){if(!G||typeof G==="string"){return q.inArray(this[0],G?q(G):this.parent().children())}return q.inArray(G.jquery?G[0]:G,this)},is:function(G){return !!G&&q.multiFilter(G,this).length>0},push:[].push,sort:[].sort,splice:[].splice};q.fn.init.prototype=q.fn;q.extend=q.fn.extend=function(){var L=arguments[0]||{},J=1,K=arguments.length,G=false,I,H,M,N;if(typeof L==="boolean"){G=L;L=arguments[1]||{};J=2}if(typeof L!=="object"&&!q.isFunction(L)){L={}}if(K===J){L=this;--J}for(;J<K;J++){if((I=arguments[J])!=null){for(H in I){M=L[H];N=I[H];if(L===N){continue}if(G&&N&&typeof N==="object"&&!N.nodeType){L[H]=q.extend(G,M||(N.length!=null?[]:{}),N)}else{if(N!==g){L[H]=N}}}}}return L};q.extend({noConflict:function(G){j.$=r;if(G){j.jQuery=A}return q},isFunction:function(G){return t.call(G)==="[object Function]"},isArray:function(G){return t.call(G)==="[object Array]"},isXMLDoc:function(G){return G.nodeType===9&&G.documentElement.nodeName!=="HTML"||!!G.ownerDocument&&G.ownerDocument.documentElement.nodeName!=="HTML"},globalEval:function(I){if(I&&/\S/.test(I)){var H=document.getElementsByTagName("head")[0]||document.documentElement,G=document.createElement("script");G.type="text/javascript";if(q.support.scriptEval){G.appendChild(document.createTextNode(I))}else{G.text=I}H.insertBefore(G,H.firstChild);H.removeChild(G)}},nodeName:function(H,G){return H.nodeName&&H.nodeName.toUpperCase()===G.toUpperCase()},each:function(J,N,I){var H,K=0,L=J.length,G=L===g||q.isFunction(J);if(I){if(G){for(H in J){if(N.apply(J[H],I)===false){break}}}else{for(;K<L;){if(N.apply(J[K++],I)===false){break}}}}else{if(G){for(H in J){if(N.call(J[H],H,J[H])===false){break}}}else{for(var M=J[0];K<L&&N.call(M,K,M)!==false;M=J[++K]){}}}return J},trim:function(G){return(G||"").replace(/^\s+|\s+$/g,"")},makeArray:function(I){var G=[],H;if(I!=null){H=I.length;if(H==null||typeof I==="string"||q.isFunction(I)||I.setInterval){G[0]=I}else{while(H){G[--H]=I[H]}}}return G},inArray:function(I,J){for(var G=0,H=J.length;G<H;G++){if(J[G]===I){return G}}return -1},merge:function(J,G){var H=0,I,K=J.length;if(!q.support.getAll){while((I=G[H++])!=null){if(I.nodeType!==8){J[K++]=I}}}else{while((I=G[H++])!=null){J[K++]=I}}return J},unique:function(M){var H=[],G={},L;try{for(var I=0,J=M.length;I<J;I++){L=q.data(M[I]);if(!G[L]){G[L]=true;H.push(M[I])}}}catch(K){H=M}return H},grep:function(H,L,G){var I=[];for(var J=0,K=H.length;J<K;J++){if(!G!==!L(H[J],J)){I.push(H[J])}}return I},map:function(G,L){var H=[],K;for(var I=0,J=G.length;I<J;I++){K=L(G[I],I);if(K!=null){H[H.length]=K}}return H.concat.apply([],H)},browser:{version:(E.match(/.+(?:rv|it|ra|ie)[\/: ]([\d.]+)/)||[0,"0"])[1],safari:/webkit/.test(E),opera:/opera/.test(E),msie:/msie/.test(E)&&!/opera/.test(E),mozilla:/mozilla/.test(E)&&!/(compatible|webkit)/.test(E)}});p=q(document);function B(G,H){if(H.src){q.ajax({url:H.src,async:false,dataType:"script"})}else{q.globalEval(H.text||H.textContent||H.innerHTML||"")}if(H.parentNode){H.parentNode.removeChild(H)}}function e(){return(new Date).getTime()}var h="jQuery"+e(),x=0,C={};q.extend({cache:{},data:function(H,G,I){H=H==j?C:H;var J=H[h];if(!J){J=H[h]=++x}if(G&&!q.cache[J]){q.cache[J]={}}if(I!==g){q.cache[J][G]=I}return G?q.cache[J][G]:J},removeData:function(H,G){H=H==j?C:H;var J=H[h];if(G){if(q.cache[J]){delete q.cache[J][G];G="";for(G in q.cache[J]){break}if(!G){q.removeData(H)}}}else{try{delete H[h]}catch(I){if(H.removeAttribute){H.removeAttribute(h)}}delete q.cache[J]}},queue:function(H,G,J){if(H){G=(G||"fx")+"queue";var I=q.data(H,G);if(!I||q.isArray(J)){I=q.data(H,G,q.makeArray(J))}else{if(J){I.push(J)}}}return I},dequeue:function(J,I){var G=q.queue(J,I),H=G.shift();if(!I||I==="fx"){H=G[0]}if(H!==g){H.call(J)}}});q.fn.extend({data:function(G,I){var J=G.split(".");J[1]=J[1]?"."+J[1]:"";if(I===g){var H=this.triggerHandler("getData"+J[1]+"!",[J[0]]);if(H===g&&this.length){H=q.data(this[0],G)}return H===g&&J[1]?this.data(J[0]):H}else{return this.trigger("setData"+J[1]+"!",[J[0],I]).each(function(){q.data(this,G,I)})}},removeData:function(G){return this.each(function(){q.removeData(this,G)})},queue:function(G,H){if(typeof G!=="string"){H=G;G="fx"}if(H===g){return q.queue(this[0],G)}return this.each(function(){var I=q.queue(this,G,H);if(G=="fx"&&I.length==1){I[0].call(this)}})},dequeue:function(G){return this.each(function(){q.dequeue(this,G)})}});
+/*
+ * Sizzle CSS Selector Engine - v1.0
+ *  Copyright 2009, The Dojo Foundation
+ *  Released under the MIT, BSD, and GPL Licenses.
+ *  More information: http://sizzlejs.com/
+ */
+(function(){var U=/((?:\((?:\([^()]+\)|[^()]+)+\)|\[(?:\[[^[\]]*\]|['"][^'"]*['"]|[^[\]'"]+)+\]|\\.|[^ >+~,(\[\\]+)+|[>+~])(\s*,\s*)?/g,N=0,J=Object.prototype.toString,S=false;var H=function(aj,Z,ag,ab){ag=ag||[];var W=Z=Z||document;if(Z.nodeType!==1&&Z.nodeType!==9){return[]}if(!aj||typeof aj!=="string"){return ag}var ah=[],ai,ae,am,al,af,Y,X=true,ac=T(Z);U.lastIndex=0;while((ai=U.exec(aj))!==null){ah.push(ai[1]);if(ai[2]){Y=RegExp.rightContext;break}}if(ah.length>1&&O.exec(aj)){if(ah.length===2&&K.relative[ah[0]]){ae=L(ah[0]+ah[1],Z)}else{ae=K.relative[ah[0]]?[Z]:H(ah.shift(),Z);while(ah.length){aj=ah.shift();if(K.relative[aj]){aj+=ah.shift()}ae=L(aj,ae)}}}else{if(!ab&&ah.length>1&&Z.nodeType===9&&!ac&&K.match.ID.test(ah[0])&&!K.match.ID.test(ah[ah.length-1])){var an=H.find(ah.shift(),Z,ac);Z=an.expr?H.filter(an.expr,an.set)[0]:an.set[0]}if(Z){var an=ab?{expr:ah.pop(),set:G(ab)}:H.find(ah.pop(),ah.length===1&&(ah[0]==="~"||ah[0]==="+")&&Z.parentNode?Z.parentNode:Z,ac);ae=an.expr?H.filter(an.expr,an.set):an.set;if(ah.length>0){am=G(ae)}else{X=false}while(ah.length){var aa=ah.pop(),ad=aa;if(!K.relative[aa]){aa=""}else{ad=ah.pop()}if(ad==null){ad=Z}K.relative[aa](am,ad,ac)}}else{am=ah=[]}}if(!am){am=ae}if(!am){throw"Syntax error, unrecognized expression: "+(aa||aj)}if(J.call(am)==="[object Array]"){if(!X){ag.push.apply(ag,am)}else{if(Z&&Z.nodeType===1){for(var ak=0;am[ak]!=null;ak++){if(am[ak]&&(am[ak]===true||am[ak].nodeType===1&&M(Z,am[ak]))){ag.push(ae[ak])}}}else{for(var ak=0;am[ak]!=null;ak++){if(am[ak]&&am[ak].nodeType===1){ag.push(ae[ak])}}}}}else{G(am,ag)}if(Y){H(Y,W,ag,ab);H.uniqueSort(ag)}return ag};H.uniqueSort=function(X){if(I){S=false;X.sort(I);if(S){for(var W=1;W<X.length;W++){if(X[W]===X[W-1]){X.splice(W--,1)}}}}};H.matches=function(W,X){return H(W,null,null,X)};H.find=function(ad,W,ae){var ac,aa;if(!ad){return[]}for(var Z=0,Y=K.order.length;Z<Y;Z++){var ab=K.order[Z],aa;if((aa=K.match[ab].exec(ad))){var X=RegExp.leftContext;if(X.substr(X.length-1)!=="\\"){aa[1]=(aa[1]||"").replace(/\\/g,"");ac=K.find[ab](aa,W,ae);if(ac!=null){ad=ad.replace(K.match[ab],"");break}}}}if(!ac){ac=W.getElementsByTagName("*")}return{set:ac,expr:ad}};H.filter=function(ag,af,aj,Z){var Y=ag,al=[],ad=af,ab,W,ac=af&&af[0]&&T(af[0]);while(ag&&af.length){for(var ae in K.filter){if((ab=K.match[ae].exec(ag))!=null){var X=K.filter[ae],ak,ai;W=false;if(ad==al){al=[]}if(K.preFilter[ae]){ab=K.preFilter[ae](ab,ad,aj,al,Z,ac);if(!ab){W=ak=true}else{if(ab===true){continue}}}if(ab){for(var aa=0;(ai=ad[aa])!=null;aa++){if(ai){ak=X(ai,ab,aa,ad);var ah=Z^!!ak;if(aj&&ak!=null){if(ah){W=true}else{ad[aa]=false}}else{if(ah){al.push(ai);W=true}}}}}if(ak!==g){if(!aj){ad=al}ag=ag.replace(K.match[ae],"");if(!W){return[]}break}}}if(ag==Y){if(W==null){throw"Syntax error, unrecognized expression: "+ag}else{break}}Y=ag}return ad};var K=H.selectors={order:["ID","NAME","TAG"],match:{ID:/#((?:[\w\u00c0-\uFFFF_-]|\\.)+)/,CLASS:/\.((?:[\w\u00c0-\uFFFF_-]|\\.)+)/,NAME:/\[name=['"]*((?:[\w\u00c0-\uFFFF_-]|\\.)+)['"]*\]/,ATTR:/\[\s*((?:[\w\u00c0-\uFFFF_-]|\\.)+)\s*(?:(\S?=)\s*(['"]*)(.*?)\3|)\s*\]/,TAG:/^((?:[\w\u00c0-\uFFFF\*_-]|\\.)+)/,CHILD:/:(only|nth|last|first)-child(?:\((even|odd|[\dn+-]*)\))?/,POS:/:(nth|eq|gt|lt|first|last|even|odd)(?:\((\d*)\))?(?=[^-]|$)/,PSEUDO:/:((?:[\w\u00c0-\uFFFF_-]|\\.)+)(?:\((['"]*)((?:\([^\)]+\)|[^\2\(\)]*)+)\2\))?/},attrMap:{"class":"className","for":"htmlFor"},attrHandle:{href:function(W){return W.getAttribute("href")}},relative:{"+":function(ad,W,ac){var aa=typeof W==="string",ae=aa&&!/\W/.test(W),ab=aa&&!ae;if(ae&&!ac){W=W.toUpperCase()}for(var Z=0,Y=ad.length,X;Z<Y;Z++){if((X=ad[Z])){while((X=X.previousSibling)&&X.nodeType!==1){}ad[Z]=ab||X&&X.nodeName===W?X||false:X===W}}if(ab){H.filter(W,ad,true)}},">":function(ac,X,ad){var aa=typeof X==="string";if(aa&&!/\W/.test(X)){X=ad?X:X.toUpperCase();for(var Y=0,W=ac.length;Y<W;Y++){var ab=ac[Y];if(ab){var Z=ab.parentNode;ac[Y]=Z.nodeName===X?Z:false}}}else{for(var Y=0,W=ac.length;Y<W;Y++){var ab=ac[Y];if(ab){ac[Y]=aa?ab.parentNode:ab.parentNode===X}}if(aa){H.filter(X,ac,true)}}},"":function(Z,X,ab){var Y=N++,W=V;if(!X.match(/\W/)){var aa=X=ab?X:X.toUpperCase();W=R}W("parentNode",X,Y,Z,aa,ab)},"~":function(Z,X,ab){var Y=N++,W=V;if(typeof X==="string"&&!X.match(/\W/)){var aa=X=ab?X:X.toUpperCase();W=R}W("previousSibling",X,Y,Z,aa,ab)}},find:{ID:function(X,Y,Z){if(typeof Y.getElementById!=="undefined"&&!Z){var W=Y.getElementById(X[1]);return W?[W]:[]}},NAME:function(Y,ab,ac){if(typeof ab.getElementsByName!=="undefined"){var X=[],aa=ab.getElementsByName(Y[1]);for(var Z=0,W=aa.length;Z<W;Z++){if(aa[Z].getAttribute("name")===Y[1]){X.push(aa[Z])}}return X.length===0?null:X}},TAG:function(W,X){return X.getElementsByTagName(W[1])}},preFilter:{CLASS:function(Z,X,Y,W,ac,ad){Z=" "+Z[1].replace(/\\/g,"")+" ";if(ad){return Z}for(var aa=0,ab;(ab=X[aa])!=null;aa++){if(ab){if(ac^(ab.className&&(" "+ab.className+" ").indexOf(Z)>=0)){if(!Y){W.push(ab)}}else{if(Y){X[aa]=false}}}}return false},ID:function(W){return W[1].replace(/\\/g,"")},TAG:function(X,W){for(var Y=0;W[Y]===false;Y++){}return W[Y]&&T(W[Y])?X[1]:X[1].toUpperCase()},CHILD:function(W){if(W[1]=="nth"){var X=/(-?)(\d*)n((?:\+|-)?\d*)/.exec(W[2]=="even"&&"2n"||W[2]=="odd"&&"2n+1"||!/\D/.test(W[2])&&"0n+"+W[2]||W[2]);W[2]=(X[1]+(X[2]||1))-0;W[3]=X[3]-0}W[0]=N++;return W},ATTR:function(aa,X,Y,W,ab,ac){var Z=aa[1].replace(/\\/g,"");if(!ac&&K.attrMap[Z]){aa[1]=K.attrMap[Z]}if(aa[2]==="~="){aa[4]=" "+aa[4]+" "}return aa},PSEUDO:function(aa,X,Y,W,ab){if(aa[1]==="not"){if(aa[3].match(U).length>1||/^\w/.test(aa[3])){aa[3]=H(aa[3],null,null,X)}else{var Z=H.filter(aa[3],X,Y,true^ab);if(!Y){W.push.apply(W,Z)}return false}}else{if(K.match.POS.test(aa[0])||K.match.CHILD.test(aa[0])){return true}}return aa},POS:function(W){W.unshift(true);return W}},filters:{enabled:function(W){return W.disabled===false&&W.type!=="hidden"},disabled:function(W){return W.disabled===true},checked:function(W){return W.checked===true},selected:function(W){W.parentNode.selectedIndex;return W.selected===true},parent:function(W){return !!W.firstChild},empty:function(W){return !W.firstChild},has:function(Y,X,W){return !!H(W[3],Y).length},header:function(W){return/h\d/i.test(W.nodeName)},text:function(W){return"text"===W.type},radio:function(W){return"radio"===W.type},checkbox:function(W){return"checkbox"===W.type},file:function(W){return"file"===W.type},password:function(W){return"password"===W.type},submit:function(W){return"submit"===W.type},image:function(W){return"image"===W.type},reset:function(W){return"reset"===W.type},button:function(W){return"button"===W.type||W.nodeName.toUpperCase()==="BUTTON"},input:function(W){return/input|select|textarea|button/i.test(W.nodeName)}},setFilters:{first:function(X,W){return W===0},last:function(Y,X,W,Z){return X===Z.length-1},even:function(X,W){return W%2===0},odd:function(X,W){return W%2===1},lt:function(Y,X,W){return X<W[3]-0},gt:function(Y,X,W){return X>W[3]-0},nth:function(Y,X,W){return W[3]-0==X},eq:function(Y,X,W){return W[3]-0==X}},filter:{PSEUDO:function(ab,X,Y,ac){var W=X[1],Z=K.filters[W];if(Z){return Z(ab,Y,X,ac)}else{if(W==="contains"){return(ab.textContent||ab.innerText||"").indexOf(X[3])>=0}else{if(W==="not"){var aa=X[3];for(Y=0,l=aa.length;Y<l;Y++){if(aa[Y]===ab){return false}}return true}}}},CHILD:function(W,Z){var ac=Z[1],X=W;switch(ac){case"only":case"first":while((X=X.previousSibling)){if(X.nodeType===1){return false}}if(ac=="first"){return true}X=W;case"last":while((X=X.nextSibling)){if(X.nodeType===1){return false}}return true;case"nth":var Y=Z[2],af=Z[3];if(Y==1&&af==0){return true}var ab=Z[0],ae=W.parentNode;if(ae&&(ae.sizcache!==ab||!W.nodeIndex)){var aa=0;for(X=ae.firstChild;X;X=X.nextSibling){if(X.nodeType===1){X.nodeIndex=++aa}}ae.sizcache=ab}var ad=W.nodeIndex-af;if(Y==0){return ad==0}else{return(ad%Y==0&&ad/Y>=0)}}},ID:function(X,W){return X.nodeType===1&&X.getAttribute("id")===W},TAG:function(X,W){return(W==="*"&&X.nodeType===1)||X.nodeName===W},CLASS:function(X,W){return(" "+(X.className||X.getAttribute("class"))+" ").indexOf(W)>-1},ATTR:function(ab,Z){var Y=Z[1],W=K.attrHandle[Y]?K.attrHandle[Y](ab):ab[Y]!=null?ab[Y]:ab.getAttribute(Y),ac=W+"",aa=Z[2],X=Z[4];return W==null?aa==="!=":aa==="="?ac===X:aa==="*="?ac.indexOf(X)>=0:aa==="~="?(" "+ac+" ").indexOf(X)>=0:!X?ac&&W!==false:aa==="!="?ac!=X:aa==="^="?ac.indexOf(X)===0:aa==="$="?ac.substr(ac.length-X.length)===X:aa==="|="?ac===X||ac.substr(0,X.length+1)===X+"-":false},POS:function(aa,X,Y,ab){var W=X[2],Z=K.setFilters[W];if(Z){return Z(aa,Y,X,ab)}}}};var O=K.match.POS;for(var Q in K.match){K.match[Q]=new RegExp(K.match[Q].source+/(?![^\[]*\])(?![^\(]*\))/.source)}var G=function(X,W){X=Array.prototype.slice.call(X);if(W){W.push.apply(W,X);return W}return X};try{Array.prototype.slice.call(document.documentElement.childNodes)}catch(P){G=function(aa,Z){var X=Z||[];if(J.call(aa)==="[object Array]"){Array.prototype.push.apply(X,aa)}else{if(typeof aa.length==="number"){for(var Y=0,W=aa.length;Y<W;Y++){X.push(aa[Y])}}else{for(var Y=0;aa[Y];Y++){X.push(aa[Y])}}}return X}}var I;if(document.documentElement.compareDocumentPosition){I=function(X,W){var Y=X.compareDocumentPosition(W)&4?-1:X===W?0:1;if(Y===0){S=true}return Y}}else{if("sourceIndex" in document.documentElement){I=function(X,W){var Y=X.sourceIndex-W.sourceIndex;if(Y===0){S=true}return Y}}else{if(document.createRange){I=function(Z,X){var Y=Z.ownerDocument.createRange(),W=X.ownerDocument.createRange();Y.selectNode(Z);Y.collapse(true);W.selectNode(X);W.collapse(true);var aa=Y.compareBoundaryPoints(Range.START_TO_END,W);if(aa===0){S=true}return aa}}}}(function(){var X=document.createElement("div"),Y="script"+(new Date).getTime();X.innerHTML="<a name='"+Y+"'/>";var W=document.documentElement;W.insertBefore(X,W.firstChild);if(!!document.getElementById(Y)){K.find.ID=function(aa,ab,ac){if(typeof ab.getElementById!=="undefined"&&!ac){var Z=ab.getElementById(aa[1]);return Z?Z.id===aa[1]||typeof Z.getAttributeNode!=="undefined"&&Z.getAttributeNode("id").nodeValue===aa[1]?[Z]:g:[]}};K.filter.ID=function(ab,Z){var aa=typeof ab.getAttributeNode!=="undefined"&&ab.getAttributeNode("id");return ab.nodeType===1&&aa&&aa.nodeValue===Z}}W.removeChild(X);W=X=null})();(function(){var W=document.createElement("div");W.appendChild(document.createComment(""));if(W.getElementsByTagName("*").length>0){K.find.TAG=function(X,ab){var aa=ab.getElementsByTagName(X[1]);if(X[1]==="*"){var Z=[];for(var Y=0;aa[Y];Y++){if(aa[Y].nodeType===1){Z.push(aa[Y])}}aa=Z}return aa}}W.innerHTML="<a href='#'></a>";if(W.firstChild&&typeof W.firstChild.getAttribute!=="undefined"&&W.firstChild.getAttribute("href")!=="#"){K.attrHandle.href=function(X){return X.getAttribute("href",2)}}W=null})();if(document.querySelectorAll){(function(){var W=H,Y=document.createElement("div");Y.innerHTML="<p class='TEST'></p>";if(Y.querySelectorAll&&Y.querySelectorAll(".TEST").length===0){return}H=function(ac,ab,Z,aa){ab=ab||document;if(!aa&&ab.nodeType===9&&!T(ab)){try{return G(ab.querySelectorAll(ac),Z)}catch(ad){}}return W(ac,ab,Z,aa)};for(var X in W){H[X]=W[X]}Y=null})()}if(document.getElementsByClassName&&document.documentElement.getElementsByClassName){(function(){var W=document.createElement("div");W.innerHTML="<div class='test e'></div><div class='test'></div>";if(W.getElementsByClassName("e").length===0){return}W.lastChild.className="e";if(W.getElementsByClassName("e").length===1){return}K.order.splice(1,0,"CLASS");K.find.CLASS=function(X,Y,Z){if(typeof Y.getElementsByClassName!=="undefined"&&!Z){return Y.getElementsByClassName(X[1])}};W=null})()}function R(X,ac,ab,ag,ad,af){var ae=X=="previousSibling"&&!af;for(var Z=0,Y=ag.length;Z<Y;Z++){var W=ag[Z];if(W){if(ae&&W.nodeType===1){W.sizcache=ab;W.sizset=Z}W=W[X];var aa=false;while(W){if(W.sizcache===ab){aa=ag[W.sizset];break}if(W.nodeType===1&&!af){W.sizcache=ab;W.sizset=Z}if(W.nodeName===ac){aa=W;break}W=W[X]}ag[Z]=aa}}}function V(X,ac,ab,ag,ad,af){var ae=X=="previousSibling"&&!af;for(var Z=0,Y=ag.length;Z<Y;Z++){var W=ag[Z];if(W){if(ae&&W.nodeType===1){W.sizcache=ab;W.sizset=Z}W=W[X];var aa=false;while(W){if(W.sizcache===ab){aa=ag[W.sizset];break}if(W.nodeType===1){if(!af){W.sizcache=ab;W.sizset=Z}if(typeof ac!=="string"){if(W===ac){aa=true;break}}else{if(H.filter(ac,[W]).length>0){aa=W;break}}}W=W[X]}ag[Z]=aa}}}var M=document.compareDocumentPosition?function(X,W){return X.compareDocumentPosition(W)&16}:function(X,W){return X!==W&&(X.contains?X.contains(W):true)};var T=function(W){return W.nodeType===9&&W.documentElement.nodeName!=="HTML"||!!W.ownerDocument&&W.ownerDocument.documentElement.nodeName!=="HTML"};var L=function(W,ad){var Z=[],aa="",ab,Y=ad.nodeType?[ad]:ad;while((ab=K.match.PSEUDO.exec(W))){aa+=ab[0];W=W.replace(K.match.PSEUDO,"")}W=K.relative[W]?W+"*":W;for(var ac=0,X=Y.length;ac<X;ac++){H(W,Y[ac],Z)}return H.filter(aa,Z)};q.find=H;q.expr=H.selectors;q.expr[":"]=q.expr.filters;H.selectors.filters.hidden=function(Y){var X=Y.offsetWidth,W=Y.offsetHeight,Z=/^tr$/i.test(Y.tagName);return(X===0&&W===0&&!Z)?true:(X!==0&&W!==0&&!Z)?false:!!(q.curCSS(Y,"display")==="none")};H.selectors.filters.visible=function(W){return !H.selectors.filters.hidden(W)};H.selectors.filters.animated=function(W){return q.grep(q.timers,function(X){return W===X.elem}).length};q.filter=q.multiFilter=function(Y,W,X){if(X){Y=":not("+Y+")"}return H.matches(Y,W)};q.dir=function(Y,X){var W=[],Z=Y[X];while(Z&&Z!=document){if(Z.nodeType==1){W.push(Z)}Z=Z[X]}return W};q.nth=function(aa,W,Y,Z){W=W||1;var X=0;for(;aa;aa=aa[Y]){if(aa.nodeType==1&&++X==W){break}}return aa};q.sibling=function(Y,X){var W=[];for(;Y;Y=Y.nextSibling){if(Y.nodeType==1&&Y!=X){W.push(Y)}}return W};return;j.Sizzle=H})();q.fn.extend({find:function(G){var I=this.pushStack("","find",G),L=0;for(var J=0,H=this.length;J<H;J++){L=I.length;q.find(G,this[J],I);if(J>0){for(var M=L;M<I.length;M++){for(var K=0;K<L;K++){if(I[K]===I[M]){I.splice(M--,1);break}}}}}return I},filter:function(G){return this.pushStack(q.isFunction(G)&&q.grep(this,function(I,H){return G.call(I,H)})||q.multiFilter(G,q.grep(this,function(H){return H.nodeType===1})),"filter",G)},closest:function(G){var I=q.expr.match.POS.test(G)?q(G):null,H=0;return this.map(function(){var J=this;while(J&&J.ownerDocument){if(I?I.index(J)>-1:q(J).is(G)){q.data(J,"closest",H);return J}J=J.parentNode;H++}})},not:function(G){if(typeof G==="string"){if(f.test(G)){return this.pushStack(q.multiFilter(G,this,true),"not",G)}else{G=q.multiFilter(G,this)}}var H=G.length&&G[G.length-1]!==g&&!G.nodeType;return this.filter(function(){return H?q.inArray(this,G)<0:this!=G})},add:function(G){return this.pushStack(q.unique(q.merge(this.get(),typeof G==="string"?q(G):q.makeArray(G))))},eq:function(G){return this.slice(G,+G+1)},slice:function(){return this.pushStack(Array.prototype.slice.apply(this,arguments),"slice",Array.prototype.slice.call(arguments).join(","))},map:function(G){return this.pushStack(q.map(this,function(I,H){return G.call(I,H,I)}))},andSelf:function(){return this.add(this.prevObject)},end:function(){return this.prevObject||q(null)}});q.each({parent:function(G){return G.parentNode},parents:function(G){return q.dir(G,"parentNode")},next:function(G){return q.nth(G,2,"nextSibling")},prev:function(G){return q.nth(G,2,"previousSibling")},nextAll:function(G){return q.dir(G,"nextSibling")},prevAll:function(G){return q.dir(G,"previousSibling")},siblings:function(G){return q.sibling(G.parentNode.firstChild,G)},children:function(G){return q.sibling(G.firstChild)},contents:function(G){return q.nodeName(G,"iframe")?G.contentDocument||G.contentWindow.document:q.makeArray(G.childNodes)}},function(G,H){q.fn[G]=function(I){var J=q.map(this,H);if(I&&typeof I=="string"){J=q.multiFilter(I,J)}return this.pushStack(q.unique(J),G,I)}});q.fn.extend({attr:function(I,L){var H=I,M=q.isFunction(L);if(typeof I==="string"){if(L===g){return this.length?q.attr(this[0],I):null}else{H={};H[I]=L}}for(var J=0,G=this.length;J<G;J++){var K=this[J];for(var N in H){L=H[N];if(M){L=L.call(K,J)}q.attr(K,N,L)}}return this},hasClass:function(G){return !!G&&this.is("."+G)},val:function(M){if(M===g){var G=this[0];if(G){if(q.nodeName(G,"option")){return(G.attributes.value||{}).specified?G.value:G.text}if(q.nodeName(G,"select")){var K=G.selectedIndex,N=[],O=G.options,J=G.type=="select-one";if(K<0){return null}for(var H=J?K:0,L=J?K+1:O.length;H<L;H++){var I=O[H];if(I.selected){M=q(I).val();if(J){return M}N.push(M)}}return N}return(G.value||"").replace(/\r/g,"")}return g}if(typeof M==="number"){M+=""}return this.each(function(){if(this.nodeType!=1){return}if(q.isArray(M)&&/radio|checkbox/.test(this.type)){this.checked=(q.inArray(this.value,M)>=0||q.inArray(this.name,M)>=0)}else{if(q.nodeName(this,"select")){var P=q.makeArray(M);q("option",this).each(function(){this.selected=(q.inArray(this.value,P)>=0||q.inArray(this.text,P)>=0)});if(!P.length){this.selectedIndex=-1}}else{this.value=M}}})}});q.each({removeAttr:function(G){q.attr(this,G,"");if(this.nodeType==1){this.removeAttribute(G)}},addClass:function(G){q.className.add(this,G)},removeClass:function(G){q.className.remove(this,G)},toggleClass:function(L,K){var J=typeof L;if(J==="string"){var G=typeof K==="boolean",I,H=0,L=L.split(/\s+/);while((I=L[H++])){K=G?K:!q.className.has(this,I);q.className[K?"add":"remove"](this,I)}}else{if(J==="undefined"||J==="boolean"){if(this.className){q.data(this,"__className__",this.className)}this.className=this.className||L===false?"":q.data(this,"__className__")||""}}}},function(G,H){q.fn[G]=function(){return this.each(H,arguments)}});q.extend({className:{add:function(G,H){q.each((H||"").split(/\s+/),function(I,J){if(G.nodeType==1&&!q.className.has(G.className,J)){G.className+=(G.className?" ":"")+J}})},remove:function(G,H){if(G.nodeType==1){G.className=H!==g?q.grep(G.className.split(/\s+/),function(I){return !q.className.has(H,I)}).join(" "):""}},has:function(H,G){return H&&q.inArray(G,(H.className||H).toString().split(/\s+/))>-1}},attr:function(L,I,M){if(!L||L.nodeType==3||L.nodeType==8){return g}var J=!L.tagName||!q.isXMLDoc(L),N=M!==g;I=J&&q.props[I]||I;if(L.tagName){var H=/href|src|style/.test(I);if(I=="selected"&&L.parentNode){L.parentNode.selectedIndex}if(I in L&&J&&!H){if(N){if(I=="type"&&L.nodeName.match(/(button|input)/i)&&L.parentNode){throw"type property can't be changed"}L[I]=M}if(q.nodeName(L,"form")&&L.getAttributeNode(I)){return L.getAttributeNode(I).nodeValue}if(I=="tabIndex"){var K=L.getAttributeNode("tabIndex");return K&&K.specified?K.value:L.nodeName.match(/(button|input|object|select|textarea)/i)?0:L.nodeName.match(/^(a|area)$/i)&&L.href?0:g}return L[I]}if(!q.support.style&&J&&I=="style"){if(N){L.style.cssText=""+M}return L.style.cssText}if(N){L.setAttribute(I,""+M)}var G=!q.support.hrefNormalized&&J&&H?L.getAttribute(I,2):L.getAttribute(I);return G===null?g:G}return q.style(L,I,M)}});q.fn.extend({text:function(H){if(typeof H!=="object"&&H!=null){return this.empty().append((this[0]&&this[0].ownerDocument||document).createTextNode(H))}var G="";q.each(H||this,function(){q.each(this.childNodes,function(){if(this.nodeType!=8){G+=this.nodeType!=1?this.nodeValue:q.fn.text([this])}})});return G},wrapAll:function(G){if(this[0]){var H=q(G,this[0].ownerDocument).clone();if(this[0].parentNode){H.insertBefore(this[0])}H.map(function(){var I=this;while(I.firstChild){I=I.firstChild}return I}).append(this)}return this},wrapInner:function(G){return this.each(function(){q(this).contents().wrapAll(G)})},wrap:function(G){return this.each(function(){q(this).wrapAll(G)})},append:function(){return this.domManip(arguments,true,function(G){if(this.nodeType==1){this.appendChild(G)}})},prepend:function(){return this.domManip(arguments,true,function(G){if(this.nodeType==1){this.insertBefore(G,this.firstChild)}})},before:function(){return this.domManip(arguments,false,function(G){this.parentNode.insertBefore(G,this)})},after:function(){return this.domManip(arguments,false,function(G){this.parentNode.insertBefore(G,this.nextSibling)})},clone:function(I){var G=this.map(function(){if(!q.support.noCloneEvent&&!q.isXMLDoc(this)){var L=this.outerHTML,K=this.ownerDocument;if(!L){var M=K.createElement("div");M.appendChild(this.cloneNode(true));L=M.innerHTML}return q.clean([L.replace(/ jQuery\d+="(?:\d+|null)"/g,"").replace(/^\s*/,"")],K)[0]}else{return this.cloneNode(true)}});if(I===true){var J=this.find("*").andSelf(),H=0;G.find("*").andSelf().each(function(){if(this.nodeName!==J[H].nodeName){return}var K=q.data(J[H],"events");for(var M in K){for(var L in K[M]){q.event.add(this,M,K[M][L],K[M][L].data)}}H++})}return G},html:function(G){return G===g?(this[0]?this[0].innerHTML.replace(/ jQuery\d+="(?:\d+|null)"/g,""):null):this.empty().append(G)},replaceWith:function(G){return this.after(G).remove()},domManip:function(L,O,N){if(this[0]){var K=(this[0].ownerDocument||this[0]).createDocumentFragment(),H=q.clean(L,(this[0].ownerDocument||this[0]),K),J=K.firstChild;if(J){for(var I=0,G=this.length;I<G;I++){N.call(M(this[I],J),this.length>1||I>0?K.cloneNode(true):K)}}if(H){q.each(H,B)}}return this;function M(P,Q){return O&&q.nodeName(P,"table")&&q.nodeName(Q,"tr")?(P.getElementsByTagName("tbody")[0]||P.appendChild(P.ownerDocument.createElement("tbody"))):P}}});q.each({appendTo:"append",prependTo:"prepend",insertBefore:"before",insertAfter:"after",replaceAll:"replaceWith"},function(G,H){q.fn[G]=function(I){var L=[],N=q(I);for(var M=0,J=N.length;M<J;M++){var K=(M>0?this.clone(true):this).get();q.fn[H].apply(q(N[M]),K);L=L.concat(K)}return this.pushStack(L,G,I)}});q.each({remove:function(G){if(!G||q.multiFilter(G,[this]).length){if(this.nodeType===1){o(q("*",this).add(this))}if(this.parentNode){this.parentNode.removeChild(this)}}},empty:function(){if(this.nodeType===1){o(q("*",this))}while(this.firstChild){this.removeChild(this.firstChild)}}},function(G,H){q.fn[G]=function(){return this.each(H,arguments)}});q.extend({clean:function(H,M,K){M=M||document;if(typeof M.createElement==="undefined"){M=M.ownerDocument||M[0]&&M[0].ownerDocument||document}if(!K&&H.length===1&&typeof H[0]==="string"){var J=/^<(\w+)\s*\/?>$/.exec(H[0]);if(J){return[M.createElement(J[1])]}}var I=[],G=[],N=M.createElement("div");q.each(H,function(R,U){if(typeof U==="number"){U+=""}if(!U){return}if(typeof U==="string"){U=U.replace(/(<(\w+)[^>]*?)\/>/g,function(W,X,V){return V.match(/^(abbr|br|col|img|input|link|meta|param|hr|area|embed)$/i)?W:X+"></"+V+">"});var Q=U.replace(/^\s+/,"").substring(0,10).toLowerCase();var S=!Q.indexOf("<opt")&&[1,"<select multiple='multiple'>","</select>"]||!Q.indexOf("<leg")&&[1,"<fieldset>","</fieldset>"]||Q.match(/^<(thead|tbody|tfoot|colg|cap)/)&&[1,"<table>","</table>"]||!Q.indexOf("<tr")&&[2,"<table><tbody>","</tbody></table>"]||(!Q.indexOf("<td")||!Q.indexOf("<th"))&&[3,"<table><tbody><tr>","</tr></tbody></table>"]||!Q.indexOf("<col")&&[2,"<table><tbody></tbody><colgroup>","</colgroup></table>"]||!q.support.htmlSerialize&&[1,"div<div>","</div>"]||[0,"",""];N.innerHTML=S[1]+U+S[2];while(S[0]--){N=N.lastChild}if(!q.support.tbody){var T=/<tbody/i.test(U),P=!Q.indexOf("<table")&&!T?N.firstChild&&N.firstChild.childNodes:S[1]=="<table>"&&!T?N.childNodes:[];for(var O=P.length-1;O>=0;--O){if(q.nodeName(P[O],"tbody")&&!P[O].childNodes.length){P[O].parentNode.removeChild(P[O])}}}if(!q.support.leadingWhitespace&&/^\s/.test(U)){N.insertBefore(M.createTextNode(U.match(/^\s*/)[0]),N.firstChild)}U=q.makeArray(N.childNodes)}if(U.nodeType){I.push(U)}else{I=q.merge(I,U)}});if(K){for(var L=0;I[L];L++){if(q.nodeName(I[L],"script")&&(!I[L].type||I[L].type.toLowerCase()==="text/javascript")){G.push(I[L].parentNode?I[L].parentNode.removeChild(I[L]):I[L])}else{if(I[L].nodeType===1){I.splice.apply(I,[L+1,0].concat(q.makeArray(I[L].getElementsByTagName("script"))))}K.appendChild(I[L])}}return G}return I}});function o(H){for(var I=0,G=H.length;I<G;I++){var J=H[I][h];if(J){delete q.cache[J]}}}q.event={add:function(I,M,R,K){if(I.nodeType===3||I.nodeType===8){return}if(I.setInterval&&(I!==j&&!I.frameElement)){I=j}if(!R.guid){R.guid=this.guid++}if(K!==g){var P=R;R=this.proxy(P);R.data=K}var S=q.data(I,"events")||q.data(I,"events",{}),L=q.data(I,"handle")||q.data(I,"handle",function(){return typeof q!=="undefined"&&!q.event.triggered?q.event.handle.apply(arguments.callee.elem,arguments):g});L.elem=I;M=M.split(/\s+/);var O,J=0;while((O=M[J++])){var G=O.split(".");O=G.shift();R.type=G.slice().sort().join(".");var H=S[O],N=this.special[O]||{};if(N.add){var Q=N.add.call(I,R,K,G);if(Q&&q.isFunction(Q)){Q.guid=Q.guid||R.guid;R=Q}}if(!H){H=S[O]={};if(!N.setup||N.setup.call(I,K,G)===false){if(I.addEventListener){I.addEventListener(O,L,false)}else{if(I.attachEvent){I.attachEvent("on"+O,L)}}}}H[R.guid]=R;this.global[O]=true}I=null},guid:1,global:{},remove:function(H,L,Q){if(H.nodeType===3||H.nodeType===8){return}var R=q.data(H,"events"),M,O;if(R){if(L===g||(typeof L==="string"&&L.charAt(0)===".")){for(O in R){this.remove(H,O+(L||""))}}else{if(L.type){Q=L.handler;L=L.type}L=L.split(/\s+/);var J=0;while((O=L[J++])){var G=O.split(".");O=G.shift();var P=!G.length,I=new RegExp("(^|\\.)"+G.slice().sort().join(".*\\.")+"(\\.|$)"),N=this.special[O]||{};if(R[O]){if(Q){delete R[O][Q.guid]}else{for(var K in R[O]){if(P||I.test(R[O][K].type)){delete R[O][K]}}}if(N.remove){N.remove.call(H,G)}for(M in R[O]){break}if(!M){if(!N.teardown||N.teardown.call(H,G)===false){if(H.removeEventListener){H.removeEventListener(O,q.data(H,"handle"),false)}else{if(H.detachEvent){H.detachEvent("on"+O,q.data(H,"handle"))}}}M=null;delete R[O]}}}}for(M in R){break}if(!M){var K=q.data(H,"handle");if(K){K.elem=null}q.removeData(H,"events");q.removeData(H,"handle")}}},trigger:function(G,K,I){var O=G.type||G,J=arguments[3];if(!J){G=typeof G==="object"?G[h]?G:q.extend(q.Event(O),G):q.Event(O);if(O.indexOf("!")>=0){G.type=O=O.slice(0,-1);G.exclusive=true}if(!I){G.stopPropagation();if(this.global[O]){q.each(q.cache,function(){if(this.events&&this.events[O]){q.event.trigger(G,K,this.handle.elem)}})}}if(!I||I.nodeType===3||I.nodeType===8){return g}G.result=g;G.target=I;K=q.makeArray(K);K.unshift(G)}G.currentTarget=I;var L=q.data(I,"handle");if(L){L.apply(I,K)}var H,N;try{H=I[O];N=I["on"+O]}catch(M){}if((!H||(q.nodeName(I,"a")&&O==="click"))&&N&&N.apply(I,K)===false){G.result=false}if(!J&&H&&!G.isDefaultPrevented()&&!(q.nodeName(I,"a")&&O==="click")){this.triggered=true;try{H()}catch(M){}}this.triggered=false;if(!G.isPropagationStopped()){var P=I.parentNode||I.ownerDocument;if(P){q.event.trigger(G,K,P,true)}}},handle:function(M){var L,G;M=arguments[0]=q.event.fix(M||j.event);M.currentTarget=this;var N=M.type.split(".");M.type=N.shift();L=!N.length&&!M.exclusive;var K=new RegExp("(^|\\.)"+N.slice().sort().join(".*\\.")+"(\\.|$)");G=(q.data(this,"events")||{})[M.type];for(var I in G){var J=G[I];if(L||K.test(J.type)){M.handler=J;M.data=J.data;var H=J.apply(this,arguments);if(H!==g){M.result=H;if(H===false){M.preventDefault();M.stopPropagation()}}if(M.isImmediatePropagationStopped()){break}}}},props:"altKey attrChange attrName bubbles button cancelable charCode clientX clientY ctrlKey currentTarget data detail eventPhase fromElement handler keyCode layerX layerY metaKey newValue offsetX offsetY originalTarget pageX pageY prevValue relatedNode relatedTarget screenX screenY shiftKey srcElement target toElement view wheelDelta which".split(" "),fix:function(J){if(J[h]){return J}var H=J;J=q.Event(H);for(var I=this.props.length,L;I;){L=this.props[--I];J[L]=H[L]}if(!J.target){J.target=J.srcElement||document}if(J.target.nodeType===3){J.target=J.target.parentNode}if(!J.relatedTarget&&J.fromElement){J.relatedTarget=J.fromElement===J.target?J.toElement:J.fromElement}if(J.pageX==null&&J.clientX!=null){var K=document.documentElement,G=document.body;J.pageX=J.clientX+(K&&K.scrollLeft||G&&G.scrollLeft||0)-(K&&K.clientLeft||G&&G.clientLeft||0);J.pageY=J.clientY+(K&&K.scrollTop||G&&G.scrollTop||0)-(K&&K.clientTop||G&&G.clientTop||0)}if(!J.which&&((J.charCode||J.charCode===0)?J.charCode:J.keyCode)){J.which=J.charCode||J.keyCode}if(!J.metaKey&&J.ctrlKey){J.metaKey=J.ctrlKey}if(!J.which&&J.button!==g){J.which=(J.button&1?1:(J.button&2?3:(J.button&4?2:0)))}return J},proxy:function(I,H,G){if(H!==g&&!q.isFunction(H)){G=H;H=g}H=H||function(){return I.apply(G!==g?G:this,arguments)};H.guid=I.guid=I.guid||H.guid||this.guid++;return H},special:{ready:{setup:D,teardown:function(){}},live:{add:function(G,I,H){q.extend(G,I||{});G.guid+=I.selector+I.live;q.event.add(this,I.live,c)},remove:function(I){if(I.length){var G=0,H=new RegExp("(^|\\.)"+I[0]+"(\\.|$)");q.each((q.data(this,"events").live||{}),function(){if(H.test(this.type)){G++}});if(G<1){q.event.remove(this,I[0],c)}}}}}};q.Event=function(G){if(!this.preventDefault){return new q.Event(G)}if(G&&G.type){this.originalEvent=G;this.type=G.type}else{this.type=G}this.timeStamp=e();this[h]=true};function k(){return false}function v(){return true}q.Event.prototype={preventDefault:function(){this.isDefaultPrevented=v;var G=this.originalEvent;if(!G){return}if(G.preventDefault){G.preventDefault()}G.returnValue=false},stopPropagation:function(){this.isPropagationStopped=v;var G=this.originalEvent;if(!G){return}if(G.stopPropagation){G.stopPropagation()}G.cancelBubble=true},stopImmediatePropagation:function(){this.isImmediatePropagationStopped=v;this.stopPropagation()},isDefaultPrevented:k,isPropagationStopped:k,isImmediatePropagationStopped:k};var b=function(H){var G=H.relatedTarget;while(G&&G!=this){try{G=G.parentNode}catch(I){break}}if(G!=this){H.type=H.data;q.event.handle.apply(this,arguments)}};q.each({mouseover:"mouseenter",mouseout:"mouseleave"},function(H,G){q.event.special[G]={setup:function(){q.event.add(this,H,b,G)},teardown:function(){q.event.remove(this,H,b)}}});q.fn.extend({bind:function(I,J,H,G){if(q.isFunction(J)){if(H!==g){G=H}H=J;J=g}H=G===g?H:q.event.proxy(H,G);return I==="unload"?this.one(I,J,H,G):this.each(function(){q.event.add(this,I,H,J)})},one:function(J,K,I,G){if(q.isFunction(K)){if(I!==g){G=I}I=K;K=g}I=G===g?I:q.event.proxy(I,G);var H=q.event.proxy(I,function(L){q(this).unbind(L,H);return I.apply(this,arguments)});return this.each(function(){q.event.add(this,J,H,K)})},unbind:function(H,G){return this.each(function(){q.event.remove(this,H,G)})},trigger:function(G,H){return this.each(function(){q.event.trigger(G,H,this)})},triggerHandler:function(G,I){if(this[0]){var H=q.Event(G);H.preventDefault();H.stopPropagation();q.event.trigger(H,I,this[0]);return H.result}},toggle:function(I){var G=arguments,H=1;while(H<G.length){q.event.proxy(I,G[H++])}return this.click(q.event.proxy(I,function(J){this.lastToggle=(this.lastToggle||0)%H;J.preventDefault();return G[this.lastToggle++].apply(this,arguments)||false}))},hover:function(G,H){return this.mouseenter(G).mouseleave(H||G)},ready:function(G){D();if(q.isReady){G.call(document,q)}else{q.readyList.push(G)}return this},live:function(I,J,H,G){if(q.isFunction(J)){if(H!==g){G=H}H=J;J=g}q(this.context).bind(i(I,this.selector),{data:J,selector:this.selector,live:I},H,G);return this},die:function(H,G){q(this.context).unbind(i(H,this.selector),G?{guid:G.guid+this.selector+H}:null);return this}});function c(J){var I=true,G=[],H=arguments;q.each(q.data(this,"events").live||[],function(K,L){if(L.live===J.type){var M=q(J.target).closest(L.selector)[0];if(M){G.push({elem:M,fn:L})}}});G.sort(function(L,K){return q.data(L.elem,"closest")-q.data(K.elem,"closest")});q.each(G,function(){J.currentTarget=this.elem;J.data=this.fn.data;if(this.fn.apply(this.elem,H)===false){return(I=false)}});return I}function i(H,G){return["live",H,G.replace(/\./g,"`").replace(/ /g,"|")].join(".")}q.extend({isReady:false,readyList:[],ready:function(){if(!q.isReady){q.isReady=true;if(q.readyList){var H,G=0;while((H=q.readyList[G++])){H.call(document,q)}q.readyList=null}q(document).triggerHandler("ready")}}});var z=false;function D(){if(z){return}z=true;if(document.addEventListener){document.addEventListener("DOMContentLoaded",function(){document.removeEventListener("DOMContentLoaded",arguments.callee,false);q.ready()},false)}else{if(document.attachEvent){document.attachEvent("onreadystatechange",function(){if(document.readyState==="complete"){document.detachEvent("onreadystatechange",arguments.callee);q.ready()}});if(document.documentElement.doScroll&&j===j.top){(function(){if(q.isReady){return}try{document.documentElement.doScroll("left")}catch(G){setTimeout(arguments.callee,0);return}q.ready()})()}}}q.event.add(j,"load",q.ready)}q.each(("blur,focus,load,resize,scroll,unload,click,dblclick,mousedown,mouseup,mousemove,mouseover,mouseout,mouseenter,mouseleave,change,select,submit,keydown,keypress,keyup,error").split(","),function(H,G){q.fn[G]=function(I){return I?this.bind(G,I):this.trigger(G)}});q(j).bind("unload",function(){for(var G in q.cache){if(G!=1&&q.cache[G].handle){q.event.remove(q.cache[G].handle.elem)}}});(function(){q.support={};var H=document.documentElement,I=document.createElement("script"),N=document.createElement("div"),M="script"+(new Date).getTime();N.style.display="none";N.innerHTML='   <link/><table></table><a href="/a" style="color:red;float:left;opacity:.5;">a</a><select><option>text</option></select>';var J=N.getElementsByTagName("*"),G=N.getElementsByTagName("a")[0];if(!J||!J.length||!G){return}q.support={leadingWhitespace:N.firstChild.nodeType==3,tbody:!N.getElementsByTagName("tbody").length,htmlSerialize:!!N.getElementsByTagName("link").length,style:/red/.test(G.getAttribute("style")),hrefNormalized:G.getAttribute("href")==="/a",opacity:G.style.opacity==="0.5",cssFloat:!!G.style.cssFloat,scriptEval:false,noCloneEvent:true,boxModel:null};I.type="text/javascript";try{I.appendChild(document.createTextNode("window."+M+"=1;"))}catch(L){}H.insertBefore(I,H.firstChild);if(j[M]){q.support.scriptEval=true;delete j[M]}H.removeChild(I);if(N.attachEvent&&N.fireEvent){N.attachEvent("onclick",function K(){q.support.noCloneEvent=false;N.detachEvent("onclick",K)});N.cloneNode(true).fireEvent("onclick")}q(function(){var O=document.createElement("div");O.style.width=O.style.paddingLeft="1px";document.body.appendChild(O);q.boxModel=q.support.boxModel=O.offsetWidth===2;document.body.removeChild(O).style.display="none";O=null});H=I=N=J=G=null})();q.props={"for":"htmlFor","class":"className",readonly:"readOnly",maxlength:"maxLength",cellspacing:"cellSpacing",rowspan:"rowSpan",colspan:"colSpan",tabindex:"tabIndex"};var a=/z-?index|font-?weight|opacity|zoom|line-?height/i,w=document.defaultView&&document.defaultView.getComputedStyle,y=q.support.cssFloat?"cssFloat":"styleFloat";q.fn.css=function(I,L){var H=I,M=q.isFunction(L);if(typeof I==="string"){if(L===g){return this.length?q.css(this[0],I):null}else{H={};H[I]=L}}for(var J=0,G=this.length;J<G;J++){var K=this[J];for(var N in H){L=H[N];if(M){L=L.call(K,J)}if(typeof L==="number"&&!a.test(N)){L=L+"px"}q.style(K,N,L)}}return this};q.extend({style:function(I,G,J){if(!I||I.nodeType==3||I.nodeType==8){return g}if((G=="width"||G=="height")&&parseFloat(J)<0){J=g}var H=I.style||I,K=J!==g;if(!q.support.opacity&&G=="opacity"){if(K){H.zoom=1;H.filter=(H.filter||"").replace(/alpha\([^)]*\)/,"")+(parseInt(J)+""=="NaN"?"":"alpha(opacity="+J*100+")")}return H.filter&&H.filter.indexOf("opacity=")>=0?(parseFloat(H.filter.match(/opacity=([^)]*)/)[1])/100)+"":""}if(/float/i.test(G)){G=y}G=G.replace(/-([a-z])/ig,function(L,M){return M.toUpperCase()});if(K){H[G]=J}return H[G]},css:function(J,H,L,G){if(H=="width"||H=="height"){var N,I={position:"absolute",visibility:"hidden",display:"block"},M=H=="width"?["Left","Right"]:["Top","Bottom"];function K(){N=H=="width"?J.offsetWidth:J.offsetHeight;if(G==="border"){return}q.each(M,function(){if(!G){N-=parseFloat(q.curCSS(J,"padding"+this,true))||0}if(G==="margin"){N+=parseFloat(q.curCSS(J,"margin"+this,true))||0}else{N-=parseFloat(q.curCSS(J,"border"+this+"Width",true))||0}})}if(J.offsetWidth!==0){K()}else{q.swap(J,I,K)}return Math.max(0,Math.round(N))}return q.curCSS(J,H,L)},curCSS:function(L,H,I){var O,G=L.style,J;if(!q.support.opacity&&H==="opacity"&&L.currentStyle){O=(L.currentStyle.filter||"").match(/opacity=([^)]*)/)?(parseFloat(RegExp.$1)/100)+"":"";return O===""?"1":O}if(/float/i.test(H)){H=y}if(!I&&G&&G[H]){O=G[H]}else{if(w){if(/float/i.test(H)){H="float"}H=H.replace(/([A-Z])/g,"-$1").toLowerCase();var P=L.ownerDocument.defaultView.getComputedStyle(L,null);if(P){O=P.getPropertyValue(H)}if(H=="opacity"&&O==""){O="1"}}else{if(L.currentStyle){var M=H.replace(/\-(\w)/g,function(Q,R){return R.toUpperCase()});O=L.currentStyle[H]||L.currentStyle[M];if(!/^\d+(px)?$/i.test(O)&&/^\d/.test(O)){var K=G.left,N=L.runtimeStyle.left;L.runtimeStyle.left=L.currentStyle.left;G.left=O||0;O=G.pixelLeft+"px";G.left=K;L.runtimeStyle.left=N}}}}return O},swap:function(J,I,K){var G={};for(var H in I){G[H]=J.style[H];J.style[H]=I[H]}K.call(J);for(var H in I){J.style[H]=G[H]}}});q.fn.extend({_load:q.fn.load,load:function(I,L,M){if(typeof I!=="string"){return this._load(I)}var K=I.indexOf(" ");if(K>=0){var G=I.slice(K,I.length);I=I.slice(0,K)}var J="GET";if(L){if(q.isFunction(L)){M=L;L=null}else{if(typeof L==="object"){L=q.param(L);J="POST"}}}var H=this;q.ajax({url:I,type:J,dataType:"html",data:L,complete:function(O,N){if(N=="success"||N=="notmodified"){H.html(G?q("<div/>").append(O.responseText.replace(/<script(.|\s)*?\/script>/g,"")).find(G):O.responseText)}if(M){H.each(M,[O.responseText,N,O])}}});return this},serialize:function(){return q.param(this.serializeArray())},serializeArray:function(){return this.map(function(){return this.elements?q.makeArray(this.elements):this}).filter(function(){return this.name&&!this.disabled&&(this.checked||/select|textarea/i.test(this.nodeName)||/text|hidden|password|search/i.test(this.type))}).map(function(G,H){var I=q(this).val();return I==null?null:q.isArray(I)?q.map(I,function(K,J){return{name:H.name,value:K}}):{name:H.name,value:I}}).get()}});q.each("ajaxStart,ajaxStop,ajaxComplete,ajaxError,ajaxSuccess,ajaxSend".split(","),function(G,H){q.fn[H]=function(I){return this.bind(H,I)}});var s=e();q.extend({get:function(G,I,J,H){if(q.isFunction(I)){J=I;I=null}return q.ajax({type:"GET",url:G,data:I,success:J,dataType:H})},getScript:function(G,H){return q.get(G,null,H,"script")},getJSON:function(G,H,I){return q.get(G,H,I,"json")},post:function(G,I,J,H){if(q.isFunction(I)){J=I;I={}}return q.ajax({type:"POST",url:G,data:I,success:J,dataType:H})},ajaxSetup:function(G){q.extend(q.ajaxSettings,G)},ajaxSettings:{url:location.href,global:true,type:"GET",contentType:"application/x-www-form-urlencoded",processData:true,async:true,xhr:function(){return j.ActiveXObject?new ActiveXObject("Microsoft.XMLHTTP"):new XMLHttpRequest()},accepts:{xml:"application/xml, text/xml",html:"text/html",script:"text/javascript, application/javascript",json:"application/json, text/javascript",text:"text/plain",_default:"*/*"}},lastModified:{},etag:{},ajax:function(O){O=q.extend(true,O,q.extend(true,{},q.ajaxSettings,O));var Y,H=/=\?(&|$)/g,T,X,I=O.type.toUpperCase();if(O.data&&O.processData&&typeof O.data!=="string"){O.data=q.param(O.data)}if(O.dataType=="jsonp"){if(I=="GET"){if(!O.url.match(H)){O.url+=(O.url.match(/\?/)?"&":"?")+(O.jsonp||"callback")+"=?"}}else{if(!O.data||!O.data.match(H)){O.data=(O.data?O.data+"&":"")+(O.jsonp||"callback")+"=?"}}O.dataType="json"}if(O.dataType=="json"&&(O.data&&O.data.match(H)||O.url.match(H))){Y="jsonp"+s++;if(O.data){O.data=(O.data+"").replace(H,"="+Y+"$1")}O.url=O.url.replace(H,"="+Y+"$1");O.dataType="script";j[Y]=function(Z){X=Z;K();N();j[Y]=g;try{delete j[Y]}catch(aa){}if(J){J.removeChild(V)}}}if(O.dataType=="script"&&O.cache==null){O.cache=false}if(O.cache===false&&I=="GET"){var G=e();var W=O.url.replace(/(\?|&)_=.*?(&|$)/,"$1_="+G+"$2");O.url=W+((W==O.url)?(O.url.match(/\?/)?"&":"?")+"_="+G:"")}if(O.data&&I=="GET"){O.url+=(O.url.match(/\?/)?"&":"?")+O.data}if(O.global&&!q.active++){q.event.trigger("ajaxStart")}var S=/^(\w+:)?\/\/([^\/?#]+)/.exec(O.url);if(O.dataType=="script"&&I=="GET"&&S&&(S[1]&&S[1]!=location.protocol||S[2]!=location.host)){var J=document.getElementsByTagName("head")[0];var V=document.createElement("script");V.src=O.url;if(O.scriptCharset){V.charset=O.scriptCharset}if(!Y){var Q=false;V.onload=V.onreadystatechange=function(){if(!Q&&(!this.readyState||this.readyState=="loaded"||this.readyState=="complete")){Q=true;K();N();V.onload=V.onreadystatechange=null;J.removeChild(V)}}}J.insertBefore(V,J.firstChild);return g}var M=false;var L=O.xhr();if(O.username){L.open(I,O.url,O.async,O.username,O.password)}else{L.open(I,O.url,O.async)}try{if(O.data){L.setRequestHeader("Content-Type",O.contentType)}if(O.ifModified){if(q.lastModified[O.url]){L.setRequestHeader("If-Modified-Since",q.lastModified[O.url])}if(q.etag[O.url]){L.setRequestHeader("If-None-Match",q.etag[O.url])}}L.setRequestHeader("X-Requested-With","XMLHttpRequest");L.setRequestHeader("Accept",O.dataType&&O.accepts[O.dataType]?O.accepts[O.dataType]+", */*":O.accepts._default)}catch(U){}if(O.beforeSend&&O.beforeSend(L,O)===false){if(O.global&&!--q.active){q.event.trigger("ajaxStop")}L.abort();return false}if(O.global){q.event.trigger("ajaxSend",[L,O])}var P=function(Z){if(L.readyState==0){if(R){clearInterval(R);R=null;if(O.global&&!--q.active){q.event.trigger("ajaxStop")}}}else{if(!M&&L&&(L.readyState==4||Z=="timeout")){M=true;if(R){clearInterval(R);R=null}T=Z=="timeout"?"timeout":!q.httpSuccess(L)?"error":O.ifModified&&q.httpNotModified(L,O.url)?"notmodified":"success";if(T=="success"){try{X=q.httpData(L,O.dataType,O)}catch(aa){T="parsererror"}}if(T=="success"||T=="notmodified"){if(!Y){K()}}else{q.handleError(O,L,T)}N();if(Z){L.abort()}if(O.async){L=null}}}};if(O.async){var R=setInterval(P,13);if(O.timeout>0){setTimeout(function(){if(L&&!M){P("timeout")}},O.timeout)}}try{L.send(I==="POST"?O.data:null)}catch(U){q.handleError(O,L,null,U)}if(!O.async){P()}function K(){if(O.success){O.success(X,T)}if(O.global){q.event.trigger("ajaxSuccess",[L,O])}}function N(){if(O.complete){O.complete(L,T)}if(O.global){q.event.trigger("ajaxComplete",[L,O])}if(O.global&&!--q.active){q.event.trigger("ajaxStop")}}return L},handleError:function(H,J,G,I){if(H.error){H.error(J,G,I)}if(H.global){q.event.trigger("ajaxError",[J,H,I])}},active:0,httpSuccess:function(H){try{return !H.status&&location.protocol=="file:"||(H.status>=200&&H.status<300)||H.status==304||H.status==1223}catch(G){}return false},httpNotModified:function(J,H){var G=J.getResponseHeader("Last-Modified");var I=J.getResponseHeader("Etag");if(G){q.lastModified[H]=G}if(I){q.etag[H]=I}return J.status==304},httpData:function(L,J,I){var H=L.getResponseHeader("content-type"),G=J=="xml"||!J&&H&&H.indexOf("xml")>=0,K=G?L.responseXML:L.responseText;if(G&&K.documentElement.tagName=="parsererror"){throw"parsererror"}if(I&&I.dataFilter){K=I.dataFilter(K,J)}if(typeof K==="string"){if(J==="script"){q.globalEval(K)}if(J=="json"){if(typeof JSON==="object"&&JSON.parse){K=JSON.parse(K)}else{K=(new Function("return "+K))()}}}return K},param:function(G){var I=[];function J(K,L){I[I.length]=encodeURIComponent(K)+"="+encodeURIComponent(L)}if(q.isArray(G)||G.jquery){q.each(G,function(){J(this.name,this.value)})}else{for(var H in G){if(q.isArray(G[H])){q.each(G[H],function(){J(H,this)})}else{J(H,q.isFunction(G[H])?G[H]():G[H])}}}return I.join("&").replace(/%20/g,"+")}});var m={},n,d=[["height","marginTop","marginBottom","paddingTop","paddingBottom"],["width","marginLeft","marginRight","paddingLeft","paddingRight"],["opacity"]];function u(H,G){var I={};q.each(d.concat.apply([],d.slice(0,G)),function(){I[this]=H});return I}q.fn.extend({show:function(L,N){if(L){return this.animate(u("show",3),L,N)}else{for(var J=0,H=this.length;J<H;J++){var G=q.data(this[J],"olddisplay");this[J].style.display=G||"";if(q.css(this[J],"display")==="none"){var I=this[J].tagName,M;if(m[I]){M=m[I]}else{var K=q("<"+I+" />").appendTo("body");M=K.css("display");if(M==="none"){M="block"}K.remove();m[I]=M}q.data(this[J],"olddisplay",M)}}for(var J=0,H=this.length;J<H;J++){this[J].style.display=q.data(this[J],"olddisplay")||""}return this}},hide:function(J,K){if(J){return this.animate(u("hide",3),J,K)}else{for(var I=0,H=this.length;I<H;I++){var G=q.data(this[I],"olddisplay");if(!G&&G!=="none"){q.data(this[I],"olddisplay",q.css(this[I],"display"))}}for(var I=0,H=this.length;I<H;I++){this[I].style.display="none"}return this}},_toggle:q.fn.toggle,toggle:function(I,H){var G=typeof I==="boolean";return q.isFunction(I)&&q.isFunction(H)?this._toggle.apply(this,arguments):I==null||G?this.each(function(){var J=G?I:q(this).is(":hidden");q(this)[J?"show":"hide"]()}):this.animate(u("toggle",3),I,H)},fadeTo:function(G,I,H){return this.filter(":hidden").css("opacity",0).show().end().animate({opacity:I},G,H)},animate:function(K,H,J,I){var G=q.speed(H,J,I);return this[G.queue===false?"each":"queue"](function(){var M=q.extend({},G),O,N=this.nodeType==1&&q(this).is(":hidden"),L=this;for(O in K){if(K[O]=="hide"&&N||K[O]=="show"&&!N){return M.complete.call(this)}if((O=="height"||O=="width")&&this.style){M.display=q.css(this,"display");M.overflow=this.style.overflow}}if(M.overflow!=null){this.style.overflow="hidden"}M.curAnim=q.extend({},K);q.each(K,function(Q,U){var T=new q.fx(L,M,Q);if(/toggle|show|hide/.test(U)){T[U=="toggle"?N?"show":"hide":U](K)}else{var S=U.toString().match(/^([+-]=)?([\d+-.]+)(.*)$/),V=T.cur(true)||0;if(S){var P=parseFloat(S[2]),R=S[3]||"px";if(R!="px"){L.style[Q]=(P||1)+R;V=((P||1)/T.cur(true))*V;L.style[Q]=V+R}if(S[1]){P=((S[1]=="-="?-1:1)*P)+V}T.custom(V,P,R)}else{T.custom(V,U,"")}}});return true})},stop:function(H,G){var I=q.timers;if(H){this.queue([])}this.each(function(){for(var J=I.length-1;J>=0;J--){if(I[J].elem==this){if(G){I[J](true)}I.splice(J,1)}}});if(!G){this.dequeue()}return this}});q.each({slideDown:u("show",1),slideUp:u("hide",1),slideToggle:u("toggle",1),fadeIn:{opacity:"show"},fadeOut:{opacity:"hide"}},function(G,H){q.fn[G]=function(I,J){return this.animate(H,I,J)}});q.extend({speed:function(I,J,H){var G=typeof I==="object"?I:{complete:H||!H&&J||q.isFunction(I)&&I,duration:I,easing:H&&J||J&&!q.isFunction(J)&&J};G.duration=q.fx.off?0:typeof G.duration==="number"?G.duration:q.fx.speeds[G.duration]||q.fx.speeds._default;G.old=G.complete;G.complete=function(){if(G.queue!==false){q(this).dequeue()}if(q.isFunction(G.old)){G.old.call(this)}};return G},easing:{linear:function(I,J,G,H){return G+H*I},swing:function(I,J,G,H){return((-Math.cos(I*Math.PI)/2)+0.5)*H+G}},timers:[],fx:function(H,G,I){this.options=G;this.elem=H;this.prop=I;if(!G.orig){G.orig={}}}});q.fx.prototype={update:function(){if(this.options.step){this.options.step.call(this.elem,this.now,this)}(q.fx.step[this.prop]||q.fx.step._default)(this);if((this.prop=="height"||this.prop=="width")&&this.elem.style){this.elem.style.display="block"}},cur:function(H){if(this.elem[this.prop]!=null&&(!this.elem.style||this.elem.style[this.prop]==null)){return this.elem[this.prop]}var G=parseFloat(q.css(this.elem,this.prop,H));return G&&G>-10000?G:parseFloat(q.curCSS(this.elem,this.prop))||0},custom:function(K,J,I){this.startTime=e();this.start=K;this.end=J;this.unit=I||this.unit||"px";this.now=this.start;this.pos=this.state=0;var G=this;function H(L){return G.step(L)}H.elem=this.elem;if(H()&&q.timers.push(H)&&!n){n=setInterval(q.fx.tick,13)}},show:function(){this.options.orig[this.prop]=q.style(this.elem,this.prop);this.options.show=true;this.custom(this.prop=="width"||this.prop=="height"?1:0,this.cur());q(this.elem).show()},hide:function(){this.options.orig[this.prop]=q.style(this.elem,this.prop);this.options.hide=true;this.custom(this.cur(),0)},step:function(J){var I=e();if(J||I>=this.options.duration+this.startTime){this.now=this.end;this.pos=this.state=1;this.update();this.options.curAnim[this.prop]=true;var G=true;for(var H in this.options.curAnim){if(this.options.curAnim[H]!==true){G=false}}if(G){if(this.options.display!=null){this.elem.style.overflow=this.options.overflow;this.elem.style.display=this.options.display;if(q.css(this.elem,"display")=="none"){this.elem.style.display="block"}}if(this.options.hide){q(this.elem).hide()}if(this.options.hide||this.options.show){for(var K in this.options.curAnim){q.style(this.elem,K,this.options.orig[K])}}this.options.complete.call(this.elem)}return false}else{var L=I-this.startTime;this.state=L/this.options.duration;this.pos=q.easing[this.options.easing||(q.easing.swing?"swing":"linear")](this.state,L,0,1,this.options.duration);this.now=this.start+((this.end-this.start)*this.pos);this.update()}return true}};q.extend(q.fx,{tick:function(){var H=q.timers;for(var G=0;G<H.length;G++){if(!H[G]()){H.splice(G--,1)}}if(!H.length){q.fx.stop()}},stop:function(){clearInterval(n);n=null},speeds:{slow:600,fast:200,_default:400},step:{opacity:function(G){q.style(G.elem,"opacity",G.now)},_default:function(G){if(G.elem.style&&G.elem.style[G.prop]!=null){G.elem.style[G.prop]=G.now+G.unit}else{G.elem[G.prop]=G.now}}}});if("getBoundingClientRect" in document.documentElement){q.fn.offset=function(){var I=this[0];if(!I||!I.ownerDocument){return null}if(I===I.ownerDocument.body){return q.offset.bodyOffset(I)}var K=I.getBoundingClientRect(),O=I.ownerDocument,L=O.body,G=O.documentElement,J=G.clientTop||L.clientTop||0,M=G.clientLeft||L.clientLeft||0,N=K.top+(self.pageYOffset||q.support.boxModel&&G.scrollTop||L.scrollTop)-J,H=K.left+(self.pageXOffset||q.support.boxModel&&G.scrollLeft||L.scrollLeft)-M;return{top:N,left:H}}}else{q.fn.offset=function(){var L=this[0];if(!L||!L.ownerDocument){return null}if(L===L.ownerDocument.body){return q.offset.bodyOffset(L)}q.offset.initialize();var I=L.offsetParent,H=L,Q=L.ownerDocument,O,J=Q.documentElement,M=Q.body,N=Q.defaultView,G=N.getComputedStyle(L,null),P=L.offsetTop,K=L.offsetLeft;while((L=L.parentNode)&&L!==M&&L!==J){if(q.offset.supportsFixedPosition&&G.position==="fixed"){break}O=N.getComputedStyle(L,null);P-=L.scrollTop,K-=L.scrollLeft;if(L===I){P+=L.offsetTop,K+=L.offsetLeft;if(q.offset.doesNotAddBorder&&!(q.offset.doesAddBorderForTableAndCells&&/^t(able|d|h)$/i.test(L.tagName))){P+=parseFloat(O.borderTopWidth)||0,K+=parseFloat(O.borderLeftWidth)||0}H=I,I=L.offsetParent}if(q.offset.subtractsBorderForOverflowNotVisible&&O.overflow!=="visible"){P+=parseFloat(O.borderTopWidth)||0,K+=parseFloat(O.borderLeftWidth)||0}G=O}if(G.position==="relative"||G.position==="static"){P+=M.offsetTop,K+=M.offsetLeft}if(q.offset.supportsFixedPosition&&G.position==="fixed"){P+=Math.max(J.scrollTop,M.scrollTop),K+=Math.max(J.scrollLeft,M.scrollLeft)}return{top:P,left:K}}}q.offset={initialize:function(){var G=document.body,H=document.createElement("div"),K,M,L,N,I=parseFloat(q.curCSS(G,"marginTop",true))||0,J='<div style="position:absolute;top:0;left:0;margin:0;border:5px solid #000;padding:0;width:1px;height:1px;"><div></div></div><table style="position:absolute;top:0;left:0;margin:0;border:5px solid #000;padding:0;width:1px;height:1px;" cellpadding="0" cellspacing="0"><tr><td></td></tr></table>';q.extend(H.style,{position:"absolute",top:0,left:0,margin:0,border:0,width:"1px",height:"1px",visibility:"hidden"});H.innerHTML=J;G.insertBefore(H,G.firstChild);K=H.firstChild,M=K.firstChild,N=K.nextSibling.firstChild.firstChild;this.doesNotAddBorder=(M.offsetTop!==5);this.doesAddBorderForTableAndCells=(N.offsetTop===5);M.style.position="fixed",M.style.top="20px";this.supportsFixedPosition=(M.offsetTop===20||M.offsetTop===15);M.style.position="",M.style.top="";K.style.overflow="hidden",K.style.position="relative";this.subtractsBorderForOverflowNotVisible=(M.offsetTop===-5);this.doesNotIncludeMarginInBodyOffset=(G.offsetTop!==I);G.removeChild(H);q.offset.initialize=function(){};G=H=K=M=L=N=null},bodyOffset:function(G){q.offset.initialize();var I=G.offsetTop,H=G.offsetLeft;if(q.offset.doesNotIncludeMarginInBodyOffset){I+=parseFloat(q.curCSS(G,"marginTop",true))||0,H+=parseFloat(q.curCSS(G,"marginLeft",true))||0}return{top:I,left:H}}};q.fn.extend({position:function(){if(!this[0]){return null}var I=this[0],H=this.offsetParent(),J=this.offset(),G=/^body|html$/i.test(H[0].tagName)?{top:0,left:0}:H.offset();J.top-=parseFloat(q.curCSS(I,"marginTop",true))||0;J.left-=parseFloat(q.curCSS(I,"marginLeft",true))||0;G.top+=parseFloat(q.curCSS(H[0],"borderTopWidth",true))||0;G.left+=parseFloat(q.curCSS(H[0],"borderLeftWidth",true))||0;return{top:J.top-G.top,left:J.left-G.left}},offsetParent:function(){var G=this[0].offsetParent||document.body;while(G&&(!/^body|html$/i.test(G.tagName)&&q.css(G,"position")==="static")){G=G.offsetParent}return q(G)}});q.each(["Left","Top"],function(H,G){var I="scroll"+G;q.fn[I]=function(L){if(!this[0]){return null}var J=this[0],K=("scrollTo" in J&&J.document)?J:(J.nodeName==="#document")?J.defaultView||J.parentWindow:false;return L!==g?this.each(function(){K=("scrollTo" in this&&this.document)?this:(this.nodeName==="#document")?this.defaultView||this.parentWindow:false;K?K.scrollTo(!H?L:q(K).scrollLeft(),H?L:q(K).scrollTop()):this[I]=L}):K?K[H?"pageYOffset":"pageXOffset"]||q.support.boxModel&&K.document.documentElement[I]||K.document.body[I]:J[I]}});q.each(["Height","Width"],function(H,G){var I=G.toLowerCase();q.fn["inner"+G]=function(){return this[0]?q.css(this[0],I,false,"padding"):null};q.fn["outer"+G]=function(J){return this[0]?q.css(this[0],I,false,J?"margin":"border"):null};q.fn[I]=function(J){var K=this[0];if(!K){return null}return("scrollTo" in K&&K.document)?K.document.compatMode==="CSS1Compat"&&K.document.documentElement["client"+G]||K.document.body["client"+G]:(K.nodeName==="#document")?Math.max(K.documentElement["client"+G],K.body["scroll"+G],K.documentElement["scroll"+G],K.body["offset"+G],K.documentElement["offset"+G]):J===g?q.css(K,I):this.css(I,typeof J==="string"?J:J+"px")}})})(window);
\ No newline at end of file
@@ -0,0 +1,4324 @@
+/*
+ * null -- Property slot definitions for the "ejs" module
+ *
+ * This file is generated by ec
+ *
+ * Slot definitions. Version 3.3.2.
+ */
+
+#ifndef _h_SLOTS_EjsSlots
+#define _h_SLOTS_EjsSlots 1
+
+
+/**
+ * Slots for the "ejs" module 
+ */
+
+
+/**
+ *   Class property slots for the "global" class 
+ */
+#define ES_Array                                                       0
+#define ES_Block                                                       1
+#define ES_Boolean                                                     2
+#define ES_ByteArray                                                   3
+#define ES_Date                                                        4
+#define ES_ArgError                                                    5
+#define ES_ArithmeticError                                             6
+#define ES_AssertError                                                 7
+#define ES_InstructionError                                            8
+#define ES_Error                                                       9
+#define ES_IOError                                                     10
+#define ES_InternalError                                               11
+#define ES_MemoryError                                                 12
+#define ES_OutOfBoundsError                                            13
+#define ES_ReferenceError                                              14
+#define ES_ResourceError                                               15
+#define ES_StateError                                                  16
+#define ES_SyntaxError                                                 17
+#define ES_TypeError                                                   18
+#define ES_URIError                                                    19
+#define ES_Frame                                                       20
+#define ES_Function                                                    21
+#define ES_makeGetter                                                  22
+#define ES_clearBoundThis                                              23
+#define ES_ECMA                                                        24
+#define ES_public                                                      25
+#define ES_internal                                                    26
+#define ES_intrinsic                                                   27
+#define ES_iterator                                                    28
+#define ES_CONFIG                                                      29
+#define ES_TODO                                                        30
+#define ES_FUTURE                                                      31
+#define ES_ASC                                                         32
+#define ES_DOC_ONLY                                                    33
+#define ES_DEPRECATED                                                  34
+#define ES_REGEXP                                                      35
+#define ES_boolean                                                     36
+#define ES_double                                                      37
+#define ES_num                                                         38
+#define ES_string                                                      39
+#define ES_false                                                       40
+#define ES_global                                                      41
+#define ES_null                                                        42
+#define ES_Infinity                                                    43
+#define ES_NegativeInfinity                                            44
+#define ES_NaN                                                         45
+#define ES_StopIteration                                               46
+#define ES_true                                                        47
+#define ES_undefined                                                   48
+#define ES_void                                                        49
+#define ES_assert                                                      50
+#define ES_breakpoint                                                  51
+#define ES_cloneBase                                                   52
+#define ES_deserialize                                                 53
+#define ES_decodeURI                                                   54
+#define ES_dump                                                        55
+#define ES_error                                                       56
+#define ES_escape                                                      57
+#define ES_encodeURI                                                   58
+#define ES_md5                                                         59
+#define ES_eval                                                        60
+#define ES_formatStack                                                 61
+#define ES_hashcode                                                    62
+#define ES_input                                                       63
+#define ES_load                                                        64
+#define ES_output                                                      65
+#define ES_print                                                       66
+#define ES_printv                                                      67
+#define ES_parse                                                       68
+#define ES_serialize                                                   69
+#define ES_printHash                                                   70
+#define ES_instanceOf                                                  71
+#define ES_Iterable                                                    72
+#define ES_Iterator                                                    73
+#define ES_JSON                                                        74
+#define ES_Math                                                        75
+#define ES_Namespace                                                   76
+#define ES_Null                                                        77
+#define ES_Number                                                      78
+#define ES_Object                                                      79
+#define ES_Reflect                                                     80
+#define ES_typeOf                                                      81
+#define ES_RegExp                                                      82
+#define ES_Stream                                                      83
+#define ES_String                                                      84
+#define ES_Type                                                        85
+#define ES_Void                                                        86
+#define ES_ejs_db_Database                                             87
+#define ES_ejs_db_DatabaseConnector                                    88
+#define ES_ejs_db_Record                                               89
+#define ES_ejs_db_Column                                               90
+#define ES_ejs_db_plural                                               91
+#define ES_ejs_db_singular                                             92
+#define ES_ejs_db_mapType                                              93
+#define ES_ejs_db_Sqlite                                               94
+#define ES_ejs_events_Dispatcher                                       95
+#define ES_Endpoint                                                    96
+#define ES_ejs_events_Event                                            97
+#define ES_ejs_events_ErrorEvent                                       98
+#define ES_ejs_events_Timer                                            99
+#define ES_ejs_events_TimerEvent                                       100
+#define ES_ejs_io_BinaryStream                                         101
+#define ES_ejs_io_File                                                 102
+#define ES_ejs_io_FileSystem                                           103
+#define ES_ejs_io_Http                                                 104
+#define ES_ejs_io_HttpDataEvent                                        105
+#define ES_ejs_io_HttpErrorEvent                                       106
+#define ES_ejs_io_Path                                                 107
+#define ES_ejs_io_TextStream                                           108
+#define ES_ejs_io_XMLHttp                                              109
+#define ES_ejs_sys_App                                                 110
+#define ES_ejs_sys_Cmd                                                 111
+#define ES_gc                                                          112
+#define ES_readFile                                                    113
+#define ES_ejs_sys_Config                                              114
+#define ES_ejs_sys_GC                                                  115
+#define ES_ejs_sys_Memory                                              116
+#define ES_ejs_sys_System                                              117
+#define ES_basename                                                    118
+#define ES_chdir                                                       119
+#define ES_chmod                                                       120
+#define ES_close                                                       121
+#define ES_cp                                                          122
+#define ES_dirname                                                     123
+#define ES_exists                                                      124
+#define ES_extension                                                   125
+#define ES_isDir                                                       126
+#define ES_kill                                                        127
+#define ES_ls                                                          128
+#define ES_find                                                        129
+#define ES_mkdir                                                       130
+#define ES_mv                                                          131
+#define ES_open                                                        132
+#define ES_pwd                                                         133
+#define ES_read                                                        134
+#define ES_rm                                                          135
+#define ES_rmdir                                                       136
+#define ES_tempname                                                    137
+#define ES_write                                                       138
+#define ES_ejs_sys_Worker                                              139
+#define ES_ejs_sys_worker_self                                         140
+#define ES_ejs_sys_worker_exit                                         141
+#define ES_ejs_sys_worker_postMessage                                  142
+#define ES_ejs_sys_worker_onerror                                      143
+#define ES_ejs_sys_worker_set_onerror                                  144
+#define ES_ejs_sys_worker_onmessage                                    145
+#define ES_ejs_sys_worker_set_onmessage                                146
+#define ES_ejs_web_Cache                                               147
+#define ES_ejs_web_GoogleConnector                                     148
+#define ES_ejs_web_HtmlConnector                                       149
+#define ES_ejs_web_action                                              150
+#define ES_ejs_web_view                                                151
+#define ES_ejs_web_Controller                                          152
+#define ES_ejs_web__SoloController                                     153
+#define ES_ejs_web_Cookie                                              154
+#define ES_ejs_web_EjsParser                                           155
+#define ES_ejs_web_Host                                                156
+#define ES_ejs_web_Request                                             157
+#define ES_ejs_web_Response                                            158
+#define ES_ejs_web_Session                                             159
+#define ES_ejs_web_UploadFile                                          160
+#define ES_ejs_web_View                                                161
+#define ES_LocalModel                                                  162
+#define ES_XML                                                         163
+#define ES_XMLList                                                     164
+#define ES_global_NUM_CLASS_PROP                                       165
+
+/**
+ * Instance slots for "global" type 
+ */
+#define ES_global_NUM_INSTANCE_PROP                                    0
+
+/**
+ * 
+ *    Local slots for methods in type global 
+ */
+#define ES_makeGetter_fn                                               0
+#define ES_clearBoundThis_fn                                           0
+#define ES_assert_condition                                            0
+#define ES_cloneBase_klass                                             0
+#define ES_deserialize_obj                                             0
+#define ES_decodeURI_str                                               0
+#define ES_dump_args                                                   0
+#define ES_dump_e                                                      1
+#define ES_error_args                                                  0
+#define ES_escape_str                                                  0
+#define ES_encodeURI_str                                               0
+#define ES_md5_str                                                     0
+#define ES_eval_script                                                 0
+#define ES_hashcode_o                                                  0
+#define ES_load_file                                                   0
+#define ES_output_args                                                 0
+#define ES_print_args                                                  0
+#define ES_printv_args                                                 0
+#define ES_parse_str                                                   0
+#define ES_parse_preferredType                                         1
+#define ES_serialize_obj                                               0
+#define ES_serialize_maxDepth                                          1
+#define ES_serialize_all                                               2
+#define ES_serialize_base                                              3
+#define ES_printHash_name                                              0
+#define ES_printHash_o                                                 1
+#define ES_instanceOf_obj                                              0
+#define ES_instanceOf_target                                           1
+#define ES_typeOf_o                                                    0
+#define ES_ejs_db_plural_name                                          0
+#define ES_ejs_db_singular_name                                        0
+#define ES_ejs_db_singular_s                                           1
+#define ES_ejs_db_mapType_value                                        0
+#define ES_readFile_path                                               0
+#define ES_readFile_encoding                                           1
+#define ES_basename_path                                               0
+#define ES_chdir_dir                                                   0
+#define ES_chmod_path                                                  0
+#define ES_chmod_perms                                                 1
+#define ES_close_file                                                  0
+#define ES_close_graceful                                              1
+#define ES_cp_fromPath                                                 0
+#define ES_cp_toPath                                                   1
+#define ES_dirname_path                                                0
+#define ES_exists_path                                                 0
+#define ES_extension_path                                              0
+#define ES_isDir_path                                                  0
+#define ES_kill_pid                                                    0
+#define ES_kill_signal                                                 1
+#define ES_ls_path                                                     0
+#define ES_ls_enumDirs                                                 1
+#define ES_find_path                                                   0
+#define ES_find_glob                                                   1
+#define ES_find_recurse                                                2
+#define ES_find_result                                                 3
+#define ES_find__hoisted_4_paths                                       4
+#define ES_find__hoisted_5_path                                        5
+#define ES_mkdir_path                                                  0
+#define ES_mkdir_permissions                                           1
+#define ES_mv_fromFile                                                 0
+#define ES_mv_toFile                                                   1
+#define ES_open_path                                                   0
+#define ES_open_mode                                                   1
+#define ES_open_permissions                                            2
+#define ES_read_file                                                   0
+#define ES_read_count                                                  1
+#define ES_rm_path                                                     0
+#define ES_rmdir_path                                                  0
+#define ES_rmdir_contents                                              1
+#define ES_tempname_directory                                          0
+#define ES_write_file                                                  0
+#define ES_write_items                                                 1
+#define ES_ejs_sys_worker_postMessage_data                             0
+#define ES_ejs_sys_worker_postMessage_transfer                         1
+#define ES_ejs_sys_worker_set_onerror_fun                              0
+#define ES_ejs_sys_worker_set_onmessage_fun                            0
+
+
+/**
+ *   Class property slots for the "Array" class 
+ */
+#define ES_Array__origin                                               6
+#define ES_Array_Array                                                 6
+#define ES_Array_append                                                7
+#define ES_Array_clear                                                 8
+#define ES_Array_compact                                               9
+#define ES_Array_concat                                                10
+#define ES_Array_contains                                              11
+#define ES_Array_every                                                 12
+#define ES_Array_filter                                                13
+#define ES_Array_find                                                  14
+#define ES_Array_findAll                                               15
+#define ES_Array_forEach                                               16
+#define ES_Array_indexOf                                               17
+#define ES_Array_insert                                                18
+#define ES_Array_join                                                  19
+#define ES_Array_lastIndexOf                                           20
+#define ES_Array_set_length                                            21
+#define ES_Array_map                                                   22
+#define ES_Array_pop                                                   23
+#define ES_Array_push                                                  24
+#define ES_Array_reject                                                25
+#define ES_Array_remove                                                26
+#define ES_Array_reverse                                               27
+#define ES_Array_shift                                                 28
+#define ES_Array_slice                                                 29
+#define ES_Array_some                                                  30
+#define ES_Array_sort                                                  31
+#define ES_Array_splice                                                32
+#define ES_Array_transform                                             33
+#define ES_Array_unique                                                34
+#define ES_Array_unshift                                               35
+#define ES_Array_NUM_CLASS_PROP                                        36
+
+/**
+ * Instance slots for "Array" type 
+ */
+#define ES_Array_NUM_INSTANCE_PROP                                     0
+
+/**
+ * 
+ *    Local slots for methods in type Array 
+ */
+#define ES_Array_Array_values                                          0
+#define ES_Array_append_obj                                            0
+#define ES_Array_concat_args                                           0
+#define ES_Array_contains_element                                      0
+#define ES_Array_every_match                                           0
+#define ES_Array_every__hoisted_1_i                                    1
+#define ES_Array_filter_match                                          0
+#define ES_Array_find_match                                            0
+#define ES_Array_find__hoisted_1_i                                     1
+#define ES_Array_findAll_match                                         0
+#define ES_Array_findAll_result                                        1
+#define ES_Array_findAll__hoisted_2_i                                  2
+#define ES_Array_forEach_modifier                                      0
+#define ES_Array_indexOf_element                                       0
+#define ES_Array_indexOf_startIndex                                    1
+#define ES_Array_insert_pos                                            0
+#define ES_Array_insert_args                                           1
+#define ES_Array_join_sep                                              0
+#define ES_Array_lastIndexOf_element                                   0
+#define ES_Array_lastIndexOf_startIndex                                1
+#define ES_Array_set_length_value                                      0
+#define ES_Array_map_mapper                                            0
+#define ES_Array_map_result                                            1
+#define ES_Array_push_items                                            0
+#define ES_Array_reject_match                                          0
+#define ES_Array_reject_result                                         1
+#define ES_Array_reject__hoisted_2_i                                   2
+#define ES_Array_remove_start                                          0
+#define ES_Array_remove_end                                            1
+#define ES_Array_slice_start                                           0
+#define ES_Array_slice_end                                             1
+#define ES_Array_slice_step                                            2
+#define ES_Array_some_match                                            0
+#define ES_Array_some_result                                           1
+#define ES_Array_some__hoisted_2_i                                     2
+#define ES_Array_sort_compare                                          0
+#define ES_Array_sort_order                                            1
+#define ES_Array_splice_start                                          0
+#define ES_Array_splice_deleteCount                                    1
+#define ES_Array_splice_values                                         2
+#define ES_Array_transform_mapper                                      0
+#define ES_Array_transform__hoisted_1_i                                1
+#define ES_Array_unshift_items                                         0
+
+
+/**
+ *   Class property slots for the "Block" class 
+ */
+#define ES_Block__origin                                               6
+#define ES_Block_NUM_CLASS_PROP                                        6
+
+/**
+ * Instance slots for "Block" type 
+ */
+#define ES_Block_NUM_INSTANCE_PROP                                     0
+
+
+/**
+ *   Class property slots for the "Boolean" class 
+ */
+#define ES_Boolean__origin                                             6
+#define ES_Boolean_Boolean                                             6
+#define ES_Boolean_NUM_CLASS_PROP                                      7
+
+/**
+ * Instance slots for "Boolean" type 
+ */
+#define ES_Boolean_NUM_INSTANCE_PROP                                   0
+
+/**
+ * 
+ *    Local slots for methods in type Boolean 
+ */
+#define ES_Boolean_Boolean_value                                       0
+
+
+/**
+ *   Class property slots for the "ByteArray" class 
+ */
+#define ES_ByteArray__origin                                           6
+#define ES_ByteArray_ByteArray                                         6
+#define ES_ByteArray__initializer__ByteArray_initializer               7
+#define ES_ByteArray_LittleEndian                                      8
+#define ES_ByteArray_BigEndian                                         9
+#define ES_ByteArray_available                                         10
+#define ES_ByteArray_close                                             11
+#define ES_ByteArray_compact                                           12
+#define ES_ByteArray_copyIn                                            13
+#define ES_ByteArray_copyOut                                           14
+#define ES_ByteArray_endian                                            15
+#define ES_ByteArray_set_endian                                        16
+#define ES_ByteArray_flush                                             17
+#define ES_ByteArray_set_input                                         18
+#define ES_ByteArray_input                                             19
+#define ES_ByteArray_output                                            20
+#define ES_ByteArray_set_output                                        21
+#define ES_ByteArray_read                                              22
+#define ES_ByteArray_readBoolean                                       23
+#define ES_ByteArray_readByte                                          24
+#define ES_ByteArray_readDate                                          25
+#define ES_ByteArray_readDouble                                        26
+#define ES_ByteArray_readInteger                                       27
+#define ES_ByteArray_readLong                                          28
+#define ES_ByteArray_readPosition                                      29
+#define ES_ByteArray_set_readPosition                                  30
+#define ES_ByteArray_readShort                                         31
+#define ES_ByteArray_readString                                        32
+#define ES_ByteArray_readXML                                           33
+#define ES_ByteArray_reset                                             34
+#define ES_ByteArray_room                                              35
+#define ES_ByteArray_write                                             36
+#define ES_ByteArray_writeByte                                         37
+#define ES_ByteArray_writeShort                                        38
+#define ES_ByteArray_writeDouble                                       39
+#define ES_ByteArray_writeInteger                                      40
+#define ES_ByteArray_writeLong                                         41
+#define ES_ByteArray_writePosition                                     42
+#define ES_ByteArray_set_writePosition                                 43
+#define ES_ByteArray_NUM_CLASS_PROP                                    44
+
+/**
+ * Instance slots for "ByteArray" type 
+ */
+#define ES_ByteArray_NUM_INSTANCE_PROP                                 0
+
+/**
+ * 
+ *    Local slots for methods in type ByteArray 
+ */
+#define ES_ByteArray_ByteArray_size                                    0
+#define ES_ByteArray_ByteArray_growable                                1
+#define ES_ByteArray_close_graceful                                    0
+#define ES_ByteArray_copyIn_destOffset                                 0
+#define ES_ByteArray_copyIn_src                                        1
+#define ES_ByteArray_copyIn_srcOffset                                  2
+#define ES_ByteArray_copyIn_count                                      3
+#define ES_ByteArray_copyOut_srcOffset                                 0
+#define ES_ByteArray_copyOut_dest                                      1
+#define ES_ByteArray_copyOut_destOffset                                2
+#define ES_ByteArray_copyOut_count                                     3
+#define ES_ByteArray_set_endian_value                                  0
+#define ES_ByteArray_flush_graceful                                    0
+#define ES_ByteArray_set_input_callback                                0
+#define ES_ByteArray_set_output_callback                               0
+#define ES_ByteArray_read_buffer                                       0
+#define ES_ByteArray_read_offset                                       1
+#define ES_ByteArray_read_count                                        2
+#define ES_ByteArray_set_readPosition_position                         0
+#define ES_ByteArray_readString_count                                  0
+#define ES_ByteArray_write_data                                        0
+#define ES_ByteArray_writeByte_data                                    0
+#define ES_ByteArray_writeShort_data                                   0
+#define ES_ByteArray_writeDouble_data                                  0
+#define ES_ByteArray_writeInteger_data                                 0
+#define ES_ByteArray_writeLong_data                                    0
+#define ES_ByteArray_set_writePosition_position                        0
+
+
+/**
+ *   Class property slots for the "Date" class 
+ */
+#define ES_Date__origin                                                6
+#define ES_Date_Date                                                   6
+#define ES_Date_day                                                    7
+#define ES_Date_set_day                                                8
+#define ES_Date_dayOfYear                                              9
+#define ES_Date_set_dayOfYear                                          10
+#define ES_Date_date                                                   11
+#define ES_Date_set_date                                               12
+#define ES_Date_elapsed                                                13
+#define ES_Date_format                                                 14
+#define ES_Date_formatUTC                                              15
+#define ES_Date_fullYear                                               16
+#define ES_Date_set_fullYear                                           17
+#define ES_Date_getDate                                                18
+#define ES_Date_getDay                                                 19
+#define ES_Date_getFullYear                                            20
+#define ES_Date_getHours                                               21
+#define ES_Date_getMilliseconds                                        22
+#define ES_Date_getMinutes                                             23
+#define ES_Date_getMonth                                               24
+#define ES_Date_getSeconds                                             25
+#define ES_Date_getTime                                                26
+#define ES_Date_getTimezoneOffset                                      27
+#define ES_Date_getUTCDate                                             28
+#define ES_Date_getUTCDay                                              29
+#define ES_Date_getUTCFullYear                                         30
+#define ES_Date_getUTCHours                                            31
+#define ES_Date_getUTCMilliseconds                                     32
+#define ES_Date_getUTCMinutes                                          33
+#define ES_Date_getUTCMonth                                            34
+#define ES_Date_getUTCSeconds                                          35
+#define ES_Date_hours                                                  36
+#define ES_Date_set_hours                                              37
+#define ES_Date_milliseconds                                           38
+#define ES_Date_set_milliseconds                                       39
+#define ES_Date_minutes                                                40
+#define ES_Date_set_minutes                                            41
+#define ES_Date_month                                                  42
+#define ES_Date_set_month                                              43
+#define ES_Date_nanoAge                                                44
+#define ES_Date_nextDay                                                45
+#define ES_Date_now                                                    46
+#define ES_Date_parseDate                                              47
+#define ES_Date_parseUTCDate                                           48
+#define ES_Date_parse                                                  49
+#define ES_Date_seconds                                                50
+#define ES_Date_set_seconds                                            51
+#define ES_Date_setDate                                                52
+#define ES_Date_setFullYear                                            53
+#define ES_Date_setHours                                               54
+#define ES_Date_setMilliseconds                                        55
+#define ES_Date_setMinutes                                             56
+#define ES_Date_setMonth                                               57
+#define ES_Date_setSeconds                                             58
+#define ES_Date_setTime                                                59
+#define ES_Date_setUTCDate                                             60
+#define ES_Date_setUTCFullYear                                         61
+#define ES_Date_setUTCHours                                            62
+#define ES_Date_setUTCMilliseconds                                     63
+#define ES_Date_setUTCMinutes                                          64
+#define ES_Date_setUTCMonth                                            65
+#define ES_Date_setUTCSeconds                                          66
+#define ES_Date_time                                                   67
+#define ES_Date_set_time                                               68
+#define ES_Date_toDateString                                           69
+#define ES_Date_toISOString                                            70
+#define ES_Date_toLocaleDateString                                     71
+#define ES_Date_toLocaleString                                         72
+#define ES_Date_toLocaleTimeString                                     73
+#define ES_Date_toTimeString                                           74
+#define ES_Date_toUTCString                                            75
+#define ES_Date_UTC                                                    76
+#define ES_Date_valueOf                                                77
+#define ES_Date_year                                                   78
+#define ES_Date_set_year                                               79
+#define ES_Date_NUM_CLASS_PROP                                         80
+
+/**
+ * Instance slots for "Date" type 
+ */
+#define ES_Date_NUM_INSTANCE_PROP                                      0
+
+/**
+ * 
+ *    Local slots for methods in type Date 
+ */
+#define ES_Date_Date_args                                              0
+#define ES_Date_set_day_day                                            0
+#define ES_Date_set_dayOfYear_day                                      0
+#define ES_Date_set_date_date                                          0
+#define ES_Date_format_layout                                          0
+#define ES_Date_formatUTC_layout                                       0
+#define ES_Date_set_fullYear_year                                      0
+#define ES_Date_set_hours_hour                                         0
+#define ES_Date_set_milliseconds_ms                                    0
+#define ES_Date_set_minutes_min                                        0
+#define ES_Date_set_month_month                                        0
+#define ES_Date_nextDay_inc                                            0
+#define ES_Date_parseDate_dateString                                   0
+#define ES_Date_parseDate_defaultDate                                  1
+#define ES_Date_parseUTCDate_dateString                                0
+#define ES_Date_parseUTCDate_defaultDate                               1
+#define ES_Date_parse_dateString                                       0
+#define ES_Date_set_seconds_sec                                        0
+#define ES_Date_setDate_d                                              0
+#define ES_Date_setFullYear_y                                          0
+#define ES_Date_setHours_h                                             0
+#define ES_Date_setMilliseconds_ms                                     0
+#define ES_Date_setMinutes_min                                         0
+#define ES_Date_setMonth_mon                                           0
+#define ES_Date_setSeconds_sec                                         0
+#define ES_Date_setSeconds_msec                                        1
+#define ES_Date_setTime_value                                          0
+#define ES_Date_setUTCDate_d                                           0
+#define ES_Date_setUTCFullYear_y                                       0
+#define ES_Date_setUTCHours_h                                          0
+#define ES_Date_setUTCMilliseconds_ms                                  0
+#define ES_Date_setUTCMinutes_min                                      0
+#define ES_Date_setUTCMonth_mon                                        0
+#define ES_Date_setUTCSeconds_sec                                      0
+#define ES_Date_setUTCSeconds_msec                                     1
+#define ES_Date_set_time_value                                         0
+#define ES_Date_UTC_year                                               0
+#define ES_Date_UTC_month                                              1
+#define ES_Date_UTC_day                                                2
+#define ES_Date_UTC_hours                                              3
+#define ES_Date_UTC_minutes                                            4
+#define ES_Date_UTC_seconds                                            5
+#define ES_Date_UTC_milliseconds                                       6
+#define ES_Date_set_year_year                                          0
+
+
+/**
+ *   Class property slots for the "ArgError" class 
+ */
+#define ES_ArgError__origin                                            9
+#define ES_ArgError_ArgError                                           9
+#define ES_ArgError_NUM_CLASS_PROP                                     10
+
+/**
+ * Instance slots for "ArgError" type 
+ */
+#define ES_ArgError_NUM_INSTANCE_PROP                                  0
+
+/**
+ * 
+ *    Local slots for methods in type ArgError 
+ */
+#define ES_ArgError_ArgError_message                                   0
+
+
+/**
+ *   Class property slots for the "ArithmeticError" class 
+ */
+#define ES_ArithmeticError__origin                                     9
+#define ES_ArithmeticError_ArithmeticError                             9
+#define ES_ArithmeticError_NUM_CLASS_PROP                              10
+
+/**
+ * Instance slots for "ArithmeticError" type 
+ */
+#define ES_ArithmeticError_NUM_INSTANCE_PROP                           0
+
+/**
+ * 
+ *    Local slots for methods in type ArithmeticError 
+ */
+#define ES_ArithmeticError_ArithmeticError_message                     0
+
+
+/**
+ *   Class property slots for the "AssertError" class 
+ */
+#define ES_AssertError__origin                                         9
+#define ES_AssertError_AssertError                                     9
+#define ES_AssertError_NUM_CLASS_PROP                                  10
+
+/**
+ * Instance slots for "AssertError" type 
+ */
+#define ES_AssertError_NUM_INSTANCE_PROP                               0
+
+/**
+ * 
+ *    Local slots for methods in type AssertError 
+ */
+#define ES_AssertError_AssertError_message                             0
+
+
+/**
+ *   Class property slots for the "InstructionError" class 
+ */
+#define ES_InstructionError__origin                                    9
+#define ES_InstructionError_InstructionError                           9
+#define ES_InstructionError_NUM_CLASS_PROP                             10
+
+/**
+ * Instance slots for "InstructionError" type 
+ */
+#define ES_InstructionError_NUM_INSTANCE_PROP                          0
+
+/**
+ * 
+ *    Local slots for methods in type InstructionError 
+ */
+#define ES_InstructionError_InstructionError_message                   0
+
+
+/**
+ *   Class property slots for the "Error" class 
+ */
+#define ES_Error__origin                                               6
+#define ES_Error_Error                                                 6
+#define ES_Error_code                                                  7
+#define ES_Error_set_code                                              8
+#define ES_Error_NUM_CLASS_PROP                                        9
+
+/**
+ * Instance slots for "Error" type 
+ */
+#define ES_Error_message                                               0
+#define ES_Error_stack                                                 1
+#define ES_Error_NUM_INSTANCE_PROP                                     2
+
+/**
+ * 
+ *    Local slots for methods in type Error 
+ */
+#define ES_Error_Error_message                                         0
+#define ES_Error_set_code_value                                        0
+
+
+/**
+ *   Class property slots for the "IOError" class 
+ */
+#define ES_IOError__origin                                             9
+#define ES_IOError_IOError                                             9
+#define ES_IOError_NUM_CLASS_PROP                                      10
+
+/**
+ * Instance slots for "IOError" type 
+ */
+#define ES_IOError_NUM_INSTANCE_PROP                                   0
+
+/**
+ * 
+ *    Local slots for methods in type IOError 
+ */
+#define ES_IOError_IOError_message                                     0
+
+
+/**
+ *   Class property slots for the "InternalError" class 
+ */
+#define ES_InternalError__origin                                       9
+#define ES_InternalError_InternalError                                 9
+#define ES_InternalError_NUM_CLASS_PROP                                10
+
+/**
+ * Instance slots for "InternalError" type 
+ */
+#define ES_InternalError_NUM_INSTANCE_PROP                             0
+
+/**
+ * 
+ *    Local slots for methods in type InternalError 
+ */
+#define ES_InternalError_InternalError_message                         0
+
+
+/**
+ *   Class property slots for the "MemoryError" class 
+ */
+#define ES_MemoryError__origin                                         9
+#define ES_MemoryError_MemoryError                                     9
+#define ES_MemoryError_NUM_CLASS_PROP                                  10
+
+/**
+ * Instance slots for "MemoryError" type 
+ */
+#define ES_MemoryError_NUM_INSTANCE_PROP                               0
+
+/**
+ * 
+ *    Local slots for methods in type MemoryError 
+ */
+#define ES_MemoryError_MemoryError_message                             0
+
+
+/**
+ *   Class property slots for the "OutOfBoundsError" class 
+ */
+#define ES_OutOfBoundsError__origin                                    9
+#define ES_OutOfBoundsError_OutOfBoundsError                           9
+#define ES_OutOfBoundsError_NUM_CLASS_PROP                             10
+
+/**
+ * Instance slots for "OutOfBoundsError" type 
+ */
+#define ES_OutOfBoundsError_NUM_INSTANCE_PROP                          0
+
+/**
+ * 
+ *    Local slots for methods in type OutOfBoundsError 
+ */
+#define ES_OutOfBoundsError_OutOfBoundsError_message                   0
+
+
+/**
+ *   Class property slots for the "ReferenceError" class 
+ */
+#define ES_ReferenceError__origin                                      9
+#define ES_ReferenceError_ReferenceError                               9
+#define ES_ReferenceError_NUM_CLASS_PROP                               10
+
+/**
+ * Instance slots for "ReferenceError" type 
+ */
+#define ES_ReferenceError_NUM_INSTANCE_PROP                            0
+
+/**
+ * 
+ *    Local slots for methods in type ReferenceError 
+ */
+#define ES_ReferenceError_ReferenceError_message                       0
+
+
+/**
+ *   Class property slots for the "ResourceError" class 
+ */
+#define ES_ResourceError__origin                                       9
+#define ES_ResourceError_ResourceError                                 9
+#define ES_ResourceError_NUM_CLASS_PROP                                10
+
+/**
+ * Instance slots for "ResourceError" type 
+ */
+#define ES_ResourceError_NUM_INSTANCE_PROP                             0
+
+/**
+ * 
+ *    Local slots for methods in type ResourceError 
+ */
+#define ES_ResourceError_ResourceError_message                         0
+
+
+/**
+ *   Class property slots for the "StateError" class 
+ */
+#define ES_StateError__origin                                          9
+#define ES_StateError_StateError                                       9
+#define ES_StateError_NUM_CLASS_PROP                                   10
+
+/**
+ * Instance slots for "StateError" type 
+ */
+#define ES_StateError_NUM_INSTANCE_PROP                                0
+
+/**
+ * 
+ *    Local slots for methods in type StateError 
+ */
+#define ES_StateError_StateError_message                               0
+
+
+/**
+ *   Class property slots for the "SyntaxError" class 
+ */
+#define ES_SyntaxError__origin                                         9
+#define ES_SyntaxError_SyntaxError                                     9
+#define ES_SyntaxError_NUM_CLASS_PROP                                  10
+
+/**
+ * Instance slots for "SyntaxError" type 
+ */
+#define ES_SyntaxError_NUM_INSTANCE_PROP                               0
+
+/**
+ * 
+ *    Local slots for methods in type SyntaxError 
+ */
+#define ES_SyntaxError_SyntaxError_message                             0
+
+
+/**
+ *   Class property slots for the "TypeError" class 
+ */
+#define ES_TypeError__origin                                           9
+#define ES_TypeError_TypeError                                         9
+#define ES_TypeError_NUM_CLASS_PROP                                    10
+
+/**
+ * Instance slots for "TypeError" type 
+ */
+#define ES_TypeError_NUM_INSTANCE_PROP                                 0
+
+/**
+ * 
+ *    Local slots for methods in type TypeError 
+ */
+#define ES_TypeError_TypeError_message                                 0
+
+
+/**
+ *   Class property slots for the "URIError" class 
+ */
+#define ES_URIError__origin                                            9
+#define ES_URIError_URIError                                           9
+#define ES_URIError_NUM_CLASS_PROP                                     10
+
+/**
+ * Instance slots for "URIError" type 
+ */
+#define ES_URIError_NUM_INSTANCE_PROP                                  0
+
+/**
+ * 
+ *    Local slots for methods in type URIError 
+ */
+#define ES_URIError_URIError_message                                   0
+
+
+/**
+ *   Class property slots for the "Function" class 
+ */
+#define ES_Function__origin                                            6
+#define ES_Function_apply                                              6
+#define ES_Function_call                                               7
+#define ES_Function_NUM_CLASS_PROP                                     8
+
+/**
+ * Instance slots for "Function" type 
+ */
+#define ES_Function_NUM_INSTANCE_PROP                                  0
+
+/**
+ * 
+ *    Local slots for methods in type Function 
+ */
+#define ES_Function_apply_thisObject                                   0
+#define ES_Function_apply_args                                         1
+#define ES_Function_call_thisObject                                    0
+#define ES_Function_call_args                                          1
+
+
+/**
+ *   Class property slots for the "StopIteration" class 
+ */
+#define ES_StopIteration__origin                                       6
+#define ES_StopIteration_NUM_CLASS_PROP                                6
+
+/**
+ * Instance slots for "StopIteration" type 
+ */
+#define ES_StopIteration_NUM_INSTANCE_PROP                             0
+
+
+/**
+ *   Class property slots for the "Iterable" class 
+ */
+#define ES_Iterable__origin                                            0
+#define ES_Iterable_get                                                0
+#define ES_Iterable_getValues                                          1
+#define ES_Iterable_NUM_CLASS_PROP                                     2
+
+/**
+ * Instance slots for "Iterable" type 
+ */
+#define ES_Iterable_NUM_INSTANCE_PROP                                  0
+
+
+/**
+ *   Class property slots for the "Iterator" class 
+ */
+#define ES_Iterator__origin                                            6
+#define ES_Iterator_next                                               6
+#define ES_Iterator_NUM_CLASS_PROP                                     7
+
+/**
+ * Instance slots for "Iterator" type 
+ */
+#define ES_Iterator_NUM_INSTANCE_PROP                                  0
+
+
+/**
+ *   Class property slots for the "JSON" class 
+ */
+#define ES_JSON__origin                                                6
+#define ES_JSON_parse                                                  6
+#define ES_JSON_stringify                                              7
+#define ES_JSON_NUM_CLASS_PROP                                         8
+
+/**
+ * Instance slots for "JSON" type 
+ */
+#define ES_JSON_NUM_INSTANCE_PROP                                      0
+
+/**
+ * 
+ *    Local slots for methods in type JSON 
+ */
+#define ES_JSON_parse_data                                             0
+#define ES_JSON_parse_filter                                           1
+#define ES_JSON_stringify_obj                                          0
+#define ES_JSON_stringify_replacer                                     1
+#define ES_JSON_stringify_indent                                       2
+
+
+/**
+ *   Class property slots for the "Math" class 
+ */
+#define ES_Math__origin                                                6
+#define ES_Math__initializer__Math_initializer                         6
+#define ES_Math_E                                                      7
+#define ES_Math_LN2                                                    8
+#define ES_Math_LN10                                                   9
+#define ES_Math_LOG2E                                                  10
+#define ES_Math_LOG10E                                                 11
+#define ES_Math_PI                                                     12
+#define ES_Math_SQRT1_2                                                13
+#define ES_Math_SQRT2                                                  14
+#define ES_Math_abs                                                    15
+#define ES_Math_acos                                                   16
+#define ES_Math_asin                                                   17
+#define ES_Math_atan                                                   18
+#define ES_Math_atan2                                                  19
+#define ES_Math_ceil                                                   20
+#define ES_Math_cos                                                    21
+#define ES_Math_exp                                                    22
+#define ES_Math_floor                                                  23
+#define ES_Math_log10                                                  24
+#define ES_Math_log                                                    25
+#define ES_Math_max                                                    26
+#define ES_Math_min                                                    27
+#define ES_Math_pow                                                    28
+#define ES_Math_random                                                 29
+#define ES_Math_round                                                  30
+#define ES_Math_sin                                                    31
+#define ES_Math_sqrt                                                   32
+#define ES_Math_tan                                                    33
+#define ES_Math_NUM_CLASS_PROP                                         34
+
+/**
+ * Instance slots for "Math" type 
+ */
+#define ES_Math_NUM_INSTANCE_PROP                                      0
+
+/**
+ * 
+ *    Local slots for methods in type Math 
+ */
+#define ES_Math_abs_value                                              0
+#define ES_Math_acos_angle                                             0
+#define ES_Math_asin_oper                                              0
+#define ES_Math_atan_oper                                              0
+#define ES_Math_atan2_y                                                0
+#define ES_Math_atan2_x                                                1
+#define ES_Math_ceil_oper                                              0
+#define ES_Math_cos_angle                                              0
+#define ES_Math_exp_power                                              0
+#define ES_Math_floor_oper                                             0
+#define ES_Math_log10_oper                                             0
+#define ES_Math_log_oper                                               0
+#define ES_Math_max_x                                                  0
+#define ES_Math_max_y                                                  1
+#define ES_Math_min_x                                                  0
+#define ES_Math_min_y                                                  1
+#define ES_Math_pow_num                                                0
+#define ES_Math_pow_pow                                                1
+#define ES_Math_round_num                                              0
+#define ES_Math_sin_angle                                              0
+#define ES_Math_sqrt_oper                                              0
+#define ES_Math_tan_angle                                              0
+
+
+/**
+ *   Class property slots for the "Namespace" class 
+ */
+#define ES_Namespace__origin                                           6
+#define ES_Namespace_NUM_CLASS_PROP                                    6
+
+/**
+ * Instance slots for "Namespace" type 
+ */
+#define ES_Namespace_NUM_INSTANCE_PROP                                 0
+
+
+/**
+ *   Class property slots for the "Null" class 
+ */
+#define ES_Null__origin                                                6
+#define ES_Null_NUM_CLASS_PROP                                         6
+
+/**
+ * Instance slots for "Null" type 
+ */
+#define ES_Null_NUM_INSTANCE_PROP                                      0
+
+
+/**
+ *   Class property slots for the "Number" class 
+ */
+#define ES_Number__origin                                              6
+#define ES_Number_Number                                               6
+#define ES_Number__initializer__Number_initializer                     7
+#define ES_Number_MAX_VALUE                                            8
+#define ES_Number_MIN_VALUE                                            9
+#define ES_Number_NaN                                                  10
+#define ES_Number_NEGATIVE_INFINITY                                    11
+#define ES_Number_POSITIVE_INFINITY                                    12
+#define ES_Number_MaxValue                                             13
+#define ES_Number_MinValue                                             14
+#define ES_Number_abs                                                  15
+#define ES_Number_ceil                                                 16
+#define ES_Number_floor                                                17
+#define ES_Number_isFinite                                             18
+#define ES_Number_isNaN                                                19
+#define ES_Number_round                                                20
+#define ES_Number_toExponential                                        21
+#define ES_Number_toFixed                                              22
+#define ES_Number_toPrecision                                          23
+#define ES_Number_byte                                                 24
+#define ES_Number_integral                                             25
+#define ES_Number_max                                                  26
+#define ES_Number_min                                                  27
+#define ES_Number_power                                                28
+#define ES_Number_NUM_CLASS_PROP                                       29
+
+/**
+ * Instance slots for "Number" type 
+ */
+#define ES_Number_NUM_INSTANCE_PROP                                    0
+
+/**
+ * 
+ *    Local slots for methods in type Number 
+ */
+#define ES_Number_Number_value                                         0
+#define ES_Number_toExponential_fractionDigits                         0
+#define ES_Number_toFixed_fractionDigits                               0
+#define ES_Number_toPrecision_numDigits                                0
+#define ES_Number_integral_size                                        0
+#define ES_Number_max_other                                            0
+#define ES_Number_max_result                                           1
+#define ES_Number_max__hoisted_2_n                                     2
+#define ES_Number_min_other                                            0
+#define ES_Number_min_result                                           1
+#define ES_Number_min__hoisted_2_n                                     2
+#define ES_Number_power_nth                                            0
+
+
+/**
+ *   Class property slots for the "Object" class 
+ */
+#define ES_Object__origin                                              0
+#define ES_Object_clone                                                0
+#define ES_Object_get                                                  1
+#define ES_Object_getValues                                            2
+#define ES_Object_length                                               3
+#define ES_Object_toJSON                                               4
+#define ES_Object_toString                                             5
+#define ES_Object_NUM_CLASS_PROP                                       6
+
+/**
+ * Instance slots for "Object" type 
+ */
+#define ES_Object_NUM_INSTANCE_PROP                                    0
+
+/**
+ * 
+ *    Local slots for methods in type Object 
+ */
+#define ES_Object_clone_deep                                           0
+
+
+/**
+ *   Class property slots for the "Reflect" class 
+ */
+#define ES_Reflect__origin                                             6
+#define ES_Reflect_Reflect                                             6
+#define ES_Reflect_name                                                7
+#define ES_Reflect_type                                                8
+#define ES_Reflect_typeName                                            9
+#define ES_Reflect_NUM_CLASS_PROP                                      10
+
+/**
+ * Instance slots for "Reflect" type 
+ */
+#define ES_Reflect_obj                                                 0
+#define ES_Reflect_NUM_INSTANCE_PROP                                   1
+
+/**
+ * 
+ *    Local slots for methods in type Reflect 
+ */
+#define ES_Reflect_Reflect_obj                                         0
+
+
+/**
+ *   Class property slots for the "RegExp" class 
+ */
+#define ES_RegExp__origin                                              6
+#define ES_RegExp_RegExp                                               6
+#define ES_RegExp_cache                                                7
+#define ES_RegExp_lastIndex                                            8
+#define ES_RegExp_set_lastIndex                                        9
+#define ES_RegExp_exec                                                 10
+#define ES_RegExp_global                                               11
+#define ES_RegExp_ignoreCase                                           12
+#define ES_RegExp_multiline                                            13
+#define ES_RegExp_setCacheLimit                                        14
+#define ES_RegExp_source                                               15
+#define ES_RegExp_matched                                              16
+#define ES_RegExp_replace                                              17
+#define ES_RegExp_split                                                18
+#define ES_RegExp_start                                                19
+#define ES_RegExp_sticky                                               20
+#define ES_RegExp_test                                                 21
+#define ES_RegExp_NUM_CLASS_PROP                                       22
+
+/**
+ * Instance slots for "RegExp" type 
+ */
+#define ES_RegExp_NUM_INSTANCE_PROP                                    0
+
+/**
+ * 
+ *    Local slots for methods in type RegExp 
+ */
+#define ES_RegExp_RegExp_pattern                                       0
+#define ES_RegExp_RegExp_flags                                         1
+#define ES_RegExp_set_lastIndex_value                                  0
+#define ES_RegExp_exec_str                                             0
+#define ES_RegExp_exec_start                                           1
+#define ES_RegExp_setCacheLimit_max                                    0
+#define ES_RegExp_replace_str                                          0
+#define ES_RegExp_replace_replacement                                  1
+#define ES_RegExp_split_target                                         0
+#define ES_RegExp_test_str                                             0
+
+
+/**
+ *   Class property slots for the "Stream" class 
+ */
+#define ES_Stream__origin                                              0
+#define ES_Stream_close                                                0
+#define ES_Stream_flush                                                1
+#define ES_Stream_read                                                 2
+#define ES_Stream_write                                                3
+#define ES_Stream_NUM_CLASS_PROP                                       4
+
+/**
+ * Instance slots for "Stream" type 
+ */
+#define ES_Stream_NUM_INSTANCE_PROP                                    0
+
+/**
+ * 
+ *    Local slots for methods in type Stream 
+ */
+#define ES_Stream_close_graceful                                       0
+#define ES_Stream_flush_graceful                                       0
+#define ES_Stream_read_buffer                                          0
+#define ES_Stream_read_offset                                          1
+#define ES_Stream_read_count                                           2
+#define ES_Stream_write_data                                           0
+
+
+/**
+ *   Class property slots for the "String" class 
+ */
+#define ES_String__origin                                              6
+#define ES_String_String                                               6
+#define ES_String_caseCompare                                          7
+#define ES_String_charAt                                               8
+#define ES_String_charCodeAt                                           9
+#define ES_String_concat                                               10
+#define ES_String_contains                                             11
+#define ES_String_endsWith                                             12
+#define ES_String_format                                               13
+#define ES_String_fromCharCode                                         14
+#define ES_String_indexOf                                              15
+#define ES_String_isDigit                                              16
+#define ES_String_isAlpha                                              17
+#define ES_String_isLower                                              18
+#define ES_String_isSpace                                              19
+#define ES_String_isUpper                                              20
+#define ES_String_lastIndexOf                                          21
+#define ES_String_match                                                22
+#define ES_String_parseJSON                                            23
+#define ES_String_toCamel                                              24
+#define ES_String_toPascal                                             25
+#define ES_String_printable                                            26
+#define ES_String_quote                                                27
+#define ES_String_remove                                               28
+#define ES_String_replace                                              29
+#define ES_String_reverse                                              30
+#define ES_String_search                                               31
+#define ES_String_slice                                                32
+#define ES_String_split                                                33
+#define ES_String_startsWith                                           34
+#define ES_String_substring                                            35
+#define ES_String_times                                                36
+#define ES_String_tokenize                                             37
+#define ES_String_toLower                                              38
+#define ES_String_toUpper                                              39
+#define ES_String_trim                                                 40
+#define ES_String_MINUS                                                41
+#define ES_String_MOD                                                  42
+#define ES_String_NUM_CLASS_PROP                                       43
+
+/**
+ * Instance slots for "String" type 
+ */
+#define ES_String_NUM_INSTANCE_PROP                                    0
+
+/**
+ * 
+ *    Local slots for methods in type String 
+ */
+#define ES_String_String_str                                           0
+#define ES_String_caseCompare_compare                                  0
+#define ES_String_charAt_index                                         0
+#define ES_String_charCodeAt_index                                     0
+#define ES_String_concat_args                                          0
+#define ES_String_contains_pattern                                     0
+#define ES_String_endsWith_test                                        0
+#define ES_String_format_args                                          0
+#define ES_String_fromCharCode_codes                                   0
+#define ES_String_indexOf_pattern                                      0
+#define ES_String_indexOf_startIndex                                   1
+#define ES_String_lastIndexOf_pattern                                  0
+#define ES_String_lastIndexOf_location                                 1
+#define ES_String_match_pattern                                        0
+#define ES_String_parseJSON_filter                                     0
+#define ES_String_remove_start                                         0
+#define ES_String_remove_end                                           1
+#define ES_String_replace_pattern                                      0
+#define ES_String_replace_replacement                                  1
+#define ES_String_search_pattern                                       0
+#define ES_String_slice_start                                          0
+#define ES_String_slice_end                                            1
+#define ES_String_slice_step                                           2
+#define ES_String_split_delimiter                                      0
+#define ES_String_split_limit                                          1
+#define ES_String_startsWith_test                                      0
+#define ES_String_substring_startIndex                                 0
+#define ES_String_substring_end                                        1
+#define ES_String_times_times                                          0
+#define ES_String_times_s                                              1
+#define ES_String_times__hoisted_2_i                                   2
+#define ES_String_tokenize_format                                      0
+#define ES_String_trim_str                                             0
+#define ES_String_MINUS_str                                            0
+#define ES_String_MINUS_i                                              1
+#define ES_String_MOD_arg                                              0
+
+
+/**
+ *   Class property slots for the "Type" class 
+ */
+#define ES_Type__origin                                                6
+#define ES_Type_NUM_CLASS_PROP                                         6
+
+/**
+ * Instance slots for "Type" type 
+ */
+#define ES_Type_NUM_INSTANCE_PROP                                      0
+
+
+/**
+ *   Class property slots for the "Void" class 
+ */
+#define ES_Void__origin                                                6
+#define ES_Void_NUM_CLASS_PROP                                         6
+
+/**
+ * Instance slots for "Void" type 
+ */
+#define ES_Void_NUM_INSTANCE_PROP                                      0
+
+
+/**
+ *   Class property slots for the "XML" class 
+ */
+#define ES_XML__origin                                                 6
+#define ES_XML_XML                                                     6
+#define ES_XML__initializer__XML_initializer                           7
+#define ES_XML_load                                                    8
+#define ES_XML_save                                                    9
+#define ES_XML_attribute                                               10
+#define ES_XML_attributes                                              11
+#define ES_XML_elements                                                12
+#define ES_XML_name                                                    13
+#define ES_XML_parent                                                  14
+#define ES_XML_NUM_CLASS_PROP                                          15
+
+/**
+ * Instance slots for "XML" type 
+ */
+#define ES_XML_NUM_INSTANCE_PROP                                       0
+
+/**
+ * 
+ *    Local slots for methods in type XML 
+ */
+#define ES_XML_XML_value                                               0
+#define ES_XML_load_filename                                           0
+#define ES_XML_save_filename                                           0
+#define ES_XML_attribute_name                                          0
+#define ES_XML_elements_name                                           0
+
+
+/**
+ *   Class property slots for the "XMLList" class 
+ */
+#define ES_XMLList__origin                                             6
+#define ES_XMLList_XMLList                                             6
+#define ES_XMLList_attribute                                           7
+#define ES_XMLList_attributes                                          8
+#define ES_XMLList_elements                                            9
+#define ES_XMLList_name                                                10
+#define ES_XMLList_parent                                              11
+#define ES_XMLList_NUM_CLASS_PROP                                      12
+
+/**
+ * Instance slots for "XMLList" type 
+ */
+#define ES_XMLList_NUM_INSTANCE_PROP                                   0
+
+/**
+ * 
+ *    Local slots for methods in type XMLList 
+ */
+#define ES_XMLList_attribute_name                                      0
+#define ES_XMLList_elements_name                                       0
+
+#define _ES_CHECKSUM_ejs 487043
+
+#endif
+/*
+ * null -- Property slot definitions for the "ejs.unix" module
+ *
+ * This file is generated by ec
+ *
+ * Slot definitions. Version 3.3.2.
+ */
+
+#ifndef _h_SLOTS_EjsUnixSlots
+#define _h_SLOTS_EjsUnixSlots 1
+
+
+/**
+ * Slots for the "ejs.unix" module 
+ */
+
+
+/**
+ *   Class property slots for the "global" class 
+ */
+
+/**
+ * Instance slots for "global" type 
+ */
+
+/**
+ * 
+ *    Local slots for methods in type global 
+ */
+
+#define _ES_CHECKSUM_ejs_unix 820
+
+#endif
+/*
+ * null -- Property slot definitions for the "ejs.db" module
+ *
+ * This file is generated by ec
+ *
+ * Slot definitions. Version 3.3.2.
+ */
+
+#ifndef _h_SLOTS_EjsDbSlots
+#define _h_SLOTS_EjsDbSlots 1
+
+
+/**
+ * Slots for the "ejs.db" module 
+ */
+
+
+/**
+ *   Class property slots for the "global" class 
+ */
+
+/**
+ * Instance slots for "global" type 
+ */
+
+/**
+ * 
+ *    Local slots for methods in type global 
+ */
+
+
+/**
+ *   Class property slots for the "Database" class 
+ */
+#define ES_ejs_db_Database__origin                                     6
+#define ES_ejs_db_Database_Database                                    6
+#define ES_ejs_db_Database_addColumn                                   7
+#define ES_ejs_db_Database_addIndex                                    8
+#define ES_ejs_db_Database_changeColumn                                9
+#define ES_ejs_db_Database_close                                       10
+#define ES_ejs_db_Database_commit                                      11
+#define ES_ejs_db_Database_connect                                     12
+#define ES_ejs_db_Database_connection                                  13
+#define ES_ejs_db_Database_createDatabase                              14
+#define ES_ejs_db_Database_createTable                                 15
+#define ES_ejs_db_Database_dataTypeToSqlType                           16
+#define ES_ejs_db_Database_defaultDatabase                             17
+#define ES_ejs_db_Database_set_defaultDatabase                         18
+#define ES_ejs_db_Database_destroyDatabase                             19
+#define ES_ejs_db_Database_destroyTable                                20
+#define ES_ejs_db_Database_endTransaction                              21
+#define ES_ejs_db_Database_getColumns                                  22
+#define ES_ejs_db_Database_getTables                                   23
+#define ES_ejs_db_Database_getNumRows                                  24
+#define ES_ejs_db_Database_name                                        25
+#define ES_ejs_db_Database_query                                       26
+#define ES_ejs_db_Database_removeColumns                               27
+#define ES_ejs_db_Database_removeIndex                                 28
+#define ES_ejs_db_Database_renameColumn                                29
+#define ES_ejs_db_Database_renameTable                                 30
+#define ES_ejs_db_Database_rollback                                    31
+#define ES_ejs_db_Database_sql                                         32
+#define ES_ejs_db_Database_sqlTypeToDataType                           33
+#define ES_ejs_db_Database_sqlTypeToEjsType                            34
+#define ES_ejs_db_Database_startTransaction                            35
+#define ES_ejs_db_Database_trace                                       36
+#define ES_ejs_db_Database_transaction                                 37
+#define ES_ejs_db_Database_quote                                       38
+#define ES_ejs_db_Database_NUM_CLASS_PROP                              39
+
+/**
+ * Instance slots for "Database" type 
+ */
+#define ES_ejs_db_Database__adapter                                    0
+#define ES_ejs_db_Database__connection                                 1
+#define ES_ejs_db_Database__name                                       2
+#define ES_ejs_db_Database__traceAll                                   3
+#define ES_ejs_db_Database_NUM_INSTANCE_PROP                           4
+
+/**
+ * 
+ *    Local slots for methods in type Database 
+ */
+#define ES_ejs_db_Database_Database_adapter                            0
+#define ES_ejs_db_Database_Database_connectionString                   1
+#define ES_ejs_db_Database_Database_adapterClass                       2
+#define ES_ejs_db_Database_addColumn_table                             0
+#define ES_ejs_db_Database_addColumn_column                            1
+#define ES_ejs_db_Database_addColumn_datatype                          2
+#define ES_ejs_db_Database_addColumn_options                           3
+#define ES_ejs_db_Database_addIndex_table                              0
+#define ES_ejs_db_Database_addIndex_column                             1
+#define ES_ejs_db_Database_addIndex_index                              2
+#define ES_ejs_db_Database_changeColumn_table                          0
+#define ES_ejs_db_Database_changeColumn_column                         1
+#define ES_ejs_db_Database_changeColumn_datatype                       2
+#define ES_ejs_db_Database_changeColumn_options                        3
+#define ES_ejs_db_Database_connect_connectionString                    0
+#define ES_ejs_db_Database_createDatabase_name                         0
+#define ES_ejs_db_Database_createDatabase_options                      1
+#define ES_ejs_db_Database_createTable_table                           0
+#define ES_ejs_db_Database_createTable_columns                         1
+#define ES_ejs_db_Database_dataTypeToSqlType_dataType                  0
+#define ES_ejs_db_Database_set_defaultDatabase_db                      0
+#define ES_ejs_db_Database_destroyDatabase_name                        0
+#define ES_ejs_db_Database_destroyTable_table                          0
+#define ES_ejs_db_Database_getColumns_table                            0
+#define ES_ejs_db_Database_getNumRows_table                            0
+#define ES_ejs_db_Database_query_cmd                                   0
+#define ES_ejs_db_Database_query_tag                                   1
+#define ES_ejs_db_Database_query_trace                                 2
+#define ES_ejs_db_Database_removeColumns_table                         0
+#define ES_ejs_db_Database_removeColumns_columns                       1
+#define ES_ejs_db_Database_removeIndex_table                           0
+#define ES_ejs_db_Database_removeIndex_index                           1
+#define ES_ejs_db_Database_renameColumn_table                          0
+#define ES_ejs_db_Database_renameColumn_oldColumn                      1
+#define ES_ejs_db_Database_renameColumn_newColumn                      2
+#define ES_ejs_db_Database_renameTable_oldTable                        0
+#define ES_ejs_db_Database_renameTable_newTable                        1
+#define ES_ejs_db_Database_sql_cmd                                     0
+#define ES_ejs_db_Database_sql_params                                  1
+#define ES_ejs_db_Database_sqlTypeToDataType_sqlType                   0
+#define ES_ejs_db_Database_sqlTypeToEjsType_sqlType                    0
+#define ES_ejs_db_Database_trace_on                                    0
+#define ES_ejs_db_Database_transaction_code                            0
+#define ES_ejs_db_Database_transaction__hoisted_1_e                    1
+#define ES_ejs_db_Database_quote_str                                   0
+
+
+/**
+ *   Class property slots for the "DatabaseConnector" class 
+ */
+#define ES_ejs_db_DatabaseConnector__origin                            0
+#define ES_ejs_db_DatabaseConnector_addColumn                          0
+#define ES_ejs_db_DatabaseConnector_addIndex                           1
+#define ES_ejs_db_DatabaseConnector_changeColumn                       2
+#define ES_ejs_db_DatabaseConnector_close                              3
+#define ES_ejs_db_DatabaseConnector_commit                             4
+#define ES_ejs_db_DatabaseConnector_connect                            5
+#define ES_ejs_db_DatabaseConnector_createDatabase                     6
+#define ES_ejs_db_DatabaseConnector_createTable                        7
+#define ES_ejs_db_DatabaseConnector_dataTypeToSqlType                  8
+#define ES_ejs_db_DatabaseConnector_destroyDatabase                    9
+#define ES_ejs_db_DatabaseConnector_destroyTable                       10
+#define ES_ejs_db_DatabaseConnector_getColumns                         11
+#define ES_ejs_db_DatabaseConnector_getTables                          12
+#define ES_ejs_db_DatabaseConnector_removeColumns                      13
+#define ES_ejs_db_DatabaseConnector_removeIndex                        14
+#define ES_ejs_db_DatabaseConnector_renameColumn                       15
+#define ES_ejs_db_DatabaseConnector_renameTable                        16
+#define ES_ejs_db_DatabaseConnector_rollback                           17
+#define ES_ejs_db_DatabaseConnector_sql                                18
+#define ES_ejs_db_DatabaseConnector_sqlTypeToDataType                  19
+#define ES_ejs_db_DatabaseConnector_sqlTypeToEjsType                   20
+#define ES_ejs_db_DatabaseConnector_startTransaction                   21
+#define ES_ejs_db_DatabaseConnector_NUM_CLASS_PROP                     22
+
+/**
+ * Instance slots for "DatabaseConnector" type 
+ */
+#define ES_ejs_db_DatabaseConnector_NUM_INSTANCE_PROP                  0
+
+/**
+ * 
+ *    Local slots for methods in type DatabaseConnector 
+ */
+#define ES_ejs_db_DatabaseConnector_addColumn_table                    0
+#define ES_ejs_db_DatabaseConnector_addColumn_column                   1
+#define ES_ejs_db_DatabaseConnector_addColumn_datatype                 2
+#define ES_ejs_db_DatabaseConnector_addColumn_options                  3
+#define ES_ejs_db_DatabaseConnector_addIndex_table                     0
+#define ES_ejs_db_DatabaseConnector_addIndex_column                    1
+#define ES_ejs_db_DatabaseConnector_addIndex_index                     2
+#define ES_ejs_db_DatabaseConnector_changeColumn_table                 0
+#define ES_ejs_db_DatabaseConnector_changeColumn_column                1
+#define ES_ejs_db_DatabaseConnector_changeColumn_datatype              2
+#define ES_ejs_db_DatabaseConnector_changeColumn_options               3
+#define ES_ejs_db_DatabaseConnector_connect_connectionString           0
+#define ES_ejs_db_DatabaseConnector_createDatabase_name                0
+#define ES_ejs_db_DatabaseConnector_createDatabase_options             1
+#define ES_ejs_db_DatabaseConnector_createTable_table                  0
+#define ES_ejs_db_DatabaseConnector_createTable_columns                1
+#define ES_ejs_db_DatabaseConnector_dataTypeToSqlType_dataType         0
+#define ES_ejs_db_DatabaseConnector_destroyDatabase_name               0
+#define ES_ejs_db_DatabaseConnector_destroyTable_table                 0
+#define ES_ejs_db_DatabaseConnector_getColumns_table                   0
+#define ES_ejs_db_DatabaseConnector_removeColumns_table                0
+#define ES_ejs_db_DatabaseConnector_removeColumns_columns              1
+#define ES_ejs_db_DatabaseConnector_removeIndex_table                  0
+#define ES_ejs_db_DatabaseConnector_removeIndex_index                  1
+#define ES_ejs_db_DatabaseConnector_renameColumn_table                 0
+#define ES_ejs_db_DatabaseConnector_renameColumn_oldColumn             1
+#define ES_ejs_db_DatabaseConnector_renameColumn_newColumn             2
+#define ES_ejs_db_DatabaseConnector_renameTable_oldTable               0
+#define ES_ejs_db_DatabaseConnector_renameTable_newTable               1
+#define ES_ejs_db_DatabaseConnector_sql_cmd                            0
+#define ES_ejs_db_DatabaseConnector_sql_params                         1
+#define ES_ejs_db_DatabaseConnector_sqlTypeToDataType_sqlType          0
+#define ES_ejs_db_DatabaseConnector_sqlTypeToEjsType_sqlType           0
+
+
+/**
+ *   Class property slots for the "Record" class 
+ */
+#define ES_ejs_db_Record__origin                                       6
+#define ES_ejs_db_Record_Record                                        6
+#define ES_ejs_db_Record__initializer__Record_initializer              7
+#define ES_ejs_db_Record_ejs_db_int__assocName                         8
+#define ES_ejs_db_Record_ejs_db_int__belongsTo                         9
+#define ES_ejs_db_Record_ejs_db_int__className                         10
+#define ES_ejs_db_Record_ejs_db_int__columns                           11
+#define ES_ejs_db_Record_ejs_db_int__hasOne                            12
+#define ES_ejs_db_Record_ejs_db_int__hasMany                           13
+#define ES_ejs_db_Record_ejs_db_int__db                                14
+#define ES_ejs_db_Record_ejs_db_int__foreignId                         15
+#define ES_ejs_db_Record_ejs_db_int__keyName                           16
+#define ES_ejs_db_Record_ejs_db_int__tableName                         17
+#define ES_ejs_db_Record_ejs_db_int__trace                             18
+#define ES_ejs_db_Record_ejs_db_int__validations                       19
+#define ES_ejs_db_Record_ejs_db_int__beforeFilters                     20
+#define ES_ejs_db_Record_ejs_db_int__afterFilters                      21
+#define ES_ejs_db_Record_ejs_db_int__wrapFilters                       22
+#define ES_ejs_db_Record_ejs_db_ErrorMessages                          23
+#define ES_ejs_db_Record_ejs_db_initialize                             24
+#define ES_ejs_db_Record_ejs_db_afterFilter                            25
+#define ES_ejs_db_Record_ejs_db_beforeFilter                           26
+#define ES_ejs_db_Record_ejs_db_belongsTo                              27
+#define ES_ejs_db_Record_cachedRead                                    28
+#define ES_ejs_db_Record_checkFormat                                   29
+#define ES_ejs_db_Record_checkNumber                                   30
+#define ES_ejs_db_Record_checkPresent                                  31
+#define ES_ejs_db_Record_checkUnique                                   32
+#define ES_ejs_db_Record_coerceToEjsTypes                              33
+#define ES_ejs_db_Record_createAssociations                            34
+#define ES_ejs_db_Record_createRecord                                  35
+#define ES_ejs_db_Record_ejs_db_error                                  36
+#define ES_ejs_db_Record_ejs_db_find                                   37
+#define ES_ejs_db_Record_ejs_db_findAll                                38
+#define ES_ejs_db_Record_ejs_db_findOneWhere                           39
+#define ES_ejs_db_Record_ejs_db_findWhere                              40
+#define ES_ejs_db_Record_ejs_db_getColumnNames                         41
+#define ES_ejs_db_Record_ejs_db_getColumnTitles                        42
+#define ES_ejs_db_Record_ejs_db_getColumnType                          43
+#define ES_ejs_db_Record_ejs_db_getDb                                  44
+#define ES_ejs_db_Record_ejs_db_getErrors                              45
+#define ES_ejs_db_Record_ejs_db_getKeyName                             46
+#define ES_ejs_db_Record_ejs_db_getNumRows                             47
+#define ES_ejs_db_Record_getSchema                                     48
+#define ES_ejs_db_Record_ejs_db_getTableName                           49
+#define ES_ejs_db_Record_ejs_db_hasAndBelongsToMany                    50
+#define ES_ejs_db_Record_ejs_db_hasError                               51
+#define ES_ejs_db_Record_ejs_db_hasMany                                52
+#define ES_ejs_db_Record_ejs_db_hasOne                                 53
+#define ES_ejs_db_Record_innerFind                                     54
+#define ES_ejs_db_Record_makeLazyReader                                55
+#define ES_ejs_db_Record_mapSqlTypeToEjs                               56
+#define ES_ejs_db_Record_prepareValue                                  57
+#define ES_ejs_db_Record_readRecords                                   58
+#define ES_ejs_db_Record_ejs_db_remove                                 59
+#define ES_ejs_db_Record_runFilters                                    60
+#define ES_ejs_db_Record_ejs_db_save                                   61
+#define ES_ejs_db_Record_ejs_db_saveUpdate                             62
+#define ES_ejs_db_Record_ejs_db_setDb                                  63
+#define ES_ejs_db_Record_ejs_db_setKeyName                             64
+#define ES_ejs_db_Record_ejs_db_setTableName                           65
+#define ES_ejs_db_Record_ejs_db_sql                                    66
+#define ES_ejs_db_Record_ejs_db_trace                                  67
+#define ES_ejs_db_Record_ejs_db_validateFormat                         68
+#define ES_ejs_db_Record_ejs_db_validateNumber                         69
+#define ES_ejs_db_Record_ejs_db_validatePresence                       70
+#define ES_ejs_db_Record_ejs_db_validateRecord                         71
+#define ES_ejs_db_Record_ejs_db_validateUnique                         72
+#define ES_ejs_db_Record_ejs_db_wrapFilter                             73
+#define ES_ejs_db_Record_ejs_db_columnNames                            74
+#define ES_ejs_db_Record_ejs_db_columnTitles                           75
+#define ES_ejs_db_Record_ejs_db_db                                     76
+#define ES_ejs_db_Record_ejs_db_keyName                                77
+#define ES_ejs_db_Record_ejs_db_numRows                                78
+#define ES_ejs_db_Record_ejs_db_tableName                              79
+#define ES_ejs_db_Record_ejs_db_constructor                            80
+#define ES_ejs_db_Record_NUM_CLASS_PROP                                81
+
+/**
+ * Instance slots for "Record" type 
+ */
+#define ES_ejs_db_Record_ejs_db_int__keyValue                          0
+#define ES_ejs_db_Record_ejs_db_int__errors                            1
+#define ES_ejs_db_Record_ejs_db_int__cacheAssoc                        2
+#define ES_ejs_db_Record_NUM_INSTANCE_PROP                             3
+
+/**
+ * 
+ *    Local slots for methods in type Record 
+ */
+#define ES_ejs_db_Record_Record_fields                                 0
+#define ES_ejs_db_Record_ejs_db_initialize_fields                      0
+#define ES_ejs_db_Record_ejs_db_initialize__hoisted_1_field            1
+#define ES_ejs_db_Record_ejs_db_afterFilter_fn                         0
+#define ES_ejs_db_Record_ejs_db_afterFilter_options                    1
+#define ES_ejs_db_Record_ejs_db_beforeFilter_fn                        0
+#define ES_ejs_db_Record_ejs_db_beforeFilter_options                   1
+#define ES_ejs_db_Record_ejs_db_belongsTo_owner                        0
+#define ES_ejs_db_Record_ejs_db_belongsTo_options                      1
+#define ES_ejs_db_Record_cachedRead_rec                                0
+#define ES_ejs_db_Record_cachedRead_field                              1
+#define ES_ejs_db_Record_cachedRead_model                              2
+#define ES_ejs_db_Record_cachedRead_key                                3
+#define ES_ejs_db_Record_cachedRead_options                            4
+#define ES_ejs_db_Record_checkFormat_thisObj                           0
+#define ES_ejs_db_Record_checkFormat_field                             1
+#define ES_ejs_db_Record_checkFormat_value                             2
+#define ES_ejs_db_Record_checkFormat_options                           3
+#define ES_ejs_db_Record_checkNumber_thisObj                           0
+#define ES_ejs_db_Record_checkNumber_field                             1
+#define ES_ejs_db_Record_checkNumber_value                             2
+#define ES_ejs_db_Record_checkNumber_options                           3
+#define ES_ejs_db_Record_checkPresent_thisObj                          0
+#define ES_ejs_db_Record_checkPresent_field                            1
+#define ES_ejs_db_Record_checkPresent_value                            2
+#define ES_ejs_db_Record_checkPresent_options                          3
+#define ES_ejs_db_Record_checkUnique_thisObj                           0
+#define ES_ejs_db_Record_checkUnique_field                             1
+#define ES_ejs_db_Record_checkUnique_value                             2
+#define ES_ejs_db_Record_checkUnique_options                           3
+#define ES_ejs_db_Record_checkUnique_grid                              4
+#define ES_ejs_db_Record_coerceToEjsTypes__hoisted_0_field             0
+#define ES_ejs_db_Record_coerceToEjsTypes__hoisted_1_col               1
+#define ES_ejs_db_Record_coerceToEjsTypes__hoisted_2_value             2
+#define ES_ejs_db_Record_createAssociations_rec                        0
+#define ES_ejs_db_Record_createAssociations_set                        1
+#define ES_ejs_db_Record_createAssociations_preload                    2
+#define ES_ejs_db_Record_createAssociations_options                    3
+#define ES_ejs_db_Record_createAssociations__hoisted_4_model           4
+#define ES_ejs_db_Record_createAssociations__hoisted_5_association     5
+#define ES_ejs_db_Record_createAssociations__hoisted_6_field           6
+#define ES_ejs_db_Record_createAssociations__hoisted_7_f               7
+#define ES_ejs_db_Record_createAssociations__hoisted_8_field           8
+#define ES_ejs_db_Record_createAssociations__hoisted_9_f               9
+#define ES_ejs_db_Record_createRecord_data                             0
+#define ES_ejs_db_Record_createRecord_options                          1
+#define ES_ejs_db_Record_createRecord_rec                              2
+#define ES_ejs_db_Record_createRecord_subOptions                       3
+#define ES_ejs_db_Record_createRecord__hoisted_4_model                 4
+#define ES_ejs_db_Record_createRecord__hoisted_5_model                 5
+#define ES_ejs_db_Record_ejs_db_error_field                            0
+#define ES_ejs_db_Record_ejs_db_error_msg                              1
+#define ES_ejs_db_Record_ejs_db_find_key                               0
+#define ES_ejs_db_Record_ejs_db_find_options                           1
+#define ES_ejs_db_Record_ejs_db_find_grid                              2
+#define ES_ejs_db_Record_ejs_db_find__hoisted_3_results                3
+#define ES_ejs_db_Record_ejs_db_findAll_options                        0
+#define ES_ejs_db_Record_ejs_db_findAll_grid                           1
+#define ES_ejs_db_Record_ejs_db_findAll__hoisted_2_i                   2
+#define ES_ejs_db_Record_ejs_db_findOneWhere_where                     0
+#define ES_ejs_db_Record_ejs_db_findOneWhere_grid                      1
+#define ES_ejs_db_Record_ejs_db_findWhere_where                        0
+#define ES_ejs_db_Record_ejs_db_findWhere_count                        1
+#define ES_ejs_db_Record_ejs_db_findWhere_grid                         2
+#define ES_ejs_db_Record_ejs_db_findWhere__hoisted_3_i                 3
+#define ES_ejs_db_Record_ejs_db_getColumnNames_result                  0
+#define ES_ejs_db_Record_ejs_db_getColumnNames__hoisted_1_col          1
+#define ES_ejs_db_Record_ejs_db_getColumnTitles_result                 0
+#define ES_ejs_db_Record_ejs_db_getColumnTitles__hoisted_1_col         1
+#define ES_ejs_db_Record_ejs_db_getColumnType_field                    0
+#define ES_ejs_db_Record_ejs_db_getNumRows_cmd                         0
+#define ES_ejs_db_Record_ejs_db_getNumRows_grid                        1
+#define ES_ejs_db_Record_getSchema_sql                                 0
+#define ES_ejs_db_Record_getSchema_grid                                1
+#define ES_ejs_db_Record_getSchema__hoisted_2_row                      2
+#define ES_ejs_db_Record_getSchema__hoisted_3_name                     3
+#define ES_ejs_db_Record_getSchema__hoisted_4_sqlType                  4
+#define ES_ejs_db_Record_getSchema__hoisted_5_ejsType                  5
+#define ES_ejs_db_Record_ejs_db_hasAndBelongsToMany_model              0
+#define ES_ejs_db_Record_ejs_db_hasAndBelongsToMany_options            1
+#define ES_ejs_db_Record_ejs_db_hasError_field                         0
+#define ES_ejs_db_Record_ejs_db_hasMany_model                          0
+#define ES_ejs_db_Record_ejs_db_hasMany_options                        1
+#define ES_ejs_db_Record_ejs_db_hasOne_model                           0
+#define ES_ejs_db_Record_ejs_db_hasOne_options                         1
+#define ES_ejs_db_Record_innerFind_key                                 0
+#define ES_ejs_db_Record_innerFind_limit                               1
+#define ES_ejs_db_Record_innerFind_options                             2
+#define ES_ejs_db_Record_innerFind_cmd                                 3
+#define ES_ejs_db_Record_innerFind_columns                             4
+#define ES_ejs_db_Record_innerFind_from                                5
+#define ES_ejs_db_Record_innerFind_conditions                          6
+#define ES_ejs_db_Record_innerFind_where                               7
+#define ES_ejs_db_Record_innerFind_results                             8
+#define ES_ejs_db_Record_innerFind__hoisted_9_index                    9
+#define ES_ejs_db_Record_innerFind__hoisted_10_model                   10
+#define ES_ejs_db_Record_innerFind__hoisted_11_entry                   11
+#define ES_ejs_db_Record_innerFind__hoisted_12_owner                   12
+#define ES_ejs_db_Record_innerFind__hoisted_13_owner                   13
+#define ES_ejs_db_Record_innerFind__hoisted_14_tname                   14
+#define ES_ejs_db_Record_innerFind__hoisted_15_parts                   15
+#define ES_ejs_db_Record_innerFind__hoisted_16_whereConditions         16
+#define ES_ejs_db_Record_innerFind__hoisted_17_cond                    17
+#define ES_ejs_db_Record_innerFind__hoisted_18_field                   18
+#define ES_ejs_db_Record_innerFind__hoisted_19_e                       19
+#define ES_ejs_db_Record_makeLazyReader_rec                            0
+#define ES_ejs_db_Record_makeLazyReader_field                          1
+#define ES_ejs_db_Record_makeLazyReader_model                          2
+#define ES_ejs_db_Record_makeLazyReader_key                            3
+#define ES_ejs_db_Record_makeLazyReader_options                        4
+#define ES_ejs_db_Record_makeLazyReader___fun_8205__                   5
+#define ES_ejs_db_Record_makeLazyReader_lazyReader                     6
+#define ES_ejs_db_Record_mapSqlTypeToEjs_sqlType                       0
+#define ES_ejs_db_Record_mapSqlTypeToEjs_ejsType                       1
+#define ES_ejs_db_Record_prepareValue_field                            0
+#define ES_ejs_db_Record_prepareValue_value                            1
+#define ES_ejs_db_Record_prepareValue_col                              2
+#define ES_ejs_db_Record_readRecords_key                               0
+#define ES_ejs_db_Record_readRecords_options                           1
+#define ES_ejs_db_Record_readRecords_data                              2
+#define ES_ejs_db_Record_readRecords__hoisted_3_result                 3
+#define ES_ejs_db_Record_readRecords__hoisted_4_row                    4
+#define ES_ejs_db_Record_ejs_db_remove_keys                            0
+#define ES_ejs_db_Record_ejs_db_remove__hoisted_1_key                  1
+#define ES_ejs_db_Record_ejs_db_remove__hoisted_2_cmd                  2
+#define ES_ejs_db_Record_runFilters_filters                            0
+#define ES_ejs_db_Record_runFilters__hoisted_1_filter                  1
+#define ES_ejs_db_Record_runFilters__hoisted_2_fn                      2
+#define ES_ejs_db_Record_runFilters__hoisted_3_options                 3
+#define ES_ejs_db_Record_runFilters__hoisted_4_only                    4
+#define ES_ejs_db_Record_ejs_db_save_sql                               0
+#define ES_ejs_db_Record_ejs_db_save_result                            1
+#define ES_ejs_db_Record_ejs_db_save__hoisted_2_field                  2
+#define ES_ejs_db_Record_ejs_db_save__hoisted_3_field                  3
+#define ES_ejs_db_Record_ejs_db_save__hoisted_4_field                  4
+#define ES_ejs_db_Record_ejs_db_saveUpdate_fields                      0
+#define ES_ejs_db_Record_ejs_db_saveUpdate__hoisted_1_field            1
+#define ES_ejs_db_Record_ejs_db_setDb_database                         0
+#define ES_ejs_db_Record_ejs_db_setKeyName_name                        0
+#define ES_ejs_db_Record_ejs_db_setTableName_name                      0
+#define ES_ejs_db_Record_ejs_db_sql_cmd                                0
+#define ES_ejs_db_Record_ejs_db_sql_count                              1
+#define ES_ejs_db_Record_ejs_db_trace_on                               0
+#define ES_ejs_db_Record_ejs_db_validateFormat_fields                  0
+#define ES_ejs_db_Record_ejs_db_validateFormat_options                 1
+#define ES_ejs_db_Record_ejs_db_validateNumber_fields                  0
+#define ES_ejs_db_Record_ejs_db_validateNumber_options                 1
+#define ES_ejs_db_Record_ejs_db_validatePresence_fields                0
+#define ES_ejs_db_Record_ejs_db_validatePresence_options               1
+#define ES_ejs_db_Record_ejs_db_validateRecord_thisType                0
+#define ES_ejs_db_Record_ejs_db_validateRecord__hoisted_1_validation   1
+#define ES_ejs_db_Record_ejs_db_validateRecord__hoisted_2_check        2
+#define ES_ejs_db_Record_ejs_db_validateRecord__hoisted_3_fields       3
+#define ES_ejs_db_Record_ejs_db_validateRecord__hoisted_4_options      4
+#define ES_ejs_db_Record_ejs_db_validateRecord__hoisted_5_field        5
+#define ES_ejs_db_Record_ejs_db_validateUnique_fields                  0
+#define ES_ejs_db_Record_ejs_db_validateUnique_options                 1
+#define ES_ejs_db_Record_ejs_db_wrapFilter_fn                          0
+#define ES_ejs_db_Record_ejs_db_wrapFilter_options                     1
+#define ES_ejs_db_Record_ejs_db_constructor_fields                     0
+
+
+/**
+ *   Class property slots for the "Column" class 
+ */
+#define ES_ejs_db_Column__origin                                       6
+#define ES_ejs_db_Column_Column                                        6
+#define ES_ejs_db_Column_NUM_CLASS_PROP                                7
+
+/**
+ * Instance slots for "Column" type 
+ */
+#define ES_ejs_db_Column_ejsType                                       0
+#define ES_ejs_db_Column_sqlType                                       1
+#define ES_ejs_db_Column_NUM_INSTANCE_PROP                             2
+
+/**
+ * 
+ *    Local slots for methods in type Column 
+ */
+#define ES_ejs_db_Column_Column_name                                   0
+#define ES_ejs_db_Column_Column_accessor                               1
+#define ES_ejs_db_Column_Column_ejsType                                2
+#define ES_ejs_db_Column_Column_sqlType                                3
+
+#define _ES_CHECKSUM_ejs_db 308246
+
+#endif
+/*
+ * null -- Property slot definitions for the "ejs.db.mapper" module
+ *
+ * This file is generated by ec
+ *
+ * Slot definitions. Version 3.3.2.
+ */
+
+#ifndef _h_SLOTS_EjsDbMapperSlots
+#define _h_SLOTS_EjsDbMapperSlots 1
+
+
+/**
+ * Slots for the "ejs.db.mapper" module 
+ */
+
+
+/**
+ *   Class property slots for the "global" class 
+ */
+
+/**
+ * Instance slots for "global" type 
+ */
+
+/**
+ * 
+ *    Local slots for methods in type global 
+ */
+
+#define _ES_CHECKSUM_ejs_db_mapper 1257
+
+#endif
+/*
+ * null -- Property slot definitions for the "ejs.db.sqlite" module
+ *
+ * This file is generated by ec
+ *
+ * Slot definitions. Version 3.3.2.
+ */
+
+#ifndef _h_SLOTS_EjsDbSqliteSlots
+#define _h_SLOTS_EjsDbSqliteSlots 1
+
+
+/**
+ * Slots for the "ejs.db.sqlite" module 
+ */
+
+
+/**
+ *   Class property slots for the "global" class 
+ */
+
+/**
+ * Instance slots for "global" type 
+ */
+
+/**
+ * 
+ *    Local slots for methods in type global 
+ */
+
+
+/**
+ *   Class property slots for the "Sqlite" class 
+ */
+#define ES_ejs_db_Sqlite__origin                                       6
+#define ES_ejs_db_Sqlite_Sqlite                                        6
+#define ES_ejs_db_Sqlite__initializer__Sqlite_initializer              7
+#define ES_ejs_db_Sqlite_DataTypeToSqlType                             8
+#define ES_ejs_db_Sqlite_SqlTypeToDataType                             9
+#define ES_ejs_db_Sqlite_SqlTypeToEjsType                              10
+#define ES_ejs_db_Sqlite_addColumn                                     11
+#define ES_ejs_db_Sqlite_addIndex                                      12
+#define ES_ejs_db_Sqlite_changeColumn                                  13
+#define ES_ejs_db_Sqlite_close                                         14
+#define ES_ejs_db_Sqlite_commit                                        15
+#define ES_ejs_db_Sqlite_connect                                       16
+#define ES_ejs_db_Sqlite_createDatabase                                17
+#define ES_ejs_db_Sqlite_createTable                                   18
+#define ES_ejs_db_Sqlite_dataTypeToSqlType                             19
+#define ES_ejs_db_Sqlite_destroyDatabase                               20
+#define ES_ejs_db_Sqlite_destroyTable                                  21
+#define ES_ejs_db_Sqlite_endTransaction                                22
+#define ES_ejs_db_Sqlite_getColumns                                    23
+#define ES_ejs_db_Sqlite_getNumRows                                    24
+#define ES_ejs_db_Sqlite_getTables                                     25
+#define ES_ejs_db_Sqlite_removeColumns                                 26
+#define ES_ejs_db_Sqlite_removeIndex                                   27
+#define ES_ejs_db_Sqlite_renameColumn                                  28
+#define ES_ejs_db_Sqlite_renameTable                                   29
+#define ES_ejs_db_Sqlite_rollback                                      30
+#define ES_ejs_db_Sqlite_query                                         31
+#define ES_ejs_db_Sqlite_sql                                           32
+#define ES_ejs_db_Sqlite_sqlTypeToDataType                             33
+#define ES_ejs_db_Sqlite_sqlTypeToEjsType                              34
+#define ES_ejs_db_Sqlite_startTransaction                              35
+#define ES_ejs_db_Sqlite_NUM_CLASS_PROP                                36
+
+/**
+ * Instance slots for "Sqlite" type 
+ */
+#define ES_ejs_db_Sqlite_NUM_INSTANCE_PROP                             0
+
+/**
+ * 
+ *    Local slots for methods in type Sqlite 
+ */
+#define ES_ejs_db_Sqlite_Sqlite_connectionString                       0
+#define ES_ejs_db_Sqlite_addColumn_table                               0
+#define ES_ejs_db_Sqlite_addColumn_column                              1
+#define ES_ejs_db_Sqlite_addColumn_datatype                            2
+#define ES_ejs_db_Sqlite_addColumn_options                             3
+#define ES_ejs_db_Sqlite_addIndex_table                                0
+#define ES_ejs_db_Sqlite_addIndex_column                               1
+#define ES_ejs_db_Sqlite_addIndex_index                                2
+#define ES_ejs_db_Sqlite_changeColumn_table                            0
+#define ES_ejs_db_Sqlite_changeColumn_column                           1
+#define ES_ejs_db_Sqlite_changeColumn_datatype                         2
+#define ES_ejs_db_Sqlite_changeColumn_options                          3
+#define ES_ejs_db_Sqlite_connect_connectionString                      0
+#define ES_ejs_db_Sqlite_createDatabase_name                           0
+#define ES_ejs_db_Sqlite_createDatabase_options                        1
+#define ES_ejs_db_Sqlite_createTable_table                             0
+#define ES_ejs_db_Sqlite_createTable_columns                           1
+#define ES_ejs_db_Sqlite_createTable_cmd                               2
+#define ES_ejs_db_Sqlite_createTable__hoisted_3_colspec                3
+#define ES_ejs_db_Sqlite_createTable__hoisted_4_spec                   4
+#define ES_ejs_db_Sqlite_createTable__hoisted_5_column                 5
+#define ES_ejs_db_Sqlite_createTable__hoisted_6_datatype               6
+#define ES_ejs_db_Sqlite_dataTypeToSqlType_dataType                    0
+#define ES_ejs_db_Sqlite_destroyDatabase_name                          0
+#define ES_ejs_db_Sqlite_destroyTable_table                            0
+#define ES_ejs_db_Sqlite_getColumns_table                              0
+#define ES_ejs_db_Sqlite_getColumns_names                              1
+#define ES_ejs_db_Sqlite_getColumns__hoisted_2_row                     2
+#define ES_ejs_db_Sqlite_getColumns__hoisted_3_name                    3
+#define ES_ejs_db_Sqlite_getNumRows_table                              0
+#define ES_ejs_db_Sqlite_getNumRows_cmd                                1
+#define ES_ejs_db_Sqlite_getNumRows_grid                               2
+#define ES_ejs_db_Sqlite_getTables_cmd                                 0
+#define ES_ejs_db_Sqlite_getTables_grid                                1
+#define ES_ejs_db_Sqlite_getTables_result                              2
+#define ES_ejs_db_Sqlite_getTables__hoisted_3_row                      3
+#define ES_ejs_db_Sqlite_getTables__hoisted_4_name                     4
+#define ES_ejs_db_Sqlite_removeColumns_table                           0
+#define ES_ejs_db_Sqlite_removeColumns_columns                         1
+#define ES_ejs_db_Sqlite_removeColumns__hoisted_2_column               2
+#define ES_ejs_db_Sqlite_removeColumns__hoisted_3_row                  3
+#define ES_ejs_db_Sqlite_removeColumns__hoisted_4_name                 4
+#define ES_ejs_db_Sqlite_removeColumns__hoisted_5_k                    5
+#define ES_ejs_db_Sqlite_removeIndex_table                             0
+#define ES_ejs_db_Sqlite_removeIndex_index                             1
+#define ES_ejs_db_Sqlite_renameColumn_table                            0
+#define ES_ejs_db_Sqlite_renameColumn_oldColumn                        1
+#define ES_ejs_db_Sqlite_renameColumn_newColumn                        2
+#define ES_ejs_db_Sqlite_renameTable_oldTable                          0
+#define ES_ejs_db_Sqlite_renameTable_newTable                          1
+#define ES_ejs_db_Sqlite_query_cmd                                     0
+#define ES_ejs_db_Sqlite_query_tag                                     1
+#define ES_ejs_db_Sqlite_query_trace                                   2
+#define ES_ejs_db_Sqlite_sql_cmd                                       0
+#define ES_ejs_db_Sqlite_sql_params                                    1
+#define ES_ejs_db_Sqlite_sqlTypeToDataType_sqlType                     0
+#define ES_ejs_db_Sqlite_sqlTypeToEjsType_sqlType                      0
+
+#define _ES_CHECKSUM_ejs_db_sqlite 74899
+
+#endif
+/*
+ * null -- Property slot definitions for the "ejs.events" module
+ *
+ * This file is generated by ec
+ *
+ * Slot definitions. Version 3.3.2.
+ */
+
+#ifndef _h_SLOTS_EjsEventsSlots
+#define _h_SLOTS_EjsEventsSlots 1
+
+
+/**
+ * Slots for the "ejs.events" module 
+ */
+
+
+/**
+ *   Class property slots for the "global" class 
+ */
+
+/**
+ * Instance slots for "global" type 
+ */
+
+/**
+ * 
+ *    Local slots for methods in type global 
+ */
+
+
+/**
+ *   Class property slots for the "Dispatcher" class 
+ */
+#define ES_ejs_events_Dispatcher__origin                               6
+#define ES_ejs_events_Dispatcher_Dispatcher                            6
+#define ES_ejs_events_Dispatcher_addListener                           7
+#define ES_ejs_events_Dispatcher_dispatch                              8
+#define ES_ejs_events_Dispatcher_removeListener                        9
+#define ES_ejs_events_Dispatcher_NUM_CLASS_PROP                        10
+
+/**
+ * Instance slots for "Dispatcher" type 
+ */
+#define ES_ejs_events_Dispatcher_endpoints                             0
+#define ES_ejs_events_Dispatcher_NUM_INSTANCE_PROP                     1
+
+/**
+ * 
+ *    Local slots for methods in type Dispatcher 
+ */
+#define ES_ejs_events_Dispatcher_addListener_callback                  0
+#define ES_ejs_events_Dispatcher_addListener_eventType                 1
+#define ES_ejs_events_Dispatcher_addListener_name                      2
+#define ES_ejs_events_Dispatcher_addListener_listeners                 3
+#define ES_ejs_events_Dispatcher_addListener_e                         4
+#define ES_ejs_events_Dispatcher_dispatch_event                        0
+#define ES_ejs_events_Dispatcher_dispatch_listeners                    1
+#define ES_ejs_events_Dispatcher_dispatch_name                         2
+#define ES_ejs_events_Dispatcher_dispatch_e                            3
+#define ES_ejs_events_Dispatcher_removeListener_callback               0
+#define ES_ejs_events_Dispatcher_removeListener_eventType              1
+#define ES_ejs_events_Dispatcher_removeListener_name                   2
+#define ES_ejs_events_Dispatcher_removeListener_listeners              3
+#define ES_ejs_events_Dispatcher_removeListener_e                      4
+#define ES_ejs_events_Dispatcher_removeListener__hoisted_5_i           5
+
+
+/**
+ *   Class property slots for the "Endpoint" class 
+ */
+#define ES_Endpoint__origin                                            6
+#define ES_Endpoint_Endpoint                                           6
+#define ES_Endpoint_NUM_CLASS_PROP                                     7
+
+/**
+ * Instance slots for "Endpoint" type 
+ */
+#define ES_Endpoint_callback                                           0
+#define ES_Endpoint_eventType                                          1
+#define ES_Endpoint_NUM_INSTANCE_PROP                                  2
+
+/**
+ * 
+ *    Local slots for methods in type Endpoint 
+ */
+#define ES_Endpoint_Endpoint_callback                                  0
+#define ES_Endpoint_Endpoint_eventType                                 1
+
+
+/**
+ *   Class property slots for the "Event" class 
+ */
+#define ES_ejs_events_Event__origin                                    6
+#define ES_ejs_events_Event_Event                                      6
+#define ES_ejs_events_Event__initializer__Event_initializer            7
+#define ES_ejs_events_Event_PRI_LOW                                    8
+#define ES_ejs_events_Event_PRI_NORMAL                                 9
+#define ES_ejs_events_Event_PRI_HIGH                                   10
+#define ES_ejs_events_Event_NUM_CLASS_PROP                             11
+
+/**
+ * Instance slots for "Event" type 
+ */
+#define ES_ejs_events_Event_bubbles                                    0
+#define ES_ejs_events_Event_data                                       1
+#define ES_ejs_events_Event_timestamp                                  2
+#define ES_ejs_events_Event_priority                                   3
+#define ES_ejs_events_Event_NUM_INSTANCE_PROP                          4
+
+/**
+ * 
+ *    Local slots for methods in type Event 
+ */
+#define ES_ejs_events_Event_Event_data                                 0
+#define ES_ejs_events_Event_Event_bubbles                              1
+#define ES_ejs_events_Event_Event_priority                             2
+
+
+/**
+ *   Class property slots for the "ErrorEvent" class 
+ */
+#define ES_ejs_events_ErrorEvent__origin                               11
+#define ES_ejs_events_ErrorEvent_ErrorEvent                            11
+#define ES_ejs_events_ErrorEvent__initializer__ErrorEvent_initializer  12
+#define ES_ejs_events_ErrorEvent_NUM_CLASS_PROP                        13
+
+/**
+ * Instance slots for "ErrorEvent" type 
+ */
+#define ES_ejs_events_ErrorEvent_message                               4
+#define ES_ejs_events_ErrorEvent_filename                              5
+#define ES_ejs_events_ErrorEvent_lineno                                6
+#define ES_ejs_events_ErrorEvent_stack                                 7
+#define ES_ejs_events_ErrorEvent_NUM_INSTANCE_PROP                     8
+
+
+/**
+ *   Class property slots for the "Timer" class 
+ */
+#define ES_ejs_events_Timer__origin                                    6
+#define ES_ejs_events_Timer_Timer                                      6
+#define ES_ejs_events_Timer_drift                                      7
+#define ES_ejs_events_Timer_set_drift                                  8
+#define ES_ejs_events_Timer_period                                     9
+#define ES_ejs_events_Timer_set_period                                 10
+#define ES_ejs_events_Timer_restart                                    11
+#define ES_ejs_events_Timer_stop                                       12
+#define ES_ejs_events_Timer_NUM_CLASS_PROP                             13
+
+/**
+ * Instance slots for "Timer" type 
+ */
+#define ES_ejs_events_Timer_NUM_INSTANCE_PROP                          0
+
+/**
+ * 
+ *    Local slots for methods in type Timer 
+ */
+#define ES_ejs_events_Timer_Timer_period                               0
+#define ES_ejs_events_Timer_Timer_callback                             1
+#define ES_ejs_events_Timer_Timer_drift                                2
+#define ES_ejs_events_Timer_set_drift_enable                           0
+#define ES_ejs_events_Timer_set_period_period                          0
+
+
+/**
+ *   Class property slots for the "TimerEvent" class 
+ */
+#define ES_ejs_events_TimerEvent__origin                               11
+#define ES_ejs_events_TimerEvent_TimerEvent                            11
+#define ES_ejs_events_TimerEvent__initializer__TimerEvent_initializer  12
+#define ES_ejs_events_TimerEvent_NUM_CLASS_PROP                        13
+
+/**
+ * Instance slots for "TimerEvent" type 
+ */
+#define ES_ejs_events_TimerEvent_NUM_INSTANCE_PROP                     4
+
+#define _ES_CHECKSUM_ejs_events 54241
+
+#endif
+/*
+ * null -- Property slot definitions for the "ejs.io" module
+ *
+ * This file is generated by ec
+ *
+ * Slot definitions. Version 3.3.2.
+ */
+
+#ifndef _h_SLOTS_EjsIoSlots
+#define _h_SLOTS_EjsIoSlots 1
+
+
+/**
+ * Slots for the "ejs.io" module 
+ */
+
+
+/**
+ *   Class property slots for the "global" class 
+ */
+
+/**
+ * Instance slots for "global" type 
+ */
+
+/**
+ * 
+ *    Local slots for methods in type global 
+ */
+
+
+/**
+ *   Class property slots for the "BinaryStream" class 
+ */
+#define ES_ejs_io_BinaryStream__origin                                 6
+#define ES_ejs_io_BinaryStream_BinaryStream                            6
+#define ES_ejs_io_BinaryStream__initializer__BinaryStream_initializer  7
+#define ES_ejs_io_BinaryStream_BigEndian                               8
+#define ES_ejs_io_BinaryStream_LittleEndian                            9
+#define ES_ejs_io_BinaryStream_available                               10
+#define ES_ejs_io_BinaryStream_close                                   11
+#define ES_ejs_io_BinaryStream_endian                                  12
+#define ES_ejs_io_BinaryStream_set_endian                              13
+#define ES_ejs_io_BinaryStream_flush                                   14
+#define ES_ejs_io_BinaryStream_read                                    15
+#define ES_ejs_io_BinaryStream_readBoolean                             16
+#define ES_ejs_io_BinaryStream_readByte                                17
+#define ES_ejs_io_BinaryStream_readDate                                18
+#define ES_ejs_io_BinaryStream_readDouble                              19
+#define ES_ejs_io_BinaryStream_readInteger                             20
+#define ES_ejs_io_BinaryStream_readLong                                21
+#define ES_ejs_io_BinaryStream_readString                              22
+#define ES_ejs_io_BinaryStream_readXML                                 23
+#define ES_ejs_io_BinaryStream_write                                   24
+#define ES_ejs_io_BinaryStream_writeByte                               25
+#define ES_ejs_io_BinaryStream_writeShort                              26
+#define ES_ejs_io_BinaryStream_writeDouble                             27
+#define ES_ejs_io_BinaryStream_writeInteger                            28
+#define ES_ejs_io_BinaryStream_writeLong                               29
+#define ES_ejs_io_BinaryStream_NUM_CLASS_PROP                          30
+
+/**
+ * Instance slots for "BinaryStream" type 
+ */
+#define ES_ejs_io_BinaryStream_inbuf                                   0
+#define ES_ejs_io_BinaryStream_outbuf                                  1
+#define ES_ejs_io_BinaryStream_nextStream                              2
+#define ES_ejs_io_BinaryStream_NUM_INSTANCE_PROP                       3
+
+/**
+ * 
+ *    Local slots for methods in type BinaryStream 
+ */
+#define ES_ejs_io_BinaryStream_BinaryStream_stream                     0
+#define ES_ejs_io_BinaryStream_BinaryStream___fun_11455__              1
+#define ES_ejs_io_BinaryStream_BinaryStream___fun_11476__              2
+#define ES_ejs_io_BinaryStream_close_graceful                          0
+#define ES_ejs_io_BinaryStream_set_endian_value                        0
+#define ES_ejs_io_BinaryStream_flush_graceful                          0
+#define ES_ejs_io_BinaryStream_read_buffer                             0
+#define ES_ejs_io_BinaryStream_read_offset                             1
+#define ES_ejs_io_BinaryStream_read_count                              2
+#define ES_ejs_io_BinaryStream_readString_count                        0
+#define ES_ejs_io_BinaryStream_readXML_data                            0
+#define ES_ejs_io_BinaryStream_readXML_s                               1
+#define ES_ejs_io_BinaryStream_write_data                              0
+#define ES_ejs_io_BinaryStream_write_count                             1
+#define ES_ejs_io_BinaryStream_write__hoisted_2_i                      2
+#define ES_ejs_io_BinaryStream_writeByte_data                          0
+#define ES_ejs_io_BinaryStream_writeShort_data                         0
+#define ES_ejs_io_BinaryStream_writeDouble_data                        0
+#define ES_ejs_io_BinaryStream_writeInteger_data                       0
+#define ES_ejs_io_BinaryStream_writeLong_data                          0
+
+
+/**
+ *   Class property slots for the "File" class 
+ */
+#define ES_ejs_io_File__origin                                         6
+#define ES_ejs_io_File_File                                            6
+#define ES_ejs_io_File_canRead                                         7
+#define ES_ejs_io_File_canWrite                                        8
+#define ES_ejs_io_File_close                                           9
+#define ES_ejs_io_File_flush                                           10
+#define ES_ejs_io_File_isOpen                                          11
+#define ES_ejs_io_File_open                                            12
+#define ES_ejs_io_File_options                                         13
+#define ES_ejs_io_File_path                                            14
+#define ES_ejs_io_File_position                                        15
+#define ES_ejs_io_File_set_position                                    16
+#define ES_ejs_io_File_read                                            17
+#define ES_ejs_io_File_readBytes                                       18
+#define ES_ejs_io_File_readString                                      19
+#define ES_ejs_io_File_remove                                          20
+#define ES_ejs_io_File_size                                            21
+#define ES_ejs_io_File_truncate                                        22
+#define ES_ejs_io_File_write                                           23
+#define ES_ejs_io_File_NUM_CLASS_PROP                                  24
+
+/**
+ * Instance slots for "File" type 
+ */
+#define ES_ejs_io_File_NUM_INSTANCE_PROP                               0
+
+/**
+ * 
+ *    Local slots for methods in type File 
+ */
+#define ES_ejs_io_File_File_path                                       0
+#define ES_ejs_io_File_File_options                                    1
+#define ES_ejs_io_File_close_graceful                                  0
+#define ES_ejs_io_File_flush_graceful                                  0
+#define ES_ejs_io_File_open_options                                    0
+#define ES_ejs_io_File_set_position_loc                                0
+#define ES_ejs_io_File_read_buffer                                     0
+#define ES_ejs_io_File_read_offset                                     1
+#define ES_ejs_io_File_read_count                                      2
+#define ES_ejs_io_File_readBytes_count                                 0
+#define ES_ejs_io_File_readString_count                                0
+#define ES_ejs_io_File_truncate_value                                  0
+#define ES_ejs_io_File_write_items                                     0
+
+
+/**
+ *   Class property slots for the "FileSystem" class 
+ */
+#define ES_ejs_io_FileSystem__origin                                   6
+#define ES_ejs_io_FileSystem_FileSystem                                6
+#define ES_ejs_io_FileSystem_hasDrives                                 7
+#define ES_ejs_io_FileSystem_newline                                   8
+#define ES_ejs_io_FileSystem_set_newline                               9
+#define ES_ejs_io_FileSystem_root                                      10
+#define ES_ejs_io_FileSystem_separators                                11
+#define ES_ejs_io_FileSystem_set_separators                            12
+#define ES_ejs_io_FileSystem_NUM_CLASS_PROP                            13
+
+/**
+ * Instance slots for "FileSystem" type 
+ */
+#define ES_ejs_io_FileSystem_NUM_INSTANCE_PROP                         0
+
+/**
+ * 
+ *    Local slots for methods in type FileSystem 
+ */
+#define ES_ejs_io_FileSystem_FileSystem_path                           0
+#define ES_ejs_io_FileSystem_set_newline_terminator                    0
+#define ES_ejs_io_FileSystem_set_separators_sep                        0
+
+
+/**
+ *   Class property slots for the "Http" class 
+ */
+#define ES_ejs_io_Http__origin                                         6
+#define ES_ejs_io_Http_Http                                            6
+#define ES_ejs_io_Http__initializer__Http_initializer                  7
+#define ES_ejs_io_Http_Continue                                        8
+#define ES_ejs_io_Http_Ok                                              9
+#define ES_ejs_io_Http_Created                                         10
+#define ES_ejs_io_Http_Accepted                                        11
+#define ES_ejs_io_Http_NotAuthoritative                                12
+#define ES_ejs_io_Http_NoContent                                       13
+#define ES_ejs_io_Http_Reset                                           14
+#define ES_ejs_io_Http_PartialContent                                  15
+#define ES_ejs_io_Http_MultipleChoice                                  16
+#define ES_ejs_io_Http_MovedPermanently                                17
+#define ES_ejs_io_Http_MovedTemporarily                                18
+#define ES_ejs_io_Http_SeeOther                                        19
+#define ES_ejs_io_Http_NotModified                                     20
+#define ES_ejs_io_Http_UseProxy                                        21
+#define ES_ejs_io_Http_BadRequest                                      22
+#define ES_ejs_io_Http_Unauthorized                                    23
+#define ES_ejs_io_Http_PaymentRequired                                 24
+#define ES_ejs_io_Http_Forbidden                                       25
+#define ES_ejs_io_Http_NotFound                                        26
+#define ES_ejs_io_Http_BadMethod                                       27
+#define ES_ejs_io_Http_NotAcceptable                                   28
+#define ES_ejs_io_Http_ProxyAuthRequired                               29
+#define ES_ejs_io_Http_RequestTimeout                                  30
+#define ES_ejs_io_Http_Conflict                                        31
+#define ES_ejs_io_Http_Gone                                            32
+#define ES_ejs_io_Http_LengthRequired                                  33
+#define ES_ejs_io_Http_PrecondFailed                                   34
+#define ES_ejs_io_Http_EntityTooLarge                                  35
+#define ES_ejs_io_Http_UriTooLong                                      36
+#define ES_ejs_io_Http_UnsupportedMedia                                37
+#define ES_ejs_io_Http_BadRange                                        38
+#define ES_ejs_io_Http_ServerError                                     39
+#define ES_ejs_io_Http_NotImplemented                                  40
+#define ES_ejs_io_Http_BadGateway                                      41
+#define ES_ejs_io_Http_ServiceUnavailable                              42
+#define ES_ejs_io_Http_GatewayTimeout                                  43
+#define ES_ejs_io_Http_VersionNotSupported                             44
+#define ES_ejs_io_Http_Read                                            45
+#define ES_ejs_io_Http_Write                                           46
+#define ES_ejs_io_Http_addHeader                                       47
+#define ES_ejs_io_Http_available                                       48
+#define ES_ejs_io_Http_chunked                                         49
+#define ES_ejs_io_Http_set_chunked                                     50
+#define ES_ejs_io_Http_close                                           51
+#define ES_ejs_io_Http_connect                                         52
+#define ES_ejs_io_Http_certificate                                     53
+#define ES_ejs_io_Http_set_certificate                                 54
+#define ES_ejs_io_Http_code                                            55
+#define ES_ejs_io_Http_codeString                                      56
+#define ES_ejs_io_Http_contentEncoding                                 57
+#define ES_ejs_io_Http_contentLength                                   58
+#define ES_ejs_io_Http_set_contentLength                               59
+#define ES_ejs_io_Http_bodyLength                                      60
+#define ES_ejs_io_Http_set_bodyLength                                  61
+#define ES_ejs_io_Http_contentType                                     62
+#define ES_ejs_io_Http_date                                            63
+#define ES_ejs_io_Http_del                                             64
+#define ES_ejs_io_Http_expires                                         65
+#define ES_ejs_io_Http_flush                                           66
+#define ES_ejs_io_Http_followRedirects                                 67
+#define ES_ejs_io_Http_set_followRedirects                             68
+#define ES_ejs_io_Http_form                                            69
+#define ES_ejs_io_Http_get                                             70
+#define ES_ejs_io_Http_head                                            71
+#define ES_ejs_io_Http_header                                          72
+#define ES_ejs_io_Http_headers                                         73
+#define ES_ejs_io_Http_isSecure                                        74
+#define ES_ejs_io_Http_key                                             75
+#define ES_ejs_io_Http_set_key                                         76
+#define ES_ejs_io_Http_lastModified                                    77
+#define ES_ejs_io_Http_method                                          78
+#define ES_ejs_io_Http_set_method                                      79
+#define ES_ejs_io_Http_mimeType                                        80
+#define ES_ejs_io_Http_options                                         81
+#define ES_ejs_io_Http_pipeline                                        82
+#define ES_ejs_io_Http_pool                                            83
+#define ES_ejs_io_Http_post                                            84
+#define ES_ejs_io_Http_put                                             85
+#define ES_ejs_io_Http_read                                            86
+#define ES_ejs_io_Http_readString                                      87
+#define ES_ejs_io_Http_readLines                                       88
+#define ES_ejs_io_Http_readXml                                         89
+#define ES_ejs_io_Http_response                                        90
+#define ES_ejs_io_Http_retries                                         91
+#define ES_ejs_io_Http_set_retries                                     92
+#define ES_ejs_io_Http_setCallback                                     93
+#define ES_ejs_io_Http_setCredentials                                  94
+#define ES_ejs_io_Http_setPoolLimits                                   95
+#define ES_ejs_io_Http_timeout                                         96
+#define ES_ejs_io_Http_set_timeout                                     97
+#define ES_ejs_io_Http_trace                                           98
+#define ES_ejs_io_Http_upload                                          99
+#define ES_ejs_io_Http_uri                                             100
+#define ES_ejs_io_Http_set_uri                                         101
+#define ES_ejs_io_Http_wait                                            102
+#define ES_ejs_io_Http_write                                           103
+#define ES_ejs_io_Http_NUM_CLASS_PROP                                  104
+
+/**
+ * Instance slots for "Http" type 
+ */
+#define ES_ejs_io_Http__response                                       0
+#define ES_ejs_io_Http_NUM_INSTANCE_PROP                               1
+
+/**
+ * 
+ *    Local slots for methods in type Http 
+ */
+#define ES_ejs_io_Http_Http_uri                                        0
+#define ES_ejs_io_Http_addHeader_key                                   0
+#define ES_ejs_io_Http_addHeader_value                                 1
+#define ES_ejs_io_Http_addHeader_overwrite                             2
+#define ES_ejs_io_Http_set_chunked_value                               0
+#define ES_ejs_io_Http_close_graceful                                  0
+#define ES_ejs_io_Http_connect_uri                                     0
+#define ES_ejs_io_Http_connect_data                                    1
+#define ES_ejs_io_Http_set_certificate_certFile                        0
+#define ES_ejs_io_Http_set_contentLength_length                        0
+#define ES_ejs_io_Http_set_bodyLength_value                            0
+#define ES_ejs_io_Http_del_uri                                         0
+#define ES_ejs_io_Http_del_data                                        1
+#define ES_ejs_io_Http_flush_graceful                                  0
+#define ES_ejs_io_Http_set_followRedirects_flag                        0
+#define ES_ejs_io_Http_form_uri                                        0
+#define ES_ejs_io_Http_form_postData                                   1
+#define ES_ejs_io_Http_get_uri                                         0
+#define ES_ejs_io_Http_get_data                                        1
+#define ES_ejs_io_Http_head_uri                                        0
+#define ES_ejs_io_Http_header_key                                      0
+#define ES_ejs_io_Http_set_key_keyFile                                 0
+#define ES_ejs_io_Http_set_method_name                                 0
+#define ES_ejs_io_Http_mimeType_path                                   0
+#define ES_ejs_io_Http_options_uri                                     0
+#define ES_ejs_io_Http_pipeline_uris                                   0
+#define ES_ejs_io_Http_post_uri                                        0
+#define ES_ejs_io_Http_post_data                                       1
+#define ES_ejs_io_Http_put_uri                                         0
+#define ES_ejs_io_Http_put_data                                        1
+#define ES_ejs_io_Http_read_buffer                                     0
+#define ES_ejs_io_Http_read_offset                                     1
+#define ES_ejs_io_Http_read_count                                      2
+#define ES_ejs_io_Http_readString_count                                0
+#define ES_ejs_io_Http_readLines_count                                 0
+#define ES_ejs_io_Http_set_retries_count                               0
+#define ES_ejs_io_Http_setCallback_eventMask                           0
+#define ES_ejs_io_Http_setCallback_cb                                  1
+#define ES_ejs_io_Http_setCredentials_username                         0
+#define ES_ejs_io_Http_setCredentials_password                         1
+#define ES_ejs_io_Http_setPoolLimits_maxPerHost                        0
+#define ES_ejs_io_Http_setPoolLimits_timeout                           1
+#define ES_ejs_io_Http_set_timeout_timeout                             0
+#define ES_ejs_io_Http_trace_uri                                       0
+#define ES_ejs_io_Http_upload_url                                      0
+#define ES_ejs_io_Http_upload_files                                    1
+#define ES_ejs_io_Http_upload_fields                                   2
+#define ES_ejs_io_Http_upload_boundary                                 3
+#define ES_ejs_io_Http_upload_buf                                      4
+#define ES_ejs_io_Http_upload_http                                     5
+#define ES_ejs_io_Http_upload___fun_12964__                            6
+#define ES_ejs_io_Http_upload__hoisted_7_key                           7
+#define ES_ejs_io_Http_upload__hoisted_8_key                           8
+#define ES_ejs_io_Http_set_uri_newUri                                  0
+#define ES_ejs_io_Http_wait_timeout                                    0
+#define ES_ejs_io_Http_write_data                                      0
+
+
+/**
+ *   Class property slots for the "HttpDataEvent" class 
+ */
+#define ES_ejs_io_HttpDataEvent__origin                                11
+#define ES_ejs_io_HttpDataEvent_HttpDataEvent                          11
+#define ES_ejs_io_HttpDataEvent__initializer__HttpDataEvent_initializer 12
+#define ES_ejs_io_HttpDataEvent_NUM_CLASS_PROP                         13
+
+/**
+ * Instance slots for "HttpDataEvent" type 
+ */
+#define ES_ejs_io_HttpDataEvent_eventMask                              4
+#define ES_ejs_io_HttpDataEvent_NUM_INSTANCE_PROP                      5
+
+
+/**
+ *   Class property slots for the "HttpErrorEvent" class 
+ */
+#define ES_ejs_io_HttpErrorEvent__origin                               11
+#define ES_ejs_io_HttpErrorEvent_HttpErrorEvent                        11
+#define ES_ejs_io_HttpErrorEvent__initializer__HttpErrorEvent_initializer 12
+#define ES_ejs_io_HttpErrorEvent_NUM_CLASS_PROP                        13
+
+/**
+ * Instance slots for "HttpErrorEvent" type 
+ */
+#define ES_ejs_io_HttpErrorEvent_NUM_INSTANCE_PROP                     4
+
+
+/**
+ *   Class property slots for the "Path" class 
+ */
+#define ES_ejs_io_Path__origin                                         6
+#define ES_ejs_io_Path_Path                                            6
+#define ES_ejs_io_Path_absolute                                        7
+#define ES_ejs_io_Path_accessed                                        8
+#define ES_ejs_io_Path_basename                                        9
+#define ES_ejs_io_Path_components                                      10
+#define ES_ejs_io_Path_contains                                        11
+#define ES_ejs_io_Path_copy                                            12
+#define ES_ejs_io_Path_created                                         13
+#define ES_ejs_io_Path_dirname                                         14
+#define ES_ejs_io_Path_endsWith                                        15
+#define ES_ejs_io_Path_exists                                          16
+#define ES_ejs_io_Path_extension                                       17
+#define ES_ejs_io_Path_find                                            18
+#define ES_ejs_io_Path_files                                           19
+#define ES_ejs_io_Path_hasDrive                                        20
+#define ES_ejs_io_Path_isAbsolute                                      21
+#define ES_ejs_io_Path_isDir                                           22
+#define ES_ejs_io_Path_isLink                                          23
+#define ES_ejs_io_Path_isRegular                                       24
+#define ES_ejs_io_Path_isRelative                                      25
+#define ES_ejs_io_Path_join                                            26
+#define ES_ejs_io_Path_joinExt                                         27
+#define ES_ejs_io_Path_linkTarget                                      28
+#define ES_ejs_io_Path_makeDir                                         29
+#define ES_ejs_io_Path_makeLink                                        30
+#define ES_ejs_io_Path_makeTemp                                        31
+#define ES_ejs_io_Path_map                                             32
+#define ES_ejs_io_Path_mimeType                                        33
+#define ES_ejs_io_Path_modified                                        34
+#define ES_ejs_io_Path_name                                            35
+#define ES_ejs_io_Path_natural                                         36
+#define ES_ejs_io_Path_normalize                                       37
+#define ES_ejs_io_Path_open                                            38
+#define ES_ejs_io_Path_openTextStream                                  39
+#define ES_ejs_io_Path_openBinaryStream                                40
+#define ES_ejs_io_Path_parent                                          41
+#define ES_ejs_io_Path_perms                                           42
+#define ES_ejs_io_Path_set_perms                                       43
+#define ES_ejs_io_Path_portable                                        44
+#define ES_ejs_io_Path_readBytes                                       45
+#define ES_ejs_io_Path_readLines                                       46
+#define ES_ejs_io_Path_readString                                      47
+#define ES_ejs_io_Path_readXML                                         48
+#define ES_ejs_io_Path_relative                                        49
+#define ES_ejs_io_Path_remove                                          50
+#define ES_ejs_io_Path_removeAll                                       51
+#define ES_ejs_io_Path_rename                                          52
+#define ES_ejs_io_Path_replaceExt                                      53
+#define ES_ejs_io_Path_resolve                                         54
+#define ES_ejs_io_Path_same                                            55
+#define ES_ejs_io_Path_separator                                       56
+#define ES_ejs_io_Path_size                                            57
+#define ES_ejs_io_Path_startsWith                                      58
+#define ES_ejs_io_Path_toLower                                         59
+#define ES_ejs_io_Path_trimEnd                                         60
+#define ES_ejs_io_Path_trimExt                                         61
+#define ES_ejs_io_Path_trimStart                                       62
+#define ES_ejs_io_Path_truncate                                        63
+#define ES_ejs_io_Path_write                                           64
+#define ES_ejs_io_Path_NUM_CLASS_PROP                                  65
+
+/**
+ * Instance slots for "Path" type 
+ */
+#define ES_ejs_io_Path_NUM_INSTANCE_PROP                               0
+
+/**
+ * 
+ *    Local slots for methods in type Path 
+ */
+#define ES_ejs_io_Path_Path_path                                       0
+#define ES_ejs_io_Path_contains_pattern                                0
+#define ES_ejs_io_Path_copy_target                                     0
+#define ES_ejs_io_Path_copy_options                                    1
+#define ES_ejs_io_Path_endsWith_suffix                                 0
+#define ES_ejs_io_Path_find_glob                                       0
+#define ES_ejs_io_Path_find_recurse                                    1
+#define ES_ejs_io_Path_find_recursiveFind                              2
+#define ES_ejs_io_Path_files_enumDirs                                  0
+#define ES_ejs_io_Path_join_other                                      0
+#define ES_ejs_io_Path_joinExt_ext                                     0
+#define ES_ejs_io_Path_makeDir_options                                 0
+#define ES_ejs_io_Path_makeLink_existing                               0
+#define ES_ejs_io_Path_makeLink_hard                                   1
+#define ES_ejs_io_Path_map_separator                                   0
+#define ES_ejs_io_Path_open_options                                    0
+#define ES_ejs_io_Path_openTextStream_options                          0
+#define ES_ejs_io_Path_openBinaryStream_options                        0
+#define ES_ejs_io_Path_set_perms_perms                                 0
+#define ES_ejs_io_Path_readBytes_file                                  0
+#define ES_ejs_io_Path_readLines_stream                                0
+#define ES_ejs_io_Path_readString_file                                 0
+#define ES_ejs_io_Path_readXML_file                                    0
+#define ES_ejs_io_Path_readXML_data                                    1
+#define ES_ejs_io_Path_removeAll__hoisted_0_f                          0
+#define ES_ejs_io_Path_rename_target                                   0
+#define ES_ejs_io_Path_replaceExt_ext                                  0
+#define ES_ejs_io_Path_resolve_otherPaths                              0
+#define ES_ejs_io_Path_same_other                                      0
+#define ES_ejs_io_Path_startsWith_prefix                               0
+#define ES_ejs_io_Path_trimEnd_pat                                     0
+#define ES_ejs_io_Path_trimStart_pat                                   0
+#define ES_ejs_io_Path_truncate_size                                   0
+#define ES_ejs_io_Path_write_args                                      0
+#define ES_ejs_io_Path_write_file                                      1
+#define ES_ejs_io_Path_write__hoisted_2_item                           2
+#define ES_ejs_io_Path_write__hoisted_3_es                             3
+
+
+/**
+ *   Class property slots for the "TextStream" class 
+ */
+#define ES_ejs_io_TextStream__origin                                   6
+#define ES_ejs_io_TextStream_TextStream                                6
+#define ES_ejs_io_TextStream__initializer__TextStream_initializer      7
+#define ES_ejs_io_TextStream_LATIN1                                    8
+#define ES_ejs_io_TextStream_UTF_8                                     9
+#define ES_ejs_io_TextStream_UTF_16                                    10
+#define ES_ejs_io_TextStream_available                                 11
+#define ES_ejs_io_TextStream_close                                     12
+#define ES_ejs_io_TextStream_encoding                                  13
+#define ES_ejs_io_TextStream_set_encoding                              14
+#define ES_ejs_io_TextStream_fill                                      15
+#define ES_ejs_io_TextStream_flush                                     16
+#define ES_ejs_io_TextStream_read                                      17
+#define ES_ejs_io_TextStream_readLine                                  18
+#define ES_ejs_io_TextStream_readLines                                 19
+#define ES_ejs_io_TextStream_readString                                20
+#define ES_ejs_io_TextStream_write                                     21
+#define ES_ejs_io_TextStream_writeLine                                 22
+#define ES_ejs_io_TextStream_NUM_CLASS_PROP                            23
+
+/**
+ * Instance slots for "TextStream" type 
+ */
+#define ES_ejs_io_TextStream_newline                                   0
+#define ES_ejs_io_TextStream_inbuf                                     1
+#define ES_ejs_io_TextStream_format                                    2
+#define ES_ejs_io_TextStream_nextStream                                3
+#define ES_ejs_io_TextStream_NUM_INSTANCE_PROP                         4
+
+/**
+ * 
+ *    Local slots for methods in type TextStream 
+ */
+#define ES_ejs_io_TextStream_TextStream_stream                         0
+#define ES_ejs_io_TextStream_close_graceful                            0
+#define ES_ejs_io_TextStream_set_encoding_encoding                     0
+#define ES_ejs_io_TextStream_flush_graceful                            0
+#define ES_ejs_io_TextStream_read_buffer                               0
+#define ES_ejs_io_TextStream_read_offset                               1
+#define ES_ejs_io_TextStream_read_count                                2
+#define ES_ejs_io_TextStream_read_total                                3
+#define ES_ejs_io_TextStream_read_where                                4
+#define ES_ejs_io_TextStream_read__hoisted_5_len                       5
+#define ES_ejs_io_TextStream_readLine_nl                               0
+#define ES_ejs_io_TextStream_readLine__hoisted_1_nlchar                1
+#define ES_ejs_io_TextStream_readLine__hoisted_2_i                     2
+#define ES_ejs_io_TextStream_readLines_numLines                        0
+#define ES_ejs_io_TextStream_readLines_result                          1
+#define ES_ejs_io_TextStream_readLines__hoisted_2_i                    2
+#define ES_ejs_io_TextStream_readString_count                          0
+#define ES_ejs_io_TextStream_write_data                                0
+#define ES_ejs_io_TextStream_writeLine_lines                           0
+#define ES_ejs_io_TextStream_writeLine_written                         1
+#define ES_ejs_io_TextStream_writeLine_count                           2
+#define ES_ejs_io_TextStream_writeLine__hoisted_3_line                 3
+
+
+/**
+ *   Class property slots for the "XMLHttp" class 
+ */
+#define ES_ejs_io_XMLHttp__origin                                      6
+#define ES_ejs_io_XMLHttp_XMLHttp                                      6
+#define ES_ejs_io_XMLHttp__initializer__XMLHttp_initializer            7
+#define ES_ejs_io_XMLHttp_Uninitialized                                8
+#define ES_ejs_io_XMLHttp_Open                                         9
+#define ES_ejs_io_XMLHttp_Sent                                         10
+#define ES_ejs_io_XMLHttp_Receiving                                    11
+#define ES_ejs_io_XMLHttp_Loaded                                       12
+#define ES_ejs_io_XMLHttp_abort                                        13
+#define ES_ejs_io_XMLHttp_http                                         14
+#define ES_ejs_io_XMLHttp_readyState                                   15
+#define ES_ejs_io_XMLHttp_responseText                                 16
+#define ES_ejs_io_XMLHttp_responseXML                                  17
+#define ES_ejs_io_XMLHttp_responseBody                                 18
+#define ES_ejs_io_XMLHttp_status                                       19
+#define ES_ejs_io_XMLHttp_statusText                                   20
+#define ES_ejs_io_XMLHttp_getAllResponseHeaders                        21
+#define ES_ejs_io_XMLHttp_getResponseHeader                            22
+#define ES_ejs_io_XMLHttp_open                                         23
+#define ES_ejs_io_XMLHttp_send                                         24
+#define ES_ejs_io_XMLHttp_setRequestHeader                             25
+#define ES_ejs_io_XMLHttp_callback                                     26
+#define ES_ejs_io_XMLHttp_notify                                       27
+#define ES_ejs_io_XMLHttp_NUM_CLASS_PROP                               28
+
+/**
+ * Instance slots for "XMLHttp" type 
+ */
+#define ES_ejs_io_XMLHttp_hp                                           0
+#define ES_ejs_io_XMLHttp_state                                        1
+#define ES_ejs_io_XMLHttp_response                                     2
+#define ES_ejs_io_XMLHttp_onreadystatechange                           3
+#define ES_ejs_io_XMLHttp_NUM_INSTANCE_PROP                            4
+
+/**
+ * 
+ *    Local slots for methods in type XMLHttp 
+ */
+#define ES_ejs_io_XMLHttp_getAllResponseHeaders_result                 0
+#define ES_ejs_io_XMLHttp_getAllResponseHeaders__hoisted_1_key         1
+#define ES_ejs_io_XMLHttp_getResponseHeader_key                        0
+#define ES_ejs_io_XMLHttp_open_method                                  0
+#define ES_ejs_io_XMLHttp_open_url                                     1
+#define ES_ejs_io_XMLHttp_open_async                                   2
+#define ES_ejs_io_XMLHttp_open_user                                    3
+#define ES_ejs_io_XMLHttp_open_password                                4
+#define ES_ejs_io_XMLHttp_open__hoisted_5_timeout                      5
+#define ES_ejs_io_XMLHttp_open__hoisted_6_when                         6
+#define ES_ejs_io_XMLHttp_send_content                                 0
+#define ES_ejs_io_XMLHttp_setRequestHeader_key                         0
+#define ES_ejs_io_XMLHttp_setRequestHeader_value                       1
+#define ES_ejs_io_XMLHttp_callback_e                                   0
+#define ES_ejs_io_XMLHttp_callback_hp                                  1
+#define ES_ejs_io_XMLHttp_callback_count                               2
+
+#define _ES_CHECKSUM_ejs_io 359987
+
+#endif
+/*
+ * null -- Property slot definitions for the "ejs.sys" module
+ *
+ * This file is generated by ec
+ *
+ * Slot definitions. Version 3.3.2.
+ */
+
+#ifndef _h_SLOTS_EjsSysSlots
+#define _h_SLOTS_EjsSysSlots 1
+
+
+/**
+ * Slots for the "ejs.sys" module 
+ */
+
+
+/**
+ *   Class property slots for the "global" class 
+ */
+
+/**
+ * Instance slots for "global" type 
+ */
+
+/**
+ * 
+ *    Local slots for methods in type global 
+ */
+
+
+/**
+ *   Class property slots for the "App" class 
+ */
+#define ES_ejs_sys_App__origin                                         6
+#define ES_ejs_sys_App_args                                            6
+#define ES_ejs_sys_App_dir                                             7
+#define ES_ejs_sys_App_chdir                                           8
+#define ES_ejs_sys_App_exeDir                                          9
+#define ES_ejs_sys_App_exePath                                         10
+#define ES_ejs_sys_App_errorStream                                     11
+#define ES_ejs_sys_App_exit                                            12
+#define ES_ejs_sys_App_getenv                                          13
+#define ES_ejs_sys_App_inputStream                                     14
+#define ES_ejs_sys_App_name                                            15
+#define ES_ejs_sys_App_noexit                                          16
+#define ES_ejs_sys_App_outputStream                                    17
+#define ES_ejs_sys_App_putenv                                          18
+#define ES_ejs_sys_App_searchPath                                      19
+#define ES_ejs_sys_App_set_searchPath                                  20
+#define ES_ejs_sys_App_serviceEvents                                   21
+#define ES_ejs_sys_App_sleep                                           22
+#define ES_ejs_sys_App_title                                           23
+#define ES_ejs_sys_App_version                                         24
+#define ES_ejs_sys_App_NUM_CLASS_PROP                                  25
+
+/**
+ * Instance slots for "App" type 
+ */
+#define ES_ejs_sys_App_NUM_INSTANCE_PROP                               0
+
+/**
+ * 
+ *    Local slots for methods in type App 
+ */
+#define ES_ejs_sys_App_chdir_value                                     0
+#define ES_ejs_sys_App_exit_status                                     0
+#define ES_ejs_sys_App_getenv_name                                     0
+#define ES_ejs_sys_App_noexit_exit                                     0
+#define ES_ejs_sys_App_putenv_name                                     0
+#define ES_ejs_sys_App_putenv_value                                    1
+#define ES_ejs_sys_App_set_searchPath_path                             0
+#define ES_ejs_sys_App_serviceEvents_count                             0
+#define ES_ejs_sys_App_serviceEvents_timeout                           1
+#define ES_ejs_sys_App_sleep_delay                                     0
+
+
+/**
+ *   Class property slots for the "Cmd" class 
+ */
+#define ES_ejs_sys_Cmd__origin                                         6
+#define ES_ejs_sys_Cmd_sh                                              6
+#define ES_ejs_sys_Cmd_run                                             7
+#define ES_ejs_sys_Cmd_daemon                                          8
+#define ES_ejs_sys_Cmd_runx                                            9
+#define ES_ejs_sys_Cmd_NUM_CLASS_PROP                                  10
+
+/**
+ * Instance slots for "Cmd" type 
+ */
+#define ES_ejs_sys_Cmd_NUM_INSTANCE_PROP                               0
+
+/**
+ * 
+ *    Local slots for methods in type Cmd 
+ */
+#define ES_ejs_sys_Cmd_sh_cmdline                                      0
+#define ES_ejs_sys_Cmd_sh_data                                         1
+#define ES_ejs_sys_Cmd_run_cmdline                                     0
+#define ES_ejs_sys_Cmd_run_data                                        1
+#define ES_ejs_sys_Cmd_daemon_cmdline                                  0
+#define ES_ejs_sys_Cmd_runx_cmdline                                    0
+
+
+/**
+ *   Class property slots for the "Config" class 
+ */
+#define ES_ejs_sys_Config__origin                                      6
+#define ES_ejs_sys_Config__initializer__Config_initializer             6
+#define ES_ejs_sys_Config_Debug                                        7
+#define ES_ejs_sys_Config_CPU                                          8
+#define ES_ejs_sys_Config_DB                                           9
+#define ES_ejs_sys_Config_E4X                                          10
+#define ES_ejs_sys_Config_Floating                                     11
+#define ES_ejs_sys_Config_Http                                         12
+#define ES_ejs_sys_Config_Lang                                         13
+#define ES_ejs_sys_Config_Legacy                                       14
+#define ES_ejs_sys_Config_Multithread                                  15
+#define ES_ejs_sys_Config_NumberType                                   16
+#define ES_ejs_sys_Config_OS                                           17
+#define ES_ejs_sys_Config_Product                                      18
+#define ES_ejs_sys_Config_RegularExpressions                           19
+#define ES_ejs_sys_Config_Title                                        20
+#define ES_ejs_sys_Config_Version                                      21
+#define ES_ejs_sys_Config_LibDir                                       22
+#define ES_ejs_sys_Config_BinDir                                       23
+#define ES_ejs_sys_Config_ModDir                                       24
+#define ES_ejs_sys_Config_NUM_CLASS_PROP                               25
+
+/**
+ * Instance slots for "Config" type 
+ */
+#define ES_ejs_sys_Config_NUM_INSTANCE_PROP                            0
+
+
+/**
+ *   Class property slots for the "GC" class 
+ */
+#define ES_ejs_sys_GC__origin                                          6
+#define ES_ejs_sys_GC_enabled                                          6
+#define ES_ejs_sys_GC_set_enabled                                      7
+#define ES_ejs_sys_GC_workQuota                                        8
+#define ES_ejs_sys_GC_set_workQuota                                    9
+#define ES_ejs_sys_GC_pauseBudget                                      10
+#define ES_ejs_sys_GC_set_pauseBudget                                  11
+#define ES_ejs_sys_GC_pauses                                           12
+#define ES_ejs_sys_GC_resetPauses                                      13
+#define ES_ejs_sys_GC_run                                              14
+#define ES_ejs_sys_GC_NUM_CLASS_PROP                                   15
+
+/**
+ * Instance slots for "GC" type 
+ */
+#define ES_ejs_sys_GC_NUM_INSTANCE_PROP                                0
+
+/**
+ * 
+ *    Local slots for methods in type GC 
+ */
+#define ES_ejs_sys_GC_set_enabled_on                                   0
+#define ES_ejs_sys_GC_set_workQuota_quota                              0
+#define ES_ejs_sys_GC_set_pauseBudget_msec                             0
+#define ES_ejs_sys_GC_run_deep                                         0
+
+
+/**
+ *   Class property slots for the "Memory" class 
+ */
+#define ES_ejs_sys_Memory__origin                                      6
+#define ES_ejs_sys_Memory_allocated                                    6
+#define ES_ejs_sys_Memory_set_callback                                 7
+#define ES_ejs_sys_Memory_callback                                     8
+#define ES_ejs_sys_Memory_maximum                                      9
+#define ES_ejs_sys_Memory_set_maximum                                  10
+#define ES_ejs_sys_Memory_peak                                         11
+#define ES_ejs_sys_Memory_redline                                      12
+#define ES_ejs_sys_Memory_set_redline                                  13
+#define ES_ejs_sys_Memory_resident                                     14
+#define ES_ejs_sys_Memory_stack                                        15
+#define ES_ejs_sys_Memory_system                                       16
+#define ES_ejs_sys_Memory_stats                                        17
+#define ES_ejs_sys_Memory_NUM_CLASS_PROP                               18
+
+/**
+ * Instance slots for "Memory" type 
+ */
+#define ES_ejs_sys_Memory_NUM_INSTANCE_PROP                            0
+
+/**
+ * 
+ *    Local slots for methods in type Memory 
+ */
+#define ES_ejs_sys_Memory_set_callback_fn                              0
+#define ES_ejs_sys_Memory_set_maximum_value                            0
+#define ES_ejs_sys_Memory_set_redline_value                            0
+
+
+/**
+ *   Class property slots for the "System" class 
+ */
+#define ES_ejs_sys_System__origin                                      6
+#define ES_ejs_sys_System__initializer__System_initializer             6
+#define ES_ejs_sys_System_Bufsize                                      7
+#define ES_ejs_sys_System_hostname                                     8
+#define ES_ejs_sys_System_run                                          9
+#define ES_ejs_sys_System_runx                                         10
+#define ES_ejs_sys_System_daemon                                       11
+#define ES_ejs_sys_System_sh                                           12
+#define ES_ejs_sys_System_cmd                                          13
+#define ES_ejs_sys_System_exec                                         14
+#define ES_ejs_sys_System_NUM_CLASS_PROP                               15
+
+/**
+ * Instance slots for "System" type 
+ */
+#define ES_ejs_sys_System_NUM_INSTANCE_PROP                            0
+
+/**
+ * 
+ *    Local slots for methods in type System 
+ */
+#define ES_ejs_sys_System_run_cmd                                      0
+#define ES_ejs_sys_System_runx_cmd                                     0
+#define ES_ejs_sys_System_daemon_cmd                                   0
+#define ES_ejs_sys_System_sh_args                                      0
+#define ES_ejs_sys_System_cmd_args                                     0
+#define ES_ejs_sys_System_exec_args                                    0
+
+
+/**
+ *   Class property slots for the "Worker" class 
+ */
+#define ES_ejs_sys_Worker__origin                                      6
+#define ES_ejs_sys_Worker_Worker                                       6
+#define ES_ejs_sys_Worker_eval                                         7
+#define ES_ejs_sys_Worker_exit                                         8
+#define ES_ejs_sys_Worker_join                                         9
+#define ES_ejs_sys_Worker_load                                         10
+#define ES_ejs_sys_Worker_preload                                      11
+#define ES_ejs_sys_Worker_lookup                                       12
+#define ES_ejs_sys_Worker_postMessage                                  13
+#define ES_ejs_sys_Worker_terminate                                    14
+#define ES_ejs_sys_Worker_waitForMessage                               15
+#define ES_ejs_sys_Worker_NUM_CLASS_PROP                               16
+
+/**
+ * Instance slots for "Worker" type 
+ */
+#define ES_ejs_sys_Worker_onclose                                      0
+#define ES_ejs_sys_Worker_onmessage                                    1
+#define ES_ejs_sys_Worker_onerror                                      2
+#define ES_ejs_sys_Worker_name                                         3
+#define ES_ejs_sys_Worker_NUM_INSTANCE_PROP                            4
+
+/**
+ * 
+ *    Local slots for methods in type Worker 
+ */
+#define ES_ejs_sys_Worker_Worker_script                                0
+#define ES_ejs_sys_Worker_Worker_options                               1
+#define ES_ejs_sys_Worker_eval_script                                  0
+#define ES_ejs_sys_Worker_eval_timeout                                 1
+#define ES_ejs_sys_Worker_join_workers                                 0
+#define ES_ejs_sys_Worker_join_timeout                                 1
+#define ES_ejs_sys_Worker_load_script                                  0
+#define ES_ejs_sys_Worker_load_timeout                                 1
+#define ES_ejs_sys_Worker_preload_path                                 0
+#define ES_ejs_sys_Worker_lookup_name                                  0
+#define ES_ejs_sys_Worker_postMessage_data                             0
+#define ES_ejs_sys_Worker_postMessage_transfer                         1
+#define ES_ejs_sys_Worker_waitForMessage_timeout                       0
+
+#define _ES_CHECKSUM_ejs_sys 141235
+
+#endif
+/*
+ * null -- Property slot definitions for the "ejs.web" module
+ *
+ * This file is generated by ec
+ *
+ * Slot definitions. Version 3.3.2.
+ */
+
+#ifndef _h_SLOTS_EjsWebSlots
+#define _h_SLOTS_EjsWebSlots 1
+
+
+/**
+ * Slots for the "ejs.web" module 
+ */
+
+
+/**
+ *   Class property slots for the "global" class 
+ */
+
+/**
+ * Instance slots for "global" type 
+ */
+
+/**
+ * 
+ *    Local slots for methods in type global 
+ */
+
+
+/**
+ *   Class property slots for the "Cache" class 
+ */
+#define ES_ejs_web_Cache__origin                                       6
+#define ES_ejs_web_Cache_Cache                                         6
+#define ES_ejs_web_Cache_read                                          7
+#define ES_ejs_web_Cache_write                                         8
+#define ES_ejs_web_Cache_remove                                        9
+#define ES_ejs_web_Cache_NUM_CLASS_PROP                                10
+
+/**
+ * Instance slots for "Cache" type 
+ */
+#define ES_ejs_web_Cache_NUM_INSTANCE_PROP                             0
+
+/**
+ * 
+ *    Local slots for methods in type Cache 
+ */
+#define ES_ejs_web_Cache_Cache_options                                 0
+#define ES_ejs_web_Cache_read_domain                                   0
+#define ES_ejs_web_Cache_read_key                                      1
+#define ES_ejs_web_Cache_write_domain                                  0
+#define ES_ejs_web_Cache_write_key                                     1
+#define ES_ejs_web_Cache_write_value                                   2
+#define ES_ejs_web_Cache_write_options                                 3
+#define ES_ejs_web_Cache_remove_domain                                 0
+#define ES_ejs_web_Cache_remove_key                                    1
+
+
+/**
+ *   Class property slots for the "GoogleConnector" class 
+ */
+#define ES_ejs_web_GoogleConnector__origin                             6
+#define ES_ejs_web_GoogleConnector_GoogleConnector                     6
+#define ES_ejs_web_GoogleConnector_scriptHeader                        7
+#define ES_ejs_web_GoogleConnector_ejs_web_table                       8
+#define ES_ejs_web_GoogleConnector_ejs_web_chart                       9
+#define ES_ejs_web_GoogleConnector_getOptions                          10
+#define ES_ejs_web_GoogleConnector_write                               11
+#define ES_ejs_web_GoogleConnector_NUM_CLASS_PROP                      12
+
+/**
+ * Instance slots for "GoogleConnector" type 
+ */
+#define ES_ejs_web_GoogleConnector_nextId                              0
+#define ES_ejs_web_GoogleConnector_NUM_INSTANCE_PROP                   1
+
+/**
+ * 
+ *    Local slots for methods in type GoogleConnector 
+ */
+#define ES_ejs_web_GoogleConnector_GoogleConnector_controller          0
+#define ES_ejs_web_GoogleConnector_scriptHeader_kind                   0
+#define ES_ejs_web_GoogleConnector_scriptHeader_id                     1
+#define ES_ejs_web_GoogleConnector_ejs_web_table_data                  0
+#define ES_ejs_web_GoogleConnector_ejs_web_table_options               1
+#define ES_ejs_web_GoogleConnector_ejs_web_table_id                    2
+#define ES_ejs_web_GoogleConnector_ejs_web_table_columns               3
+#define ES_ejs_web_GoogleConnector_ejs_web_table_firstLine             4
+#define ES_ejs_web_GoogleConnector_ejs_web_table_goptions              5
+#define ES_ejs_web_GoogleConnector_ejs_web_table__hoisted_6_i          6
+#define ES_ejs_web_GoogleConnector_ejs_web_table__hoisted_7_name       7
+#define ES_ejs_web_GoogleConnector_ejs_web_table__hoisted_8_name       8
+#define ES_ejs_web_GoogleConnector_ejs_web_table__hoisted_9_row        9
+#define ES_ejs_web_GoogleConnector_ejs_web_table__hoisted_10_col       10
+#define ES_ejs_web_GoogleConnector_ejs_web_table__hoisted_11_name      11
+#define ES_ejs_web_GoogleConnector_ejs_web_chart_grid                  0
+#define ES_ejs_web_GoogleConnector_ejs_web_chart_options               1
+#define ES_ejs_web_GoogleConnector_ejs_web_chart_id                    2
+#define ES_ejs_web_GoogleConnector_ejs_web_chart_columns               3
+#define ES_ejs_web_GoogleConnector_ejs_web_chart_firstLine             4
+#define ES_ejs_web_GoogleConnector_ejs_web_chart_col                   5
+#define ES_ejs_web_GoogleConnector_ejs_web_chart_dataType              6
+#define ES_ejs_web_GoogleConnector_ejs_web_chart_goptions              7
+#define ES_ejs_web_GoogleConnector_ejs_web_chart__hoisted_8_name       8
+#define ES_ejs_web_GoogleConnector_ejs_web_chart__hoisted_9_row        9
+#define ES_ejs_web_GoogleConnector_ejs_web_chart__hoisted_10_col2      10
+#define ES_ejs_web_GoogleConnector_ejs_web_chart__hoisted_11_name2     11
+#define ES_ejs_web_GoogleConnector_getOptions_options                  0
+#define ES_ejs_web_GoogleConnector_getOptions_defaults                 1
+#define ES_ejs_web_GoogleConnector_getOptions_result                   2
+#define ES_ejs_web_GoogleConnector_getOptions__hoisted_3_word          3
+#define ES_ejs_web_GoogleConnector_write_str                           0
+
+
+/**
+ *   Class property slots for the "HtmlConnector" class 
+ */
+#define ES_ejs_web_HtmlConnector__origin                               6
+#define ES_ejs_web_HtmlConnector_HtmlConnector                         6
+#define ES_ejs_web_HtmlConnector_ejs_web_aform                         7
+#define ES_ejs_web_HtmlConnector_ejs_web_alink                         8
+#define ES_ejs_web_HtmlConnector_ejs_web_button                        9
+#define ES_ejs_web_HtmlConnector_ejs_web_buttonLink                    10
+#define ES_ejs_web_HtmlConnector_ejs_web_chart                         11
+#define ES_ejs_web_HtmlConnector_ejs_web_checkbox                      12
+#define ES_ejs_web_HtmlConnector_ejs_web_endform                       13
+#define ES_ejs_web_HtmlConnector_ejs_web_flash                         14
+#define ES_ejs_web_HtmlConnector_ejs_web_form                          15
+#define ES_ejs_web_HtmlConnector_ejs_web_image                         16
+#define ES_ejs_web_HtmlConnector_ejs_web_label                         17
+#define ES_ejs_web_HtmlConnector_ejs_web_link                          18
+#define ES_ejs_web_HtmlConnector_ejs_web_extlink                       19
+#define ES_ejs_web_HtmlConnector_ejs_web_list                          20
+#define ES_ejs_web_HtmlConnector_ejs_web_mail                          21
+#define ES_ejs_web_HtmlConnector_ejs_web_progress                      22
+#define ES_ejs_web_HtmlConnector_ejs_web_radio                         23
+#define ES_ejs_web_HtmlConnector_ejs_web_script                        24
+#define ES_ejs_web_HtmlConnector_ejs_web_status                        25
+#define ES_ejs_web_HtmlConnector_ejs_web_stylesheet                    26
+#define ES_ejs_web_HtmlConnector_ejs_web_tabs                          27
+#define ES_ejs_web_HtmlConnector_getColumns                            28
+#define ES_ejs_web_HtmlConnector_ejs_web_table                         29
+#define ES_ejs_web_HtmlConnector_ejs_web_text                          30
+#define ES_ejs_web_HtmlConnector_ejs_web_textarea                      31
+#define ES_ejs_web_HtmlConnector_ejs_web_tree                          32
+#define ES_ejs_web_HtmlConnector_getTextKind                           33
+#define ES_ejs_web_HtmlConnector_getOptions                            34
+#define ES_ejs_web_HtmlConnector_write                                 35
+#define ES_ejs_web_HtmlConnector_getDataAttributes                     36
+#define ES_ejs_web_HtmlConnector_NUM_CLASS_PROP                        37
+
+/**
+ * Instance slots for "HtmlConnector" type 
+ */
+#define ES_ejs_web_HtmlConnector_nextId                                0
+#define ES_ejs_web_HtmlConnector_controller                            1
+#define ES_ejs_web_HtmlConnector_NUM_INSTANCE_PROP                     2
+
+/**
+ * 
+ *    Local slots for methods in type HtmlConnector 
+ */
+#define ES_ejs_web_HtmlConnector_HtmlConnector_controller              0
+#define ES_ejs_web_HtmlConnector_ejs_web_aform_record                  0
+#define ES_ejs_web_HtmlConnector_ejs_web_aform_url                     1
+#define ES_ejs_web_HtmlConnector_ejs_web_aform_options                 2
+#define ES_ejs_web_HtmlConnector_ejs_web_alink_text                    0
+#define ES_ejs_web_HtmlConnector_ejs_web_alink_url                     1
+#define ES_ejs_web_HtmlConnector_ejs_web_alink_options                 2
+#define ES_ejs_web_HtmlConnector_ejs_web_button_value                  0
+#define ES_ejs_web_HtmlConnector_ejs_web_button_buttonName             1
+#define ES_ejs_web_HtmlConnector_ejs_web_button_options                2
+#define ES_ejs_web_HtmlConnector_ejs_web_buttonLink_text               0
+#define ES_ejs_web_HtmlConnector_ejs_web_buttonLink_url                1
+#define ES_ejs_web_HtmlConnector_ejs_web_buttonLink_options            2
+#define ES_ejs_web_HtmlConnector_ejs_web_buttonLink__hoisted_3_attributes 3
+#define ES_ejs_web_HtmlConnector_ejs_web_chart_data                    0
+#define ES_ejs_web_HtmlConnector_ejs_web_chart_options                 1
+#define ES_ejs_web_HtmlConnector_ejs_web_checkbox_name                 0
+#define ES_ejs_web_HtmlConnector_ejs_web_checkbox_value                1
+#define ES_ejs_web_HtmlConnector_ejs_web_checkbox_submitValue          2
+#define ES_ejs_web_HtmlConnector_ejs_web_checkbox_options              3
+#define ES_ejs_web_HtmlConnector_ejs_web_checkbox_checked              4
+#define ES_ejs_web_HtmlConnector_ejs_web_flash_kind                    0
+#define ES_ejs_web_HtmlConnector_ejs_web_flash_msg                     1
+#define ES_ejs_web_HtmlConnector_ejs_web_flash_options                 2
+#define ES_ejs_web_HtmlConnector_ejs_web_form_record                   0
+#define ES_ejs_web_HtmlConnector_ejs_web_form_url                      1
+#define ES_ejs_web_HtmlConnector_ejs_web_form_options                  2
+#define ES_ejs_web_HtmlConnector_ejs_web_image_src                     0
+#define ES_ejs_web_HtmlConnector_ejs_web_image_options                 1
+#define ES_ejs_web_HtmlConnector_ejs_web_label_text                    0
+#define ES_ejs_web_HtmlConnector_ejs_web_label_options                 1
+#define ES_ejs_web_HtmlConnector_ejs_web_link_text                     0
+#define ES_ejs_web_HtmlConnector_ejs_web_link_action                   1
+#define ES_ejs_web_HtmlConnector_ejs_web_link_options                  2
+#define ES_ejs_web_HtmlConnector_ejs_web_extlink_text                  0
+#define ES_ejs_web_HtmlConnector_ejs_web_extlink_url                   1
+#define ES_ejs_web_HtmlConnector_ejs_web_extlink_options               2
+#define ES_ejs_web_HtmlConnector_ejs_web_list_field                    0
+#define ES_ejs_web_HtmlConnector_ejs_web_list_choices                  1
+#define ES_ejs_web_HtmlConnector_ejs_web_list_defaultValue             2
+#define ES_ejs_web_HtmlConnector_ejs_web_list_options                  3
+#define ES_ejs_web_HtmlConnector_ejs_web_list_isSelected               4
+#define ES_ejs_web_HtmlConnector_ejs_web_list_i                        5
+#define ES_ejs_web_HtmlConnector_ejs_web_list__hoisted_6_choice        6
+#define ES_ejs_web_HtmlConnector_ejs_web_list__hoisted_7_field         7
+#define ES_ejs_web_HtmlConnector_ejs_web_mail_nameText                 0
+#define ES_ejs_web_HtmlConnector_ejs_web_mail_address                  1
+#define ES_ejs_web_HtmlConnector_ejs_web_mail_options                  2
+#define ES_ejs_web_HtmlConnector_ejs_web_progress_initialData          0
+#define ES_ejs_web_HtmlConnector_ejs_web_progress_options              1
+#define ES_ejs_web_HtmlConnector_ejs_web_radio_name                    0
+#define ES_ejs_web_HtmlConnector_ejs_web_radio_selected                1
+#define ES_ejs_web_HtmlConnector_ejs_web_radio_choices                 2
+#define ES_ejs_web_HtmlConnector_ejs_web_radio_options                 3
+#define ES_ejs_web_HtmlConnector_ejs_web_radio_checked                 4
+#define ES_ejs_web_HtmlConnector_ejs_web_radio__hoisted_5_v            5
+#define ES_ejs_web_HtmlConnector_ejs_web_radio__hoisted_6_item         6
+#define ES_ejs_web_HtmlConnector_ejs_web_script_url                    0
+#define ES_ejs_web_HtmlConnector_ejs_web_script_options                1
+#define ES_ejs_web_HtmlConnector_ejs_web_status_data                   0
+#define ES_ejs_web_HtmlConnector_ejs_web_status_options                1
+#define ES_ejs_web_HtmlConnector_ejs_web_stylesheet_url                0
+#define ES_ejs_web_HtmlConnector_ejs_web_stylesheet_options            1
+#define ES_ejs_web_HtmlConnector_ejs_web_tabs_initialData              0
+#define ES_ejs_web_HtmlConnector_ejs_web_tabs_options                  1
+#define ES_ejs_web_HtmlConnector_ejs_web_tabs__hoisted_2_t             2
+#define ES_ejs_web_HtmlConnector_ejs_web_tabs__hoisted_3_name          3
+#define ES_ejs_web_HtmlConnector_ejs_web_tabs__hoisted_4_url           4
+#define ES_ejs_web_HtmlConnector_getColumns_data                       0
+#define ES_ejs_web_HtmlConnector_getColumns_options                    1
+#define ES_ejs_web_HtmlConnector_getColumns_columns                    2
+#define ES_ejs_web_HtmlConnector_getColumns__hoisted_3_name            3
+#define ES_ejs_web_HtmlConnector_getColumns__hoisted_4_name            4
+#define ES_ejs_web_HtmlConnector_ejs_web_table_data                    0
+#define ES_ejs_web_HtmlConnector_ejs_web_table_options                 1
+#define ES_ejs_web_HtmlConnector_ejs_web_table_originalOptions         2
+#define ES_ejs_web_HtmlConnector_ejs_web_table_tableId                 3
+#define ES_ejs_web_HtmlConnector_ejs_web_table_columns                 4
+#define ES_ejs_web_HtmlConnector_ejs_web_table_refresh                 5
+#define ES_ejs_web_HtmlConnector_ejs_web_table_sortOrder               6
+#define ES_ejs_web_HtmlConnector_ejs_web_table_sort                    7
+#define ES_ejs_web_HtmlConnector_ejs_web_table_attributes              8
+#define ES_ejs_web_HtmlConnector_ejs_web_table_styleBody               9
+#define ES_ejs_web_HtmlConnector_ejs_web_table_row                     10
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_11_url         11
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_12_name        12
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_13_header      13
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_14_width       14
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_15_r           15
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_16_url         16
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_17_urlOptions  17
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_18_odd         18
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_19_even        19
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_20_dataId      20
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_21_col         21
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_22_name        22
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_23_column      23
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_24_styleCell   24
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_25_align       25
+#define ES_ejs_web_HtmlConnector_ejs_web_table__hoisted_26_cellUrl     26
+#define ES_ejs_web_HtmlConnector_ejs_web_text_name                     0
+#define ES_ejs_web_HtmlConnector_ejs_web_text_value                    1
+#define ES_ejs_web_HtmlConnector_ejs_web_text_options                  2
+#define ES_ejs_web_HtmlConnector_ejs_web_textarea_name                 0
+#define ES_ejs_web_HtmlConnector_ejs_web_textarea_value                1
+#define ES_ejs_web_HtmlConnector_ejs_web_textarea_options              2
+#define ES_ejs_web_HtmlConnector_ejs_web_tree_initialData              0
+#define ES_ejs_web_HtmlConnector_ejs_web_tree_options                  1
+#define ES_ejs_web_HtmlConnector_getTextKind_options                   0
+#define ES_ejs_web_HtmlConnector_getTextKind_kind                      1
+#define ES_ejs_web_HtmlConnector_getOptions_options                    0
+#define ES_ejs_web_HtmlConnector_write_str                             0
+#define ES_ejs_web_HtmlConnector_getDataAttributes_options             0
+#define ES_ejs_web_HtmlConnector_getDataAttributes_attributes          1
+
+
+/**
+ *   Class property slots for the "Controller" class 
+ */
+#define ES_ejs_web_Controller__origin                                  6
+#define ES_ejs_web_Controller_Controller                               6
+#define ES_ejs_web_Controller_ejs_web_initialize                       7
+#define ES_ejs_web_Controller_ejs_web_cache                            8
+#define ES_ejs_web_Controller_ejs_web_createSession                    9
+#define ES_ejs_web_Controller_ejs_web_destroySession                   10
+#define ES_ejs_web_Controller_ejs_web_discardOutput                    11
+#define ES_ejs_web_Controller_ejs_web_resetFilters                     12
+#define ES_ejs_web_Controller_ejs_web_beforeFilter                     13
+#define ES_ejs_web_Controller_ejs_web_afterFilter                      14
+#define ES_ejs_web_Controller_ejs_web_wrapFilter                       15
+#define ES_ejs_web_Controller_runFilters                               16
+#define ES_ejs_web_Controller_ejs_web_doAction                         17
+#define ES_ejs_web_Controller_ejs_web_sendError                        18
+#define ES_ejs_web_Controller_ejs_web_renderError                      19
+#define ES_ejs_web_Controller_ejs_web_escapeHtml                       20
+#define ES_ejs_web_Controller_ejs_web_html                             21
+#define ES_ejs_web_Controller_ejs_web_inform                           22
+#define ES_ejs_web_Controller_ejs_web_error                            23
+#define ES_ejs_web_Controller_ejs_web_keepAlive                        24
+#define ES_ejs_web_Controller_ejs_web_loadView                         25
+#define ES_ejs_web_Controller_ejs_web_makeUrl                          26
+#define ES_ejs_web_Controller_ejs_web_redirectUrl                      27
+#define ES_ejs_web_Controller_ejs_web_redirect                         28
+#define ES_ejs_web_Controller_ejs_web_render                           29
+#define ES_ejs_web_Controller_ejs_web_renderFile                       30
+#define ES_ejs_web_Controller_ejs_web_renderRaw                        31
+#define ES_ejs_web_Controller_ejs_web_renderJSON                       32
+#define ES_ejs_web_Controller_ejs_web_renderView                       33
+#define ES_ejs_web_Controller_reportError                              34
+#define ES_ejs_web_Controller_ejs_web_setCookie                        35
+#define ES_ejs_web_Controller_ejs_web_setHeader                        36
+#define ES_ejs_web_Controller_ejs_web_setHttpCode                      37
+#define ES_ejs_web_Controller_ejs_web_setMimeType                      38
+#define ES_ejs_web_Controller_ejs_web_unescapeHtml                     39
+#define ES_ejs_web_Controller_ejs_web_warn                             40
+#define ES_ejs_web_Controller_ejs_web_write                            41
+#define ES_ejs_web_Controller_ejs_web_writeJSON                        42
+#define ES_ejs_web_Controller_ejs_web_writeHtml                        43
+#define ES_ejs_web_Controller_ejs_web_writeRaw                         44
+#define ES_ejs_web_Controller_action_missing                           45
+#define ES_ejs_web_Controller_NUM_CLASS_PROP                           46
+
+/**
+ * Instance slots for "Controller" type 
+ */
+#define ES_ejs_web_Controller_actionName                               0
+#define ES_ejs_web_Controller_originalActionName                       1
+#define ES_ejs_web_Controller_absUrl                                   2
+#define ES_ejs_web_Controller_appUrl                                   3
+#define ES_ejs_web_Controller_controllerName                           4
+#define ES_ejs_web_Controller_config                                   5
+#define ES_ejs_web_Controller_flash                                    6
+#define ES_ejs_web_Controller_home                                     7
+#define ES_ejs_web_Controller_host                                     8
+#define ES_ejs_web_Controller_params                                   9
+#define ES_ejs_web_Controller_request                                  10
+#define ES_ejs_web_Controller_response                                 11
+#define ES_ejs_web_Controller_session                                  12
+#define ES_ejs_web_Controller_isApp                                    13
+#define ES_ejs_web_Controller_rendered                                 14
+#define ES_ejs_web_Controller_redirected                               15
+#define ES_ejs_web_Controller_events                                   16
+#define ES_ejs_web_Controller__afterFilters                            17
+#define ES_ejs_web_Controller__beforeFilters                           18
+#define ES_ejs_web_Controller__wrapFilters                             19
+#define ES_ejs_web_Controller_NUM_INSTANCE_PROP                        20
+
+/**
+ * 
+ *    Local slots for methods in type Controller 
+ */
+#define ES_ejs_web_Controller_ejs_web_initialize_isApp                 0
+#define ES_ejs_web_Controller_ejs_web_initialize_appDir                1
+#define ES_ejs_web_Controller_ejs_web_initialize_appUrl                2
+#define ES_ejs_web_Controller_ejs_web_initialize_session               3
+#define ES_ejs_web_Controller_ejs_web_initialize_host                  4
+#define ES_ejs_web_Controller_ejs_web_initialize_request               5
+#define ES_ejs_web_Controller_ejs_web_initialize_response              6
+#define ES_ejs_web_Controller_ejs_web_initialize_url                   7
+#define ES_ejs_web_Controller_ejs_web_initialize_parts                 8
+#define ES_ejs_web_Controller_ejs_web_initialize_name                  9
+#define ES_ejs_web_Controller_ejs_web_initialize__hoisted_10_adapter   10
+#define ES_ejs_web_Controller_ejs_web_initialize__hoisted_11_dbname    11
+#define ES_ejs_web_Controller_ejs_web_cache_enable                     0
+#define ES_ejs_web_Controller_ejs_web_createSession_timeout            0
+#define ES_ejs_web_Controller_ejs_web_beforeFilter_fn                  0
+#define ES_ejs_web_Controller_ejs_web_beforeFilter_options             1
+#define ES_ejs_web_Controller_ejs_web_afterFilter_fn                   0
+#define ES_ejs_web_Controller_ejs_web_afterFilter_options              1
+#define ES_ejs_web_Controller_ejs_web_wrapFilter_fn                    0
+#define ES_ejs_web_Controller_ejs_web_wrapFilter_options               1
+#define ES_ejs_web_Controller_runFilters_filters                       0
+#define ES_ejs_web_Controller_runFilters__hoisted_1_filter             1
+#define ES_ejs_web_Controller_runFilters__hoisted_2_fn                 2
+#define ES_ejs_web_Controller_runFilters__hoisted_3_options            3
+#define ES_ejs_web_Controller_ejs_web_doAction_act                     0
+#define ES_ejs_web_Controller_ejs_web_doAction_lastFlash               1
+#define ES_ejs_web_Controller_ejs_web_doAction__hoisted_2_e            2
+#define ES_ejs_web_Controller_ejs_web_doAction__hoisted_3_item         3
+#define ES_ejs_web_Controller_ejs_web_doAction__hoisted_4_old          4
+#define ES_ejs_web_Controller_ejs_web_sendError_code                   0
+#define ES_ejs_web_Controller_ejs_web_sendError_msg                    1
+#define ES_ejs_web_Controller_ejs_web_renderError_code                 0
+#define ES_ejs_web_Controller_ejs_web_renderError_msg                  1
+#define ES_ejs_web_Controller_ejs_web_escapeHtml_s                     0
+#define ES_ejs_web_Controller_ejs_web_html_args                        0
+#define ES_ejs_web_Controller_ejs_web_html__hoisted_1_s                1
+#define ES_ejs_web_Controller_ejs_web_inform_msg                       0
+#define ES_ejs_web_Controller_ejs_web_error_msg                        0
+#define ES_ejs_web_Controller_ejs_web_keepAlive_on                     0
+#define ES_ejs_web_Controller_ejs_web_loadView_path                    0
+#define ES_ejs_web_Controller_ejs_web_makeUrl_action                   0
+#define ES_ejs_web_Controller_ejs_web_makeUrl_id                       1
+#define ES_ejs_web_Controller_ejs_web_makeUrl_options                  2
+#define ES_ejs_web_Controller_ejs_web_makeUrl_query                    3
+#define ES_ejs_web_Controller_ejs_web_makeUrl_url                      4
+#define ES_ejs_web_Controller_ejs_web_makeUrl__hoisted_5_cname         5
+#define ES_ejs_web_Controller_ejs_web_redirectUrl_url                  0
+#define ES_ejs_web_Controller_ejs_web_redirectUrl_code                 1
+#define ES_ejs_web_Controller_ejs_web_redirect_action                  0
+#define ES_ejs_web_Controller_ejs_web_redirect_id                      1
+#define ES_ejs_web_Controller_ejs_web_redirect_options                 2
+#define ES_ejs_web_Controller_ejs_web_render_args                      0
+#define ES_ejs_web_Controller_ejs_web_renderFile_filename              0
+#define ES_ejs_web_Controller_ejs_web_renderFile_file                  1
+#define ES_ejs_web_Controller_ejs_web_renderFile__hoisted_2_e          2
+#define ES_ejs_web_Controller_ejs_web_renderRaw_args                   0
+#define ES_ejs_web_Controller_ejs_web_renderJSON_data                  0
+#define ES_ejs_web_Controller_ejs_web_renderView_viewName              0
+#define ES_ejs_web_Controller_ejs_web_renderView_viewClass             1
+#define ES_ejs_web_Controller_ejs_web_renderView__hoisted_2_name       2
+#define ES_ejs_web_Controller_ejs_web_renderView__hoisted_3_e          3
+#define ES_ejs_web_Controller_ejs_web_renderView__hoisted_4_n          4
+#define ES_ejs_web_Controller_ejs_web_renderView__hoisted_5_e          5
+#define ES_ejs_web_Controller_ejs_web_renderView__hoisted_6_msg        6
+#define ES_ejs_web_Controller_reportError_code                         0
+#define ES_ejs_web_Controller_reportError_msg                          1
+#define ES_ejs_web_Controller_reportError_e                            2
+#define ES_ejs_web_Controller_ejs_web_setCookie_name                   0
+#define ES_ejs_web_Controller_ejs_web_setCookie_value                  1
+#define ES_ejs_web_Controller_ejs_web_setCookie_path                   2
+#define ES_ejs_web_Controller_ejs_web_setCookie_domain                 3
+#define ES_ejs_web_Controller_ejs_web_setCookie_lifetime               4
+#define ES_ejs_web_Controller_ejs_web_setCookie_secure                 5
+#define ES_ejs_web_Controller_ejs_web_setHeader_key                    0
+#define ES_ejs_web_Controller_ejs_web_setHeader_value                  1
+#define ES_ejs_web_Controller_ejs_web_setHeader_allowMultiple          2
+#define ES_ejs_web_Controller_ejs_web_setHttpCode_code                 0
+#define ES_ejs_web_Controller_ejs_web_setMimeType_format               0
+#define ES_ejs_web_Controller_ejs_web_unescapeHtml_s                   0
+#define ES_ejs_web_Controller_ejs_web_warn_msg                         0
+#define ES_ejs_web_Controller_ejs_web_write_args                       0
+#define ES_ejs_web_Controller_ejs_web_writeJSON_data                   0
+#define ES_ejs_web_Controller_ejs_web_writeHtml_args                   0
+#define ES_ejs_web_Controller_ejs_web_writeRaw_args                    0
+
+
+/**
+ *   Class property slots for the "_SoloController" class 
+ */
+#define ES_ejs_web__SoloController__origin                             46
+#define ES_ejs_web__SoloController__SoloController                     46
+#define ES_ejs_web__SoloController_NUM_CLASS_PROP                      47
+
+/**
+ * Instance slots for "_SoloController" type 
+ */
+#define ES_ejs_web__SoloController_NUM_INSTANCE_PROP                   20
+
+
+/**
+ *   Class property slots for the "Cookie" class 
+ */
+#define ES_ejs_web_Cookie__origin                                      6
+#define ES_ejs_web_Cookie_Cookie                                       6
+#define ES_ejs_web_Cookie_NUM_CLASS_PROP                               7
+
+/**
+ * Instance slots for "Cookie" type 
+ */
+#define ES_ejs_web_Cookie_name                                         0
+#define ES_ejs_web_Cookie_value                                        1
+#define ES_ejs_web_Cookie_domain                                       2
+#define ES_ejs_web_Cookie_path                                         3
+#define ES_ejs_web_Cookie_NUM_INSTANCE_PROP                            4
+
+
+/**
+ *   Class property slots for the "EjsParser" class 
+ */
+#define ES_ejs_web_EjsParser__origin                                   6
+#define ES_ejs_web_EjsParser_EjsParser                                 6
+#define ES_ejs_web_EjsParser__initializer__EjsParser_initializer       7
+#define ES_ejs_web_EjsParser_Err                                       8
+#define ES_ejs_web_EjsParser_Eof                                       9
+#define ES_ejs_web_EjsParser_EjsTag                                    10
+#define ES_ejs_web_EjsParser_Var                                       11
+#define ES_ejs_web_EjsParser_Literal                                   12
+#define ES_ejs_web_EjsParser_Equals                                    13
+#define ES_ejs_web_EjsParser_Control                                   14
+#define ES_ejs_web_EjsParser_ViewHeader                                15
+#define ES_ejs_web_EjsParser_ViewFooter                                16
+#define ES_ejs_web_EjsParser_buildView                                 17
+#define ES_ejs_web_EjsParser_parse                                     18
+#define ES_ejs_web_EjsParser_getToken                                  19
+#define ES_ejs_web_EjsParser_eatSpace                                  20
+#define ES_ejs_web_EjsParser_abort                                     21
+#define ES_ejs_web_EjsParser_NUM_CLASS_PROP                            22
+
+/**
+ * Instance slots for "EjsParser" type 
+ */
+#define ES_ejs_web_EjsParser_ContentMarker                             0
+#define ES_ejs_web_EjsParser_ContentPattern                            1
+#define ES_ejs_web_EjsParser_LayoutsDir                                2
+#define ES_ejs_web_EjsParser_appBaseDir                                3
+#define ES_ejs_web_EjsParser_script                                    4
+#define ES_ejs_web_EjsParser_pos                                       5
+#define ES_ejs_web_EjsParser_lineNumber                                6
+#define ES_ejs_web_EjsParser_layoutPage                                7
+#define ES_ejs_web_EjsParser_NUM_INSTANCE_PROP                         8
+
+/**
+ * 
+ *    Local slots for methods in type EjsParser 
+ */
+#define ES_ejs_web_EjsParser_buildView_file                            0
+#define ES_ejs_web_EjsParser_buildView_appDir                          1
+#define ES_ejs_web_EjsParser_buildView_layout                          2
+#define ES_ejs_web_EjsParser_buildView_prefix                          3
+#define ES_ejs_web_EjsParser_buildView_view                            4
+#define ES_ejs_web_EjsParser_buildView_result                          5
+#define ES_ejs_web_EjsParser_parse_file                                0
+#define ES_ejs_web_EjsParser_parse_appDir                              1
+#define ES_ejs_web_EjsParser_parse_layout                              2
+#define ES_ejs_web_EjsParser_parse_token                               3
+#define ES_ejs_web_EjsParser_parse_out                                 4
+#define ES_ejs_web_EjsParser_parse_tid                                 5
+#define ES_ejs_web_EjsParser_parse__hoisted_6_args                     6
+#define ES_ejs_web_EjsParser_parse__hoisted_7_cmd                      7
+#define ES_ejs_web_EjsParser_parse__hoisted_8_path                     8
+#define ES_ejs_web_EjsParser_parse__hoisted_9_incPath                  9
+#define ES_ejs_web_EjsParser_parse__hoisted_10_inc                     10
+#define ES_ejs_web_EjsParser_parse__hoisted_11_path                    11
+#define ES_ejs_web_EjsParser_parse__hoisted_12_layoutText              12
+#define ES_ejs_web_EjsParser_getToken_token                            0
+#define ES_ejs_web_EjsParser_getToken_tid                              1
+#define ES_ejs_web_EjsParser_getToken_c                                2
+#define ES_ejs_web_EjsParser_abort_msg                                 0
+
+
+/**
+ *   Class property slots for the "Host" class 
+ */
+#define ES_ejs_web_Host__origin                                        6
+#define ES_ejs_web_Host_Host                                           6
+#define ES_ejs_web_Host_NUM_CLASS_PROP                                 7
+
+/**
+ * Instance slots for "Host" type 
+ */
+#define ES_ejs_web_Host_documentRoot                                   0
+#define ES_ejs_web_Host_name                                           1
+#define ES_ejs_web_Host_protocol                                       2
+#define ES_ejs_web_Host_isVirtualHost                                  3
+#define ES_ejs_web_Host_isNamedVirtualHost                             4
+#define ES_ejs_web_Host_software                                       5
+#define ES_ejs_web_Host_logErrors                                      6
+#define ES_ejs_web_Host_NUM_INSTANCE_PROP                              7
+
+
+/**
+ *   Class property slots for the "Request" class 
+ */
+#define ES_ejs_web_Request__origin                                     6
+#define ES_ejs_web_Request_Request                                     6
+#define ES_ejs_web_Request_NUM_CLASS_PROP                              7
+
+/**
+ * Instance slots for "Request" type 
+ */
+#define ES_ejs_web_Request_accept                                      0
+#define ES_ejs_web_Request_acceptCharset                               1
+#define ES_ejs_web_Request_acceptEncoding                              2
+#define ES_ejs_web_Request_authAcl                                     3
+#define ES_ejs_web_Request_authGroup                                   4
+#define ES_ejs_web_Request_authType                                    5
+#define ES_ejs_web_Request_authUser                                    6
+#define ES_ejs_web_Request_body                                        7
+#define ES_ejs_web_Request_connection                                  8
+#define ES_ejs_web_Request_contentLength                               9
+#define ES_ejs_web_Request_cookies                                     10
+#define ES_ejs_web_Request_extension                                   11
+#define ES_ejs_web_Request_files                                       12
+#define ES_ejs_web_Request_headers                                     13
+#define ES_ejs_web_Request_hostName                                    14
+#define ES_ejs_web_Request_method                                      15
+#define ES_ejs_web_Request_mimeType                                    16
+#define ES_ejs_web_Request_pathInfo                                    17
+#define ES_ejs_web_Request_pathTranslated                              18
+#define ES_ejs_web_Request_pragma                                      19
+#define ES_ejs_web_Request_query                                       20
+#define ES_ejs_web_Request_originalUri                                 21
+#define ES_ejs_web_Request_referrer                                    22
+#define ES_ejs_web_Request_remoteAddress                               23
+#define ES_ejs_web_Request_remoteHost                                  24
+#define ES_ejs_web_Request_sessionID                                   25
+#define ES_ejs_web_Request_url                                         26
+#define ES_ejs_web_Request_userAgent                                   27
+#define ES_ejs_web_Request_NUM_INSTANCE_PROP                           28
+
+
+/**
+ *   Class property slots for the "Response" class 
+ */
+#define ES_ejs_web_Response__origin                                    6
+#define ES_ejs_web_Response_Response                                   6
+#define ES_ejs_web_Response_NUM_CLASS_PROP                             7
+
+/**
+ * Instance slots for "Response" type 
+ */
+#define ES_ejs_web_Response_code                                       0
+#define ES_ejs_web_Response_filename                                   1
+#define ES_ejs_web_Response_headers                                    2
+#define ES_ejs_web_Response_mimeType                                   3
+#define ES_ejs_web_Response_NUM_INSTANCE_PROP                          4
+
+
+/**
+ *   Class property slots for the "Session" class 
+ */
+#define ES_ejs_web_Session__origin                                     6
+#define ES_ejs_web_Session_NUM_CLASS_PROP                              6
+
+/**
+ * Instance slots for "Session" type 
+ */
+#define ES_ejs_web_Session_NUM_INSTANCE_PROP                           0
+
+
+/**
+ *   Class property slots for the "UploadFile" class 
+ */
+#define ES_ejs_web_UploadFile__origin                                  6
+#define ES_ejs_web_UploadFile_UploadFile                               6
+#define ES_ejs_web_UploadFile_NUM_CLASS_PROP                           7
+
+/**
+ * Instance slots for "UploadFile" type 
+ */
+#define ES_ejs_web_UploadFile_clientFilename                           0
+#define ES_ejs_web_UploadFile_contentType                              1
+#define ES_ejs_web_UploadFile_filename                                 2
+#define ES_ejs_web_UploadFile_name                                     3
+#define ES_ejs_web_UploadFile_size                                     4
+#define ES_ejs_web_UploadFile_NUM_INSTANCE_PROP                        5
+
+
+/**
+ *   Class property slots for the "View" class 
+ */
+#define ES_ejs_web_View__origin                                        6
+#define ES_ejs_web_View_View                                           6
+#define ES_ejs_web_View__initializer__View_initializer                 7
+#define ES_ejs_web_View_ejs_web_getNextId                              8
+#define ES_ejs_web_View_render                                         9
+#define ES_ejs_web_View_ejs_web_aform                                  10
+#define ES_ejs_web_View_ejs_web_alink                                  11
+#define ES_ejs_web_View_ejs_web_button                                 12
+#define ES_ejs_web_View_ejs_web_buttonLink                             13
+#define ES_ejs_web_View_ejs_web_chart                                  14
+#define ES_ejs_web_View_ejs_web_checkbox                               15
+#define ES_ejs_web_View_ejs_web_endform                                16
+#define ES_ejs_web_View_ejs_web_form                                   17
+#define ES_ejs_web_View_ejs_web_image                                  18
+#define ES_ejs_web_View_ejs_web_imageLink                              19
+#define ES_ejs_web_View_ejs_web_input                                  20
+#define ES_ejs_web_View_ejs_web_label                                  21
+#define ES_ejs_web_View_ejs_web_link                                   22
+#define ES_ejs_web_View_ejs_web_extlink                                23
+#define ES_ejs_web_View_ejs_web_list                                   24
+#define ES_ejs_web_View_ejs_web_mail                                   25
+#define ES_ejs_web_View_ejs_web_progress                               26
+#define ES_ejs_web_View_ejs_web_radio                                  27
+#define ES_ejs_web_View_ejs_web_script                                 28
+#define ES_ejs_web_View_ejs_web_status                                 29
+#define ES_ejs_web_View_ejs_web_stylesheet                             30
+#define ES_ejs_web_View_ejs_web_table                                  31
+#define ES_ejs_web_View_ejs_web_tabs                                   32
+#define ES_ejs_web_View_ejs_web_text                                   33
+#define ES_ejs_web_View_ejs_web_textarea                               34
+#define ES_ejs_web_View_ejs_web_tree                                   35
+#define ES_ejs_web_View_ejs_web_flash                                  36
+#define ES_ejs_web_View_formErrors                                     37
+#define ES_ejs_web_View_ejs_web_createSession                          38
+#define ES_ejs_web_View_ejs_web_destroySession                         39
+#define ES_ejs_web_View_ejs_web_html                                   40
+#define ES_ejs_web_View_ejs_web_makeUrl                                41
+#define ES_ejs_web_View_ejs_web_redirectUrl                            42
+#define ES_ejs_web_View_ejs_web_redirect                               43
+#define ES_ejs_web_View_ejs_web_setCookie                              44
+#define ES_ejs_web_View_ejs_web_setHeader                              45
+#define ES_ejs_web_View_ejs_web_setHttpCode                            46
+#define ES_ejs_web_View_ejs_web_setMimeType                            47
+#define ES_ejs_web_View_ejs_web_write                                  48
+#define ES_ejs_web_View_ejs_web_writeHtml                              49
+#define ES_ejs_web_View_ejs_web_writeJSON                              50
+#define ES_ejs_web_View_ejs_web_writeRaw                               51
+#define ES_ejs_web_View_ejs_web_d                                      52
+#define ES_ejs_web_View_addHelper                                      53
+#define ES_ejs_web_View_getConnector                                   54
+#define ES_ejs_web_View_setOptions                                     55
+#define ES_ejs_web_View_ejs_web_getValue                               56
+#define ES_ejs_web_View_ejs_web_date                                   57
+#define ES_ejs_web_View_ejs_web_currency                               58
+#define ES_ejs_web_View_ejs_web_number                                 59
+#define ES_ejs_web_View_htmlOptions                                    60
+#define ES_ejs_web_View_ejs_web_getOptions                             61
+#define ES_ejs_web_View_pivot                                          62
+#define ES_ejs_web_View_filter                                         63
+#define ES_ejs_web_View_NUM_CLASS_PROP                                 64
+
+/**
+ * Instance slots for "View" type 
+ */
+#define ES_ejs_web_View_ejs_web_controller                             0
+#define ES_ejs_web_View_currentModel                                   1
+#define ES_ejs_web_View_config                                         2
+#define ES_ejs_web_View_nextId                                         3
+#define ES_ejs_web_View_NUM_INSTANCE_PROP                              4
+
+/**
+ * 
+ *    Local slots for methods in type View 
+ */
+#define ES_ejs_web_View_View_controller                                0
+#define ES_ejs_web_View_ejs_web_aform_action                           0
+#define ES_ejs_web_View_ejs_web_aform_record                           1
+#define ES_ejs_web_View_ejs_web_aform_options                          2
+#define ES_ejs_web_View_ejs_web_aform_connector                        3
+#define ES_ejs_web_View_ejs_web_alink_text                             0
+#define ES_ejs_web_View_ejs_web_alink_action                           1
+#define ES_ejs_web_View_ejs_web_alink_options                          2
+#define ES_ejs_web_View_ejs_web_alink_connector                        3
+#define ES_ejs_web_View_ejs_web_button_value                           0
+#define ES_ejs_web_View_ejs_web_button_buttonName                      1
+#define ES_ejs_web_View_ejs_web_button_options                         2
+#define ES_ejs_web_View_ejs_web_button_connector                       3
+#define ES_ejs_web_View_ejs_web_buttonLink_text                        0
+#define ES_ejs_web_View_ejs_web_buttonLink_action                      1
+#define ES_ejs_web_View_ejs_web_buttonLink_options                     2
+#define ES_ejs_web_View_ejs_web_buttonLink_connector                   3
+#define ES_ejs_web_View_ejs_web_chart_initialData                      0
+#define ES_ejs_web_View_ejs_web_chart_options                          1
+#define ES_ejs_web_View_ejs_web_chart_connector                        2
+#define ES_ejs_web_View_ejs_web_checkbox_field                         0
+#define ES_ejs_web_View_ejs_web_checkbox_choice                        1
+#define ES_ejs_web_View_ejs_web_checkbox_options                       2
+#define ES_ejs_web_View_ejs_web_checkbox_value                         3
+#define ES_ejs_web_View_ejs_web_checkbox_connector                     4
+#define ES_ejs_web_View_ejs_web_endform_connector                      0
+#define ES_ejs_web_View_ejs_web_form_action                            0
+#define ES_ejs_web_View_ejs_web_form_record                            1
+#define ES_ejs_web_View_ejs_web_form_options                           2
+#define ES_ejs_web_View_ejs_web_form_connector                         3
+#define ES_ejs_web_View_ejs_web_image_src                              0
+#define ES_ejs_web_View_ejs_web_image_options                          1
+#define ES_ejs_web_View_ejs_web_image_connector                        2
+#define ES_ejs_web_View_ejs_web_imageLink_image                        0
+#define ES_ejs_web_View_ejs_web_imageLink_action                       1
+#define ES_ejs_web_View_ejs_web_imageLink_options                      2
+#define ES_ejs_web_View_ejs_web_imageLink_connector                    3
+#define ES_ejs_web_View_ejs_web_input_field                            0
+#define ES_ejs_web_View_ejs_web_input_options                          1
+#define ES_ejs_web_View_ejs_web_label_text                             0
+#define ES_ejs_web_View_ejs_web_label_options                          1
+#define ES_ejs_web_View_ejs_web_label_connector                        2
+#define ES_ejs_web_View_ejs_web_link_text                              0
+#define ES_ejs_web_View_ejs_web_link_action                            1
+#define ES_ejs_web_View_ejs_web_link_options                           2
+#define ES_ejs_web_View_ejs_web_link_connector                         3
+#define ES_ejs_web_View_ejs_web_extlink_text                           0
+#define ES_ejs_web_View_ejs_web_extlink_url                            1
+#define ES_ejs_web_View_ejs_web_extlink_options                        2
+#define ES_ejs_web_View_ejs_web_extlink_connector                      3
+#define ES_ejs_web_View_ejs_web_list_field                             0
+#define ES_ejs_web_View_ejs_web_list_choices                           1
+#define ES_ejs_web_View_ejs_web_list_options                           2
+#define ES_ejs_web_View_ejs_web_list_value                             3
+#define ES_ejs_web_View_ejs_web_list_connector                         4
+#define ES_ejs_web_View_ejs_web_mail_nameText                          0
+#define ES_ejs_web_View_ejs_web_mail_address                           1
+#define ES_ejs_web_View_ejs_web_mail_options                           2
+#define ES_ejs_web_View_ejs_web_mail_connector                         3
+#define ES_ejs_web_View_ejs_web_progress_initialData                   0
+#define ES_ejs_web_View_ejs_web_progress_options                       1
+#define ES_ejs_web_View_ejs_web_progress_connector                     2
+#define ES_ejs_web_View_ejs_web_radio_field                            0
+#define ES_ejs_web_View_ejs_web_radio_choices                          1
+#define ES_ejs_web_View_ejs_web_radio_options                          2
+#define ES_ejs_web_View_ejs_web_radio_value                            3
+#define ES_ejs_web_View_ejs_web_radio_connector                        4
+#define ES_ejs_web_View_ejs_web_script_url                             0
+#define ES_ejs_web_View_ejs_web_script_options                         1
+#define ES_ejs_web_View_ejs_web_script_connector                       2
+#define ES_ejs_web_View_ejs_web_script__hoisted_3_u                    3
+#define ES_ejs_web_View_ejs_web_status_initialData                     0
+#define ES_ejs_web_View_ejs_web_status_options                         1
+#define ES_ejs_web_View_ejs_web_status_connector                       2
+#define ES_ejs_web_View_ejs_web_stylesheet_url                         0
+#define ES_ejs_web_View_ejs_web_stylesheet_options                     1
+#define ES_ejs_web_View_ejs_web_stylesheet_connector                   2
+#define ES_ejs_web_View_ejs_web_stylesheet__hoisted_3_u                3
+#define ES_ejs_web_View_ejs_web_table_data                             0
+#define ES_ejs_web_View_ejs_web_table_options                          1
+#define ES_ejs_web_View_ejs_web_table_connector                        2
+#define ES_ejs_web_View_ejs_web_tabs_initialData                       0
+#define ES_ejs_web_View_ejs_web_tabs_options                           1
+#define ES_ejs_web_View_ejs_web_tabs_connector                         2
+#define ES_ejs_web_View_ejs_web_text_field                             0
+#define ES_ejs_web_View_ejs_web_text_options                           1
+#define ES_ejs_web_View_ejs_web_text_value                             2
+#define ES_ejs_web_View_ejs_web_text_connector                         3
+#define ES_ejs_web_View_ejs_web_textarea_field                         0
+#define ES_ejs_web_View_ejs_web_textarea_options                       1
+#define ES_ejs_web_View_ejs_web_textarea_value                         2
+#define ES_ejs_web_View_ejs_web_textarea_connector                     3
+#define ES_ejs_web_View_ejs_web_tree_initialData                       0
+#define ES_ejs_web_View_ejs_web_tree_options                           1
+#define ES_ejs_web_View_ejs_web_tree_connector                         2
+#define ES_ejs_web_View_ejs_web_flash_kinds                            0
+#define ES_ejs_web_View_ejs_web_flash_options                          1
+#define ES_ejs_web_View_ejs_web_flash_cflash                           2
+#define ES_ejs_web_View_ejs_web_flash_msgs                             3
+#define ES_ejs_web_View_ejs_web_flash__hoisted_4_kind                  4
+#define ES_ejs_web_View_ejs_web_flash__hoisted_5_kind                  5
+#define ES_ejs_web_View_ejs_web_flash__hoisted_6_msg                   6
+#define ES_ejs_web_View_ejs_web_flash__hoisted_7_connector             7
+#define ES_ejs_web_View_formErrors_model                               0
+#define ES_ejs_web_View_formErrors_errors                              1
+#define ES_ejs_web_View_formErrors__hoisted_2_e                        2
+#define ES_ejs_web_View_ejs_web_createSession_timeout                  0
+#define ES_ejs_web_View_ejs_web_html_args                              0
+#define ES_ejs_web_View_ejs_web_makeUrl_action                         0
+#define ES_ejs_web_View_ejs_web_makeUrl_id                             1
+#define ES_ejs_web_View_ejs_web_makeUrl_options                        2
+#define ES_ejs_web_View_ejs_web_redirectUrl_url                        0
+#define ES_ejs_web_View_ejs_web_redirectUrl_code                       1
+#define ES_ejs_web_View_ejs_web_redirect_action                        0
+#define ES_ejs_web_View_ejs_web_redirect_id                            1
+#define ES_ejs_web_View_ejs_web_redirect_options                       2
+#define ES_ejs_web_View_ejs_web_setCookie_name                         0
+#define ES_ejs_web_View_ejs_web_setCookie_value                        1
+#define ES_ejs_web_View_ejs_web_setCookie_path                         2
+#define ES_ejs_web_View_ejs_web_setCookie_domain                       3
+#define ES_ejs_web_View_ejs_web_setCookie_lifetime                     4
+#define ES_ejs_web_View_ejs_web_setCookie_secure                       5
+#define ES_ejs_web_View_ejs_web_setHeader_key                          0
+#define ES_ejs_web_View_ejs_web_setHeader_value                        1
+#define ES_ejs_web_View_ejs_web_setHeader_allowMultiple                2
+#define ES_ejs_web_View_ejs_web_setHttpCode_code                       0
+#define ES_ejs_web_View_ejs_web_setMimeType_format                     0
+#define ES_ejs_web_View_ejs_web_write_args                             0
+#define ES_ejs_web_View_ejs_web_writeHtml_args                         0
+#define ES_ejs_web_View_ejs_web_writeJSON_data                         0
+#define ES_ejs_web_View_ejs_web_writeRaw_args                          0
+#define ES_ejs_web_View_ejs_web_d_args                                 0
+#define ES_ejs_web_View_ejs_web_d_e                                    1
+#define ES_ejs_web_View_addHelper_fun                                  0
+#define ES_ejs_web_View_addHelper_overwrite                            1
+#define ES_ejs_web_View_addHelper_name                                 2
+#define ES_ejs_web_View_getConnector_kind                              0
+#define ES_ejs_web_View_getConnector_options                           1
+#define ES_ejs_web_View_getConnector_connectorName                     2
+#define ES_ejs_web_View_getConnector_name                              3
+#define ES_ejs_web_View_getConnector__hoisted_4_e                      4
+#define ES_ejs_web_View_setOptions_field                               0
+#define ES_ejs_web_View_setOptions_options                             1
+#define ES_ejs_web_View_ejs_web_getValue_model                         0
+#define ES_ejs_web_View_ejs_web_getValue_field                         1
+#define ES_ejs_web_View_ejs_web_getValue_options                       2
+#define ES_ejs_web_View_ejs_web_getValue_value                         3
+#define ES_ejs_web_View_ejs_web_getValue_typeName                      4
+#define ES_ejs_web_View_ejs_web_getValue_fmt                           5
+#define ES_ejs_web_View_ejs_web_getValue__hoisted_6_part               6
+#define ES_ejs_web_View_ejs_web_date_fmt                               0
+#define ES_ejs_web_View_ejs_web_date___fun_27670__                     1
+#define ES_ejs_web_View_ejs_web_currency_fmt                           0
+#define ES_ejs_web_View_ejs_web_currency___fun_27704__                 1
+#define ES_ejs_web_View_ejs_web_number_fmt                             0
+#define ES_ejs_web_View_ejs_web_number___fun_27734__                   1
+#define ES_ejs_web_View_ejs_web_getOptions_options                     0
+#define ES_ejs_web_View_ejs_web_getOptions_result                      1
+#define ES_ejs_web_View_ejs_web_getOptions__hoisted_2_option           2
+#define ES_ejs_web_View_ejs_web_getOptions__hoisted_3_mapped           3
+#define ES_ejs_web_View_pivot_grid                                     0
+#define ES_ejs_web_View_pivot_options                                  1
+#define ES_ejs_web_View_pivot_headers                                  2
+#define ES_ejs_web_View_pivot_i                                        3
+#define ES_ejs_web_View_pivot_table                                    4
+#define ES_ejs_web_View_pivot_row                                      5
+#define ES_ejs_web_View_pivot__hoisted_6_name                          6
+#define ES_ejs_web_View_pivot__hoisted_7_name                          7
+#define ES_ejs_web_View_pivot__hoisted_8_r                             8
+#define ES_ejs_web_View_filter_data                                    0
+#define ES_ejs_web_View_filter__hoisted_1_i                            1
+#define ES_ejs_web_View_filter__hoisted_2_found                        2
+#define ES_ejs_web_View_filter__hoisted_3_f                            3
+
+
+/**
+ *   Class property slots for the "LocalModel" class 
+ */
+#define ES_LocalModel__origin                                          6
+#define ES_LocalModel_Record                                           6
+#define ES_LocalModel__initializer__Record_initializer                 7
+#define ES_LocalModel_ejs_db_int__assocName                            8
+#define ES_LocalModel_ejs_db_int__belongsTo                            9
+#define ES_LocalModel_ejs_db_int__className                            10
+#define ES_LocalModel_ejs_db_int__columns                              11
+#define ES_LocalModel_ejs_db_int__hasOne                               12
+#define ES_LocalModel_ejs_db_int__hasMany                              13
+#define ES_LocalModel_ejs_db_int__db                                   14
+#define ES_LocalModel_ejs_db_int__foreignId                            15
+#define ES_LocalModel_ejs_db_int__keyName                              16
+#define ES_LocalModel_ejs_db_int__tableName                            17
+#define ES_LocalModel_ejs_db_int__trace                                18
+#define ES_LocalModel_ejs_db_int__validations                          19
+#define ES_LocalModel_ejs_db_int__beforeFilters                        20
+#define ES_LocalModel_ejs_db_int__afterFilters                         21
+#define ES_LocalModel_ejs_db_int__wrapFilters                          22
+#define ES_LocalModel_ejs_db_ErrorMessages                             23
+#define ES_LocalModel_ejs_db_initialize                                24
+#define ES_LocalModel_ejs_db_afterFilter                               25
+#define ES_LocalModel_ejs_db_beforeFilter                              26
+#define ES_LocalModel_ejs_db_belongsTo                                 27
+#define ES_LocalModel_cachedRead                                       28
+#define ES_LocalModel_checkFormat                                      29
+#define ES_LocalModel_checkNumber                                      30
+#define ES_LocalModel_checkPresent                                     31
+#define ES_LocalModel_checkUnique                                      32
+#define ES_LocalModel_coerceToEjsTypes                                 33
+#define ES_LocalModel_createAssociations                               34
+#define ES_LocalModel_createRecord                                     35
+#define ES_LocalModel_ejs_db_error                                     36
+#define ES_LocalModel_ejs_db_find                                      37
+#define ES_LocalModel_ejs_db_findAll                                   38
+#define ES_LocalModel_ejs_db_findOneWhere                              39
+#define ES_LocalModel_ejs_db_findWhere                                 40
+#define ES_LocalModel_ejs_db_getColumnNames                            41
+#define ES_LocalModel_ejs_db_getColumnTitles                           42
+#define ES_LocalModel_ejs_db_getColumnType                             43
+#define ES_LocalModel_ejs_db_getDb                                     44
+#define ES_LocalModel_ejs_db_getErrors                                 45
+#define ES_LocalModel_ejs_db_getKeyName                                46
+#define ES_LocalModel_ejs_db_getNumRows                                47
+#define ES_LocalModel_getSchema                                        48
+#define ES_LocalModel_ejs_db_getTableName                              49
+#define ES_LocalModel_ejs_db_hasAndBelongsToMany                       50
+#define ES_LocalModel_ejs_db_hasError                                  51
+#define ES_LocalModel_ejs_db_hasMany                                   52
+#define ES_LocalModel_ejs_db_hasOne                                    53
+#define ES_LocalModel_innerFind                                        54
+#define ES_LocalModel_makeLazyReader                                   55
+#define ES_LocalModel_mapSqlTypeToEjs                                  56
+#define ES_LocalModel_prepareValue                                     57
+#define ES_LocalModel_readRecords                                      58
+#define ES_LocalModel_ejs_db_remove                                    59
+#define ES_LocalModel_runFilters                                       60
+#define ES_LocalModel_ejs_db_save                                      61
+#define ES_LocalModel_ejs_db_saveUpdate                                62
+#define ES_LocalModel_ejs_db_setDb                                     63
+#define ES_LocalModel_ejs_db_setKeyName                                64
+#define ES_LocalModel_ejs_db_setTableName                              65
+#define ES_LocalModel_ejs_db_sql                                       66
+#define ES_LocalModel_ejs_db_trace                                     67
+#define ES_LocalModel_ejs_db_validateFormat                            68
+#define ES_LocalModel_ejs_db_validateNumber                            69
+#define ES_LocalModel_ejs_db_validatePresence                          70
+#define ES_LocalModel_ejs_db_validateRecord                            71
+#define ES_LocalModel_ejs_db_validateUnique                            72
+#define ES_LocalModel_ejs_db_wrapFilter                                73
+#define ES_LocalModel_ejs_db_columnNames                               74
+#define ES_LocalModel_ejs_db_columnTitles                              75
+#define ES_LocalModel_ejs_db_db                                        76
+#define ES_LocalModel_ejs_db_keyName                                   77
+#define ES_LocalModel_ejs_db_numRows                                   78
+#define ES_LocalModel_ejs_db_tableName                                 79
+#define ES_LocalModel_ejs_db_constructor                               80
+#define ES_LocalModel_LocalModel                                       81
+#define ES_LocalModel__initializer__LocalModel_initializer             82
+#define ES_LocalModel_NUM_CLASS_PROP                                   83
+
+/**
+ * Instance slots for "LocalModel" type 
+ */
+#define ES_LocalModel_ejs_db_int__keyValue                             0
+#define ES_LocalModel_ejs_db_int__errors                               1
+#define ES_LocalModel_ejs_db_int__cacheAssoc                           2
+#define ES_LocalModel_NUM_INSTANCE_PROP                                3
+
+/**
+ * 
+ *    Local slots for methods in type LocalModel 
+ */
+#define ES_LocalModel_Record_fields                                    0
+#define ES_LocalModel_ejs_db_initialize_fields                         0
+#define ES_LocalModel_ejs_db_initialize__hoisted_1_field               1
+#define ES_LocalModel_ejs_db_afterFilter_fn                            0
+#define ES_LocalModel_ejs_db_afterFilter_options                       1
+#define ES_LocalModel_ejs_db_beforeFilter_fn                           0
+#define ES_LocalModel_ejs_db_beforeFilter_options                      1
+#define ES_LocalModel_ejs_db_belongsTo_owner                           0
+#define ES_LocalModel_ejs_db_belongsTo_options                         1
+#define ES_LocalModel_cachedRead_rec                                   0
+#define ES_LocalModel_cachedRead_field                                 1
+#define ES_LocalModel_cachedRead_model                                 2
+#define ES_LocalModel_cachedRead_key                                   3
+#define ES_LocalModel_cachedRead_options                               4
+#define ES_LocalModel_checkFormat_thisObj                              0
+#define ES_LocalModel_checkFormat_field                                1
+#define ES_LocalModel_checkFormat_value                                2
+#define ES_LocalModel_checkFormat_options                              3
+#define ES_LocalModel_checkNumber_thisObj                              0
+#define ES_LocalModel_checkNumber_field                                1
+#define ES_LocalModel_checkNumber_value                                2
+#define ES_LocalModel_checkNumber_options                              3
+#define ES_LocalModel_checkPresent_thisObj                             0
+#define ES_LocalModel_checkPresent_field                               1
+#define ES_LocalModel_checkPresent_value                               2
+#define ES_LocalModel_checkPresent_options                             3
+#define ES_LocalModel_checkUnique_thisObj                              0
+#define ES_LocalModel_checkUnique_field                                1
+#define ES_LocalModel_checkUnique_value                                2
+#define ES_LocalModel_checkUnique_options                              3
+#define ES_LocalModel_checkUnique_grid                                 4
+#define ES_LocalModel_coerceToEjsTypes__hoisted_0_field                0
+#define ES_LocalModel_coerceToEjsTypes__hoisted_1_col                  1
+#define ES_LocalModel_coerceToEjsTypes__hoisted_2_value                2
+#define ES_LocalModel_createAssociations_rec                           0
+#define ES_LocalModel_createAssociations_set                           1
+#define ES_LocalModel_createAssociations_preload                       2
+#define ES_LocalModel_createAssociations_options                       3
+#define ES_LocalModel_createAssociations__hoisted_4_model              4
+#define ES_LocalModel_createAssociations__hoisted_5_association        5
+#define ES_LocalModel_createAssociations__hoisted_6_field              6
+#define ES_LocalModel_createAssociations__hoisted_7_f                  7
+#define ES_LocalModel_createAssociations__hoisted_8_field              8
+#define ES_LocalModel_createAssociations__hoisted_9_f                  9
+#define ES_LocalModel_createRecord_data                                0
+#define ES_LocalModel_createRecord_options                             1
+#define ES_LocalModel_createRecord_rec                                 2
+#define ES_LocalModel_createRecord_subOptions                          3
+#define ES_LocalModel_createRecord__hoisted_4_model                    4
+#define ES_LocalModel_createRecord__hoisted_5_model                    5
+#define ES_LocalModel_ejs_db_error_field                               0
+#define ES_LocalModel_ejs_db_error_msg                                 1
+#define ES_LocalModel_ejs_db_find_key                                  0
+#define ES_LocalModel_ejs_db_find_options                              1
+#define ES_LocalModel_ejs_db_find_grid                                 2
+#define ES_LocalModel_ejs_db_find__hoisted_3_results                   3
+#define ES_LocalModel_ejs_db_findAll_options                           0
+#define ES_LocalModel_ejs_db_findAll_grid                              1
+#define ES_LocalModel_ejs_db_findAll__hoisted_2_i                      2
+#define ES_LocalModel_ejs_db_findOneWhere_where                        0
+#define ES_LocalModel_ejs_db_findOneWhere_grid                         1
+#define ES_LocalModel_ejs_db_findWhere_where                           0
+#define ES_LocalModel_ejs_db_findWhere_count                           1
+#define ES_LocalModel_ejs_db_findWhere_grid                            2
+#define ES_LocalModel_ejs_db_findWhere__hoisted_3_i                    3
+#define ES_LocalModel_ejs_db_getColumnNames_result                     0
+#define ES_LocalModel_ejs_db_getColumnNames__hoisted_1_col             1
+#define ES_LocalModel_ejs_db_getColumnTitles_result                    0
+#define ES_LocalModel_ejs_db_getColumnTitles__hoisted_1_col            1
+#define ES_LocalModel_ejs_db_getColumnType_field                       0
+#define ES_LocalModel_ejs_db_getNumRows_cmd                            0
+#define ES_LocalModel_ejs_db_getNumRows_grid                           1
+#define ES_LocalModel_getSchema_sql                                    0
+#define ES_LocalModel_getSchema_grid                                   1
+#define ES_LocalModel_getSchema__hoisted_2_row                         2
+#define ES_LocalModel_getSchema__hoisted_3_name                        3
+#define ES_LocalModel_getSchema__hoisted_4_sqlType                     4
+#define ES_LocalModel_getSchema__hoisted_5_ejsType                     5
+#define ES_LocalModel_ejs_db_hasAndBelongsToMany_model                 0
+#define ES_LocalModel_ejs_db_hasAndBelongsToMany_options               1
+#define ES_LocalModel_ejs_db_hasError_field                            0
+#define ES_LocalModel_ejs_db_hasMany_model                             0
+#define ES_LocalModel_ejs_db_hasMany_options                           1
+#define ES_LocalModel_ejs_db_hasOne_model                              0
+#define ES_LocalModel_ejs_db_hasOne_options                            1
+#define ES_LocalModel_innerFind_key                                    0
+#define ES_LocalModel_innerFind_limit                                  1
+#define ES_LocalModel_innerFind_options                                2
+#define ES_LocalModel_innerFind_cmd                                    3
+#define ES_LocalModel_innerFind_columns                                4
+#define ES_LocalModel_innerFind_from                                   5
+#define ES_LocalModel_innerFind_conditions                             6
+#define ES_LocalModel_innerFind_where                                  7
+#define ES_LocalModel_innerFind_results                                8
+#define ES_LocalModel_innerFind__hoisted_9_index                       9
+#define ES_LocalModel_innerFind__hoisted_10_model                      10
+#define ES_LocalModel_innerFind__hoisted_11_entry                      11
+#define ES_LocalModel_innerFind__hoisted_12_owner                      12
+#define ES_LocalModel_innerFind__hoisted_13_owner                      13
+#define ES_LocalModel_innerFind__hoisted_14_tname                      14
+#define ES_LocalModel_innerFind__hoisted_15_parts                      15
+#define ES_LocalModel_innerFind__hoisted_16_whereConditions            16
+#define ES_LocalModel_innerFind__hoisted_17_cond                       17
+#define ES_LocalModel_innerFind__hoisted_18_field                      18
+#define ES_LocalModel_innerFind__hoisted_19_e                          19
+#define ES_LocalModel_makeLazyReader_rec                               0
+#define ES_LocalModel_makeLazyReader_field                             1
+#define ES_LocalModel_makeLazyReader_model                             2
+#define ES_LocalModel_makeLazyReader_key                               3
+#define ES_LocalModel_makeLazyReader_options                           4
+#define ES_LocalModel_makeLazyReader___fun_8205__                      5
+#define ES_LocalModel_makeLazyReader_lazyReader                        6
+#define ES_LocalModel_mapSqlTypeToEjs_sqlType                          0
+#define ES_LocalModel_mapSqlTypeToEjs_ejsType                          1
+#define ES_LocalModel_prepareValue_field                               0
+#define ES_LocalModel_prepareValue_value                               1
+#define ES_LocalModel_prepareValue_col                                 2
+#define ES_LocalModel_readRecords_key                                  0
+#define ES_LocalModel_readRecords_options                              1
+#define ES_LocalModel_readRecords_data                                 2
+#define ES_LocalModel_readRecords__hoisted_3_result                    3
+#define ES_LocalModel_readRecords__hoisted_4_row                       4
+#define ES_LocalModel_ejs_db_remove_keys                               0
+#define ES_LocalModel_ejs_db_remove__hoisted_1_key                     1
+#define ES_LocalModel_ejs_db_remove__hoisted_2_cmd                     2
+#define ES_LocalModel_runFilters_filters                               0
+#define ES_LocalModel_runFilters__hoisted_1_filter                     1
+#define ES_LocalModel_runFilters__hoisted_2_fn                         2
+#define ES_LocalModel_runFilters__hoisted_3_options                    3
+#define ES_LocalModel_runFilters__hoisted_4_only                       4
+#define ES_LocalModel_ejs_db_save_sql                                  0
+#define ES_LocalModel_ejs_db_save_result                               1
+#define ES_LocalModel_ejs_db_save__hoisted_2_field                     2
+#define ES_LocalModel_ejs_db_save__hoisted_3_field                     3
+#define ES_LocalModel_ejs_db_save__hoisted_4_field                     4
+#define ES_LocalModel_ejs_db_saveUpdate_fields                         0
+#define ES_LocalModel_ejs_db_saveUpdate__hoisted_1_field               1
+#define ES_LocalModel_ejs_db_setDb_database                            0
+#define ES_LocalModel_ejs_db_setKeyName_name                           0
+#define ES_LocalModel_ejs_db_setTableName_name                         0
+#define ES_LocalModel_ejs_db_sql_cmd                                   0
+#define ES_LocalModel_ejs_db_sql_count                                 1
+#define ES_LocalModel_ejs_db_trace_on                                  0
+#define ES_LocalModel_ejs_db_validateFormat_fields                     0
+#define ES_LocalModel_ejs_db_validateFormat_options                    1
+#define ES_LocalModel_ejs_db_validateNumber_fields                     0
+#define ES_LocalModel_ejs_db_validateNumber_options                    1
+#define ES_LocalModel_ejs_db_validatePresence_fields                   0
+#define ES_LocalModel_ejs_db_validatePresence_options                  1
+#define ES_LocalModel_ejs_db_validateRecord_thisType                   0
+#define ES_LocalModel_ejs_db_validateRecord__hoisted_1_validation      1
+#define ES_LocalModel_ejs_db_validateRecord__hoisted_2_check           2
+#define ES_LocalModel_ejs_db_validateRecord__hoisted_3_fields          3
+#define ES_LocalModel_ejs_db_validateRecord__hoisted_4_options         4
+#define ES_LocalModel_ejs_db_validateRecord__hoisted_5_field           5
+#define ES_LocalModel_ejs_db_validateUnique_fields                     0
+#define ES_LocalModel_ejs_db_validateUnique_options                    1
+#define ES_LocalModel_ejs_db_wrapFilter_fn                             0
+#define ES_LocalModel_ejs_db_wrapFilter_options                        1
+#define ES_LocalModel_ejs_db_constructor_fields                        0
+#define ES_LocalModel_LocalModel_fields                                0
+
+#define _ES_CHECKSUM_ejs_web 492746
+
+#endif
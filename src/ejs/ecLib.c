@@ -4087,6 +4087,7 @@ static void     addJump(EcCompiler *cp, EcNode *np, int kind);
 static void     addModule(EcCompiler *cp, EjsModule *mp);
 static EcCodeGen *allocCodeBuffer(EcCompiler *cp);
 static void     badNode(EcCompiler *cp, EcNode *np);
+static int      closeModuleFile(EcCompiler *cp);
 static void     copyCodeBuffer(EcCompiler *cp, EcCodeGen *dest, EcCodeGen *code);
 static void     createInitializer(EcCompiler *cp, EjsModule *mp);
 static void     discardStackItems(EcCompiler *cp, int preserve);
@@ -4236,8 +4237,7 @@ int ecCodeGen(EcCompiler *cp, int argc, EcNode **nodes)
         if (flushModule(cp->file, cp->state->code) < 0) {
             genError(cp, 0, "Can't write to module file %s", cp->outputFile);
         }
-        mprFree(cp->file);
-        cp->file = 0;
+        closeModuleFile(cp);
     }
     cp->file = 0;
     ecLeaveState(cp);
@@ -7400,6 +7400,7 @@ static void genWith(EcCompiler *cp, EcNode *np)
 static MprFile *openModuleFile(EcCompiler *cp, cchar *filename)
 {
     EcState     *state;
+    char        *tempPath;
 
     mprAssert(cp);
     mprAssert(filename && *filename);
@@ -7409,7 +7410,16 @@ static MprFile *openModuleFile(EcCompiler *cp, cchar *filename)
     if (cp->noout) {
         return 0;
     }
-    if ((cp->file = mprOpen(cp, filename,  O_CREAT | O_WRONLY | O_TRUNC | O_BINARY, 0664)) == 0) {
+    /*
+     *  Write to a temporary file that is renamed when complete. Loaders never see a partial module and any memory
+     *  mapped image of the prior module file remains valid.
+     */
+    mprFree(cp->filePath);
+    cp->filePath = mprStrdup(cp, filename);
+    tempPath = mprStrcat(cp, -1, filename, ".tmp", NULL);
+    cp->file = mprOpen(cp, tempPath,  O_CREAT | O_WRONLY | O_TRUNC | O_BINARY, 0664);
+    mprFree(tempPath);
+    if (cp->file == 0) {
         genError(cp, 0, "Can't create %s", filename);
         return 0;
     }
@@ -7420,6 +7430,7 @@ static MprFile *openModuleFile(EcCompiler *cp, cchar *filename)
     state->code = allocCodeBuffer(cp);
     if (ecCreateModuleHeader(cp) < 0) {
         genError(cp, 0, "Can't write module file header");
+        closeModuleFile(cp);
         return 0;
     }
     return cp->file;
@@ -7575,6 +7586,44 @@ rescan:
 /*
  *  Write the module contents
  */
+/*
+ *  Close the output file and rename it into place. If there were errors, the partial module is deleted and any prior
+ *  module file is left intact.
+ */
+static int closeModuleFile(EcCompiler *cp)
+{
+    char        *tempPath;
+    int         rc;
+
+    if (cp->file == 0 || cp->filePath == 0) {
+        return 0;
+    }
+    mprFree(cp->file);
+    cp->file = 0;
+
+    rc = 0;
+    tempPath = mprStrcat(cp, -1, cp->filePath, ".tmp", NULL);
+    if (cp->errorCount > 0 || cp->fatalError) {
+        mprDeletePath(cp, tempPath);
+        rc = EJS_ERR;
+
+    } else {
+#if BLD_WIN_LIKE
+        mprDeletePath(cp, cp->filePath);
+#endif
+        if (rename(tempPath, cp->filePath) < 0) {
+            genError(cp, 0, "Can't rename %s to %s", tempPath, cp->filePath);
+            mprDeletePath(cp, tempPath);
+            rc = EJS_ERR;
+        }
+    }
+    mprFree(tempPath);
+    mprFree(cp->filePath);
+    cp->filePath = 0;
+    return rc;
+}
+
+
 static int flushModule(MprFile *file, EcCodeGen *code)
 {
     int         len;
@@ -8045,16 +8094,24 @@ static void processModule(EcCompiler *cp, EjsModule *mp)
     }
     if (ecCreateModuleSection(cp) < 0) {
         genError(cp, 0, "Can't write module sections");
+        if (! cp->outputFile) {
+            closeModuleFile(cp);
+        }
+        mp->file = 0;
         LEAVE(cp);
         return;
     }
     if (flushModule(mp->file, code) < 0) {
         genError(cp, 0, "Can't write to module file %s", mp->name);
+        if (! cp->outputFile) {
+            closeModuleFile(cp);
+        }
+        mp->file = 0;
         LEAVE(cp);
         return;
     }
     if (! cp->outputFile) {
-        mprFree(mp->file);
+        closeModuleFile(cp);
         mp->file = 0;
         mp->code = 0;
 
@@ -8352,6 +8409,7 @@ void ecStartBreakableStatement(EcCompiler *cp, int kinds)
 
 
 
+static int      compileModule(Ejs *ejs, cchar *out, cchar *use, int argc, char **files);
 static EjsVar   *loadScriptLiteral(Ejs *ejs, cchar *script);
 static EjsVar   *loadScriptFile(Ejs *ejs, cchar *path);
 
@@ -8360,10 +8418,54 @@ int ecInitCompiler(EjsService *service)
 {
     service->loadScriptLiteral = loadScriptLiteral;
     service->loadScriptFile = loadScriptFile;
+    service->compileModule = compileModule;
     return 0;
 }
 
 
+/*
+    Compile source and module files into a module file. This indirect routine is used by the web framework to compile
+    pages without running the compiler as a separate program. A private interpreter is used so the interpreter
+    requesting the compile is not modified. Errors are thrown as exceptions in the requesting interpreter.
+ */
+static int compileModule(Ejs *ejs, cchar *out, cchar *use, int argc, char **files)
+{
+    Ejs             *compiler;
+    EcCompiler      *ec;
+    char            *list, *name, *tok;
+    int             rc;
+
+    if ((compiler = ejsCreate(ejs->service, NULL, ejs->ejsPath, EJS_FLAG_NO_EXE)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return MPR_ERR_NO_MEMORY;
+    }
+    if ((ec = ecCreateCompiler(compiler, EC_FLAGS_DEBUG, BLD_FEATURE_EJS_LANG)) == 0) {
+        mprFree(compiler);
+        ejsThrowMemoryError(ejs);
+        return MPR_ERR_NO_MEMORY;
+    }
+    ecSetOutputFile(ec, out);
+    rc = 0;
+    if (use) {
+        ec->useModules = mprCreateList(ec);
+        list = mprStrdup(ec, use);
+        for (name = mprStrTok(list, " \t", &tok); name && rc == 0; name = mprStrTok(NULL, " \t", &tok)) {
+            if (ejsLoadModule(compiler, name, -1, -1, EJS_MODULE_DONT_INIT, NULL) < 0) {
+                ejsThrowReferenceError(ejs, "Can't load module %s", name);
+                rc = EJS_ERR;
+            }
+            mprAddItem(ec->useModules, name);
+        }
+    }
+    if (rc == 0 && (ecCompile(ec, argc, files, 0) < 0 || ec->errorCount > 0)) {
+        ejsThrowSyntaxError(ejs, "%s", ec->errorMsg ? ec->errorMsg : "Can't compile module");
+        rc = EJS_ERR;
+    }
+    mprFree(compiler);
+    return rc;
+}
+
+
 /*
     Load a script file. This indirect routine is used by the core VM to compile a file when required.
  */
@@ -10281,6 +10383,9 @@ static int createFunctionSection(EcCompiler *cp, EjsVar *block, int slotNum, Ejs
     code = &fun->body.code;
     mprAssert(code);
 
+    if (cp->optimize && cp->optimizeLevel > 0) {
+        ecOptimizeFunction(cp, fun);
+    }
     if (block && slotNum >= 0) {
         trait = ejsGetPropertyTrait(ejs, block, slotNum);
 #if BLD_FEATURE_EJS_DOC
@@ -11069,6 +11174,725 @@ static int sum(cchar *name, int value)
 
 
 
+/************************************************************************/
+/*
+ *  Start of file "../src/compiler/ecOptimize.c"
+ */
+/************************************************************************/
+
+/**
+ *  ecOptimize.c - Byte code optimizer
+ *
+ *  This optional pass runs over the completed byte code of each function before it is written to a module file.
+ *  The code is decoded into instructions which are grouped into basic blocks. Loads of the constant globals true,
+ *  false, null and undefined are folded into load opcodes, branches on constant conditions are resolved, jumps to
+ *  jumps are threaded, redundant instruction pairs are combined and unreachable blocks are removed. The code is then
+ *  re-emitted using the shortest jump encodings.
+ *
+ *  Functions with exception handlers are not modified as the interpreter locates handlers by code offset.
+ *
+ *  Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+
+
+/*
+ *  Maximum optimization passes over a function and maximum jumps to follow when threading
+ */
+#define EC_OPT_MAX_PASSES       16
+#define EC_OPT_MAX_THREAD       16
+
+/*
+ *  Decoded instruction. Short jump opcodes are decoded to their long form and the encoding is chosen when emitting.
+ */
+typedef struct EcInstruction {
+    uchar       *operands;                  /* Non-jump operands in the original code */
+    int         operandLen;                 /* Length of the non-jump operands */
+    int         opcode;                     /* Instruction opcode */
+    int         target;                     /* Index of the jump target instruction or -1 */
+    int         *table;                     /* Default argument jump table. Indexes of target instructions */
+    int         tableSize;                  /* Number of entries in the default argument jump table */
+    int         block;                      /* Basic block containing the instruction */
+    int         offset;                     /* Offset in the optimized code */
+    int         length;                     /* Length in the optimized code */
+    uint        deleted: 1;                 /* Instruction has been removed */
+    uint        leader: 1;                  /* Instruction starts a basic block */
+} EcInstruction;
+
+
+typedef struct EcBasicBlock {
+    int         first;                      /* Index of the first instruction */
+    int         last;                       /* Index of the last instruction */
+    int         reachable;                  /* Block can be reached from the function entry */
+} EcBasicBlock;
+
+
+typedef struct EcOptimizer {
+    EcCompiler      *cp;
+    Ejs             *ejs;
+    EcInstruction   *instructions;          /* Instructions. instructions[count] marks the end of the code */
+    int             count;                  /* Number of instructions */
+    EcBasicBlock    *blocks;                /* Basic blocks */
+    int             numBlocks;              /* Number of basic blocks */
+    int             changed;                /* Set if the current pass modified the code */
+} EcOptimizer;
+
+
+static int  buildBlocks(EcOptimizer *op);
+static int  decodeInstructions(EcOptimizer *op, uchar *code, int len);
+static int  emitInstructions(EcOptimizer *op, uchar **codep);
+static void foldConstants(EcOptimizer *op);
+static int  isJump(int opcode);
+static int  isTerminal(int opcode);
+static int  nextInstruction(EcOptimizer *op, int index);
+static void optimizeInstructions(EcOptimizer *op);
+static void removeUnreachable(EcOptimizer *op);
+static int  threadJump(EcOptimizer *op, int target);
+
+/*
+ *  Optimize the byte code for a function. Returns the number of bytes saved.
+ */
+int ecOptimizeFunction(EcCompiler *cp, EjsFunction *fun)
+{
+    EcOptimizer     *op;
+    EjsCode         *code;
+    uchar           *buf;
+    int             pass, len, saved;
+
+    code = &fun->body.code;
+    if (code->codeLen <= 0 || code->numHandlers > 0) {
+        return 0;
+    }
+    if ((op = mprAllocObjZeroed(cp, EcOptimizer)) == 0) {
+        return 0;
+    }
+    op->cp = cp;
+    op->ejs = cp->ejs;
+    saved = 0;
+
+    if (decodeInstructions(op, code->byteCode, code->codeLen) == 0) {
+        foldConstants(op);
+        for (pass = 0; pass < EC_OPT_MAX_PASSES; pass++) {
+            op->changed = 0;
+            if (buildBlocks(op) < 0) {
+                break;
+            }
+            removeUnreachable(op);
+            optimizeInstructions(op);
+            if (!op->changed) {
+                break;
+            }
+        }
+        if ((len = emitInstructions(op, &buf)) > 0 && len <= code->codeLen) {
+            saved = code->codeLen - len;
+            ejsSetFunctionCode(fun, buf, len);
+        }
+    }
+    mprFree(op);
+    return saved;
+}
+
+
+/*
+ *  Decode the byte code into instructions. Jump offsets are converted to instruction indexes. Returns a negative
+ *  error code if the code uses an encoding the optimizer does not handle.
+ */
+static int decodeInstructions(EcOptimizer *op, uchar *code, int len)
+{
+    EjsOptable      *optable, *opt;
+    EcInstruction   *ip;
+    uchar           *pc, *end, *start;
+    int             *index, *targets, *argp;
+    int             maxOp, opcode, i, j, t;
+
+    optable = ejsGetOptable(op->cp);
+    for (maxOp = 0, opt = optable; opt->name; opt++) {
+        maxOp++;
+    }
+
+    /*
+     *  Every instruction is at least one byte. Targets hold the raw target offsets until all instructions are decoded.
+     */
+    op->instructions = (EcInstruction*) mprAllocZeroed(op, (len + 1) * (int) sizeof(EcInstruction));
+    index = (int*) mprAlloc(op, (len + 1) * (int) sizeof(int));
+    targets = (int*) mprAlloc(op, (len + 1) * (int) sizeof(int));
+    if (op->instructions == 0 || index == 0 || targets == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    for (i = 0; i <= len; i++) {
+        index[i] = -1;
+    }
+    end = &code[len];
+
+    for (pc = code, i = 0; pc < end; i++) {
+        ip = &op->instructions[i];
+        start = pc;
+        index[pc - code] = i;
+        targets[i] = -1;
+        ip->target = -1;
+        opcode = *pc++;
+        if (opcode >= maxOp) {
+            return MPR_ERR_BAD_FORMAT;
+        }
+        ip->opcode = opcode;
+        opt = &optable[opcode];
+
+        if (opcode == EJS_OP_DEBUG) {
+            /* Filename, line number and source line */
+            ejsDecodeNum(&pc);
+            ejsDecodeNum(&pc);
+            ejsDecodeNum(&pc);
+
+        } else {
+            for (argp = opt->args; *argp; argp++) {
+                switch (*argp) {
+                case EBC_BYTE:
+                    pc++;
+                    break;
+
+                case EBC_DOUBLE:
+                    pc += sizeof(double);
+                    break;
+
+                case EBC_NUM:
+                case EBC_STRING:
+                case EBC_SLOT:
+                case EBC_ARGC:
+                case EBC_ARGC2:
+                case EBC_ARGC3:
+                    ejsDecodeNum(&pc);
+                    break;
+
+                case EBC_GLOBAL:
+                    t = (int) ejsDecodeNum(&pc);
+                    if (t >= 0 && (t & EJS_ENCODE_GLOBAL_MASK) == EJS_ENCODE_GLOBAL_NAME) {
+                        ejsDecodeNum(&pc);
+                    }
+                    break;
+
+                case EBC_JMP:
+                    t = ejsDecodeWord(&pc);
+                    targets[i] = (int) (pc - code) + t;
+                    break;
+
+                case EBC_JMP8:
+                    t = (schar) *pc++;
+                    targets[i] = (int) (pc - code) + t;
+                    break;
+
+                case EBC_INIT_DEFAULT8:
+                    ip->tableSize = *pc++;
+                    if ((ip->table = (int*) mprAlloc(op, (ip->tableSize + 1) * (int) sizeof(int))) == 0) {
+                        return MPR_ERR_NO_MEMORY;
+                    }
+                    for (j = 0; j < ip->tableSize; j++) {
+                        /* Entries are relative to the start of the table. Convert to indexes below */
+                        ip->table[j] = (int) (pc - code) + pc[j];
+                    }
+                    pc += ip->tableSize;
+                    break;
+
+                default:
+                    /* Long default argument tables are left unoptimized */
+                    return MPR_ERR_BAD_FORMAT;
+                }
+            }
+        }
+        if (pc > end) {
+            return MPR_ERR_BAD_FORMAT;
+        }
+        if (targets[i] >= 0 || ip->table) {
+            ip->operands = 0;
+            ip->operandLen = 0;
+        } else {
+            ip->operands = start + 1;
+            ip->operandLen = (int) (pc - start) - 1;
+        }
+        if (opcode == EJS_OP_GOTO_8) {
+            ip->opcode = EJS_OP_GOTO;
+        } else if (opcode == EJS_OP_BRANCH_TRUE_8) {
+            ip->opcode = EJS_OP_BRANCH_TRUE;
+        } else if (opcode == EJS_OP_BRANCH_FALSE_8) {
+            ip->opcode = EJS_OP_BRANCH_FALSE;
+        }
+    }
+    op->count = i;
+    index[len] = op->count;
+    op->instructions[op->count].opcode = -1;
+    op->instructions[op->count].target = -1;
+
+    /*
+     *  Map jump offsets to instruction indexes. All jumps must land on an instruction boundary.
+     */
+    for (i = 0; i < op->count; i++) {
+        ip = &op->instructions[i];
+        if (targets[i] >= 0) {
+            if (targets[i] > len || index[targets[i]] < 0) {
+                return MPR_ERR_BAD_FORMAT;
+            }
+            ip->target = index[targets[i]];
+        }
+        for (j = 0; j < ip->tableSize; j++) {
+            t = ip->table[j];
+            if (t < 0 || t > len || index[t] < 0) {
+                return MPR_ERR_BAD_FORMAT;
+            }
+            ip->table[j] = index[t];
+        }
+    }
+    mprFree(index);
+    mprFree(targets);
+    return 0;
+}
+
+
+/*
+ *  Fold loads of the constant global values into direct load opcodes
+ */
+static void foldConstants(EcOptimizer *op)
+{
+    Ejs             *ejs;
+    EcInstruction   *ip;
+    EjsName         qname;
+    uchar           *pc;
+    int             i, slotNum, opcode;
+
+    ejs = op->ejs;
+
+    for (i = 0; i < op->count; i++) {
+        ip = &op->instructions[i];
+        if (ip->opcode != EJS_OP_GET_GLOBAL_SLOT) {
+            continue;
+        }
+        pc = ip->operands;
+        slotNum = (int) ejsDecodeNum(&pc);
+        if (slotNum < 0 || slotNum >= ejsGetPropertyCount(ejs, ejs->global)) {
+            continue;
+        }
+        qname = ejsGetPropertyName(ejs, ejs->global, slotNum);
+        if (qname.name == 0 || qname.space == 0 || strcmp(qname.space, EJS_INTRINSIC_NAMESPACE) != 0) {
+            continue;
+        }
+        if (strcmp(qname.name, "true") == 0) {
+            opcode = EJS_OP_LOAD_TRUE;
+        } else if (strcmp(qname.name, "false") == 0) {
+            opcode = EJS_OP_LOAD_FALSE;
+        } else if (strcmp(qname.name, "null") == 0) {
+            opcode = EJS_OP_LOAD_NULL;
+        } else if (strcmp(qname.name, "undefined") == 0) {
+            opcode = EJS_OP_LOAD_UNDEFINED;
+        } else {
+            continue;
+        }
+        ip->opcode = opcode;
+        ip->operands = 0;
+        ip->operandLen = 0;
+    }
+}
+
+
+/*
+ *  Return the index of the first live instruction at or after index. Returns op->count for the end of code.
+ */
+static int nextInstruction(EcOptimizer *op, int index)
+{
+    while (index < op->count && op->instructions[index].deleted) {
+        index++;
+    }
+    return index;
+}
+
+
+static int isJump(int opcode)
+{
+    return (EJS_OP_BRANCH_EQ <= opcode && opcode <= EJS_OP_BRANCH_ZERO) || opcode == EJS_OP_GOTO;
+}
+
+
+/*
+ *  Return true if control can't fall through to the next instruction
+ */
+static int isTerminal(int opcode)
+{
+    switch (opcode) {
+    case EJS_OP_GOTO:
+    case EJS_OP_INIT_DEFAULT_ARGS_8:
+    case EJS_OP_RETURN:
+    case EJS_OP_RETURN_VALUE:
+    case EJS_OP_THROW:
+    case EJS_OP_END_CODE:
+        return 1;
+    }
+    return 0;
+}
+
+
+/*
+ *  Partition the live instructions into basic blocks. Blocks start at jump targets and after jumps and terminal
+ *  instructions.
+ */
+static int buildBlocks(EcOptimizer *op)
+{
+    EcInstruction   *ip;
+    EcBasicBlock    *bp;
+    int             i, j, next;
+
+    for (i = 0; i <= op->count; i++) {
+        op->instructions[i].leader = 0;
+    }
+    op->instructions[nextInstruction(op, 0)].leader = 1;
+
+    for (i = nextInstruction(op, 0); i < op->count; i = next) {
+        ip = &op->instructions[i];
+        next = nextInstruction(op, i + 1);
+        if (ip->target >= 0) {
+            ip->target = nextInstruction(op, ip->target);
+            op->instructions[ip->target].leader = 1;
+        }
+        for (j = 0; j < ip->tableSize; j++) {
+            ip->table[j] = nextInstruction(op, ip->table[j]);
+            op->instructions[ip->table[j]].leader = 1;
+        }
+        if (ip->target >= 0 || isTerminal(ip->opcode)) {
+            op->instructions[next].leader = 1;
+        }
+    }
+
+    mprFree(op->blocks);
+    op->numBlocks = 0;
+    if ((op->blocks = (EcBasicBlock*) mprAllocZeroed(op, (op->count + 1) * (int) sizeof(EcBasicBlock))) == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    bp = 0;
+    for (i = nextInstruction(op, 0); i < op->count; i = nextInstruction(op, i + 1)) {
+        ip = &op->instructions[i];
+        if (ip->leader || bp == 0) {
+            bp = &op->blocks[op->numBlocks++];
+            bp->first = i;
+        }
+        bp->last = i;
+        ip->block = (int) (bp - op->blocks);
+    }
+    return 0;
+}
+
+
+/*
+ *  Delete the instructions of blocks that can't be reached from the function entry
+ */
+static void removeUnreachable(EcOptimizer *op)
+{
+    EcInstruction   *ip;
+    EcBasicBlock    *bp;
+    int             *stack, sp, b, i, j, target;
+
+    if (op->numBlocks == 0) {
+        return;
+    }
+    if ((stack = (int*) mprAlloc(op, (op->numBlocks + 1) * (int) sizeof(int))) == 0) {
+        return;
+    }
+    sp = 0;
+    op->blocks[0].reachable = 1;
+    stack[sp++] = 0;
+
+    while (sp > 0) {
+        bp = &op->blocks[stack[--sp]];
+        ip = &op->instructions[bp->last];
+        for (j = -2; j < ip->tableSize; j++) {
+            if (j == -2) {
+                /* Fall through to the next block */
+                b = isTerminal(ip->opcode) ? -1 : (int) (bp - op->blocks) + 1;
+            } else {
+                target = (j == -1) ? ip->target : ip->table[j];
+                b = (target >= 0 && target < op->count) ? op->instructions[target].block : -1;
+            }
+            if (0 <= b && b < op->numBlocks && !op->blocks[b].reachable) {
+                op->blocks[b].reachable = 1;
+                stack[sp++] = b;
+            }
+        }
+    }
+    for (b = 0; b < op->numBlocks; b++) {
+        bp = &op->blocks[b];
+        if (!bp->reachable) {
+            for (i = bp->first; i <= bp->last; i++) {
+                op->instructions[i].deleted = 1;
+            }
+            op->changed = 1;
+        }
+    }
+    mprFree(stack);
+}
+
+
+/*
+ *  Follow a chain of unconditional jumps to the final destination
+ */
+static int threadJump(EcOptimizer *op, int target)
+{
+    EcInstruction   *tp;
+    int             hops, next;
+
+    target = nextInstruction(op, target);
+    for (hops = 0; hops < EC_OPT_MAX_THREAD && target < op->count; hops++) {
+        tp = &op->instructions[target];
+        if (tp->opcode != EJS_OP_GOTO) {
+            break;
+        }
+        next = nextInstruction(op, tp->target);
+        if (next == target) {
+            break;
+        }
+        target = next;
+    }
+    return target;
+}
+
+
+/*
+ *  Peephole optimizations and jump threading over the live instructions
+ */
+static void optimizeInstructions(EcOptimizer *op)
+{
+    EcInstruction   *ip, *np, *tp;
+    int             i, next, target, taken;
+
+    for (i = nextInstruction(op, 0); i < op->count; i = nextInstruction(op, i + 1)) {
+        ip = &op->instructions[i];
+        next = nextInstruction(op, i + 1);
+        np = &op->instructions[next];
+
+        if (isJump(ip->opcode)) {
+            target = threadJump(op, ip->target);
+            if (target != ip->target) {
+                ip->target = target;
+                op->changed = 1;
+            }
+            if (ip->opcode == EJS_OP_GOTO) {
+                tp = &op->instructions[target];
+                if (target == next) {
+                    /* Jump to the next instruction */
+                    ip->deleted = 1;
+                    op->changed = 1;
+
+                } else if (tp->opcode == EJS_OP_RETURN || tp->opcode == EJS_OP_RETURN_VALUE) {
+                    /* Jump to a return */
+                    ip->opcode = tp->opcode;
+                    ip->target = -1;
+                    op->changed = 1;
+                }
+            }
+            continue;
+        }
+        if (next >= op->count || np->leader) {
+            continue;
+        }
+        switch (ip->opcode) {
+        case EJS_OP_LOAD_TRUE:
+        case EJS_OP_LOAD_FALSE:
+            if (np->opcode == EJS_OP_BRANCH_TRUE || np->opcode == EJS_OP_BRANCH_FALSE) {
+                /* Branch on a constant condition */
+                taken = (ip->opcode == EJS_OP_LOAD_TRUE) == (np->opcode == EJS_OP_BRANCH_TRUE);
+                if (taken) {
+                    ip->opcode = EJS_OP_GOTO;
+                    ip->target = np->target;
+                } else {
+                    ip->deleted = 1;
+                }
+                np->deleted = 1;
+                op->changed = 1;
+
+            } else if (np->opcode == EJS_OP_LOGICAL_NOT) {
+                ip->opcode = (ip->opcode == EJS_OP_LOAD_TRUE) ? EJS_OP_LOAD_FALSE : EJS_OP_LOAD_TRUE;
+                np->deleted = 1;
+                op->changed = 1;
+            }
+            break;
+
+        case EJS_OP_LOGICAL_NOT:
+            if (np->opcode == EJS_OP_BRANCH_TRUE || np->opcode == EJS_OP_BRANCH_FALSE) {
+                /* Both cast to boolean so the negation can be folded into the branch */
+                ip->opcode = (np->opcode == EJS_OP_BRANCH_TRUE) ? EJS_OP_BRANCH_FALSE : EJS_OP_BRANCH_TRUE;
+                ip->target = np->target;
+                np->deleted = 1;
+                op->changed = 1;
+            }
+            break;
+
+        case EJS_OP_GET_LOCAL_SLOT_0: case EJS_OP_GET_LOCAL_SLOT_1: case EJS_OP_GET_LOCAL_SLOT_2:
+        case EJS_OP_GET_LOCAL_SLOT_3: case EJS_OP_GET_LOCAL_SLOT_4: case EJS_OP_GET_LOCAL_SLOT_5:
+        case EJS_OP_GET_LOCAL_SLOT_6: case EJS_OP_GET_LOCAL_SLOT_7: case EJS_OP_GET_LOCAL_SLOT_8:
+        case EJS_OP_GET_LOCAL_SLOT_9:
+            if (np->opcode == ip->opcode - EJS_OP_GET_LOCAL_SLOT_0 + EJS_OP_PUT_LOCAL_SLOT_0) {
+                /* Store of a local back to itself */
+                ip->deleted = 1;
+                np->deleted = 1;
+                op->changed = 1;
+            }
+            break;
+
+        case EJS_OP_PUT_LOCAL_SLOT_0: case EJS_OP_PUT_LOCAL_SLOT_1: case EJS_OP_PUT_LOCAL_SLOT_2:
+        case EJS_OP_PUT_LOCAL_SLOT_3: case EJS_OP_PUT_LOCAL_SLOT_4: case EJS_OP_PUT_LOCAL_SLOT_5:
+        case EJS_OP_PUT_LOCAL_SLOT_6: case EJS_OP_PUT_LOCAL_SLOT_7: case EJS_OP_PUT_LOCAL_SLOT_8:
+        case EJS_OP_PUT_LOCAL_SLOT_9:
+            if (np->opcode == ip->opcode - EJS_OP_PUT_LOCAL_SLOT_0 + EJS_OP_GET_LOCAL_SLOT_0) {
+                /* Reload of a just stored local. Keep the value on the stack instead */
+                np->opcode = ip->opcode;
+                ip->opcode = EJS_OP_DUP;
+                op->changed = 1;
+            }
+            break;
+
+        case EJS_OP_SWAP:
+            if (np->opcode == EJS_OP_SWAP) {
+                ip->deleted = 1;
+                np->deleted = 1;
+                op->changed = 1;
+            }
+            break;
+        }
+    }
+}
+
+
+/*
+ *  Lay out and encode the live instructions. Jumps start with the short encoding and are widened until every
+ *  displacement fits. Returns the code length or a negative error code.
+ */
+static int emitInstructions(EcOptimizer *op, uchar **codep)
+{
+    EcInstruction   *ip;
+    uchar           *code, *pc;
+    int             i, j, offset, dist, widened, len;
+
+    for (i = 0; i < op->count; i++) {
+        ip = &op->instructions[i];
+        if (ip->opcode == EJS_OP_GOTO || ip->opcode == EJS_OP_BRANCH_TRUE || ip->opcode == EJS_OP_BRANCH_FALSE) {
+            ip->length = 2;
+        } else if (ip->target >= 0) {
+            ip->length = 5;
+        } else if (ip->table) {
+            ip->length = 2 + ip->tableSize;
+        } else {
+            ip->length = 1 + ip->operandLen;
+        }
+    }
+    do {
+        offset = 0;
+        for (i = 0; i <= op->count; i++) {
+            ip = &op->instructions[i];
+            ip->offset = offset;
+            if (!ip->deleted && i < op->count) {
+                offset += ip->length;
+            }
+        }
+        widened = 0;
+        for (i = nextInstruction(op, 0); i < op->count; i = nextInstruction(op, i + 1)) {
+            ip = &op->instructions[i];
+            if (ip->target >= 0 && ip->length == 2) {
+                dist = op->instructions[ip->target].offset - (ip->offset + 2);
+                if (dist < -128 || dist > 127) {
+                    ip->length = 5;
+                    widened = 1;
+                }
+            }
+        }
+    } while (widened);
+
+    len = offset;
+    if ((code = (uchar*) mprAlloc(op, len + 1)) == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    pc = code;
+    for (i = nextInstruction(op, 0); i < op->count; i = nextInstruction(op, i + 1)) {
+        ip = &op->instructions[i];
+        mprAssert(pc == &code[ip->offset]);
+        if (ip->target >= 0) {
+            dist = op->instructions[ip->target].offset - (ip->offset + ip->length);
+            if (ip->length == 2) {
+                if (ip->opcode == EJS_OP_GOTO) {
+                    *pc++ = EJS_OP_GOTO_8;
+                } else {
+                    *pc++ = (ip->opcode == EJS_OP_BRANCH_TRUE) ? EJS_OP_BRANCH_TRUE_8 : EJS_OP_BRANCH_FALSE_8;
+                }
+                *pc++ = (uchar) (schar) dist;
+            } else {
+                *pc++ = (uchar) ip->opcode;
+                if (abs(dist) > EJS_ENCODE_MAX_WORD) {
+                    return MPR_ERR_BAD_FORMAT;
+                }
+                pc += ejsEncodeWord(pc, dist);
+            }
+
+        } else if (ip->table) {
+            *pc++ = (uchar) ip->opcode;
+            *pc++ = (uchar) ip->tableSize;
+            for (j = 0; j < ip->tableSize; j++) {
+                /* Table entries are unsigned displacements from the start of the table */
+                dist = op->instructions[ip->table[j]].offset - (ip->offset + 2);
+                if (dist < 0 || dist >= 0x7f) {
+                    return MPR_ERR_BAD_FORMAT;
+                }
+                *pc++ = (uchar) dist;
+            }
+
+        } else {
+            *pc++ = (uchar) ip->opcode;
+            if (ip->operandLen > 0) {
+                memcpy(pc, ip->operands, ip->operandLen);
+                pc += ip->operandLen;
+            }
+        }
+    }
+    *codep = code;
+    return len;
+}
+
+
+/*
+ *  @copy   default
+ *
+ *  Copyright (c) Embedthis Software LLC, 2003-2011. All Rights Reserved.
+ *  Copyright (c) Michael O'Brien, 1993-2011. All Rights Reserved.
+ *
+ *  This software is distributed under commercial and open source licenses.
+ *  You may use the GPL open source license described below or you may acquire
+ *  a commercial license from Embedthis Software. You agree to be fully bound
+ *  by the terms of either license. Consult the LICENSE.TXT distributed with
+ *  this software for full details.
+ *
+ *  This software is open source; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 2 of the License, or (at your
+ *  option) any later version. See the GNU General Public License for more
+ *  details at: http://www.embedthis.com/downloads/gplLicense.html
+ *
+ *  This program is distributed WITHOUT ANY WARRANTY; without even the
+ *  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  This GPL license does NOT permit incorporating this software into
+ *  proprietary programs. If you are unable to comply with the GPL, you must
+ *  acquire a commercial license to use this software. Commercial licenses
+ *  for this software and support services are available from Embedthis
+ *  Software at http://www.embedthis.com
+ *
+ *  Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
+/************************************************************************/
+/*
+ *  End of file "../src/compiler/ecOptimize.c"
+ */
+/************************************************************************/
+
+
+
 /************************************************************************/
 /*
  *  Start of file "../src/compiler/ecParser.c"
@@ -11545,6 +12369,9 @@ EcCompiler *ecCreateCompiler(Ejs *ejs, int flags, int langLevel)
     if (flags & EC_FLAGS_NO_OUT) {
         cp->noout = 1;
     }
+    if (flags & EC_FLAGS_OPTIMIZE) {
+        cp->optimize = 1;
+    }
     if (ecResetModuleList(cp) < 0) {
         mprFree(cp);
         return 0;
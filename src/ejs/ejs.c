@@ -55,7 +55,7 @@ static void setupSignals();
     cchar           *cmd, *className, *methodName;
     char            *argp, *searchPath, *modules, *name, *tok, *extraFiles, *spec;
     int             nextArg, err, ecFlags, stats, run, merge, bind, noout, debug, optimizeLevel, warnLevel;
-    int             compilerMode, lang;
+    int             compilerMode, lang, ejsFlags;
 
     /*
      *  Create the Embedthis Portable Runtime (MPR) and setup a memory failure handler
@@ -80,6 +80,7 @@ static void setupSignals();
     bind = 1;
     noout = 1;
     debug = 1;
+    ejsFlags = 0;
     warnLevel = 1;
     optimizeLevel = 9;
     compilerMode = PRAGMA_MODE_STANDARD;
@@ -161,6 +162,9 @@ static void setupSignals();
         } else if (strcmp(argp, "--nodebug") == 0) {
             debug = 0;
 
+        } else if (strcmp(argp, "--noinline") == 0) {
+            ejsFlags |= EJS_FLAG_NO_INLINE_CACHE;
+
         } else if (strcmp(argp, "--optimize") == 0) {
             if (nextArg >= argc) {
                 err++;
@@ -237,6 +241,7 @@ static void setupSignals();
             "  --log logSpec            # Internal compiler diagnostics logging\n"
             "  --method methodName      # Name of method to run. Defaults to main\n"
             "  --nodebug                # Omit symbolic debugging information\n"
+            "  --noinline               # Disable inline caching of property lookups\n"
             "  --optimize level         # Set the optimization level (0-9 default is 9)\n"
             "  --search ejsPath         # Module search path\n"
             "  --standard               # Default compilation mode to standard (default)\n"
@@ -255,7 +260,7 @@ static void setupSignals();
     }
     ecInitCompiler(vmService);
 
-    ejs = ejsCreate(vmService, NULL, searchPath, 0);
+    ejs = ejsCreate(vmService, NULL, searchPath, ejsFlags);
     if (ejs == 0) {
         return MPR_ERR_NO_MEMORY;
     }
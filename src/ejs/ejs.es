@@ -3829,6 +3829,14 @@ module ejs {
          */
         native function RegExp(pattern: String, flags: String = null)
 
+        /**
+         *  Compiled pattern cache statistics. Compiled patterns are held in a process-wide cache keyed by the pattern 
+         *  and flags, and are shared by all interpreters.
+         *  @return An object with properties: hits, misses, entries and evicted.
+         *  @spec ejs
+         */
+        native static function get cache(): Object
+
         /**
          *  The integer index of the end of the last match plus one. This is the index to start the next match for
          *  global patterns. This is only set if the "g" flag was used.
@@ -3873,6 +3881,13 @@ module ejs {
          */
         native function get multiline(): Boolean
 
+        /**
+         *  Set the maximum number of compiled patterns to cache. Idle patterns beyond the limit are discarded.
+         *  @param max Maximum number of cached patterns. Set to zero to disable caching.
+         *  @spec ejs
+         */
+        native static function setCacheLimit(max: Number): Void
+
         /**
          *  Regular expression source pattern currently set
          */
@@ -4972,11 +4987,13 @@ module ejs.db {
          *  Execute a SQL command on the database. This is a low level SQL command interface that bypasses logging.
          *      Use @query instead.
             @param cmd SQL command to issue. Note: "SELECT" is automatically prepended and ";" is appended for you.
+            @param params Values to bind in order to "?" placeholders in the command. Bound values are not interpreted
+                as SQL and do not need quoting.
          *  @returns An array of row results where each row is represented by an Object hash containing the column 
          *      names and values
          */
-        function sql(cmd: String): Array
-            _adapter.sql(cmd)
+        function sql(cmd: String, ...params): Array
+            _adapter.sql.apply(_adapter, [cmd].concat(params))
 
         /**
          *  Map the SQL type to a database independant data type
@@ -5166,7 +5183,7 @@ module ejs.db {
         function rollback(): Void
 
         /** @duplicate ejs.db::Database.sql */
-        function sql(cmd: String): Array
+        function sql(cmd: String, ...params): Array
 
         /** @duplicate ejs.db::Database.sqlTypeToDataType */
         function sqlTypeToDataType(sqlType: String): String
@@ -6463,7 +6480,8 @@ module ejs.db.sqlite {
                 <ul>
                     <li>filename</li>
                 </ul>
-                Where filename is the path to the database. 
+                Where filename is the path to the database. Connections to database files are taken from a 
+                process-wide pool and returned to it by close() so they can be reused by later interpreters.
          */
         native "ejs.db" function Sqlite(connectionString: String)
 
@@ -6653,8 +6671,12 @@ module ejs.db.sqlite {
             return sql(cmd)
         }
 
-        /** @duplicate ejs.db::Database.sql */
-        native function sql(cmd: String): Array
+        /** 
+            @duplicate ejs.db::Database.sql 
+            Single commands are prepared once per connection and cached. Use params rather than building command
+            strings with literal values so repeated commands reuse the cached statement.
+         */
+        native function sql(cmd: String, ...params): Array
 
         /** @duplicate ejs.db::Database.sqlTypeToDataType */
         static function sqlTypeToDataType(sqlType: String): String
@@ -8293,6 +8315,26 @@ module ejs.io {
          */
         native function options(uri: String = null): Void
 
+        /**
+            Issue GET requests for a set of uris over one connection without waiting for each response (HTTP 
+            pipelining). Responses are read in request order. If the server closes the connection early or a response
+            must be retried for a redirection or authentication, the remaining requests are reissued normally. 
+            A uri for a different host, port or scheme than the current connection is also issued normally, and the
+            following requests are pipelined on its connection.
+            @param uris Array of uris to request.
+            @return An array of response objects in request order. Each response has "uri", "code" and "response" 
+                properties.
+            @throws IOError if a request cannot be issued to the remote server.
+         */
+        native function pipeline(uris: Array): Array
+
+        /**
+            Keep-alive connection pool statistics. Completed keep-alive connections are held in a process-wide pool and
+            reused by any Http object, in any interpreter, for later requests to the same host and port.
+            @return An object with properties: opened, reused, idle, expired, discarded and pipelined.
+         */
+        native static function get pool(): Object
+
         /**
             Initiate a POST request for the current uri. Posted data is NOT URL encoded. If you want to post data to a 
             form, consider using the $form method instead which automatically URL encodes the data. Post data may be 
@@ -8400,6 +8442,14 @@ module ejs.io {
          */
         native function setCredentials(username: String, password: String): Void
 
+        /**
+            Set the keep-alive connection pool limits.
+            @param maxPerHost Maximum number of idle connections to retain for each host and port. Set to zero to 
+                disable pooling. Set to -1 to leave unchanged.
+            @param timeout Time in milliseconds to retain an idle connection. Set to -1 to leave unchanged.
+         */
+        native static function setPoolLimits(maxPerHost: Number = -1, timeout: Number = -1): Void
+
         /**
             Request timeout in milliseconds. This is the idle timeout value. If the request has no I/O activity for 
             this time period, it will be retried or aborted.
@@ -10409,6 +10459,33 @@ module ejs.sys {
          */
         native static function set workQuota(quota: Number): Void
 
+        /**
+         *  The maximum time in milliseconds for one step of an incremental collection. Collections triggered by the
+         *  work quota are done in steps so that the program is not paused for long. Steps are also run when the
+         *  program is idle waiting for events. Set to zero to do each collection in one step.
+         */
+        native static function get pauseBudget(): Number
+
+        /**
+         *  @duplicate GC.pauseBudget
+         *  @param msec Maximum milliseconds for one collection step.
+         */
+        native static function set pauseBudget(msec: Number): Void
+
+        /**
+         *  Garbage collector pause statistics. The returned object has properties: collections, steps, count (number 
+         *  of pauses), total and max (pause times in microseconds), histogram and limits. The histogram is an array 
+         *  of pause counts where each element counts the pauses shorter than the corresponding limits element in 
+         *  microseconds. The last histogram element counts all longer pauses.
+         */
+        native static function get pauses(): Object
+
+        /**
+         *  Reset the pause statistics so the pauses of a phase of the program can be measured on their own. The
+         *  collections and steps totals are not reset.
+         */
+        native static function resetPauses(): Void
+
         /**
          *  Run the garbage collector and reclaim memory allocated to objects and properties that are no longer reachable. 
          *  When objects and properties are freed, any registered destructors will be called. The run function will run 
@@ -11389,10 +11466,14 @@ module ejs.sys {
 
         /**
          *  Post a message to the Worker's parent
-         *  @param data Data to pass to the worker's onmessage callback.
-         *  @param ports Not implemented
+         *  @param data Data to pass to the worker's onmessage callback. The data is cloned into the receiving 
+         *      interpreter using a binary structured clone. Strings, numbers, booleans, dates, byte arrays, arrays and 
+         *      objects are supported including shared and cyclic references. Other objects are received as plain
+         *      objects with the same enumerable properties. Functions are not cloned.
+         *  @param transfer Optional array of ByteArrays in data whose buffers are passed by ownership rather than 
+         *      copied. Transferred ByteArrays are left empty in the sending interpreter.
          */
-        native function postMessage(data: Object, ports: Array = null): Void
+        native function postMessage(data: Object, transfer: Array = null): Void
 
         /**
          *  Terminate the worker
@@ -11430,10 +11511,11 @@ module ejs.sys {
     /**
      *  Post a message to the Worker's parent
      *  @param data Data to pass to the worker's onmessage callback.
+     *  @param transfer Optional array of ByteArrays in data to pass by ownership. See Worker.postMessage.
      *  This is only valid inside Worker scripts.
      */
-    function postMessage(data: Object): Void
-        self.postMessage(data, null)
+    function postMessage(data: Object, transfer: Array = null): Void
+        self.postMessage(data, transfer)
 
     /**
      *  The error callback function
@@ -11499,8 +11581,6 @@ module ejs.web {
 
         use default namespace public
 
-        private static var cache: Object = {}
-
         /**
          *  @options connect Connection string for the cache store
          *  @options timeout Timeout on cache I/O operations
@@ -13094,8 +13174,14 @@ module ejs.web {
         # FUTURE
         function renderXml(): Void {}
 
-        # FUTURE
-        function renderJSON(): Void {}
+        /**
+         *  Render an object back to the client as JSON
+         *  @param data Object to serialize
+         */
+        function renderJSON(data: Object): Void {
+            rendered = true
+            writeJSON(data)
+        }
 
         /**
          *  Render a view template
@@ -13231,6 +13317,13 @@ module ejs.web {
          */
         native function write(...args): Void
 
+        /**
+         *  Write an object to the client as JSON. The object is serialized straight into the response in chunks 
+         *  rather than being converted to a string first. The encoding is the same as serialize().
+         *  @param data Object to serialize
+         */
+        native function writeJSON(data: Object): Void
+
         /**
          *  Send text back to the client which must first be HTML escaped
          *  @param args Objects to emit
@@ -13394,6 +13487,352 @@ module ejs.web {
 
 
 
+/************************************************************************/
+/*
+ *  Start of file "../src/es/web/EjsParser.es"
+ */
+/************************************************************************/
+
+/**
+ *  EjsParser.es -- Ejs page parser
+ */
+
+module ejs.web {
+
+    /**
+     *  Ejs page parser. Parse an Ejs page and emit the equivalent Ejscript. This is used by the ejsweb program and when 
+     *  pages are compiled within the web server, so both generate the same view classes. It supports:
+     *
+     *    <%                    Begin an ejs directive section containing statements
+     *    <%=                   Begin an ejs directive section that contains an expression to evaluate and substitute
+     *    %>                    End an ejs directive
+     *    <%@ include "file" %> Include an ejs file
+     *    <%@ layout "file" %>  Specify a layout page to use. Use layout "" to disable layout management.
+     *
+     *  Directives for use outside of <% %> 
+     *    @@var                 To expand the value of "var". Var can also be simple expressions (without spaces).
+     *
+     *  @spec ejs
+     *  @stability prototype
+     *  @hide
+     */
+    class EjsParser {
+
+        use default namespace public
+
+        /*
+         *  Parser tokens
+         */
+        private static const Err         = -1        /* Any input error */
+        private static const Eof         = 0         /* End of file */
+        private static const EjsTag      = 1         /* <% text %> */
+        private static const Var         = 2         /* @@var */
+        private static const Literal     = 3         /* literal HTML */
+        private static const Equals      = 4         /* <%= expression */
+        private static const Control     = 6         /* <%@ control */
+
+        private const ContentMarker: String         = "__ejs:CONTENT:ejs__"
+        private const ContentPattern: RegExp        = new RegExp(ContentMarker)
+        private const LayoutsDir: String            = "views/layouts"
+
+        /**
+         *  View class template. ${CONTROLLER} is replaced with the controller prefix and ${VIEW} with the view name.
+         */
+        static const ViewHeader = 
+'
+
+public dynamic class ${CONTROLLER}${VIEW}View extends View {
+    function ${CONTROLLER}${VIEW}View(c: Controller) {
+        super(c)
+    }
+
+    override public function render() {
+'
+
+        static const ViewFooter = '
+    }
+}
+'
+
+        private var appBaseDir: String
+        private var script: String
+        private var pos: Number                     = 0
+        private var lineNumber: Number              = 0
+        private var layoutPage: String
+
+        /**
+         *  Parse an Ejs page and return the view class source that renders it
+         *  @param file Ejs page to parse
+         *  @param appDir Application directory. Relative layout pages are found under the "views/layouts" directory here.
+         *  @param layout Layout page to wrap the page. Set to undefined for no layout.
+         *  @param prefix View class name prefix. This is the controller name followed by "_", or "_Solo_" for stand-alone
+         *      pages.
+         *  @param view View name
+         *  @return Ejscript source for the view class
+         */
+        static function buildView(file: String, appDir: String, layout: String, prefix: String, view: String): String {
+            let result: String = ViewHeader + new EjsParser().parse(file, appDir, layout) + ViewFooter
+            result = result.replace(/\${CONTROLLER}/g, prefix)
+            return result.replace(/\${VIEW}/g, view)
+        }
+
+        /**
+         *  Main parser. Parse the script and return the compiled (Ejscript) result
+         *  @param file Ejs page to parse
+         *  @param appDir Application directory. Relative layout pages are found under the "views/layouts" directory here.
+         *  @param layout Layout page to wrap the page. Set to undefined for no layout.
+         *  @return Ejscript statements that render the page
+         */
+        function parse(file: String, appDir: String, layout: String): String {
+
+            var token: ByteArray = new ByteArray
+            var out: ByteArray = new ByteArray
+            var tid: Number
+
+            appBaseDir = appDir;
+            layoutPage = layout
+            script = Path(file).readString()
+
+            while ((tid = getToken(token)) != Eof) {
+
+                switch (tid) {
+                case Literal:
+                    out.write("\nwrite(\"" + token + "\");\n")
+                    break
+
+                case Var:
+                    /*
+                     *  Trick to get undefined variables to evaluate to "".
+                     *  Catenate with "" to cause toString to run.
+                     */
+                    out.write("\nwrite(\"\" + ", token, ");\n")
+                    break
+
+                case Equals:
+                    out.write("\nwrite(\"\" + (", token, "));\n")
+                    break
+
+                case EjsTag:
+                    /*
+                     *  Just copy the Ejscript code straight through
+                     */
+                    out.write(token.toString())
+                    break
+
+                case Control:
+                    let args: Array = token.toString().split(/\s/g)
+                    let cmd: String = args[0]
+
+                    switch (cmd) {
+                    case "include":
+                        let path = args[1].trim("'").trim('"')
+                        let incPath = dirname(file).join(path)
+                        /*
+                         *  Recurse and process the include script
+                         */
+                        let inc: EjsParser = new EjsParser
+                        out.write(inc.parse(incPath, appBaseDir, undefined))
+                        break
+
+                    case "layout":
+                        let path = args[1]
+                        if (path == "" || path == '""') {
+                            layoutPage = undefined
+                        } else {
+                            path = args[1].trim("'").trim('"').trim('.ejs') + ".ejs"
+                            if (Path(path).isAbsolute) {
+                                layoutPage = path
+                            } else {
+                                layoutPage = Path(appBaseDir).join(LayoutsDir).join(path)
+                            }
+                            if (! exists(layoutPage)) {
+                                abort("Can't find layout page " + layoutPage)
+                            }
+                        }
+                        break
+
+                    case "content":
+                        out.write(ContentMarker)
+                        break
+
+                    default:
+                        abort("Bad control directive: " + cmd)
+                    }
+                    break
+
+                default:
+                case Err:
+                    abort("Bad input token: " + token)
+
+                }
+            }
+
+            if (layoutPage != undefined && layoutPage != file) {
+                let layoutText: String = new EjsParser().parse(layoutPage, appBaseDir, layoutPage)
+                return layoutText.replace(ContentPattern, out.toString().replace(/\$/g, "$$$$"))
+            }
+            return out.toString()
+        }
+
+        /*
+         *  Get the next input token. Read from script[pos]. Return the next token ID and update the token byte array
+         */
+        private function getToken(token: ByteArray): Number {
+
+            var tid = Literal
+
+            token.flush()
+
+            var c
+            while (pos < script.length) {
+                c = script[pos++]
+
+                switch (c) {
+
+                case '<':
+                    if (script[pos] == '%' && (pos < 2 || script[pos - 2] != '\\')) {
+                        if (token.available > 0) {
+                            pos--
+                            return Literal
+                        }
+                        pos++
+                        eatSpace()
+                        if (script[pos] == '=') {
+                            /*
+                             *  <%=  directive
+                             */
+                            pos++
+                            eatSpace()
+                            while ((c = script[pos]) != undefined && 
+                                    (c != '%' || script[pos+1] != '>' || script[pos-1] == '\\')) {
+                                token.write(c)
+                                pos++
+                            }
+                            pos += 2
+                            return Equals
+
+                        } else if (script[pos] == '@') {
+                            /*
+                             *  <%@  directive
+                             */
+                            pos++
+                            eatSpace()
+                            while ((c = script[pos]) != undefined && (c != '%' || script[pos+1] != '>')) {
+                                token.write(c)
+                                pos++
+                            }
+                            pos += 2
+                            return Control
+
+                        } else {
+                            while ((c = script[pos]) != undefined && 
+                                    (c != '%' || script[pos+1] != '>' || script[pos-1] == '\\')) {
+                                token.write(c)
+                                pos++
+                            }
+                            pos += 2
+                            return EjsTag
+                        }
+                    }
+                    token.write(c)
+                    break
+
+                case '@':
+                    if (script[pos] == '@' && (pos < 1 || script[pos-1] != '\\')) {
+                        if (token.available > 0) {
+                            pos--
+                            return Literal
+                        }
+                        pos++
+                        c = script[pos++]
+                        while (c.isAlpha || c.isDigit || c == '[' || c == ']' || c == '.' || c == '$' || 
+                                c == '_' || c == "'") {
+                            token.write(c)
+                            c = script[pos++]
+                        }
+                        pos--
+                        return Var
+                    }
+                    token.write(c)
+                    break
+
+                case "\r":
+                case "\n":
+                    lineNumber++
+                    token.write(c)
+                    tid = Literal
+                    break
+
+                default:
+                    if (c == '\"' || c == '\\') {
+                        token.write('\\')
+                    }
+                    token.write(c)
+                    break
+                }
+            }
+            if (token.available == 0 && pos >= script.length) {
+                return Eof
+            }
+            return tid
+        }
+
+        private function eatSpace(): Void {
+            while (script[pos].isSpace) {
+                pos++
+            }
+        }
+
+        private function abort(msg: String): Void {
+            throw "ejsweb: " + msg + ". At line " + lineNumber
+        }
+    }
+}
+
+
+/*
+ *  @copy   default
+ *  
+ *  Copyright (c) Embedthis Software LLC, 2003-2011. All Rights Reserved.
+ *  Copyright (c) Michael O'Brien, 1993-2011. All Rights Reserved.
+ *  
+ *  This software is distributed under commercial and open source licenses.
+ *  You may use the GPL open source license described below or you may acquire 
+ *  a commercial license from Embedthis Software. You agree to be fully bound 
+ *  by the terms of either license. Consult the LICENSE.TXT distributed with 
+ *  this software for full details.
+ *  
+ *  This software is open source; you can redistribute it and/or modify it 
+ *  under the terms of the GNU General Public License as published by the 
+ *  Free Software Foundation; either version 2 of the License, or (at your 
+ *  option) any later version. See the GNU General Public License for more 
+ *  details at: http://www.embedthis.com/downloads/gplLicense.html
+ *  
+ *  This program is distributed WITHOUT ANY WARRANTY; without even the 
+ *  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+ *  
+ *  This GPL license does NOT permit incorporating this software into 
+ *  proprietary programs. If you are unable to comply with the GPL, you must
+ *  acquire a commercial license to use this software. Commercial licenses 
+ *  for this software and support services are available from Embedthis 
+ *  Software at http://www.embedthis.com 
+ *
+ *  Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
+/************************************************************************/
+/*
+ *  End of file "../src/es/web/EjsParser.es"
+ */
+/************************************************************************/
+
+
+
 /************************************************************************/
 /*
  *  Start of file "../src/es/web/Host.es"
@@ -13617,7 +14056,7 @@ module ejs.web {
         native var remoteHost: String
 
         /**
-         *  Current session ID. Index into the $sessions object
+         *  Current session ID. Key of the session in the session store
          */
         native var sessionID: String
 
@@ -13720,13 +14159,6 @@ module ejs.web {
 
 module ejs.web {
 
-    /**
-     *  Hash of all sessions. Held by the master interpreter.
-     *  @spec ejs
-     *  @stability prototype
-     */
-    var sessions = {}
-
     /**
      *  Session state storage class. 
      *  @spec ejs
@@ -14613,6 +15045,12 @@ module ejs.web {
         function writeHtml(...args): Void
             controller.write(html(args))
 
+        /**
+            @duplicate ejs.web::Controller.writeJSON
+         */
+        function writeJSON(data: Object): Void
+            controller.writeJSON(data)
+
         /**
             @duplicate ejs.web::Controller.writeRaw
             @hide
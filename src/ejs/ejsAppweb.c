@@ -11,6 +11,9 @@
 #if BLD_APPWEB_PRODUCT || BLD_FEATURE_APPWEB
 
  #include    "appweb.h"
+#if BLD_FEATURE_EJS_AUTO_COMPILE
+ #include    "ec.h"
+#endif
 
 /*********************************** Locals ***********************************/
 
@@ -701,6 +704,8 @@ static int parseEjs(MaHttp *http, cchar *key, char *value, MaConfigState *state)
     MaLocation      *location;
     MaServer        *server;
     MaHost          *host;
+    MaStage         *ejsHandler;
+    EjsWebControl   *control;
     char            *prefix, *path;
     int             flags;
     
@@ -805,6 +810,71 @@ static int parseEjs(MaHttp *http, cchar *key, char *value, MaConfigState *state)
         }
         return 1;
 
+    } else if (mprStrcmpAnyCase(key, "EjsCheckInterval") == 0) {
+        if (value == 0) {
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        if ((ejsHandler = maLookupStage(http, "ejsHandler")) == 0) {
+            mprError(http, "Ejscript module is not loaded");
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        if (! mprGetDebugMode(http)) {
+            control = (EjsWebControl*) ejsHandler->stageData;
+            control->checkInterval = atoi(mprStrTrim(value, "\"")) * MPR_TICKS_PER_SEC;
+        }
+        return 1;
+
+    } else if (mprStrcmpAnyCase(key, "EjsInterpreterPool") == 0) {
+        if (value == 0) {
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        if ((ejsHandler = maLookupStage(http, "ejsHandler")) == 0) {
+            mprError(http, "Ejscript module is not loaded");
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        control = (EjsWebControl*) ejsHandler->stageData;
+        value = mprStrTrim(value, "\"");
+        if (mprStrcmpAnyCase(value, "on") == 0) {
+            /*
+             *  Keep enough pooled interpreters for each worker thread to have one
+             */
+            control->poolMax = max(http->limits.maxThreads, 1);
+        } else if (mprStrcmpAnyCase(value, "off") == 0) {
+            control->poolMax = 0;
+        } else if (isdigit((int) *value)) {
+            control->poolMax = atoi(value);
+        } else {
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        return 1;
+
+    } else if (mprStrcmpAnyCase(key, "EjsSessionStore") == 0) {
+#if BLD_FEATURE_SQLITE
+        if (value == 0) {
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        if ((ejsHandler = maLookupStage(http, "ejsHandler")) == 0) {
+            mprError(http, "Ejscript module is not loaded");
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        control = (EjsWebControl*) ejsHandler->stageData;
+        path = maMakePath(host, mprStrTrim(value, "\""));
+        if (ejsOpenWebSessionStore(control, path) < 0) {
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        return 1;
+#else
+        mprError(http, "EjsSessionStore requires SQLite");
+        return MPR_ERR_BAD_SYNTAX;
+#endif
+
+    } else if (mprStrcmpAnyCase(key, "EjsCacheMemory") == 0) {
+        if (value == 0) {
+            return MPR_ERR_BAD_SYNTAX;
+        }
+        ejsSetWebCacheLimits(http, atoi(mprStrTrim(value, "\"")));
+        return 1;
+
     } else if (mprStrcmpAnyCase(key, "EjsSession") == 0) {
         if (mprStrcmpAnyCase(value, "on") == 0) {
             location->flags |= MA_LOC_AUTO_SESSION;
@@ -839,6 +909,47 @@ static void ejsWebUnlock(void *lockData)
 #endif /* BLD_FEATURE_MULTITHREAD */
 
 
+/*
+ *  Report interpreter pool, cache and session metrics
+ */
+static void reportEjsMetrics(MaStage *stage, MprBuf *buf, bool json)
+{
+    int64       hits, misses, cacheHits, cacheMisses, evictions, memory;
+    int         idle, sessions;
+
+    ejsGetWebPoolStats((EjsWebControl*) stage->stageData, &hits, &misses, &idle);
+    ejsGetWebCacheStats(stage, &cacheHits, &cacheMisses, &evictions, &memory);
+    sessions = ejsGetWebSessionCount((EjsWebControl*) stage->stageData);
+    if (json) {
+        mprPutFmtToBuf(buf, "\"hits\":%Ld,\"misses\":%Ld,\"idle\":%d", hits, misses, idle);
+        mprPutFmtToBuf(buf, ",\"cacheHits\":%Ld,\"cacheMisses\":%Ld,\"cacheEvictions\":%Ld,\"cacheMemory\":%Ld",
+            cacheHits, cacheMisses, evictions, memory);
+        mprPutFmtToBuf(buf, ",\"sessions\":%d", sessions);
+    } else {
+        mprPutFmtToBuf(buf, "appweb_ejs_interp_pool_total{result=\"hit\"} %Ld\n", hits);
+        mprPutFmtToBuf(buf, "appweb_ejs_interp_pool_total{result=\"miss\"} %Ld\n", misses);
+        mprPutFmtToBuf(buf, "appweb_ejs_interp_pool_idle %d\n", idle);
+        mprPutFmtToBuf(buf, "appweb_ejs_cache_total{result=\"hit\"} %Ld\n", cacheHits);
+        mprPutFmtToBuf(buf, "appweb_ejs_cache_total{result=\"miss\"} %Ld\n", cacheMisses);
+        mprPutFmtToBuf(buf, "appweb_ejs_cache_evictions_total %Ld\n", evictions);
+        mprPutFmtToBuf(buf, "appweb_ejs_cache_bytes %Ld\n", memory);
+        mprPutFmtToBuf(buf, "appweb_ejs_sessions %d\n", sessions);
+    }
+}
+
+
+/*
+ *  Save write-behind sessions when the service stops
+ */
+static int stopEjsHandler(MprModule *mp)
+{
+#if BLD_FEATURE_SQLITE
+    ejsCloseWebSessionStore((EjsWebControl*) mp->moduleData);
+#endif
+    return 0;
+}
+
+
 /*
  *  Dynamic module initialization
  */
@@ -882,6 +993,12 @@ MprModule *maEjsHandlerInit(MaHttp *http, cchar *path)
         mprFree(control);
         return 0;
     }
+#if BLD_FEATURE_EJS_AUTO_COMPILE
+    /*
+     *  Compile stale pages and controllers in-process rather than by running ejsweb
+     */
+    ecInitCompiler(control->service);
+#endif
 
     handler = maCreateHandler(http, "ejsHandler", 
         MA_STAGE_GET | MA_STAGE_HEAD | MA_STAGE_POST | MA_STAGE_PUT | MA_STAGE_VARS | MA_STAGE_VIRTUAL);
@@ -896,8 +1013,9 @@ MprModule *maEjsHandlerInit(MaHttp *http, cchar *path)
     handler->incomingData = incomingEjsData;
     handler->parse = parseEjs;
     handler->stageData = control;
+    handler->reportMetrics = reportEjsMetrics;
 
-    module = mprCreateModule(http, "ejsHandler", BLD_VERSION, 0, 0, 0);
+    module = mprCreateModule(http, "ejsHandler", BLD_VERSION, control, 0, stopEjsHandler);
     if (module == 0) {
         mprFree(handler);
         mprFree(control);
@@ -385,6 +385,7 @@ static int setArrayProperty(Ejs *ejs, EjsArray *ap, int slotNum,  EjsVar *value)
     if ((slotNum = checkSlot(ejs, ap, slotNum)) < 0) {
         return EJS_ERR;
     }
+    ejsWriteBarrier(ejs, value);
     ap->data[slotNum] = value;
     return slotNum;
 }
@@ -418,6 +419,7 @@ static int setArrayPropertyByName(Ejs *ejs, EjsArray *ap, EjsName *qname, EjsVar
     if ((slotNum = checkSlot(ejs, ap, atoi(qname->name))) < 0) {
         return EJS_ERR;
     }
+    ejsWriteBarrier(ejs, value);
     ap->data[slotNum] = value;
 
     return slotNum;
@@ -5811,6 +5813,7 @@ static EjsFunction *cloneFunctionVar(Ejs *ejs, EjsFunction *src, bool deep)
     dest->nativeProc = src->nativeProc;
     dest->lang = src->lang;
     dest->isFrame = src->isFrame;
+    dest->sharedCode = src->sharedCode;
     return dest;
 }
 
@@ -5844,8 +5847,9 @@ void ejsMarkFunction(Ejs *ejs, EjsVar *parent, EjsFunction *fun)
 
 static EjsVar *applyFunction(Ejs *ejs, EjsFunction *fun, int argc, EjsVar **argv)
 {
-    EjsArray        *args;
-    EjsVar          *save, *result;
+    EjsArray        *args, *rest;
+    EjsVar          *save, *result, **callArgs;
+    int             i, fixed;
     
     mprAssert(argc == 2);
     args = (EjsArray*) argv[1];
@@ -5854,8 +5858,31 @@ static EjsVar *applyFunction(Ejs *ejs, EjsFunction *fun, int argc, EjsVar **argv
     save = fun->thisObj;
     fun->thisObj = 0;
 
-    result =  ejsRunFunction(ejs, fun, argv[0], args->length, args->data);
-
+    fixed = fun->numArgs - 1;
+    if (ejsIsNativeFunction(fun) && fun->rest && args->length >= fixed) {
+        /*
+         *  Native functions expect ...rest args collected into a trailing array as the VM does for direct calls
+         */
+        if ((callArgs = (EjsVar**) mprAlloc(ejs, fun->numArgs * sizeof(EjsVar*))) == 0 ||
+                (rest = ejsCreateArray(ejs, args->length - fixed)) == 0) {
+            mprFree(callArgs);
+            fun->thisObj = save;
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+        for (i = 0; i < args->length; i++) {
+            if (i < fixed) {
+                callArgs[i] = args->data[i];
+            } else {
+                ejsSetProperty(ejs, (EjsVar*) rest, i - fixed, args->data[i]);
+            }
+        }
+        callArgs[fixed] = (EjsVar*) rest;
+        result = ejsRunFunction(ejs, fun, argv[0], fun->numArgs, callArgs);
+        mprFree(callArgs);
+    } else {
+        result =  ejsRunFunction(ejs, fun, argv[0], args->length, args->data);
+    }
     fun->thisObj = save;
     return result;
 }
@@ -6130,8 +6157,11 @@ int ejsSetFunctionCode(EjsFunction *fun, uchar *byteCode, int len)
         return EJS_ERR;
     }
     fun->body.code.codeLen = len;
-    mprFree(fun->body.code.byteCode);
+    if (!fun->sharedCode) {
+        mprFree(fun->body.code.byteCode);
+    }
     fun->body.code.byteCode = (uchar*) byteCode;
+    fun->sharedCode = 0;
     return 0;
 }
 
@@ -6764,6 +6794,149 @@ void ejsCreateGlobalBlock(Ejs *ejs)
 }
 
 
+/*
+ *  Save the static and instance properties of saved global types. Types shared with the master are skipped as other
+ *  interpreters may be using them concurrently.
+ */
+static int saveTypes(Ejs *ejs)
+{
+    EjsSavedBlock   *saved, *sp;
+    EjsType         *type;
+    EjsBlock        *block;
+    EjsVar          *vp;
+    int             i, count, side;
+
+    for (count = 0, i = 0; i < ejs->globalStateCount; i++) {
+        vp = ejs->globalState[i];
+        if (vp && ejsIsType(vp) && !vp->master) {
+            count += 2;
+        }
+    }
+    saved = 0;
+    if (count > 0 && (saved = (EjsSavedBlock*) mprAllocZeroed(ejs, count * sizeof(EjsSavedBlock))) == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    for (sp = saved, i = 0; i < ejs->globalStateCount; i++) {
+        vp = ejs->globalState[i];
+        if (vp == 0 || !ejsIsType(vp) || vp->master) {
+            continue;
+        }
+        type = (EjsType*) vp;
+        for (side = 0; side < 2; side++) {
+            block = (side == 0) ? &type->block : type->instanceBlock;
+            if (block == 0) {
+                continue;
+            }
+            sp->block = block;
+            sp->numProp = block->obj.numProp;
+            if (sp->numProp > 0) {
+                sp->slots = (EjsVar**) mprMemdup(saved, block->obj.slots, sp->numProp * sizeof(EjsVar*));
+                if (sp->slots == 0) {
+                    mprFree(saved);
+                    return MPR_ERR_NO_MEMORY;
+                }
+            }
+            sp++;
+        }
+    }
+    mprFree(ejs->savedBlocks);
+    ejs->savedBlocks = saved;
+    ejs->savedBlockCount = (int) (sp - saved);
+    return 0;
+}
+
+
+/*
+ *  Remove the properties of a block beyond the given count
+ */
+static void truncateBlock(Ejs *ejs, EjsBlock *block, int count)
+{
+    EjsObject   *obj;
+    EjsNames    *names;
+    int         i;
+
+    obj = &block->obj;
+    if (obj->numProp <= count) {
+        return;
+    }
+    names = obj->names;
+    for (i = count; i < obj->numProp; i++) {
+        obj->slots[i] = 0;
+        if (names) {
+            names->entries[i].qname.name = "";
+            names->entries[i].qname.space = "";
+            names->entries[i].nextSlot = -1;
+        }
+    }
+    for (i = count; i < block->numTraits; i++) {
+        block->traits[i].type = 0;
+        block->traits[i].attributes = 0;
+    }
+    if (block->numTraits > count) {
+        block->numTraits = count;
+    }
+    obj->numProp = count;
+    ejsRebuildHash(ejs, obj);
+}
+
+
+/*
+ *  Save the values of global properties defined since the last save. The saved values are GC roots. The properties
+ *  of types owned by this interpreter are saved afresh each time as module initializers may have changed them.
+ */
+int ejsSaveGlobalState(Ejs *ejs)
+{
+    EjsObject   *obj;
+    int         count;
+
+    obj = &ejs->globalBlock->obj;
+    count = obj->numProp;
+    if (count > ejs->globalStateCount) {
+        ejs->globalState = (EjsVar**) mprRealloc(ejs, ejs->globalState, count * sizeof(EjsVar*));
+        if (ejs->globalState == 0) {
+            ejs->globalStateCount = 0;
+            return MPR_ERR_NO_MEMORY;
+        }
+        memcpy(&ejs->globalState[ejs->globalStateCount], &obj->slots[ejs->globalStateCount], 
+            (count - ejs->globalStateCount) * sizeof(EjsVar*));
+        ejs->globalStateCount = count;
+    }
+    if (saveTypes(ejs) < 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    ejs->savedModuleCount = mprGetListCount(ejs->modules);
+    return count;
+}
+
+
+/*
+ *  Truncate the global object back to the saved properties and restore their values. Then restore the saved types 
+ *  and forget modules loaded since the save so they will be reloaded (and their globals redefined) if required again.
+ */
+void ejsRestoreGlobalState(Ejs *ejs)
+{
+    EjsSavedBlock   *sp;
+    EjsObject       *obj;
+    int             i, count;
+
+    obj = &ejs->globalBlock->obj;
+    count = ejs->globalStateCount;
+    truncateBlock(ejs, ejs->globalBlock, count);
+    if (count > 0) {
+        memcpy(obj->slots, ejs->globalState, count * sizeof(EjsVar*));
+    }
+    for (i = 0; i < ejs->savedBlockCount; i++) {
+        sp = &ejs->savedBlocks[i];
+        obj = &sp->block->obj;
+        truncateBlock(ejs, sp->block, sp->numProp);
+        memcpy(obj->slots, sp->slots, min(obj->numProp, sp->numProp) * sizeof(EjsVar*));
+    }
+    while (mprGetListCount(ejs->modules) > ejs->savedModuleCount) {
+        mprRemoveLastItem(ejs->modules);
+    }
+}
+
+
 void ejsConfigureGlobalBlock(Ejs *ejs)
 {
     EjsBlock    *block;
@@ -7062,11 +7235,25 @@ typedef struct JsonState {
     char    *end;
     char    *next;
     char    *error;
+    MprBuf  *buf;               /* Token buffer. Reused for all tokens. */
+    EjsVar  **stack;            /* Array elements parsed but not yet stored */
+    int     top;                /* Next free stack entry */
+    int     size;               /* Size of the stack */
 } JsonState;
 
+/*
+ *  Serializer state
+ */
+typedef struct JsonWriter {
+    MprBuf          *buf;           /* Output buffer */
+    EjsJsonWriter   writer;         /* Output callback when streaming. Null to accumulate all output in buf. */
+    EjsVar          *objectToJson;  /* Object.toJSON. Values using it are encoded inline. */
+    EjsVar          *stringToJson;  /* String.toJSON */
+} JsonWriter;
+
 
 static EjsVar *parseLiteral(Ejs *ejs, JsonState *js);
-static EjsVar *parseLiteralInner(Ejs *ejs, MprBuf *buf, JsonState *js);
+static int jsonObject(Ejs *ejs, JsonWriter *jw, EjsVar *vp);
 
 /*
  *  Convert a string into an object.
@@ -7099,9 +7286,20 @@ EjsVar *ejsDeserialize(Ejs *ejs, EjsString *str)
     js.next = js.data = data;
     js.end = &js.data[str->length];
     js.error = 0;
-    if ((obj = parseLiteral(ejs, &js)) == 0) {
+    js.top = 0;
+    js.size = 0;
+    js.stack = 0;
+    if ((js.buf = mprCreateBuf(ejs, 0, 0)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    obj = parseLiteral(ejs, &js);
+    mprFree(js.buf);
+    mprFree(js.stack);
+
+    if (obj == 0) {
         if (js.error) {
-            ejsThrowSyntaxError(ejs, 
+            ejsThrowSyntaxError(ejs,
                 "Can't parse object literal. Error at position %d.\n"
                 "===========================\n"
                 "Offending text: %s\n"
@@ -7118,20 +7316,6 @@ EjsVar *ejsDeserialize(Ejs *ejs, EjsString *str)
 }
 
 
-static EjsVar *parseLiteral(Ejs *ejs, JsonState *js)
-{
-    MprBuf      *buf;
-    EjsVar      *vp;
-
-    mprAssert(js);
-
-    buf = mprCreateBuf(ejs, 0, 0);
-    vp = parseLiteralInner(ejs, buf, js);
-    mprFree(buf);
-    return vp;
-}
-
-
 typedef enum Token {
     TOK_ERR,            /* Error */
     TOK_EOF,            /* End of input */
@@ -7146,24 +7330,44 @@ typedef enum Token {
 } Token;
 
 
-Token getNextJsonToken(MprBuf *buf, char **token, JsonState *js)
+/*
+ *  Find the closing quote of a quoted token. Quotes are located with memchr which libc vectorizes, so long strings
+ *  are not scanned a character at a time. A quote is escaped if preceded by an odd number of backslashes.
+ */
+static uchar *findQuote(uchar *start, uchar *end, int quote)
 {
+    uchar   *cp, *bp;
+
+    for (cp = start; cp < end && (cp = memchr(cp, quote, end - cp)) != 0; cp++) {
+        for (bp = cp; bp > start && bp[-1] == '\\'; bp--) ;
+        if (((cp - bp) & 1) == 0) {
+            return cp;
+        }
+    }
+    return end;
+}
+
+
+/*
+ *  Get the next token. If "token" is set, the token text is unescaped into js->buf.
+ */
+static Token getNextJsonToken(JsonState *js, char **token)
+{
+    MprBuf  *buf;
     uchar   *start, *cp, *end, *next;
     char    *src, *dest;
     int     quote, tid, c;
 
     next = (uchar*) js->next;
     end = (uchar*) js->end;
+    buf = js->buf;
 
-    if (buf) {
-        mprFlushBuf(buf);
-    }
     for (cp = next; cp < end && isspace((int) *cp); cp++) {
         ;
     }
     next = cp + 1;
 
-    if (*cp == '\0') {
+    if (cp >= end || *cp == '\0') {
         tid = TOK_EOF;
 
     } else  if (*cp == '{') {
@@ -7174,8 +7378,8 @@ Token getNextJsonToken(MprBuf *buf, char **token, JsonState *js)
 
     } else if (*cp == '}' || *cp == ']') {
         tid = *cp == '}' ? TOK_RBRACE: TOK_RBRACKET;
-        while (*++cp && isspace((int) *cp)) ;
-        if (*cp == ',' || *cp == ':') {
+        while (++cp < end && isspace((int) *cp)) ;
+        if (cp < end && (*cp == ',' || *cp == ':')) {
             cp++;
         }
         next = cp;
@@ -7184,17 +7388,8 @@ Token getNextJsonToken(MprBuf *buf, char **token, JsonState *js)
         if (*cp == '"' || *cp == '\'') {
             tid = TOK_QID;
             quote = *cp++;
-            for (start = cp; cp < end; cp++) {
-                if (*cp == '\\') {
-                    if (cp[1] == quote) {
-                        cp++;
-                    }
-                    continue;
-                }
-                if (*cp == quote) {
-                    break;
-                }
-            }
+            start = cp;
+            cp = findQuote(start, end, quote);
         } else {
             quote = -1;
             tid = TOK_ID;
@@ -7208,42 +7403,49 @@ Token getNextJsonToken(MprBuf *buf, char **token, JsonState *js)
                 }
             }
         }
-        if (buf) {
+        if (token) {
+            mprFlushBuf(buf);
             mprPutBlockToBuf(buf, (char*) start, (int) (cp - start));
             mprAddNullToBuf(buf);
         }
         if (quote > 0) {
-            if (*cp == quote) {
+            if (cp < end && *cp == quote) {
                 cp++;
             } else {
                 js->error = (char*) cp;
                 return TOK_ERR;
             }
         }
-        if (*cp == ',' || *cp == ':') {
-            cp++;
-        } else if (*cp != '}' && *cp != ']' && *cp != '\0' && *cp != '\n' && *cp != '\r' && *cp != ' ') {
-            js->error = (char*) cp;
-            return TOK_ERR;
+        if (cp < end) {
+            if (*cp == ',' || *cp == ':') {
+                cp++;
+            } else if (*cp != '}' && *cp != ']' && *cp != '\0' && *cp != '\n' && *cp != '\r' && *cp != ' ') {
+                js->error = (char*) cp;
+                return TOK_ERR;
+            }
         }
         next = cp;
 
-        if (buf) {
-            for (dest = src = buf->start; src < buf->end; ) {
-                c = *src++;
-                if (c == '\\') {
+        if (token) {
+            src = mprGetBufStart(buf);
+            if (memchr(src, '\\', mprGetBufLength(buf)) != 0) {
+                for (dest = src; src < buf->end; ) {
                     c = *src++;
-                    if (c == 'r') {
-                        c = '\r';
-                    } else if (c == 'n') {
-                        c = '\n';
-                    } else if (c == 'b') {
-                        c = '\b';
+                    if (c == '\\') {
+                        c = *src++;
+                        if (c == 'r') {
+                            c = '\r';
+                        } else if (c == 'n') {
+                            c = '\n';
+                        } else if (c == 'b') {
+                            c = '\b';
+                        }
                     }
+                    *dest++ = c;
                 }
-                *dest++ = c;
+                *dest = '\0';
+                buf->end = dest;
             }
-            *dest = '\0';
             *token = mprGetBufStart(buf);
         }
     }
@@ -7252,134 +7454,441 @@ Token getNextJsonToken(MprBuf *buf, char **token, JsonState *js)
 }
 
 
-Token peekNextJsonToken(JsonState *js)
+/*
+ *  Peek at the type of the next token. This only classifies the next character. Errors are reported when the
+ *  token is read.
+ */
+static Token peekNextJsonToken(JsonState *js)
 {
-    JsonState   discard = *js;
-    return getNextJsonToken(NULL, NULL, &discard);
+    uchar   *cp, *end;
+
+    end = (uchar*) js->end;
+    for (cp = (uchar*) js->next; cp < end && isspace((int) *cp); cp++) {
+        ;
+    }
+    if (cp >= end || *cp == '\0') {
+        return TOK_EOF;
+    }
+    switch (*cp) {
+    case '{':
+        return TOK_LBRACE;
+    case '[':
+        return TOK_LBRACKET;
+    case '}':
+        return TOK_RBRACE;
+    case ']':
+        return TOK_RBRACKET;
+    case '"':
+    case '\'':
+        return TOK_QID;
+    default:
+        return TOK_ID;
+    }
 }
 
 
 /*
- *  Parse an object literal string pointed to by js->next into the given buffer. Update js->next to point
- *  to the next input token in the object literal. Supports nested object literals.
+ *  Push an array element. Elements are held until the array is complete so it can be created at its final size.
  */
-static EjsVar *parseLiteralInner(Ejs *ejs, MprBuf *buf, JsonState *js)
+static int pushJsonValue(Ejs *ejs, JsonState *js, EjsVar *vp)
+{
+    EjsVar  **stack;
+    int     size;
+
+    if (js->top >= js->size) {
+        size = (js->size) ? js->size * 2 : EJS_JSON_STACK;
+        if ((stack = (EjsVar**) mprRealloc(ejs, js->stack, size * (int) sizeof(EjsVar*))) == 0) {
+            return EJS_ERR;
+        }
+        js->stack = stack;
+        js->size = size;
+    }
+    js->stack[js->top++] = vp;
+    return 0;
+}
+
+
+/*
+ *  Create an array from the elements pushed since "base"
+ */
+static EjsVar *popJsonArray(Ejs *ejs, JsonState *js, int base)
+{
+    EjsArray    *ap;
+    EjsVar      *vp;
+    int         i, count;
+
+    count = js->top - base;
+    if ((ap = ejsCreateArray(ejs, count)) == 0) {
+        return 0;
+    }
+    for (i = 0; i < count; i++) {
+        vp = js->stack[base + i];
+        ejsWriteBarrier(ejs, vp);
+        ap->data[i] = vp;
+    }
+    js->top = base;
+    return (EjsVar*) ap;
+}
+
+
+/*
+ *  Parse an object literal string pointed to by js->next. Update js->next to point to the next input token in the
+ *  object literal. Supports nested object literals.
+ */
+static EjsVar *parseLiteral(Ejs *ejs, JsonState *js)
 {
     EjsName     qname;
     EjsVar      *obj, *vp;
-    MprBuf      *valueBuf;
-    char        *token, *key, *value;
-    int         tid, isArray;
+    cchar       *key;
+    char        *token, *value;
+    int         tid, isArray, base;
 
     isArray = 0;
+    obj = 0;
+    base = js->top;
 
-    tid = getNextJsonToken(buf, &token, js);
+    tid = getNextJsonToken(js, &token);
     if (tid == TOK_ERR || tid == TOK_EOF) {
         return 0;
     }
     if (tid == TOK_LBRACKET) {
         isArray = 1;
-        obj = (EjsVar*) ejsCreateArray(ejs, 0);
     } else if (tid == TOK_LBRACE) {
         obj = (EjsVar*) ejsCreateObject(ejs, ejs->objectType, 0);
-    } else {
+        if (obj == 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+    } else if (tid == TOK_ID || tid == TOK_QID) {
         return ejsParseVar(ejs, token, ES_String);
-    }
-    if (obj == 0) {
-        ejsThrowMemoryError(ejs);
+    } else {
+        js->error = js->next;
         return 0;
     }
 
     while (1) {
         vp = 0;
         tid = peekNextJsonToken(js);
-        if (tid == TOK_ERR) {
-            return 0;
-        } else if (tid == TOK_EOF) {
+        if (tid == TOK_EOF) {
             break;
         } else if (tid == TOK_RBRACE || tid == TOK_RBRACKET) {
-            getNextJsonToken(buf, &key, js);
+            getNextJsonToken(js, NULL);
             break;
         }
-        if (tid == TOK_LBRACKET) {
-            /* For array values */
-            vp = parseLiteral(ejs, js);
-            mprAssert(vp);
-            
-        } else if (tid == TOK_LBRACE) {
-            /* For object values */
-            vp = parseLiteral(ejs, js);
-            mprAssert(vp);
-            
-        } else if (isArray) {
-            tid = getNextJsonToken(buf, &value, js);
-            vp = ejsParseVar(ejs, value, (tid == TOK_QID) ? ES_String : -1);
-            mprAssert(vp);
-            
+        if (isArray) {
+            if (tid == TOK_LBRACKET || tid == TOK_LBRACE) {
+                vp = parseLiteral(ejs, js);
+            } else {
+                if ((tid = getNextJsonToken(js, &value)) == TOK_ERR) {
+                    return 0;
+                }
+                vp = ejsParseVar(ejs, value, (tid == TOK_QID) ? ES_String : -1);
+            }
+            if (vp && pushJsonValue(ejs, js, vp) < 0) {
+                ejsThrowMemoryError(ejs);
+                return 0;
+            }
+
         } else {
-            getNextJsonToken(buf, &key, js);
-            tid = peekNextJsonToken(js);
-            if (tid == TOK_ERR) {
-                mprAssert(0);
+            if (tid != TOK_ID && tid != TOK_QID) {
+                js->error = js->next;
                 return 0;
-            } else if (tid == TOK_EOF) {
+            }
+            if (getNextJsonToken(js, &token) == TOK_ERR) {
+                return 0;
+            }
+            /*
+             *  The token buffer is reused for the value so get a persistent key now
+             */
+            key = ejsInternName(ejs, obj, token);
+            tid = peekNextJsonToken(js);
+            if (tid == TOK_EOF) {
                 break;
             } else if (tid == TOK_LBRACE || tid == TOK_LBRACKET) {
                 vp = parseLiteral(ejs, js);
-                mprAssert(vp);
 
             } else if (tid == TOK_ID || tid == TOK_QID) {
-                valueBuf = mprCreateBuf(ejs, 0, 0);
-                getNextJsonToken(valueBuf, &value, js);
+                if ((tid = getNextJsonToken(js, &value)) == TOK_ERR) {
+                    return 0;
+                }
                 if (tid == TOK_QID) {
-                    vp = (EjsVar*) ejsCreateString(ejs, value);
+                    vp = (EjsVar*) ejsCreateStringWithLength(ejs, value, mprGetBufLength(js->buf));
+                } else if (strcmp(value, "null") == 0) {
+                    vp = ejs->nullValue;
+                } else if (strcmp(value, "undefined") == 0) {
+                    vp = ejs->undefinedValue;
                 } else {
-                    if (strcmp(value, "null") == 0) {
-                        vp = ejs->nullValue;
-                    } else if (strcmp(value, "undefined") == 0) {
-                        vp = ejs->undefinedValue;
-                    } else {
-                        vp = ejsParseVar(ejs, value, -1);
-                    }
+                    vp = ejsParseVar(ejs, value, -1);
                 }
-                mprAssert(vp);
-                mprFree(valueBuf);
             } else {
-                getNextJsonToken(buf, &value, js);
-                mprAssert(0);
                 js->error = js->next;
                 return 0;
             }
+            if (vp) {
+                ejsName(&qname, EJS_EMPTY_NAMESPACE, key);
+                if (ejsSetPropertyByName(ejs, obj, &qname, vp) < 0) {
+                    ejsThrowMemoryError(ejs);
+                    return 0;
+                }
+            }
         }
         if (vp == 0) {
-            js->error = js->next;
+            if (js->error == 0) {
+                js->error = js->next;
+            }
             return 0;
         }
-        if (isArray) {
-            if (ejsSetProperty(ejs, obj, -1, vp) < 0) {
-                ejsThrowMemoryError(ejs);
-                return 0;
+    }
+    if (isArray) {
+        if ((obj = popJsonArray(ejs, js, base)) == 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+    }
+    return obj;
+}
+
+
+/*
+ *  Pass buffered output to the writer
+ */
+static int flushJson(Ejs *ejs, JsonWriter *jw)
+{
+    int     len;
+
+    len = mprGetBufLength(jw->buf);
+    if (jw->writer && len > 0) {
+        if ((jw->writer)(ejs, mprGetBufStart(jw->buf), len) != len) {
+            return MPR_ERR_CANT_WRITE;
+        }
+        mprFlushBuf(jw->buf);
+    }
+    return 0;
+}
+
+
+/*
+ *  Encode a quoted string. Runs of characters that need no escaping are copied as a block.
+ */
+static void jsonString(MprBuf *buf, cchar *str)
+{
+    int     len;
+
+    mprPutCharToBuf(buf, '"');
+    while (*str) {
+        len = (int) strcspn(str, "\"\\");
+        mprPutBlockToBuf(buf, str, len);
+        str += len;
+        if (*str) {
+            mprPutCharToBuf(buf, '\\');
+            mprPutCharToBuf(buf, *str++);
+        }
+    }
+    mprPutCharToBuf(buf, '"');
+}
+
+
+/*
+ *  Encode any value. Plain objects, arrays and strings are encoded inline. Other types are encoded by their toJSON
+ *  method via ejsToJson.
+ */
+static int jsonVar(Ejs *ejs, JsonWriter *jw, EjsVar *vp)
+{
+    EjsString   *sv;
+    EjsVar      *fn;
+    int         rc;
+
+    if (vp == 0) {
+        mprPutStringToBuf(jw->buf, "undefined");
+        return 0;
+    }
+    if (vp->jsonVisited) {
+        mprPutStringToBuf(jw->buf, "this");
+        return 0;
+    }
+    fn = ejsGetProperty(ejs, (EjsVar*) vp->type, ES_Object_toJSON);
+    if (fn && fn == jw->stringToJson && ejsIsString(vp)) {
+        jsonString(jw->buf, ((EjsString*) vp)->value);
+        return 0;
+    }
+    if (fn && fn == jw->objectToJson) {
+        if (ejsGetPropertyCount(ejs, vp) == 0 && vp->type != ejs->objectType && vp->type != ejs->arrayType) {
+            if ((sv = ejsToString(ejs, vp)) == 0) {
+                return EJS_ERR;
             }
-        } else {
-            /*
-             *  Must not pool this object otherwise the key allocation will be leak. Need the var to be freed.
-             */
-            key = mprStrdup(obj, key);
-            ejsName(&qname, EJS_EMPTY_NAMESPACE, key);
-            obj->noPool = 1;
-            if (ejsSetPropertyByName(ejs, obj, &qname, vp) < 0) {
-                ejsThrowMemoryError(ejs);
-                return 0;
+            mprPutStringToBuf(jw->buf, sv->value);
+            return 0;
+        }
+        /*
+         *  Primitive values cannot contain cycles and may be shared between interpreters, so don't mark them
+         */
+        if (!vp->primitive) {
+            vp->jsonVisited = 1;
+        }
+        rc = jsonObject(ejs, jw, vp);
+        if (!vp->primitive) {
+            vp->jsonVisited = 0;
+        }
+        return rc;
+    }
+    sv = ejsToJson(ejs, vp);
+    if (sv == 0 || !ejsIsString(sv)) {
+        return EJS_ERR;
+    }
+    mprPutStringToBuf(jw->buf, sv->value);
+    return 0;
+}
+
+
+/*
+ *  Encode an object or array. The layout matches the original toJSON encoding.
+ */
+static int jsonObject(Ejs *ejs, JsonWriter *jw, EjsVar *vp)
+{
+    MprBuf      *buf;
+    EjsVar      *pp;
+    EjsBlock    *block;
+    EjsName     qname;
+    char        key[16];
+    int         isArray, i, count, slotNum, numInherited, maxDepth, flags, rc;
+
+    buf = jw->buf;
+    count = ejsGetPropertyCount(ejs, vp);
+    maxDepth = 99;
+    flags = 0;
+    rc = 0;
+
+    isArray = ejsIsArray(vp);
+    mprPutStringToBuf(buf, isArray ? "[\n" : "{\n");
+
+    if (++ejs->serializeDepth <= maxDepth) {
+
+        for (slotNum = 0; slotNum < count && !ejs->exception; slotNum++) {
+            if (ejsIsBlock(vp)) {
+                block = (EjsBlock*) vp;
+                numInherited = ejsGetNumInheritedTraits(block);
+                if (slotNum < numInherited && !(flags & EJS_FLAGS_ENUM_INHERITED)) {
+                    continue;
+                }
+            }
+            pp = ejsGetProperty(ejs, vp, slotNum);
+            if (ejs->exception) {
+                rc = EJS_ERR;
+                break;
+            }
+            if (pp == 0 || (pp->hidden && !(flags & EJS_FLAGS_ENUM_ALL))) {
+                continue;
+            }
+            if (ejsIsFunction(pp) && !(flags & EJS_FLAGS_ENUM_ALL)) {
+                continue;
+            }
+            if (isArray) {
+                mprItoa(key, sizeof(key), slotNum, 10);
+                qname.name = key;
+                qname.space = "";
+            } else {
+                qname = ejsGetPropertyName(ejs, vp, slotNum);
+            }
+            if (qname.space && strstr(qname.space, ",private") != 0) {
+                continue;
+            }
+            if (qname.space[0] == '\0' && qname.name[0] == '\0') {
+                continue;
+            }
+            for (i = 0; i < ejs->serializeDepth; i++) {
+                mprPutStringToBuf(buf, "  ");
+            }
+            if (!isArray) {
+                jsonString(buf, (qname.name) ? qname.name : "");
+                mprPutStringToBuf(buf, ": ");
+            }
+            if (jsonVar(ejs, jw, pp) < 0) {
+                if (!ejs->exception) {
+                    ejsThrowTypeError(ejs, "Can't serialize property %s", qname.name);
+                }
+                rc = EJS_ERR;
+                break;
+            }
+            if ((slotNum + 1) < count) {
+                mprPutCharToBuf(buf, ',');
+            }
+            mprPutCharToBuf(buf, '\n');
+            if (jw->writer && mprGetBufLength(buf) >= EJS_JSON_CHUNK && flushJson(ejs, jw) < 0) {
+                rc = MPR_ERR_CANT_WRITE;
+                break;
             }
         }
     }
-    return obj;
+    for (i = --ejs->serializeDepth; i > 0; i--) {
+        mprPutStringToBuf(buf, "  ");
+    }
+    mprPutCharToBuf(buf, isArray ? ']' : '}');
+    return rc;
+}
+
+
+static void initJsonWriter(Ejs *ejs, JsonWriter *jw, EjsJsonWriter writer)
+{
+    jw->writer = writer;
+    jw->objectToJson = ejsGetProperty(ejs, (EjsVar*) ejs->objectType, ES_Object_toJSON);
+    jw->stringToJson = ejsGetProperty(ejs, (EjsVar*) ejs->stringType, ES_Object_toJSON);
+    jw->buf = mprCreateBuf(ejs, (writer) ? EJS_JSON_CHUNK * 2 : 0, 0);
+}
+
+
+static EjsString *jsonResult(Ejs *ejs, JsonWriter *jw, int rc)
+{
+    EjsString   *result;
+
+    result = 0;
+    if (rc >= 0) {
+        mprAddNullToBuf(jw->buf);
+        result = ejsCreateStringWithLength(ejs, mprGetBufStart(jw->buf), mprGetBufLength(jw->buf));
+    }
+    mprFree(jw->buf);
+    return result;
+}
+
+
+EjsString *ejsObjectToJson(Ejs *ejs, EjsVar *vp)
+{
+    JsonWriter  jw;
+
+    if (ejsGetPropertyCount(ejs, vp) == 0 && vp->type != ejs->objectType && vp->type != ejs->arrayType) {
+        return ejsToString(ejs, vp);
+    }
+    initJsonWriter(ejs, &jw, NULL);
+    if (jw.buf == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    return jsonResult(ejs, &jw, jsonObject(ejs, &jw, vp));
+}
+
+
+int ejsWriteJson(Ejs *ejs, EjsVar *vp, EjsJsonWriter writer)
+{
+    JsonWriter  jw;
+    int         rc;
+
+    mprAssert(writer);
+
+    initJsonWriter(ejs, &jw, writer);
+    if (jw.buf == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    if ((rc = jsonVar(ejs, &jw, vp)) >= 0) {
+        rc = flushJson(ejs, &jw);
+    }
+    mprFree(jw.buf);
+    return rc;
 }
 
 
 EjsVar *ejsSerialize(Ejs *ejs, EjsVar *vp, int maxDepth, bool showAll, bool showBase)
 {
-    int   flags;
+    JsonWriter  jw;
+    int         flags;
 
     if (maxDepth <= 0) {
         maxDepth = MAXINT;
@@ -7391,7 +7900,12 @@ EjsVar *ejsSerialize(Ejs *ejs, EjsVar *vp, int maxDepth, bool showAll, bool show
     if (showBase) {
         flags |= EJS_FLAGS_ENUM_INHERITED;
     }
-    return (EjsVar*) ejsToJson(ejs, vp); 
+    initJsonWriter(ejs, &jw, NULL);
+    if (jw.buf == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    return (EjsVar*) jsonResult(ejs, &jw, jsonVar(ejs, &jw, vp));
 }
 
 
@@ -8382,7 +8896,7 @@ static EjsVar *castNumber(Ejs *ejs, EjsNumber *vp, EjsType *type)
     case ES_String:
         {
 #if BLD_FEATURE_NUM_TYPE_DOUBLE
-        char *result = mprDtoa(vp, vp->value, 0, 0, 0);
+        char *result = mprDtoa(ejs, vp->value, 0, 0, 0);
         return (EjsVar*) ejsCreateStringAndFree(ejs, result);
 #elif MPR_64_BIT
         char     numBuf[32];
@@ -8690,7 +9204,7 @@ static EjsVar *toExponential(Ejs *ejs, EjsNumber *np, int argc, EjsVar **argv)
     int     ndigits;
     
     ndigits = (argc > 0) ? ejsGetInt(argv[0]): 0;
-    result = mprDtoa(np, np->value, ndigits, MPR_DTOA_N_DIGITS, MPR_DTOA_EXPONENT_FORM);
+    result = mprDtoa(ejs, np->value, ndigits, MPR_DTOA_N_DIGITS, MPR_DTOA_EXPONENT_FORM);
     return (EjsVar*) ejsCreateStringAndFree(ejs, result);
 #else
     char    numBuf[32];
@@ -8712,7 +9226,7 @@ static EjsVar *toFixed(Ejs *ejs, EjsNumber *np, int argc, EjsVar **argv)
     int     ndigits;
     
     ndigits = (argc > 0) ? ejsGetInt(argv[0]) : 0;
-    result = mprDtoa(np, np->value, ndigits, MPR_DTOA_N_FRACTION_DIGITS, MPR_DTOA_FIXED_FORM);
+    result = mprDtoa(ejs, np->value, ndigits, MPR_DTOA_N_FRACTION_DIGITS, MPR_DTOA_FIXED_FORM);
     return (EjsVar*) ejsCreateStringAndFree(ejs, result);
 #else
     char    numBuf[32];
@@ -8733,7 +9247,7 @@ static EjsVar *toPrecision(Ejs *ejs, EjsNumber *np, int argc, EjsVar **argv)
     int     ndigits;
     
     ndigits = (argc > 0) ? ejsGetInt(argv[0]) : 0;
-    result = mprDtoa(np, np->value, ndigits, MPR_DTOA_N_DIGITS, 0);
+    result = mprDtoa(ejs, np->value, ndigits, MPR_DTOA_N_DIGITS, 0);
     return (EjsVar*) ejsCreateStringAndFree(ejs, result);
 #else
     char    numBuf[32];
@@ -8805,12 +9319,16 @@ EjsNumber *ejsCreateNumber(Ejs *ejs, MprNumber value)
 {
     EjsNumber   *vp;
 
-    if (value == 0) {
-        return ejs->zeroValue;
-    } else if (value == 1) {
-        return ejs->oneValue;
-    } else if (value == -1) {
-        return ejs->minusOneValue;
+    if (value >= EJS_MIN_SMALL_INT && value <= EJS_MAX_SMALL_INT && value == (int) value) {
+        if (ejs->smallInts) {
+            return ejs->smallInts[(int) value - EJS_MIN_SMALL_INT];
+        } else if (value == 0) {
+            return ejs->zeroValue;
+        } else if (value == 1) {
+            return ejs->oneValue;
+        } else if (value == -1) {
+            return ejs->minusOneValue;
+        }
     }
 
     vp = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
@@ -8823,6 +9341,37 @@ EjsNumber *ejsCreateNumber(Ejs *ejs, MprNumber value)
 }
 
 
+/*
+ *  Preallocate the shared small integer values. These live in the eternal generation with the other core values.
+ */
+static void createSmallInts(Ejs *ejs)
+{
+    EjsNumber   *vp;
+    int         i;
+
+    ejs->smallInts = (EjsNumber**) mprAlloc(ejs, (EJS_MAX_SMALL_INT - EJS_MIN_SMALL_INT + 1) * sizeof(EjsNumber*));
+    if (ejs->smallInts == 0) {
+        return;
+    }
+    for (i = EJS_MIN_SMALL_INT; i <= EJS_MAX_SMALL_INT; i++) {
+        if (i == 0) {
+            vp = ejs->zeroValue;
+        } else if (i == 1) {
+            vp = ejs->oneValue;
+        } else if (i == -1) {
+            vp = ejs->minusOneValue;
+        } else if ((vp = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0)) == 0) {
+            ejs->smallInts = 0;
+            return;
+        } else {
+            vp->value = i;
+            vp->obj.var.primitive = 1;
+        }
+        ejs->smallInts[i - EJS_MIN_SMALL_INT] = vp;
+    }
+}
+
+
 void ejsCreateNumberType(Ejs *ejs)
 {
     EjsType     *type;
@@ -8847,6 +9396,10 @@ void ejsCreateNumberType(Ejs *ejs)
     ejs->oneValue->value = 1;
     ejs->minusOneValue = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
     ejs->minusOneValue->value = -1;
+    ejs->zeroValue->obj.var.primitive = 1;
+    ejs->oneValue->obj.var.primitive = 1;
+    ejs->minusOneValue->obj.var.primitive = 1;
+    createSmallInts(ejs);
 
 #if BLD_FEATURE_NUM_TYPE_DOUBLE
     ejs->infinityValue = (EjsNumber*) ejsCreateVar(ejs, ejs->numberType, 0);
@@ -9197,6 +9750,17 @@ static int deleteObjectProperty(Ejs *ejs, EjsObject *obj, int slotNum)
     if (qname.name == 0) {
         return EJS_ERR;
     }
+    if (obj->var.dynamic && obj->names && obj != mprGetParent(obj->names)) {
+        /*
+         *  Object is using the type's original names. Don't change the type's layout, use own names from here on.
+         */
+        if (ejsGrowObjectNames(obj, obj->numProp) < 0) {
+            return EJS_ERR;
+        }
+    }
+    if (obj->var.isType || obj->var.isInstanceBlock) {
+        ejsInvalidateInlineCaches(ejs);
+    }
     removeHashEntry(obj, &qname);
     obj->slots[slotNum] = ejs->undefinedValue;
     return 0;
@@ -9572,6 +10136,7 @@ static int setObjectProperty(Ejs *ejs, EjsObject *obj, int slotNum, EjsVar *valu
         value->permanent = 1;
     }
     mprAssert(value);
+    ejsWriteBarrier(ejs, value);
     obj->slots[slotNum] = value;
     return slotNum;
 }
@@ -9626,6 +10191,9 @@ static int setObjectPropertyName(Ejs *ejs, EjsObject *obj, int slotNum, EjsName
         }
         removeHashEntry(obj, &names->entries[slotNum].qname);
     }
+    if (obj->var.isType || obj->var.isInstanceBlock) {
+        ejsInvalidateInlineCaches(ejs);
+    }
 
     /*
      *  Set the property name
@@ -9719,7 +10287,10 @@ int ejsInsertGrowObject(Ejs *ejs, EjsObject *obj, int incr, int offset)
     if (incr == 0) {
         return 0;
     }
-    
+    if (obj->var.isType || obj->var.isInstanceBlock) {
+        ejsInvalidateInlineCaches(ejs);
+    }
+
     /*
      *  Base this comparison on numProp and not on capacity as we may already have room to fit the inserted properties.
      */
@@ -9835,6 +10406,9 @@ void ejsRemoveSlot(Ejs *ejs, EjsObject *obj, int slotNum, int compact)
     mprAssert(slotNum >= 0);
 
     names = obj->names;
+    if (obj->var.isType || obj->var.isInstanceBlock) {
+        ejsInvalidateInlineCaches(ejs);
+    }
 
     if (compact) {
         mprAssert(names);
@@ -10412,104 +10986,7 @@ static EjsVar *seal(Ejs *ejs, EjsVar *vp, int argc, EjsVar **argv)
  */
 static EjsVar *objectToJson(Ejs *ejs, EjsVar *vp, int argc, EjsVar **argv)
 {
-    MprBuf      *buf;
-    EjsVar      *pp, *result;
-    EjsBlock    *block;
-    EjsName     qname;
-    EjsObject   *obj;
-    EjsString   *sv;
-    char        key[16], *cp;
-    int         c, isArray, i, count, slotNum, numInherited, maxDepth, flags, showAll, showBase;
-
-    count = ejsGetPropertyCount(ejs, (EjsVar*) vp);
-    if (count == 0 && vp->type != ejs->objectType && vp->type != ejs->arrayType) {
-        return (EjsVar*) ejsToString(ejs, vp);
-    }
-
-    maxDepth = 99;
-    flags = 0;
-    showAll = 0;
-    showBase = 0;
-
-    isArray = ejsIsArray(vp);
-    obj = (EjsObject*) vp;
-    buf = mprCreateBuf(ejs, 0, 0);
-    mprPutStringToBuf(buf, isArray ? "[\n" : "{\n");
-
-    if (++ejs->serializeDepth <= maxDepth) {
-
-        for (slotNum = 0; slotNum < count && !ejs->exception; slotNum++) {
-            if (ejsIsBlock(obj)) {
-                block = (EjsBlock*) obj;
-                numInherited = ejsGetNumInheritedTraits(block);
-                if (slotNum < numInherited && !(flags & EJS_FLAGS_ENUM_INHERITED)) {
-                    continue;
-                }
-            }
-            pp = ejsGetProperty(ejs, (EjsVar*) obj, slotNum);
-            if (ejs->exception) {
-                return 0;
-            }
-            if (pp == 0 || (pp->hidden && !(flags & EJS_FLAGS_ENUM_ALL))) {
-                continue;
-            }
-            if (ejsIsFunction(pp) && !(flags & EJS_FLAGS_ENUM_ALL)) {
-                continue;
-            }
-            if (isArray) {
-                mprItoa(key, sizeof(key), slotNum, 10);
-                qname.name = key;
-                qname.space = "";
-            } else {
-                qname = ejsGetPropertyName(ejs, vp, slotNum);
-            }
-
-            if (qname.space && strstr(qname.space, ",private") != 0) {
-                continue;
-            }
-            if (qname.space[0] == '\0' && qname.name[0] == '\0') {
-                continue;
-            }
-            for (i = 0; i < ejs->serializeDepth; i++) {
-                mprPutStringToBuf(buf, "  ");
-            }
-            if (!isArray) {
-                mprPutCharToBuf(buf, '"');
-                for (cp = (char*) qname.name; cp && *cp; cp++) {
-                    c = *cp;
-                    if (c == '"' || c == '\\') {
-                        mprPutCharToBuf(buf, '\\');
-                        mprPutCharToBuf(buf, c);
-                    } else {
-                        mprPutCharToBuf(buf, c);
-                    }
-                }
-                mprPutStringToBuf(buf, "\": ");
-            }
-            sv = (EjsString*) ejsToJson(ejs, pp);
-            if (sv == 0 || !ejsIsString(sv)) {
-                if (!ejs->exception) {
-                    ejsThrowTypeError(ejs, "Can't serialize property %s", qname.name);
-                }
-                return 0;
-            } else {
-                mprPutStringToBuf(buf, sv->value);
-            }
-            if ((slotNum + 1) < count) {
-                mprPutCharToBuf(buf, ',');
-            }
-            mprPutStringToBuf(buf, "\n");
-        }
-    }
-    for (i = --ejs->serializeDepth; i > 0; i--) {
-        mprPutStringToBuf(buf, "  ");
-    }
-    mprPutCharToBuf(buf, isArray ? ']' : '}');
-
-    mprAddNullToBuf(buf);
-    result = (EjsVar*) ejsCreateString(ejs, mprGetBufStart(buf));
-    mprFree(buf);
-    return result;
+    return (EjsVar*) ejsObjectToJson(ejs, vp);
 }
 
 
@@ -10999,6 +11476,7 @@ void ejsConfigureReflectType(Ejs *ejs)
 #if BLD_FEATURE_REGEXP && ES_RegExp
 
 
+static int compileRegExp(Ejs *ejs, EjsRegExp *rp);
 static int parseFlags(EjsRegExp *rp, cchar *flags);
 static char *makeFlags(EjsRegExp *rp);
 
@@ -11035,8 +11513,9 @@ static void destroyRegExp(Ejs *ejs, EjsRegExp *rp)
 {
     mprAssert(rp);
 
-    if (rp->compiled) {
-        free(rp->compiled);
+    if (rp->regex) {
+        mprReleaseRegex(ejs, rp->regex);
+        rp->regex = 0;
         rp->compiled = 0;
     }
     ejsFreeVar(ejs, (EjsVar*) rp, -1);
@@ -11051,8 +11530,7 @@ static void destroyRegExp(Ejs *ejs, EjsRegExp *rp)
 
 static EjsVar *regexConstructor(Ejs *ejs, EjsRegExp *rp, int argc, EjsVar **argv)
 {
-    cchar       *errMsg, *flags, *pattern;
-    int         column, errCode;
+    cchar       *flags, *pattern;
 
     pattern = ejsGetString(argv[0]);
     rp->options = PCRE_JAVASCRIPT_COMPAT;
@@ -11062,14 +11540,7 @@ static EjsVar *regexConstructor(Ejs *ejs, EjsRegExp *rp, int argc, EjsVar **argv
         rp->options |= parseFlags(rp, flags);
     }
     rp->pattern = mprStrdup(rp, pattern);
-    if (rp->compiled) {
-        free(rp->compiled);
-    }
-    rp->compiled = (void*) pcre_compile2(rp->pattern, rp->options, &errCode, &errMsg, &column, NULL);
-
-    if (rp->compiled == NULL) {
-        ejsThrowArgError(ejs, "Can't compile regular expression. Error %s at column %d", errMsg, column);
-    }
+    compileRegExp(ejs, rp);
     return (EjsVar*) rp;
 }
 
@@ -11205,9 +11676,7 @@ EjsVar *ejsRegExpToString(Ejs *ejs, EjsRegExp *rp)
 EjsRegExp *ejsCreateRegExp(Ejs *ejs, cchar *pattern)
 {
     EjsRegExp   *rp;
-    cchar       *errMsg;
     char        *flags;
-    int         column, errCode;
 
     mprAssert(pattern[0] == '/');
     
@@ -11225,12 +11694,7 @@ EjsRegExp *ejsCreateRegExp(Ejs *ejs, cchar *pattern)
             rp->options = parseFlags(rp, &flags[1]);
             *flags = '\0';
         }
-        if (rp->compiled) {
-            free(rp->compiled);
-        }
-        rp->compiled = pcre_compile2(rp->pattern, rp->options, &errCode, &errMsg, &column, NULL);
-        if (rp->compiled == NULL) {
-            ejsThrowArgError(ejs, "Can't compile regular expression. Error %s at column %d", errMsg, column);
+        if (compileRegExp(ejs, rp) < 0) {
             return 0;
         }
     }
@@ -11238,6 +11702,61 @@ EjsRegExp *ejsCreateRegExp(Ejs *ejs, cchar *pattern)
 }
 
 
+/*
+ *  Compile the pattern via the process-wide MPR regex cache. Regular expression literals are evaluated afresh in each
+ *  interpreter and on each execution, so most compiles are satisfied from the cache.
+ */
+static int compileRegExp(Ejs *ejs, EjsRegExp *rp)
+{
+    cchar       *errMsg;
+    int         column;
+
+    if (rp->regex) {
+        mprReleaseRegex(ejs, rp->regex);
+    }
+    rp->compiled = 0;
+    if ((rp->regex = mprCompileRegex(ejs, rp->pattern, rp->options, &errMsg, &column)) == 0) {
+        ejsThrowArgError(ejs, "Can't compile regular expression. Error %s at column %d", errMsg, column);
+        return EJS_ERR;
+    }
+    rp->compiled = rp->regex->compiled;
+    return 0;
+}
+
+
+/*
+ *  Get the regular expression cache statistics
+ *
+ *  static function get cache(): Object
+ */
+static EjsVar *getRegExpCache(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
+{
+    MprRegexStats   stats;
+    EjsVar          *result;
+    EjsName         qname;
+
+    mprGetRegexStats(ejs, &stats);
+    result = (EjsVar*) ejsCreateSimpleObject(ejs);
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "hits"), (EjsVar*) ejsCreateNumber(ejs, stats.hits));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "misses"), (EjsVar*) ejsCreateNumber(ejs, stats.misses));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "entries"), (EjsVar*) ejsCreateNumber(ejs, stats.entries));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "evicted"), (EjsVar*) ejsCreateNumber(ejs, stats.evicted));
+    return result;
+}
+
+
+/*
+ *  Set the maximum number of cached patterns
+ *
+ *  static function setCacheLimit(max: Number): Void
+ */
+static EjsVar *setRegExpCacheLimit(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
+{
+    mprSetRegexCacheLimit(ejs, ejsGetInt(argv[0]));
+    return 0;
+}
+
+
 static int parseFlags(EjsRegExp *rp, cchar *flags)
 {
     cchar       *cp;
@@ -11364,6 +11883,8 @@ void ejsConfigureRegExpType(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_RegExp_sticky, (EjsNativeFunction) sticky);
 #endif
     ejsBindMethod(ejs, type, ES_RegExp_test, (EjsNativeFunction) test);
+    ejsBindMethod(ejs, type, ES_RegExp_cache, (EjsNativeFunction) getRegExpCache);
+    ejsBindMethod(ejs, type, ES_RegExp_setCacheLimit, (EjsNativeFunction) setRegExpCacheLimit);
     ejsBindMethod(ejs, type, ES_Object_toString, (EjsNativeFunction) ejsRegExpToString);
 }
 
@@ -11646,8 +12167,20 @@ static EjsVar *invokeStringOperator(Ejs *ejs, EjsString *lhs, int opcode,  EjsSt
      *  Binary operators
      */
     case EJS_OP_ADD:
-        result = (EjsVar*) ejsCreateString(ejs, lhs->value);
-        ejsStrcat(ejs, (EjsString*) result, (EjsVar*) rhs);
+        /*
+         *  Strings are immutable so an empty operand can return the other. Otherwise allocate the result once and 
+         *  copy both operands rather than copying the lhs and then growing it.
+         */
+        if (rhs->length == 0 && lhs->obj.var.type == ejs->stringType) {
+            return (EjsVar*) lhs;
+        } else if (lhs->length == 0 && rhs->obj.var.type == ejs->stringType) {
+            return (EjsVar*) rhs;
+        }
+        if ((result = (EjsVar*) ejsCreateBareString(ejs, lhs->length + rhs->length)) == 0) {
+            return 0;
+        }
+        memcpy(((EjsString*) result)->value, lhs->value, lhs->length);
+        memcpy(&((EjsString*) result)->value[lhs->length], rhs->value, rhs->length);
         return result;
 
     case EJS_OP_AND: case EJS_OP_DIV: case EJS_OP_OR:
@@ -13060,9 +13593,19 @@ static int catString(Ejs *ejs, EjsString *dest, char *str, int len)
     oldLen = dest->length;
     newLen = oldLen + len + 1;
 
-    buf = (char*) mprRealloc(ejs, oldBuf, newLen);
-    if (buf == 0) {
-        return -1;
+    /*
+     *  Grow geometrically so strings built by repeated appends (join, concat) take linear rather than quadratic time
+     */
+    if (oldBuf == 0 || newLen > (int) mprGetBlockSize(oldBuf)) {
+        if (oldBuf && newLen < oldLen * 2) {
+            newLen = oldLen * 2;
+        }
+        buf = (char*) mprRealloc(ejs, oldBuf, newLen);
+        if (buf == 0) {
+            return -1;
+        }
+    } else {
+        buf = oldBuf;
     }
     dest->value = buf;
     memcpy(&buf[oldLen], str, len);
@@ -13275,6 +13818,60 @@ EjsString *ejsCreateBareString(Ejs *ejs, int len)
 }
 
 
+/*
+ *  Test if a name is worth interning. Only short identifier-like names and the empty namespace qualify.
+ */
+static bool isInternable(cchar *name)
+{
+    cchar   *cp;
+
+    if (*name == '\0') {
+        return 1;
+    }
+    if (!isalpha((uchar) *name) && *name != '_' && *name != '$') {
+        return 0;
+    }
+    for (cp = &name[1]; *cp; cp++) {
+        if ((!isalnum((uchar) *cp) && *cp != '_' && *cp != '$') || (cp - name) >= EJS_MAX_INTERN_LENGTH) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+/*
+ *  Return a persistent property name. Interned names are the keys of the interpreter's intern hash and live as long 
+ *  as the interpreter. This saves a copy per property and lets objects with run-time names be pooled.
+ */
+cchar *ejsInternName(Ejs *ejs, EjsVar *owner, cchar *name)
+{
+    MprHash     *hp;
+
+    mprAssert(name);
+
+    if (isInternable(name)) {
+        if (ejs->internedNames == 0) {
+            ejs->internedNames = mprCreateHash(ejs, EJS_INTERN_HASH_SIZE);
+        }
+        if (ejs->internedNames) {
+            if ((hp = mprLookupHashEntry(ejs->internedNames, name)) != 0) {
+                return hp->key;
+            }
+            if (mprGetHashCount(ejs->internedNames) < EJS_MAX_INTERNED_NAMES && 
+                    (hp = mprAddHash(ejs->internedNames, name, 0)) != 0) {
+                return hp->key;
+            }
+        }
+    }
+    /*
+     *  Must not pool the owner otherwise the name allocation will leak. Need the var to be freed.
+     */
+    owner->noPool = 1;
+    return mprStrdup(owner, name);
+}
+
+
 void ejsCreateStringType(Ejs *ejs)
 {
     EjsType     *type;
@@ -13441,6 +14038,7 @@ static EjsType *cloneTypeVar(Ejs *ejs, EjsType *src, bool deep)
     if (dest == 0) {
         return dest;
     }
+    ejsInvalidateInlineCaches(ejs);
 
     dest->qname = src->qname;
     dest->baseType = src->baseType;
@@ -13688,6 +14286,7 @@ EjsBlock *ejsCreateTypeInstanceBlock(Ejs *ejs, EjsType *type, int numInstancePro
     type->instanceBlock = block;
     block->nobind = type->block.nobind;
     block->dynamicInstance = type->block.dynamicInstance;
+    ejsInvalidateInlineCaches(ejs);
     return block;
 }
 
@@ -13796,6 +14395,7 @@ static EjsType *createType(Ejs *ejs, EjsName *qname, EjsModule *up, EjsType *bas
     if (type == 0) {
         return 0;
     }
+    ejsInvalidateInlineCaches(ejs);
 
     if (baseType) {
         mprAssert(!(attributes & EJS_ATTR_SLOTS_NEED_FIXUP));
@@ -16083,6 +16683,7 @@ void ejsConfigureFileSystemType(Ejs *ejs)
 static EjsVar   *getDateHeader(Ejs *ejs, EjsHttp *hp, cchar *key);
 static EjsVar   *getStringHeader(Ejs *ejs, EjsHttp *hp, cchar *key);
 static void     httpCallback(EjsHttp *hp, int mask);
+static EjsVar   *httpResponse(Ejs *ejs, EjsHttp *hp, int argc, EjsVar **argv);
 static void     prepForm(Ejs *ejs, EjsHttp *hp, char *prefix, EjsVar *data);
 static char     *prepUri(MprCtx ctx, cchar *uri);
 static EjsVar   *startRequest(Ejs *ejs, EjsHttp *hp, char *method, int argc, EjsVar **argv);
@@ -16553,6 +17154,104 @@ static EjsVar *optionsMethod(Ejs *ejs, EjsHttp *hp, int argc, EjsVar **argv)
 }
 
 
+/*
+ *  Write GET requests for uris[first..] on the current connection ahead of their responses. Returns the index of 
+ *  the last request written.
+ */
+static int pipelineRequests(Ejs *ejs, EjsHttp *hp, EjsArray *uris, int first)
+{
+    EjsString   *uri;
+    char        *url;
+    int         i, rc;
+
+    for (i = first; i < uris->length; i++) {
+        if ((uri = ejsToString(ejs, uris->data[i])) == 0) {
+            break;
+        }
+        url = prepUri(hp, uri->value);
+        rc = mprPipelineHttpRequest(hp->http, url);
+        mprFree(url);
+        if (rc < 0) {
+            break;
+        }
+    }
+    return i - 1;
+}
+
+
+/*
+ *  function pipeline(uris: Array): Array
+ */
+static EjsVar *httpPipeline(Ejs *ejs, EjsHttp *hp, int argc, EjsVar **argv)
+{
+    EjsArray    *uris, *result;
+    EjsVar      *uri, *response, *item;
+    EjsName     qname;
+    int         i, written;
+
+    uris = (EjsArray*) argv[0];
+    result = ejsCreateArray(ejs, 0);
+    written = -1;
+
+    for (i = 0; i < uris->length; i++) {
+        if ((uri = (EjsVar*) ejsToString(ejs, uris->data[i])) == 0) {
+            return 0;
+        }
+        if (i <= written && mprNextHttpResponse(hp->http) == 0) {
+            mprFree(hp->uri);
+            hp->uri = prepUri(hp, ejsGetString(uri));
+            mprFlushBuf(hp->responseContent);
+            hp->responseCache = 0;
+            hp->requestStarted = 1;
+            hp->gotResponse = 0;
+        } else {
+            /*
+             *  Issue the request normally. This is also the fallback if the server closed the connection or a response 
+             *  had to be retried. Then write the remaining requests ahead of this response.
+             */
+            startRequest(ejs, hp, "GET", 1, &uri);
+            if (ejs->exception) {
+                return 0;
+            }
+            written = pipelineRequests(ejs, hp, uris, i + 1);
+        }
+        if ((response = httpResponse(ejs, hp, 0, NULL)) == 0) {
+            return 0;
+        }
+        item = (EjsVar*) ejsCreateSimpleObject(ejs);
+        ejsSetPropertyByName(ejs, item, ejsName(&qname, "", "uri"), uri);
+        ejsSetPropertyByName(ejs, item, ejsName(&qname, "", "code"), 
+            (EjsVar*) ejsCreateNumber(ejs, mprGetHttpCode(hp->http)));
+        ejsSetPropertyByName(ejs, item, ejsName(&qname, "", "response"), response);
+        ejsSetProperty(ejs, (EjsVar*) result, i, item);
+    }
+    return (EjsVar*) result;
+}
+
+
+/*
+ *  static function get pool(): Object
+ */
+static EjsVar *getPool(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
+{
+    MprHttpPoolStats    stats;
+    EjsName             qname;
+    EjsVar              *result;
+
+    mprGetHttpPoolStats(ejs, &stats);
+    result = (EjsVar*) ejsCreateSimpleObject(ejs);
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "opened"), (EjsVar*) ejsCreateNumber(ejs, stats.opened));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "reused"), (EjsVar*) ejsCreateNumber(ejs, stats.reused));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "idle"), (EjsVar*) ejsCreateNumber(ejs, stats.idle));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "expired"), (EjsVar*) ejsCreateNumber(ejs, stats.expired));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "discarded"), 
+        (EjsVar*) ejsCreateNumber(ejs, stats.discarded));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "pipelined"), 
+        (EjsVar*) ejsCreateNumber(ejs, stats.pipelined));
+    return result;
+}
+
+
 /*
  *  function post(uri: String = null, ...requestContent): Void
  */
@@ -16768,6 +17467,16 @@ static EjsVar *setCredentials(Ejs *ejs, EjsHttp *hp, int argc, EjsVar **argv)
 }
 
 
+/*
+ *  static function setPoolLimits(maxPerHost: Number = -1, timeout: Number = -1): Void
+ */
+static EjsVar *setPoolLimits(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
+{
+    mprSetHttpPoolLimits(ejs, (argc >= 1) ? ejsGetInt(argv[0]) : -1, (argc >= 2) ? ejsGetInt(argv[1]) : -1);
+    return 0;
+}
+
+
 /*
  *  function get timeout(): Number
  */
@@ -17259,7 +17968,10 @@ void ejsConfigureHttpType(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_ejs_io_Http_readLines, (EjsNativeFunction) readLines);
     ejsBindMethod(ejs, type, ES_ejs_io_Http_response, (EjsNativeFunction) httpResponse);
     ejsBindMethod(ejs, type, ES_ejs_io_Http_options, (EjsNativeFunction) optionsMethod);
+    ejsBindMethod(ejs, type, ES_ejs_io_Http_pipeline, (EjsNativeFunction) httpPipeline);
+    ejsBindMethod(ejs, type, ES_ejs_io_Http_pool, (EjsNativeFunction) getPool);
     ejsBindMethod(ejs, type, ES_ejs_io_Http_setCredentials, (EjsNativeFunction) setCredentials);
+    ejsBindMethod(ejs, type, ES_ejs_io_Http_setPoolLimits, (EjsNativeFunction) setPoolLimits);
     ejsBindMethod(ejs, type, ES_ejs_io_Http_timeout, (EjsNativeFunction) getTimeout);
     ejsBindMethod(ejs, type, ES_ejs_io_Http_set_timeout, (EjsNativeFunction) setTimeout);
     ejsBindMethod(ejs, type, ES_ejs_io_Http_trace, (EjsNativeFunction) traceMethod);
@@ -18934,6 +19646,12 @@ EjsVar *ejsServiceEvents(Ejs *ejs, int count, int timeout, int flags)
     }
     mark = mprGetTime(ejs);
     do {
+        /*
+         *  Use idle time to do incremental garbage collection
+         */
+        while (ejsIsTimeForGC(ejs, mprGetIdleTime(ejs->dispatcher)) && !ejsStepGarbage(ejs, EJS_GEN_NEW)) {
+            ;
+        }
         rc = mprServiceEvents(ejs->dispatcher, timeout, MPR_SERVICE_EVENTS | MPR_SERVICE_ONE_THING);
         if (rc > 0) {
             count -= rc;
@@ -19360,6 +20078,78 @@ static EjsVar *setWorkQuota(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
 }
 
 
+#if ES_ejs_sys_GC_pauses
+/*
+ *  native static function get pauseBudget(): Number
+ */
+static EjsVar *getPauseBudget(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    return (EjsVar*) ejsCreateNumber(ejs, ejs->gc.pauseBudget);
+}
+
+
+/*
+ *  native static function set pauseBudget(msec: Number): Void
+ */
+static EjsVar *setPauseBudget(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    int     msec;
+
+    mprAssert(argc == 1 && ejsIsNumber(argv[0]));
+    msec = ejsGetInt(argv[0]);
+    if (msec < 0) {
+        ejsThrowArgError(ejs, "Bad pause budget");
+        return 0;
+    }
+    ejsSetGCPauseBudget(ejs, msec);
+    return 0;
+}
+
+
+/*
+ *  native static function get pauses(): Object
+ */
+static EjsVar *getPauses(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    EjsName     qname;
+    EjsGC       *gc;
+    EjsVar      *result, *histogram, *limits;
+    int         *pauseLimits, count, i;
+
+    gc = &ejs->gc;
+    pauseLimits = ejsGetGCPauseLimits(ejs);
+    histogram = (EjsVar*) ejsCreateArray(ejs, EJS_GC_PAUSE_BUCKETS);
+    limits = (EjsVar*) ejsCreateArray(ejs, EJS_GC_PAUSE_BUCKETS - 1);
+    for (count = 0, i = 0; i < EJS_GC_PAUSE_BUCKETS; i++) {
+        ejsSetProperty(ejs, histogram, i, (EjsVar*) ejsCreateNumber(ejs, gc->pauses[i]));
+        if (pauseLimits[i]) {
+            ejsSetProperty(ejs, limits, i, (EjsVar*) ejsCreateNumber(ejs, pauseLimits[i]));
+        }
+        count += gc->pauses[i];
+    }
+    result = (EjsVar*) ejsCreateSimpleObject(ejs);
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "collections"), (EjsVar*) ejsCreateNumber(ejs, gc->totalCycles));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "steps"), (EjsVar*) ejsCreateNumber(ejs, gc->totalSteps));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "count"), (EjsVar*) ejsCreateNumber(ejs, count));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "total"), 
+        (EjsVar*) ejsCreateNumber(ejs, (MprNumber) gc->totalPause));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "max"), (EjsVar*) ejsCreateNumber(ejs, (MprNumber) gc->maxPause));
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "histogram"), histogram);
+    ejsSetPropertyByName(ejs, result, ejsName(&qname, "", "limits"), limits);
+    return result;
+}
+
+
+/*
+ *  native static function resetPauses(): Void
+ */
+static EjsVar *resetPauses(Ejs *ejs, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    ejsResetGCPauses(ejs);
+    return 0;
+}
+#endif
+
 
 void ejsCreateGCType(Ejs *ejs)
 {
@@ -19381,6 +20171,12 @@ void ejsConfigureGCType(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_ejs_sys_GC_workQuota, (EjsNativeFunction) getWorkQuota);
     ejsBindMethod(ejs, type, ES_ejs_sys_GC_set_workQuota, (EjsNativeFunction) setWorkQuota);
     ejsBindMethod(ejs, type, ES_ejs_sys_GC_run, (EjsNativeFunction) runGC);
+#if ES_ejs_sys_GC_pauses
+    ejsBindMethod(ejs, type, ES_ejs_sys_GC_pauseBudget, (EjsNativeFunction) getPauseBudget);
+    ejsBindMethod(ejs, type, ES_ejs_sys_GC_set_pauseBudget, (EjsNativeFunction) setPauseBudget);
+    ejsBindMethod(ejs, type, ES_ejs_sys_GC_pauses, (EjsNativeFunction) getPauses);
+    ejsBindMethod(ejs, type, ES_ejs_sys_GC_resetPauses, (EjsNativeFunction) resetPauses);
+#endif
 }
 
 
@@ -20045,6 +20841,8 @@ typedef struct Message {
     EjsWorker   *worker;
     cchar       *callback;
     char        *data;
+    MprBuf      *clone;                 /* Structured clone of the message data */
+    MprList     *transfers;             /* Byte array buffers transferred by ownership */
     char        *message;
     char        *filename;
     char        *stack;
@@ -20052,15 +20850,62 @@ typedef struct Message {
     int         callbackSlot;
 } Message;
 
+/*
+ *  Structured clone tags. Message data is encoded in this compact binary form by the sending interpreter and
+ *  rebuilt directly by the receiving interpreter without any text parsing.
+ */
+#define CLONE_UNDEFINED     'u'
+#define CLONE_NULL          'n'
+#define CLONE_TRUE          't'
+#define CLONE_FALSE         'f'
+#define CLONE_NUMBER        'd'
+#define CLONE_STRING        's'
+#define CLONE_DATE          'D'
+#define CLONE_ARRAY         'a'
+#define CLONE_OBJECT        'o'
+#define CLONE_BYTES         'b'         /* Byte array copied into the clone */
+#define CLONE_TRANSFER      'T'         /* Byte array buffer transferred by ownership */
+#define CLONE_REF           'r'         /* Reference to an object already in the clone (shared or cyclic) */
+
+typedef struct Clone {
+    MprBuf      *buf;                   /* Encoded data */
+    MprList     *objects;               /* Objects in encoding order. Indexes are used by CLONE_REF */
+    MprList     *transfers;             /* Byte arrays to detach once encoding succeeds */
+    EjsArray    *transfer;              /* Byte arrays the caller permits to be transferred */
+    cchar       *pos;                   /* Decode position */
+    cchar       *end;                   /* End of encoded data */
+} Clone;
 
 static void addWorker(Ejs *ejs, EjsWorker *worker);
 static int join(Ejs *ejs, EjsVar *workers, int timeout);
 static void handleError(Ejs *ejs, EjsWorker *worker, EjsVar *exception);
 static void loadFile(EjsWorker *insideWorker, cchar *filename);
 static void removeWorker(Ejs *ejs, EjsWorker *worker);
+static int scheduleWorker(Ejs *ejs, EjsWorker *worker);
+static void waitWorker(Ejs *ejs, bool waiting);
 static void workerMain(EjsWorker *worker, MprWorker *mprWorker);
 static EjsVar *workerPreload(Ejs *ejs, EjsWorker *worker, int argc, EjsVar **argv);
 
+/*
+ *  Get the master interpreter used to clone worker interpreters. This is created on first use and shared by all
+ *  interpreters in the process.
+ */
+static Ejs *getWorkerMaster(Ejs *ejs)
+{
+    EjsService  *sp;
+    Ejs         *master;
+
+    sp = ejs->service;
+    mprLock(sp->mutex);
+    if (sp->workerMaster == 0) {
+        sp->workerMaster = ejsCreate(sp, NULL, NULL, EJS_FLAG_MASTER);
+    }
+    master = sp->workerMaster;
+    mprUnlock(sp->mutex);
+    return master;
+}
+
+
 /*
  *  function Worker(script: String = null, options: Object = null)
  *
@@ -20102,8 +20947,9 @@ static EjsVar *workerConstructor(Ejs *ejs, EjsWorker *worker, int argc, EjsVar *
 
     /*
      *  Create a new interpreter and an "inside" worker object and pair it with the current "outside" worker.
+     *  Interpreters are cloned from a shared master so the core types are not loaded again for each worker.
      */
-    wejs = ejsCreate(ejs->service, NULL, search, 0);
+    wejs = ejsCreate(ejs->service, getWorkerMaster(ejs), search, 0);
     if (wejs == 0) {
         ejsThrowMemoryError(ejs);
         return 0;
@@ -20114,6 +20960,7 @@ static EjsVar *workerConstructor(Ejs *ejs, EjsWorker *worker, int argc, EjsVar *
     self->inside = 1;
     self->pair = worker;
     self->name = mprStrcat(self, -1, "inside-", worker->name, NULL);
+    wejs->flags |= EJS_FLAG_WORKER;
 
     ejsSetProperty(ejs,  (EjsVar*) worker, ES_ejs_sys_Worker_name, (EjsVar*) ejsCreateString(ejs, self->name));
     ejsSetProperty(wejs, (EjsVar*) self,   ES_ejs_sys_Worker_name, (EjsVar*) ejsCreateString(wejs, self->name));
@@ -20134,7 +20981,7 @@ static EjsVar *workerConstructor(Ejs *ejs, EjsWorker *worker, int argc, EjsVar *
         worker->scriptFile = mprStrdup(worker, ((EjsPath*) argv[0])->path);
         worker->state = EJS_WORKER_STARTED;
         worker->obj.var.permanent = 1;
-        if (mprStartWorker(ejs, (MprWorkerProc) workerMain, (void*) worker, MPR_NORMAL_PRIORITY) < 0) {
+        if (scheduleWorker(ejs, worker) < 0) {
             ejsThrowStateError(ejs, "Can't start worker");
             worker->obj.var.permanent = 0;
             return 0;
@@ -20198,7 +21045,7 @@ static EjsVar *startWorker(Ejs *ejs, EjsWorker *worker, int timeout)
     worker->state = EJS_WORKER_STARTED;
 
     worker->obj.var.permanent = 1;
-    if (mprStartWorker(ejs, (MprWorkerProc) workerMain, (void*) worker, MPR_NORMAL_PRIORITY) < 0) {
+    if (scheduleWorker(ejs, worker) < 0) {
         ejsThrowStateError(ejs, "Can't start worker");
         worker->obj.var.permanent = 0;
         return 0;
@@ -20302,6 +21149,7 @@ static int join(Ejs *ejs, EjsVar *workers, int timeout)
 
     mark = mprGetTime(ejs);
     ejs->joining = 1;
+    waitWorker(ejs, 1);
 
     do {
         /*
@@ -20317,6 +21165,7 @@ static int join(Ejs *ejs, EjsVar *workers, int timeout)
         }
         remaining = mprGetRemainingTime(ejs, mark, timeout);
     } while (ejs->joining && remaining > 0 && !ejs->exception);
+    waitWorker(ejs, 0);
 
     if (ejs->exception) {
         return 0;
@@ -20408,6 +21257,347 @@ static EjsVar *workerLookup(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
 }
 
 
+static void putCloneInt(MprBuf *buf, int value)
+{
+    mprPutBlockToBuf(buf, (char*) &value, sizeof(value));
+}
+
+
+static void putCloneString(MprBuf *buf, cchar *str, int len)
+{
+    putCloneInt(buf, len);
+    mprPutBlockToBuf(buf, str, len + 1);
+}
+
+
+static bool isTransferable(Clone *cp, EjsByteArray *ap)
+{
+    int     i;
+
+    if (cp->transfer == 0 || ap->value == 0) {
+        return 0;
+    }
+    for (i = 0; i < cp->transfer->length; i++) {
+        if (cp->transfer->data[i] == (EjsVar*) ap) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+ *  Encode a value into the clone. Returns EJS_ERR for values that can't be cloned such as functions and types.
+ */
+static int cloneValue(Ejs *ejs, Clone *cp, EjsVar *vp)
+{
+    MprBuf          *buf;
+    EjsByteArray    *ap;
+    EjsString       *str;
+    EjsVar          *pp;
+    EjsName         qname;
+    MprNumber       number;
+    MprTime         when;
+    int             slotNum, count, numInherited, offset, rc;
+
+    buf = cp->buf;
+    if (vp == 0 || ejsIsUndefined(vp)) {
+        mprPutCharToBuf(buf, CLONE_UNDEFINED);
+
+    } else if (ejsIsNull(vp)) {
+        mprPutCharToBuf(buf, CLONE_NULL);
+
+    } else if (ejsIsBoolean(vp)) {
+        mprPutCharToBuf(buf, ejsGetBoolean(vp) ? CLONE_TRUE : CLONE_FALSE);
+
+    } else if (ejsIsNumber(vp)) {
+        number = ejsGetNumber(vp);
+        mprPutCharToBuf(buf, CLONE_NUMBER);
+        mprPutBlockToBuf(buf, (char*) &number, sizeof(number));
+
+    } else if (ejsIsString(vp)) {
+        mprPutCharToBuf(buf, CLONE_STRING);
+        putCloneString(buf, ((EjsString*) vp)->value, ((EjsString*) vp)->length);
+
+    } else if (ejsIsFunction(vp) || ejsIsType(vp)) {
+        return EJS_ERR;
+
+    } else if (ejsIsDate(vp)) {
+        when = ((EjsDate*) vp)->value;
+        mprPutCharToBuf(buf, CLONE_DATE);
+        mprPutBlockToBuf(buf, (char*) &when, sizeof(when));
+
+    } else if (ejsGetPropertyCount(ejs, vp) == 0 && vp->type != ejs->objectType && !ejsIsArray(vp) &&
+            !ejsIsByteArray(vp)) {
+        /*
+         *  Native values without properties such as Path and Uri are cloned as their string value like serialize()
+         */
+        if ((str = ejsToString(ejs, vp)) == 0) {
+            return EJS_ERR;
+        }
+        mprPutCharToBuf(buf, CLONE_STRING);
+        putCloneString(buf, str->value, str->length);
+
+    } else if (vp->jsonVisited) {
+        mprPutCharToBuf(buf, CLONE_REF);
+        putCloneInt(buf, mprLookupItem(cp->objects, vp));
+
+    } else {
+        vp->jsonVisited = 1;
+        mprAddItem(cp->objects, vp);
+
+        if (ejsIsByteArray(vp)) {
+            ap = (EjsByteArray*) vp;
+            if (isTransferable(cp, ap)) {
+                mprPutCharToBuf(buf, CLONE_TRANSFER);
+                putCloneInt(buf, mprAddItem(cp->transfers, ap));
+                putCloneInt(buf, ap->length);
+            } else {
+                mprPutCharToBuf(buf, CLONE_BYTES);
+                putCloneInt(buf, ap->length);
+                mprPutBlockToBuf(buf, (char*) ap->value, ap->length);
+            }
+            putCloneInt(buf, ap->readPosition);
+            putCloneInt(buf, ap->writePosition);
+
+        } else if (ejsIsArray(vp)) {
+            count = ((EjsArray*) vp)->length;
+            mprPutCharToBuf(buf, CLONE_ARRAY);
+            putCloneInt(buf, count);
+            for (slotNum = 0; slotNum < count; slotNum++) {
+                pp = ((EjsArray*) vp)->data[slotNum];
+                if (cloneValue(ejs, cp, pp) < 0) {
+                    if (ejs->exception) {
+                        return EJS_ERR;
+                    }
+                    /* Elements that can't be cloned become undefined so indexes are preserved */
+                    mprPutCharToBuf(buf, CLONE_UNDEFINED);
+                }
+            }
+
+        } else {
+            /*
+             *  Other objects are cloned as plain objects with the same enumerable properties serialize() would emit.
+             *  The property count is patched once known.
+             */
+            mprPutCharToBuf(buf, CLONE_OBJECT);
+            offset = mprGetBufLength(buf);
+            putCloneInt(buf, 0);
+            numInherited = ejsIsBlock(vp) ? ejsGetNumInheritedTraits((EjsBlock*) vp) : 0;
+            count = 0;
+            for (slotNum = numInherited; slotNum < ejsGetPropertyCount(ejs, vp); slotNum++) {
+                pp = ejsGetProperty(ejs, vp, slotNum);
+                if (pp == 0 || pp->hidden || ejsIsFunction(pp) || ejsIsType(pp)) {
+                    continue;
+                }
+                qname = ejsGetPropertyName(ejs, vp, slotNum);
+                if (qname.name == 0 || qname.name[0] == '\0' || (qname.space && strstr(qname.space, ",private"))) {
+                    continue;
+                }
+                putCloneString(buf, qname.name, (int) strlen(qname.name));
+                if ((rc = cloneValue(ejs, cp, pp)) < 0) {
+                    return rc;
+                }
+                count++;
+            }
+            memcpy(mprGetBufStart(buf) + offset, &count, sizeof(count));
+        }
+    }
+    return 0;
+}
+
+
+/*
+ *  Encode message data. Transferred byte arrays are detached from this interpreter only after the whole value has
+ *  been encoded successfully.
+ */
+static int cloneMessage(Ejs *ejs, Message *msg, EjsVar *data, EjsVar *transfer)
+{
+    Clone           clone;
+    EjsByteArray    *ap;
+    EjsVar          *vp;
+    int             next, rc;
+
+    memset(&clone, 0, sizeof(clone));
+    clone.buf = mprCreateBuf(msg, MPR_BUFSIZE, -1);
+    clone.objects = mprCreateList(msg);
+    clone.transfers = mprCreateList(msg);
+    clone.transfer = ejsIsArray(transfer) ? (EjsArray*) transfer : 0;
+    if (clone.buf == 0 || clone.objects == 0 || clone.transfers == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    rc = cloneValue(ejs, &clone, data);
+
+    for (next = 0; (vp = mprGetNextItem(clone.objects, &next)) != 0; ) {
+        vp->jsonVisited = 0;
+    }
+    mprFree(clone.objects);
+    if (rc < 0) {
+        return rc;
+    }
+    if (mprGetListCount(clone.transfers) > 0) {
+        msg->transfers = mprCreateList(msg);
+        for (next = 0; (ap = mprGetNextItem(clone.transfers, &next)) != 0; ) {
+            mprStealBlock(msg, ap->value);
+            mprAddItem(msg->transfers, ap->value);
+            ap->value = 0;
+            ap->length = ap->readPosition = ap->writePosition = 0;
+        }
+    }
+    mprFree(clone.transfers);
+    msg->clone = clone.buf;
+    return 0;
+}
+
+
+static int getCloneInt(Clone *cp)
+{
+    int     value;
+
+    mprAssert(cp->pos + sizeof(value) <= cp->end);
+    memcpy(&value, cp->pos, sizeof(value));
+    cp->pos += sizeof(value);
+    return value;
+}
+
+
+static cchar *getCloneString(Clone *cp, int *lenp)
+{
+    cchar   *str;
+
+    *lenp = getCloneInt(cp);
+    str = cp->pos;
+    cp->pos += *lenp + 1;
+    mprAssert(cp->pos <= cp->end);
+    return str;
+}
+
+
+/*
+ *  Rebuild a value in the receiving interpreter
+ */
+static EjsVar *uncloneValue(Ejs *ejs, Clone *cp, Message *msg)
+{
+    EjsByteArray    *ap;
+    EjsVar          *vp, *pp;
+    EjsName         qname;
+    MprNumber       number;
+    MprTime         when;
+    cchar           *str;
+    uchar           *bytes;
+    int             i, count, len;
+
+    mprAssert(cp->pos < cp->end);
+
+    switch (*cp->pos++) {
+    case CLONE_UNDEFINED:
+        return ejs->undefinedValue;
+
+    case CLONE_NULL:
+        return ejs->nullValue;
+
+    case CLONE_TRUE:
+        return (EjsVar*) ejs->trueValue;
+
+    case CLONE_FALSE:
+        return (EjsVar*) ejs->falseValue;
+
+    case CLONE_NUMBER:
+        memcpy(&number, cp->pos, sizeof(number));
+        cp->pos += sizeof(number);
+        return (EjsVar*) ejsCreateNumber(ejs, number);
+
+    case CLONE_STRING:
+        str = getCloneString(cp, &len);
+        return (EjsVar*) ejsCreateStringWithLength(ejs, str, len);
+
+    case CLONE_DATE:
+        memcpy(&when, cp->pos, sizeof(when));
+        cp->pos += sizeof(when);
+        return (EjsVar*) ejsCreateDate(ejs, when);
+
+    case CLONE_REF:
+        return (EjsVar*) mprGetItem(cp->objects, getCloneInt(cp));
+
+    case CLONE_BYTES:
+    case CLONE_TRANSFER:
+        if (cp->pos[-1] == CLONE_TRANSFER) {
+            /*
+             *  Adopt the sender's buffer without copying
+             */
+            bytes = (uchar*) mprGetItem(msg->transfers, getCloneInt(cp));
+            if ((ap = (EjsByteArray*) ejsCreateVar(ejs, ejs->byteArrayType, 0)) == 0) {
+                return 0;
+            }
+            mprStealBlock(ap, bytes);
+            ap->value = bytes;
+            ap->length = getCloneInt(cp);
+            ap->growable = 1;
+            ap->growInc = MPR_BUFSIZE;
+            ap->endian = mprGetEndian(ejs);
+        } else {
+            len = getCloneInt(cp);
+            if ((ap = ejsCreateByteArray(ejs, len)) == 0) {
+                return 0;
+            }
+            memcpy(ap->value, cp->pos, len);
+            cp->pos += len;
+        }
+        ap->readPosition = getCloneInt(cp);
+        ap->writePosition = getCloneInt(cp);
+        mprAddItem(cp->objects, ap);
+        return (EjsVar*) ap;
+
+    case CLONE_ARRAY:
+        count = getCloneInt(cp);
+        if ((vp = (EjsVar*) ejsCreateArray(ejs, count)) == 0) {
+            return 0;
+        }
+        mprAddItem(cp->objects, vp);
+        for (i = 0; i < count; i++) {
+            if ((pp = uncloneValue(ejs, cp, msg)) == 0) {
+                return 0;
+            }
+            ejsSetProperty(ejs, vp, i, pp);
+        }
+        return vp;
+
+    case CLONE_OBJECT:
+        count = getCloneInt(cp);
+        if ((vp = (EjsVar*) ejsCreateSimpleObject(ejs)) == 0) {
+            return 0;
+        }
+        mprAddItem(cp->objects, vp);
+        for (i = 0; i < count; i++) {
+            str = getCloneString(cp, &len);
+            ejsName(&qname, EJS_EMPTY_NAMESPACE, ejsInternName(ejs, vp, str));
+            if ((pp = uncloneValue(ejs, cp, msg)) == 0) {
+                return 0;
+            }
+            ejsSetPropertyByName(ejs, vp, &qname, pp);
+        }
+        return vp;
+    }
+    mprAssert(0);
+    return 0;
+}
+
+
+static EjsVar *uncloneMessage(Ejs *ejs, Message *msg)
+{
+    Clone       clone;
+    EjsVar      *result;
+
+    memset(&clone, 0, sizeof(clone));
+    clone.pos = mprGetBufStart(msg->clone);
+    clone.end = clone.pos + mprGetBufLength(msg->clone);
+    clone.objects = mprCreateList(msg);
+    result = uncloneValue(ejs, &clone, msg);
+    mprFree(clone.objects);
+    return result;
+}
+
+
 /*
  *  Process a message sent from postMessage. This may run inside the worker or outside in the parent depending on the
  *  direction of the message. But it ALWAYS runs in the appropriate thread for the interpreter.
@@ -20440,7 +21630,9 @@ static void doMessage(Message *msg, MprEvent *mprEvent)
         mprFree(mprEvent);
         return;
     }
-    if (msg->data) {
+    if (msg->clone) {
+        ejsSetProperty(ejs, event, ES_ejs_events_Event_data, uncloneMessage(ejs, msg));
+    } else if (msg->data) {
         ejsSetProperty(ejs, event, ES_ejs_events_Event_data, (EjsVar*) ejsCreateStringAndFree(ejs, msg->data));
     }
     if (msg->message) {
@@ -20523,11 +21715,10 @@ static EjsVar *workerPreload(Ejs *ejs, EjsWorker *worker, int argc, EjsVar **arg
 /*
  *  Post a message to this worker. Note: the worker is the destination worker which may be the parent.
  *
- *  function postMessage(data: Object, ports: Array = null): Void
+ *  function postMessage(data: Object, transfer: Array = null): Void
  */
 static EjsVar *workerPostMessage(Ejs *ejs, EjsWorker *worker, int argc, EjsVar **argv)
 {
-    EjsVar          *data;
     EjsWorker       *target;
     MprDispatcher   *dispatcher;
     Message         *msg;
@@ -20538,18 +21729,24 @@ static EjsVar *workerPostMessage(Ejs *ejs, EjsWorker *worker, int argc, EjsVar *
     }
 
     /*
-     *  Create the event with serialized data in the originating interpreter. It owns the data.
+     *  Create the event with cloned data in the originating interpreter. The message owns the data and is freed by
+     *  the receiver. Strings are passed as a single buffer that the receiving string adopts.
      */
-    if ((data = ejsSerialize(ejs, argv[0], -1, 0, 0)) == 0) {
-        ejsThrowArgError(ejs, "Can't serialize message data");
-        return 0;
-    }
     if ((msg = mprAllocObjZeroed(ejs, Message)) == 0) {
         ejsThrowMemoryError(ejs);
         return 0;
     }
+    if (ejsIsString(argv[0])) {
+        msg->data = mprMemdup(msg, ((EjsString*) argv[0])->value, ((EjsString*) argv[0])->length + 1);
+
+    } else if (cloneMessage(ejs, msg, argv[0], (argc > 1) ? argv[1] : 0) < 0) {
+        mprFree(msg);
+        if (!ejs->exception) {
+            ejsThrowArgError(ejs, "Can't clone message data");
+        }
+        return 0;
+    }
     target = worker->pair;
-    msg->data = mprStrdup(target->ejs, ejsGetString(data));
     msg->worker = target;
     msg->callback = "onmessage";
     msg->callbackSlot = ES_ejs_sys_Worker_onmessage;
@@ -20562,9 +21759,9 @@ static EjsVar *workerPostMessage(Ejs *ejs, EjsWorker *worker, int argc, EjsVar *
 
 
 /*
- *  Worker thread main procedure
+ *  Run a worker script to completion on the current thread
  */
-static void workerMain(EjsWorker *worker, MprWorker *mprWorker)
+static void runWorker(EjsWorker *worker)
 {
     Ejs             *ejs, *inside;
     EjsWorker       *insideWorker;
@@ -20620,6 +21817,111 @@ static void workerMain(EjsWorker *worker, MprWorker *mprWorker)
 }
 
 
+/*
+ *  Start queued workers on added pool threads while no thread running a worker can make progress. Queued workers are
+ *  otherwise only started by threads finishing a worker. If all of those are blocked waiting, possibly for a queued
+ *  worker, the queue would never drain. The pool shrinks again as worker threads finish. Must be called locked.
+ */
+static void growWorkers(Ejs *ejs)
+{
+    EjsService  *sp;
+    EjsWorker   *worker;
+
+    sp = ejs->service;
+    while (sp->blockedWorkers >= sp->runningWorkers && (worker = mprGetFirstItem(sp->pendingWorkers)) != 0) {
+        mprSetMaxWorkers(ejs, mprGetMaxWorkers(ejs) + 1);
+        if (mprStartWorker(ejs, (MprWorkerProc) workerMain, (void*) worker, MPR_NORMAL_PRIORITY) < 0) {
+            mprSetMaxWorkers(ejs, mprGetMaxWorkers(ejs) - 1);
+            break;
+        }
+        mprRemoveItemAtPos(sp->pendingWorkers, 0);
+        sp->addedWorkers++;
+        sp->runningWorkers++;
+    }
+}
+
+
+/*
+ *  Start a worker on a pool thread. If the MPR worker pool is exhausted, the worker is queued and run by the next
+ *  pool thread to finish a worker.
+ */
+static int scheduleWorker(Ejs *ejs, EjsWorker *worker)
+{
+    EjsService  *sp;
+    int         rc;
+
+    sp = ejs->service;
+    mprLock(sp->mutex);
+    if (mprGetListCount(sp->pendingWorkers) > 0) {
+        /* Preserve start order behind already queued workers */
+        rc = MPR_ERR_BUSY;
+    } else {
+        rc = mprStartWorker(ejs, (MprWorkerProc) workerMain, (void*) worker, MPR_NORMAL_PRIORITY);
+    }
+    if (rc == MPR_ERR_BUSY) {
+        if (mprAddItem(sp->pendingWorkers, worker) < 0) {
+            rc = MPR_ERR_NO_MEMORY;
+        } else {
+            rc = 0;
+            growWorkers(ejs);
+        }
+    } else if (rc == 0) {
+        sp->runningWorkers++;
+    }
+    mprUnlock(sp->mutex);
+    return rc;
+}
+
+
+/*
+ *  Note a worker interpreter entering or leaving a blocking join or waitForMessage
+ */
+static void waitWorker(Ejs *ejs, bool waiting)
+{
+    EjsService  *sp;
+
+    if (!(ejs->flags & EJS_FLAG_WORKER)) {
+        return;
+    }
+    sp = ejs->service;
+    mprLock(sp->mutex);
+    if (waiting) {
+        if (ejs->waiting++ == 0) {
+            sp->blockedWorkers++;
+            growWorkers(ejs);
+        }
+    } else if (--ejs->waiting == 0) {
+        sp->blockedWorkers--;
+    }
+    mprUnlock(sp->mutex);
+}
+
+
+/*
+ *  Worker thread main procedure. Runs queued workers before returning the thread to the pool.
+ */
+static void workerMain(EjsWorker *worker, MprWorker *mprWorker)
+{
+    EjsService  *sp;
+
+    sp = worker->ejs->service;
+    while (worker) {
+        runWorker(worker);
+        mprLock(sp->mutex);
+        if ((worker = mprGetFirstItem(sp->pendingWorkers)) != 0) {
+            mprRemoveItemAtPos(sp->pendingWorkers, 0);
+        } else {
+            sp->runningWorkers--;
+            if (sp->addedWorkers > 0) {
+                sp->addedWorkers--;
+                mprSetMaxWorkers(sp, mprGetMaxWorkers(sp) - 1);
+            }
+        }
+        mprUnlock(sp->mutex);
+    }
+}
+
+
 /*
  *  function terminate()
  */
@@ -20658,12 +21960,15 @@ static EjsVar *workerWaitForMessage(Ejs *ejs, EjsWorker *worker, int argc, EjsVa
         timeout = MAXINT;
     }
     mark = mprGetTime(ejs);
+    waitWorker(ejs, 1);
     do {
         if (mprServiceEvents(ejs->dispatcher, timeout, MPR_SERVICE_EVENTS | MPR_SERVICE_ONE_THING) > 0) {
+            waitWorker(ejs, 0);
             return (EjsVar*) ejs->trueValue;
         }
         remaining = mprGetRemainingTime(ejs, mark, timeout);
     } while (remaining > 0 && !mprIsExiting(ejs) && !ejs->exiting);
+    waitWorker(ejs, 0);
     return (EjsVar*) ejs->falseValue;
 }
 
@@ -23722,17 +25027,36 @@ EjsVar *ejsGetException(Ejs *ejs)
  *  This implements a non-compacting, generational mark and sweep collection algorithm with 
  *  fast pooled object allocations.
  *
+ *  Collections triggered by the work quota are incremental. The mark phase uses a tri-color scheme: unmarked objects
+ *  are white, marked objects waiting on the gray stack are gray and scanned objects are black. Each step scans gray 
+ *  objects until the pause budget is consumed. A write barrier shades values stored while marking and native
+ *  methods rescan their "this" object. When the gray stack empties, the roots are rescanned and the generation swept.
+ *
  *  Copyright (c) All Rights Reserved. See details at the end of the file.
  */
 
 
 
+static void cancelMark(Ejs *ejs);
+static int clearMarks(Ejs *ejs, MprTime deadline);
+static int finishMark(Ejs *ejs);
 static void mark(Ejs *ejs, int generation);
 static void markGlobal(Ejs *ejs, int generation);
+static void markRoots(Ejs *ejs, int generation);
 static inline bool memoryUsageOk(Ejs *ejs);
 static inline void pruneTypePools(Ejs *ejs);
-static void resetMarks(Ejs *ejs);
-static void sweep(Ejs *ejs, int generation);
+static void pushGray(Ejs *ejs, EjsVar *vp);
+static void recordPause(Ejs *ejs, MprTime start);
+static void resetMarks(Ejs *ejs, int generation);
+static int scanGray(Ejs *ejs, MprTime deadline);
+static void startMark(Ejs *ejs, int generation);
+static void startSweep(Ejs *ejs, int maxGeneration);
+static int sweep(Ejs *ejs, MprTime deadline);
+
+/*
+ *  Upper limits in usec for the pause time histogram buckets. The last bucket holds all longer pauses.
+ */
+static int pauseLimits[EJS_GC_PAUSE_BUCKETS] = { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 0 };
 
 #if BLD_DEBUG
 /*
@@ -23780,6 +25104,7 @@ int ejsCreateGCService(Ejs *ejs)
     gc->firstGlobal = ES_global_NUM_CLASS_PROP;
     gc->numPools = EJS_MAX_TYPE;
     gc->allocGeneration = EJS_GEN_ETERNAL;
+    gc->pauseBudget = EJS_GC_PAUSE_BUDGET;
     ejs->workQuota = EJS_GC_WORK_QUOTA;
 
     for (i = 0; i < EJS_MAX_GEN; i++) {
@@ -23902,6 +25227,7 @@ void ejsFreeVar(Ejs *ejs, EjsVar *vp, int id)
     EjsPool     *pool;
     EjsGC       *gc;
     MprBlk      *bp, *pp;
+    int         i;
 
     mprAssert(vp);
     checkAddr(vp);
@@ -23913,6 +25239,25 @@ void ejsFreeVar(Ejs *ejs, EjsVar *vp, int id)
     }
     pool = gc->pools[id];
 
+    if (gc->sweepNext == MPR_GET_BLK(vp)) {
+        gc->sweepNext = gc->sweepNext->next;
+    }
+    if (gc->clearNext == MPR_GET_BLK(vp)) {
+        gc->clearNext = gc->clearNext->next;
+    }
+    if (vp->gray) {
+        /*
+         *  Explicitly freed while waiting to be scanned. Rare, so a linear search is fine.
+         */
+        for (i = 0; i < gc->grayCount; i++) {
+            if (gc->gray[i] == vp) {
+                gc->gray[i] = gc->gray[--gc->grayCount];
+                break;
+            }
+        }
+        vp->gray = 0;
+    }
+
     if (!vp->noPool && !type->dontPool && 0 <= id && id < gc->numPools && pool->count < EJS_MAX_TYPE_POOL) {
         /*
          *  Transfer from the current generation back to the pool. Inline for speed.
@@ -23972,21 +25317,32 @@ void ejsFreeVar(Ejs *ejs, EjsVar *vp, int id)
 void ejsCollectGarbage(Ejs *ejs, int gen)
 {
     EjsGC       *gc;
+    MprTime     start;
     
     gc = &ejs->gc;
     if (!gc->enabled || gc->collecting || !ejs->initialized) {
         return;
     }
     gc->collecting = 1;
+    start = mprGetHiResTime(ejs);
 
+    if (gc->marking || gc->clearing) {
+        /*
+         *  Abandon an incremental collection in progress and do it all now
+         */
+        cancelMark(ejs);
+    }
     mark(ejs, gen);
-    sweep(ejs, gen);
+    startSweep(ejs, gen);
+    sweep(ejs, 0);
     if (!memoryUsageOk(ejs)) {
         pruneTypePools(ejs);
     }
     ejs->workDone = 0;
     ejs->gcRequired = 0;
+    gc->totalCycles++;
     gc->collecting = 0;
+    recordPause(ejs, start);
 #if BLD_DEBUG
     gc->totalSweeps++;
 #if REPORT
@@ -23997,26 +25353,341 @@ void ejsCollectGarbage(Ejs *ejs, int gen)
 }
 
 
+/*
+ *  Do one bounded step of garbage collection. This starts a new incremental collection if none is in progress and 
+ *  then scans gray objects until the pause budget is consumed. When all reachable objects have been scanned, the mark 
+ *  is finished and the generation is swept over following steps. If the pause budget is zero, this does a full 
+ *  collection.
+ *  Returns true if the collection completed.
+ */
+int ejsStepGarbage(Ejs *ejs, int gen)
+{
+    EjsGC       *gc;
+    MprTime     start, deadline;
+    int         done;
+    
+    gc = &ejs->gc;
+    if (gc->pauseBudget <= 0) {
+        ejsCollectGarbage(ejs, gen);
+        return 1;
+    }
+    if (!gc->enabled || gc->collecting || !ejs->initialized) {
+        return 0;
+    }
+    gc->collecting = 1;
+    start = mprGetHiResTime(ejs);
+
+    deadline = start + gc->pauseBudget * 1000;
+    done = 0;
+    if (gc->sweeping) {
+        done = sweep(ejs, deadline);
+    } else {
+        if (!gc->marking && !gc->clearing) {
+            startMark(ejs, gen);
+        }
+        if (gc->clearing && clearMarks(ejs, deadline)) {
+            gc->marking = 1;
+            markRoots(ejs, gc->markGeneration);
+        }
+        if (gc->marking && scanGray(ejs, deadline) && finishMark(ejs)) {
+            startSweep(ejs, gc->markGeneration);
+            done = sweep(ejs, deadline);
+        }
+    }
+    if (done) {
+        if (!memoryUsageOk(ejs)) {
+            pruneTypePools(ejs);
+        }
+        gc->totalCycles++;
+        ejs->workDone = 0;
+#if BLD_DEBUG
+        gc->totalSweeps++;
+#endif
+    } else {
+        /*
+         *  Schedule the next step after a few more allocations so marking keeps ahead of the program
+         */
+        ejs->workDone = max(ejs->workQuota - EJS_GC_STEP_WORK, 0);
+    }
+    ejs->gcRequired = 0;
+    gc->totalSteps++;
+    gc->collecting = 0;
+    recordPause(ejs, start);
+    return done;
+}
+
+
+/*
+ *  Begin an incremental collection. Objects in the generations being swept have had their marks cleared by the last 
+ *  sweep, so only the elder generations need resetting. That is done over following steps by clearMarks before the 
+ *  roots are shaded.
+ */
+static void startMark(Ejs *ejs, int generation)
+{
+    EjsGC       *gc;
+
+    gc = &ejs->gc;
+    gc->collectGeneration = generation;
+    gc->markGeneration = generation;
+    gc->clearing = 1;
+    gc->clearGeneration = generation + 1;
+    gc->clearNext = (gc->clearGeneration < EJS_MAX_GEN) ? mprGetFirstChild(gc->generations[gc->clearGeneration]) : 0;
+}
+
+
+/*
+ *  Clear the marks of the elder generations. Like the sweep, this is bounded by the deadline so the pause does not 
+ *  grow with the size of the elder generations. Objects allocated while clearing are inserted at the head of their 
+ *  generation and are already clear. Return true when all marks are cleared.
+ */
+static int clearMarks(Ejs *ejs, MprTime deadline)
+{
+    EjsGC       *gc;
+    EjsVar      *vp;
+    EjsBlock    *block, *b;
+    MprBlk      *bp;
+    int         count;
+
+    gc = &ejs->gc;
+    for (count = 0; gc->clearGeneration < EJS_MAX_GEN; ) {
+        while ((bp = gc->clearNext) != 0) {
+            gc->clearNext = bp->next;
+            vp = MPR_GET_PTR(bp);
+            vp->marked = 0;
+            if (deadline && (++count % EJS_GC_CHECK_WORK) == 0 && mprGetHiResTime(ejs) >= deadline) {
+                return 0;
+            }
+        }
+        if (++gc->clearGeneration < EJS_MAX_GEN) {
+            gc->clearNext = mprGetFirstChild(gc->generations[gc->clearGeneration]);
+        }
+    }
+    for (block = ejs->state->bp; block; block = block->prev) {
+        block->obj.var.marked = 0;
+        if (block->prevException) {
+            block->prevException->marked = 0;
+        }
+        for (b = block->scopeChain; b; b = b->scopeChain) {
+            b->obj.var.marked = 0;
+        }
+    }
+    gc->clearing = 0;
+    return 1;
+}
+
+
+/*
+ *  Finish an incremental mark. The VM modifies the evaluation stack, frames and blocks without a write barrier and 
+ *  native methods currently executing may be modifying their "this" object. So rescan these with the roots. Returns 
+ *  false if the mark cannot be finished yet.
+ */
+static int finishMark(Ejs *ejs)
+{
+    EjsGC       *gc;
+    EjsBlock    *block, *b;
+    int         i;
+
+    gc = &ejs->gc;
+    if (gc->nativeDepth > EJS_GC_MAX_NATIVES) {
+        return 0;
+    }
+    for (i = 0; i < gc->nativeDepth; i++) {
+        ejsGrayVar(ejs, gc->natives[i]);
+    }
+    for (block = ejs->state->bp; block; block = block->prev) {
+        ejsGrayVar(ejs, (EjsVar*) block);
+        for (b = block->scopeChain; b; b = b->scopeChain) {
+            ejsGrayVar(ejs, (EjsVar*) b);
+        }
+    }
+    markRoots(ejs, gc->markGeneration);
+    scanGray(ejs, 0);
+    gc->marking = 0;
+    return 1;
+}
+
+
+/*
+ *  Abandon an incremental mark and clear all marks
+ */
+static void cancelMark(Ejs *ejs)
+{
+    EjsGC       *gc;
+    int         i;
+
+    gc = &ejs->gc;
+    for (i = 0; i < gc->grayCount; i++) {
+        gc->gray[i]->gray = 0;
+    }
+    gc->grayCount = 0;
+    gc->marking = 0;
+    gc->clearing = 0;
+    gc->clearNext = 0;
+    resetMarks(ejs, 0);
+}
+
+
+/*
+ *  Scan gray objects and blacken them. Return true if all gray objects have been scanned. If deadline is non-zero,
+ *  return when the deadline (in usec) has passed.
+ */
+static int scanGray(Ejs *ejs, MprTime deadline)
+{
+    EjsGC       *gc;
+    EjsVar      *vp;
+    int         count;
+
+    gc = &ejs->gc;
+    for (count = 0; gc->grayCount > 0; ) {
+        vp = gc->gray[--gc->grayCount];
+        vp->gray = 0;
+        (vp->type->helpers->markVar)(ejs, NULL, vp);
+        if (deadline && (++count % EJS_GC_CHECK_WORK) == 0 && mprGetHiResTime(ejs) >= deadline) {
+            break;
+        }
+    }
+    return gc->grayCount == 0;
+}
+
+
+/*
+ *  Push a marked object onto the gray stack. If the stack cannot grow, scan the object immediately.
+ */
+static void pushGray(Ejs *ejs, EjsVar *vp)
+{
+    EjsGC       *gc;
+    EjsVar      **gray;
+    int         size;
+
+    gc = &ejs->gc;
+    if (vp->gray) {
+        return;
+    }
+    if (gc->grayCount >= gc->graySize) {
+        size = max(gc->graySize * 2, EJS_GC_STEP_WORK * 4);
+        if ((gray = (EjsVar**) mprRealloc(ejs, gc->gray, size * sizeof(EjsVar*))) == 0) {
+            (vp->type->helpers->markVar)(ejs, NULL, vp);
+            return;
+        }
+        gc->gray = gray;
+        gc->graySize = size;
+    }
+    vp->gray = 1;
+    gc->gray[gc->grayCount++] = vp;
+}
+
+
+/*
+ *  Queue an object to be scanned again. This is used for objects that have been modified without a write barrier.
+ *  The global object is always rescanned by markGlobal when the mark is finished.
+ */
+void ejsGrayVar(Ejs *ejs, EjsVar *vp)
+{
+    if (vp && ejs->gc.marking && !vp->gray && vp != ejs->global) {
+        vp->marked = 1;
+        pushGray(ejs, vp);
+    }
+}
+
+
+/*
+ *  Record a GC pause in the pause time histogram
+ */
+static void recordPause(Ejs *ejs, MprTime start)
+{
+    EjsGC       *gc;
+    MprTime     elapsed;
+    int         i;
+
+    gc = &ejs->gc;
+    elapsed = mprGetHiResTime(ejs) - start;
+    for (i = 0; i < EJS_GC_PAUSE_BUCKETS - 1 && elapsed >= pauseLimits[i]; i++) {
+        ;
+    }
+    gc->pauses[i]++;
+    gc->totalPause += elapsed;
+    if (elapsed > gc->maxPause) {
+        gc->maxPause = elapsed;
+    }
+}
+
+
+/*
+ *  Return the upper limits in usec of the pause histogram buckets. The last bucket has no upper limit and is zero.
+ */
+int *ejsGetGCPauseLimits(Ejs *ejs)
+{
+    return pauseLimits;
+}
+
+
+/*
+ *  Clear the pause time statistics. Collection and step totals are retained.
+ */
+void ejsResetGCPauses(Ejs *ejs)
+{
+    EjsGC       *gc;
+
+    gc = &ejs->gc;
+    memset(gc->pauses, 0, sizeof(gc->pauses));
+    gc->totalPause = 0;
+    gc->maxPause = 0;
+}
+
+
+/*
+ *  Set the max time in msec for an incremental GC step. Set to zero to make all collections stop the world.
+ *  Returns the prior budget.
+ */
+int ejsSetGCPauseBudget(Ejs *ejs, int msec)
+{
+    EjsGC       *gc;
+    int         old;
+
+    gc = &ejs->gc;
+    old = gc->pauseBudget;
+    gc->pauseBudget = max(msec, 0);
+    if (gc->pauseBudget == 0 && (gc->marking || gc->clearing) && !gc->collecting) {
+        cancelMark(ejs);
+    }
+    return old;
+}
+
+
 /*
  *  Mark phase. Mark objects that are still in use and should not be collected.
  */
 static void mark(Ejs *ejs, int generation)
 {
-    EjsModule       *mp;
     EjsGC           *gc;
-    EjsBlock        *block;
-    EjsVar          *vp, **sp, **top;
-    int             next;
 
     gc = &ejs->gc;
     gc->collectGeneration = generation;
 
-    resetMarks(ejs);
+    resetMarks(ejs, 0);
+    markRoots(ejs, generation);
+}
+
+
+/*
+ *  Mark the roots. When doing an incremental mark, this shades the roots and pushes them onto the gray stack.
+ */
+static void markRoots(Ejs *ejs, int generation)
+{
+    EjsModule       *mp;
+    EjsBlock        *block;
+    EjsSavedBlock   *saved;
+    EjsVar          *vp, **sp, **top;
+    int             next, i;
+
     markGlobal(ejs, generation);
 
     if (ejs->result) {
         ejsMarkVar(ejs, NULL, ejs->result);
     }
+    if (ejs->appendString) {
+        ejsMarkVar(ejs, NULL, (EjsVar*) ejs->appendString);
+    }
     if (ejs->exception) {
         ejsMarkVar(ejs, NULL, ejs->exception);
     }
@@ -24026,8 +25697,18 @@ static void mark(Ejs *ejs, int generation)
     if (ejs->memoryCallback) {
         ejsMarkVar(ejs, NULL, (EjsVar*) ejs->memoryCallback);
     }
-    if (ejs->sessions) {
-        ejsMarkVar(ejs, NULL, (EjsVar*) ejs->sessions);
+    for (next = 0; next < ejs->globalStateCount; next++) {
+        if ((vp = ejs->globalState[next]) != 0) {
+            ejsMarkVar(ejs, NULL, vp);
+        }
+    }
+    for (next = 0; next < ejs->savedBlockCount; next++) {
+        saved = &ejs->savedBlocks[next];
+        for (i = 0; i < saved->numProp; i++) {
+            if ((vp = saved->slots[i]) != 0) {
+                ejsMarkVar(ejs, NULL, vp);
+            }
+        }
     }
 
     /*
@@ -24059,47 +25740,79 @@ static void mark(Ejs *ejs, int generation)
 
 
 /*
- *  Sweep up the garbage for a given generation
+ *  Prepare to sweep the garbage for a given generation and all younger generations
+ */
+static void startSweep(Ejs *ejs, int maxGeneration)
+{
+    EjsGC       *gc;
+
+    gc = &ejs->gc;
+    gc->sweeping = 1;
+    gc->sweepGeneration = maxGeneration;
+    gc->sweepNext = mprGetFirstChild(gc->generations[maxGeneration]);
+}
+
+
+/*
+ *  Sweep up the garbage. Objects allocated since the mark completed are inserted at the head of the generation and
+ *  are not visited. If deadline is non-zero, return when the deadline (in usec) has passed. Return true when the 
+ *  sweep is complete.
  */
-static void sweep(Ejs *ejs, int maxGeneration)
+static int sweep(Ejs *ejs, MprTime deadline)
 {
     EjsVar      *vp;
     EjsGC       *gc;
     EjsGen      *gen;
-    MprBlk      *bp, *next;
-    int         destroyed, generation;
+    MprBlk      *bp;
+    int         count, destroyed;
     
     /*
      *  Go from oldest to youngest incase moving objects to elder generations and we clear the mark.
      */
     gc = &ejs->gc;
-    for (generation = maxGeneration; generation >= 0; generation--) {
-        gc->collectGeneration = generation;
-        gen = gc->generations[generation];
+    for (count = 0; gc->sweepGeneration >= 0; ) {
+        gc->collectGeneration = gc->sweepGeneration;
+        gen = gc->generations[gc->sweepGeneration];
 
-        for (destroyed = 0, bp = mprGetFirstChild(gen); bp; bp = next) {
-            next = bp->next;
+        for (destroyed = 0; (bp = gc->sweepNext) != 0; ) {
+            gc->sweepNext = bp->next;
             vp = MPR_GET_PTR(bp);
             checkAddr(vp);
             if (!vp->marked && !vp->permanent) {
                 (vp->type->helpers->destroyVar)(ejs, vp);
                 destroyed++;
+            } else {
+                /* Survivors start the next incremental collection white */
+                vp->marked = 0;
+            }
+            if (deadline && (++count % EJS_GC_CHECK_WORK) == 0 && mprGetHiResTime(ejs) >= deadline) {
+                break;
             }
         }
 #if BLD_DEBUG
         gc->allocatedObjects -= destroyed;
         gc->totalReclaimed += destroyed;
         gen->totalReclaimed += destroyed;
+#endif
+        if (gc->sweepNext) {
+            return 0;
+        }
+#if BLD_DEBUG
         gen->totalSweeps++;
 #endif
+        if (--gc->sweepGeneration >= 0) {
+            gc->sweepNext = mprGetFirstChild(gc->generations[gc->sweepGeneration]);
+        }
     }
+    gc->sweeping = 0;
+    return 1;
 }
 
 
 /*
-    Reset all marks prior to doing a mark/sweep
+    Reset all marks prior to doing a mark/sweep. Only generations from the given generation and elder are reset.
  */
-static void resetMarks(Ejs *ejs)
+static void resetMarks(Ejs *ejs, int generation)
 {
     EjsGen      *gen;
     EjsGC       *gc;
@@ -24109,7 +25822,7 @@ static void resetMarks(Ejs *ejs)
     int         i;
 
     gc = &ejs->gc;
-    for (i = 0; i < EJS_MAX_GEN; i++) {
+    for (i = generation; i < EJS_MAX_GEN; i++) {
         gen = gc->generations[i];
         for (bp = mprGetFirstChild(gen); bp; bp = bp->next) {
             vp = MPR_GET_PTR(bp);
@@ -24157,6 +25870,13 @@ static void markGlobal(Ejs *ejs, int generation)
         for (i = gc->firstGlobal; i < obj->numProp; i++) {
             ejsMarkVar(ejs, NULL, obj->slots[i]);
         }
+        /*
+         *  Worker interpreters store the inside worker in a core slot after the core is loaded. It is permanent, but
+         *  its properties are young and must be marked.
+         */
+        if (ES_ejs_sys_worker_self < obj->numProp) {
+            ejsMarkVar(ejs, NULL, obj->slots[ES_ejs_sys_worker_self]);
+        }
     }
     block = ejs->globalBlock;
     if (block->prevException) {
@@ -24171,7 +25891,8 @@ static void markGlobal(Ejs *ejs, int generation)
 
 
 /*
- *  Mark a variable as used. All variable marking comes through here.
+ *  Mark a variable as used. All variable marking comes through here. During an incremental mark, the variable is
+ *  pushed onto the gray stack to be scanned by a later step rather than being scanned recursively.
  *  NOTE: The container is not used by anyone (verified).
  */
 void ejsMarkVar(Ejs *ejs, EjsVar *container, EjsVar *vp)
@@ -24179,7 +25900,11 @@ void ejsMarkVar(Ejs *ejs, EjsVar *container, EjsVar *vp)
     if (vp && !vp->marked) {
         checkAddr(vp);
         vp->marked = 1;
-        (vp->type->helpers->markVar)(ejs, container, vp);
+        if (ejs->gc.marking) {
+            pushGray(ejs, vp);
+        } else {
+            (vp->type->helpers->markVar)(ejs, container, vp);
+        }
     }
 }
 
@@ -24270,14 +25995,24 @@ void ejsMakeTransient(Ejs *ejs, EjsVar *vp)
 
 
 /*
- *  Return true if there is time to do a garbage collection and if we will benefit from it.
- *  Currently not used.
+ *  Return true if there is time to do a garbage collection step and if we will benefit from it. This is used to run 
+ *  GC steps when the dispatcher is idle.
  */
 int ejsIsTimeForGC(Ejs *ejs, int timeTillNextEvent)
 {
     EjsGC       *gc;
 
-    if (timeTillNextEvent < EJS_MIN_TIME_FOR_GC) {
+    gc = &ejs->gc;
+    if (!gc->enabled || gc->collecting || !ejs->initialized) {
+        return 0;
+    }
+    if (gc->clearing || gc->marking || gc->sweeping) {
+        /*
+         *  Continue an incremental collection if a step can complete before the next event
+         */
+        return timeTillNextEvent > gc->pauseBudget;
+    }
+    if (timeTillNextEvent < ((gc->pauseBudget > 0) ? gc->pauseBudget : EJS_MIN_TIME_FOR_GC)) {
         /*
          *  This is a heuristic where we want a good amount of idle time so that a proactive garbage collection won't 
          *  delay any I/O events.
@@ -24289,8 +26024,7 @@ int ejsIsTimeForGC(Ejs *ejs, int timeTillNextEvent)
      *  Return if we haven't done enough work to warrant a collection. Trigger a little short of the work quota to try 
      *  to run GC before a demand allocation requires it.
      */
-    gc = &ejs->gc;
-    if (!gc->enabled || ejs->workDone < (ejs->workQuota - EJS_GC_SHORT_WORK_QUOTA)) {
+    if (ejs->workDone < (ejs->workQuota - EJS_GC_SHORT_WORK_QUOTA)) {
         return 0;
     }
     mprLog(ejs, 7, "Time for GC. Work done %d, time till next event %d", ejs->workDone, timeTillNextEvent);
@@ -24431,6 +26165,37 @@ void ejsPrintAllocReport(Ejs *ejs)
     mprLog(ejs, 0, "  Total redlines         %,14d", gc->totalRedlines);
     mprLog(ejs, 0, "  Object GC work quota   %,14d", ejs->workQuota);
 #endif
+    ejsPrintPauseReport(ejs);
+}
+
+
+/*
+ *  Report GC pause times. This is available in all builds.
+ */
+void ejsPrintPauseReport(Ejs *ejs)
+{
+    EjsGC       *gc;
+    uint        count;
+    int         i;
+
+    gc = &ejs->gc;
+    for (count = 0, i = 0; i < EJS_GC_PAUSE_BUCKETS; i++) {
+        count += gc->pauses[i];
+    }
+    mprLog(ejs, 0, "\nEJS Garbage Collector Pauses");
+    mprLog(ejs, 0, "  Pause budget (msec)    %,14d", gc->pauseBudget);
+    mprLog(ejs, 0, "  Collections            %,14d", gc->totalCycles);
+    mprLog(ejs, 0, "  Incremental steps      %,14d", gc->totalSteps);
+    mprLog(ejs, 0, "  Pauses                 %,14d", count);
+    mprLog(ejs, 0, "  Max pause (usec)       %14Ld", gc->maxPause);
+    mprLog(ejs, 0, "  Avg pause (usec)       %14Ld", (count > 0) ? (gc->totalPause / count) : 0);
+    for (i = 0; i < EJS_GC_PAUSE_BUCKETS; i++) {
+        if (pauseLimits[i]) {
+            mprLog(ejs, 0, "  < %,7d usec          %,14d", pauseLimits[i], gc->pauses[i]);
+        } else {
+            mprLog(ejs, 0, "  >= %,6d usec          %,14d", pauseLimits[i - 1], gc->pauses[i]);
+        }
+    }
 }
 
 /*
@@ -24503,10 +26268,21 @@ void ejsPrintAllocReport(Ejs *ejs)
 #define top                     (*state.stack)
 #define pop(ejs)                (*state.stack--)
 
-#define push(value)             (*(++(state.stack))) = ((EjsVar*) (value))
+#define push(value)             (*(++(state.stack))) = countLoad(ejs, (EjsVar*) (value))
 #define popString(ejs)          ((EjsString*) pop(ejs))
 #define popOutside(ejs)         *(ejs->state->stack)--
-#define pushOutside(ejs, value) (*(++(ejs->state->stack))) = ((EjsVar*) (value))
+#define pushOutside(ejs, value) (*(++(ejs->state->stack))) = countLoad(ejs, (EjsVar*) (value))
+
+/*
+ *  Count pushes of the string being built by "local += string". Every reference to it outside its local is made via
+ *  the stack, so appendString can tell when it is safe to extend in place.
+ */
+static MPR_INLINE EjsVar *countLoad(Ejs *ejs, EjsVar *vp) {
+    if (unlikely(vp == (EjsVar*) ejs->appendString)) {
+        ejs->appendLoads++;
+    }
+    return vp;
+}
 
 #define FRAME                   state.fp
 #define FUNCTION                state.fp.function
@@ -24601,22 +26377,27 @@ static void callProperty(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc,
 static void callConstructor(Ejs *ejs, EjsFunction *vp, int argc, int stackAdjust);
 static void callInterfaceInitializers(Ejs *ejs, EjsType *type);
 static void callFunction(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackAdjust);
+static MPR_INLINE EjsVar *callNative(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, EjsVar **argv);
+static EjsVar *appendString(Ejs *ejs, EjsString *lhs, EjsVar *rhs, bool stored);
 static EjsVar *evalBinaryExpr(Ejs *ejs, EjsVar *lhs, EjsOpCode opcode, EjsVar *rhs);
 static EjsVar *evalUnaryExpr(Ejs *ejs, EjsVar *lhs, EjsOpCode opcode);
 static inline uint findEndException(Ejs *ejs);
 static inline EjsEx *findExceptionHandler(Ejs *ejs, int kind);
+static void fillInlineCache(Ejs *ejs, uchar *site, EjsVar *vp, EjsName *qname, EjsLookup *lookup);
+static int getLocalStoreSlot(uchar *pc);
 static EjsName getNameArg(EjsFrame *fp);
 static EjsVar *getNthBase(Ejs *ejs, EjsVar *obj, int nthBase);
 static EjsVar *getNthBaseFromBottom(Ejs *ejs, EjsVar *obj, int nthBase);
 static MPR_INLINE EjsVar *getNthBlock(Ejs *ejs, int nth);
 static char *getStringArg(EjsFrame *fp);
 static EjsVar *getGlobalArg(Ejs *ejs, EjsFrame *fp);
+static MPR_INLINE EjsVar *lookupInlineCache(Ejs *ejs, uchar *site, EjsVar *vp, EjsName *qname, int *slotNum);
 static bool manageExceptions(Ejs *ejs);
 static void checkExceptionHandlers(Ejs *ejs);
 static void handleGetters(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj);
 static EjsBlock *popExceptionBlock(Ejs *ejs);
 static void createExceptionBlock(Ejs *ejs, EjsEx *ex, int flags);
-static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *name, bool dup);
+static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *name, bool dup, uchar *site);
 static MPR_INLINE int storePropertyToSlot(Ejs *ejs, EjsObject *obj, int slotNum, EjsVar *value, EjsVar *thisObj);
 static void storePropertyToScope(Ejs *ejs, EjsName *qname, bool dup);
 static void throwNull(Ejs *ejs);
@@ -24644,7 +26425,7 @@ static void VM(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, int stackA
     EjsEx           *ex;
     EjsFrame        *newFrame;
     char            *str;
-    uchar           *mark;
+    uchar           *mark, *site;
     int             i, offset, count, opcode;
 
 #if BLD_UNIX_LIKE || (VXWORKS && !BLD_CC_DIAB)
@@ -25419,13 +27200,21 @@ static void *opcodeJump[] = {
 #if DYNAMIC_BINDING
             mark = FRAME->pc - 1;
 #endif
+            site = FRAME->pc;
             qname = GET_NAME();
             vp = pop(ejs);
             if (vp == 0 || vp == ejs->nullValue || vp == ejs->undefinedValue) {
                 ejsThrowReferenceError(ejs, "Object reference is null");
                 CHECK; BREAK;
             }
-            v1 = ejsGetVarByName(ejs, vp, &qname, &lookup);
+            if ((lookup.obj = lookupInlineCache(ejs, site, vp, &qname, &lookup.slotNum)) != 0) {
+                v1 = ejsGetProperty(ejs, lookup.obj, lookup.slotNum);
+            } else {
+                v1 = ejsGetVarByName(ejs, vp, &qname, &lookup);
+                if (v1) {
+                    fillInlineCache(ejs, site, vp, &qname, &lookup);
+                }
+            }
             push(v1 ? v1 : ejs->undefinedValue);
 #if DYNAMIC_BINDING
             if (lookup.slotNum < 0 || lookup.slotNum > 4096 || ejs->flags & EJS_FLAG_COMPILER) {
@@ -25655,9 +27444,15 @@ static void *opcodeJump[] = {
          *      Stack after         []
          */
         CASE (EJS_OP_PUT_OBJ_NAME):
+            site = FRAME->pc;
             qname = GET_NAME();
             vp = pop(ejs);
-            storeProperty(ejs, vp, &qname, 0);
+            if ((v1 = lookupInlineCache(ejs, site, vp, &qname, &slotNum)) != 0 && !v1->hasGetterSetter) {
+                ejs->result = v2 = pop(ejs);
+                ejsSetProperty(ejs, v1, slotNum, v2);
+            } else {
+                storeProperty(ejs, vp, &qname, 0, site);
+            }
             CHECK; BREAK;
 
         /*
@@ -25683,7 +27478,7 @@ static void *opcodeJump[] = {
                     qname.space = ejsToString(ejs, v2)->value;
                 }
                 if (qname.name && qname.space) {
-                    storeProperty(ejs, vp, &qname, 1);
+                    storeProperty(ejs, vp, &qname, 1, NULL);
                 }
             }
             CHECK; BREAK;
@@ -25866,6 +27661,7 @@ static void *opcodeJump[] = {
          *      Stack after         []
          */
         CASE (EJS_OP_CALL_OBJ_NAME):
+            site = FRAME->pc;
             qname = GET_NAME();
             argc = GET_INT();
             vp = state.stack[-argc];
@@ -25874,7 +27670,10 @@ static void *opcodeJump[] = {
                 throwNull(ejs);
                 CHECK; BREAK;
             }
-            slotNum = ejsLookupVar(ejs, (EjsVar*) vp, &qname, &lookup);
+            if ((lookup.obj = lookupInlineCache(ejs, site, vp, &qname, &slotNum)) == 0) {
+                slotNum = ejsLookupVar(ejs, (EjsVar*) vp, &qname, &lookup);
+                fillInlineCache(ejs, site, vp, &qname, &lookup);
+            }
             if (slotNum < 0) {
                 ejsThrowReferenceError(ejs, "Can't find function \"%s\"", qname.name);
             } else {
@@ -26601,6 +28400,16 @@ static void *opcodeJump[] = {
          *      Stack after         [boolean]
          */
         CASE (EJS_OP_ADD):
+            if (state.stack[-1] && state.stack[-1]->type == ejs->stringType && 
+                    (slotNum = getLocalStoreSlot(FRAME->pc)) >= 0) {
+                v2 = pop(ejs);
+                v1 = pop(ejs);
+                ejs->result = appendString(ejs, (EjsString*) v1, v2, GET_SLOT(FRAME, slotNum) == v1);
+                push(ejs->result);
+                CHECK; BREAK;
+            }
+            goto binaryExpression;
+
         CASE (EJS_OP_SUB):
         CASE (EJS_OP_MUL):
         CASE (EJS_OP_DIV):
@@ -26731,8 +28540,7 @@ static void *opcodeJump[] = {
                              vp->hasGetterSetter = 1;
                         }
                     }
-                    ejsName(&qname, mprStrdup(vp, spaceVar->value), mprStrdup(vp, nameVar->value));
-                    vp->noPool = 1;
+                    ejsName(&qname, ejsInternName(ejs, vp, spaceVar->value), ejsInternName(ejs, vp, nameVar->value));
                     ejsSetPropertyByName(ejs, vp, &qname, v1);
                 }
             }
@@ -26917,6 +28725,7 @@ static MPR_INLINE int storePropertyToSlot(Ejs *ejs, EjsObject *obj, int slotNum,
         return 1;
     }
     if (ejsIsObject(obj) && slotNum < obj->numProp) {
+        ejsWriteBarrier(ejs, value);
         obj->slots[slotNum] = value;
     } else {
         ejsSetProperty(ejs, (EjsVar*) obj, slotNum, (EjsVar*) value);
@@ -26931,7 +28740,7 @@ static MPR_INLINE int storePropertyToSlot(Ejs *ejs, EjsObject *obj, int slotNum,
 /*
  *  Store a property by name in the given object. Will create if the property does not already exist.
  */
-static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *qname, bool dup)
+static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *qname, bool dup, uchar *site)
 {
     EjsFunction     *fun;
     EjsLookup       lookup;
@@ -26960,6 +28769,9 @@ static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *qname, bool dup)
 
     slotNum = ejsLookupVar(ejs, obj, qname, &lookup);
     if (slotNum >= 0) {
+        if (site) {
+            fillInlineCache(ejs, site, obj, qname, &lookup);
+        }
         obj = lookup.obj;
         /*
          *  Handle setters. Setters, if present, are chained off the getter.
@@ -26982,9 +28794,8 @@ static void storeProperty(Ejs *ejs, EjsVar *obj, EjsName *qname, bool dup)
         slotNum = ejsSetProperty(ejs, obj, slotNum, value);
         if (slotNum >= 0) {
             if (dup) {
-                qname->name = mprStrdup(obj, qname->name);
-                qname->space = mprStrdup(obj, qname->space);
-                obj->noPool = 1;
+                qname->name = ejsInternName(ejs, obj, qname->name);
+                qname->space = ejsInternName(ejs, obj, qname->space);
             }
             ejsSetPropertyName(ejs, obj, slotNum, qname);
         }
@@ -27028,15 +28839,143 @@ static void storePropertyToScope(Ejs *ejs, EjsName *qname, bool dup)
     slotNum = ejsSetProperty(ejs, obj, slotNum, value);
     if (slotNum >= 0) {
         if (dup) {
-            qname->name = mprStrdup(obj, qname->name);
-            qname->space = mprStrdup(obj, qname->space);
-            obj->noPool = 1;
+            qname->name = ejsInternName(ejs, obj, qname->name);
+            qname->space = ejsInternName(ejs, obj, qname->space);
         }
         ejsSetPropertyName(ejs, obj, slotNum, qname);
     }
 }
 
 
+#define INLINE_CACHE_INDEX(site) ((((size_t) (site)) ^ (((size_t) (site)) >> 9)) & (EJS_INLINE_CACHE_SITES - 1))
+
+/*
+ *  Find a cached property for a named property access site. Returns the object owning the property and sets *slotNum.
+ *  Returns null if the site has not resolved the property for this type of object or the entry is stale.
+ */
+static MPR_INLINE EjsVar *lookupInlineCache(Ejs *ejs, uchar *site, EjsVar *vp, EjsName *qname, int *slotNum)
+{
+    EjsInlineCacheSite  *sp;
+    EjsInlineCacheEntry *ep;
+    EjsObject           *obj, *owner;
+    EjsBlock            *instanceBlock;
+    EjsName             *pname;
+    int                 i, slot;
+
+    if (ejs->inlineCache == 0) {
+        return 0;
+    }
+    sp = &ejs->inlineCache[INLINE_CACHE_INDEX(site)];
+    if (sp->pc != site || sp->name != qname->name) {
+        return 0;
+    }
+    obj = (EjsObject*) vp;
+    for (i = 0; i < EJS_INLINE_CACHE_WAYS; i++) {
+        ep = &sp->entries[i];
+        if (ep->type != vp->type || ep->version != ejs->service->typeVersion) {
+            continue;
+        }
+        if (ep->exact) {
+            /*
+             *  Own property with the exact name. The object may be dynamic, so the name is verified below.
+             */
+            owner = obj;
+        } else {
+            /*
+             *  The object must still use its type's instance property names so its layout is fixed by the type
+             */
+            instanceBlock = vp->type->instanceBlock;
+            if (instanceBlock == 0 || obj->names != instanceBlock->obj.names) {
+                continue;
+            }
+            owner = (ep->owner) ? (EjsObject*) ep->owner : obj;
+        }
+        slot = ep->slotNum;
+        if (slot >= owner->numProp || owner->names == 0 || slot >= owner->names->sizeEntries) {
+            continue;
+        }
+        pname = &owner->names->entries[slot].qname;
+        if (pname->name != qname->name && (pname->name == 0 || strcmp(pname->name, qname->name) != 0)) {
+            continue;
+        }
+        if (ep->exact && pname->space != qname->space && strcmp(pname->space, qname->space) != 0) {
+            continue;
+        }
+        *slotNum = slot;
+        return (EjsVar*) owner;
+    }
+    return 0;
+}
+
+
+/*
+ *  Record a resolved named property access in the inline cache for the site. Only objects using the standard object 
+ *  property lookup are cached. Properties found on a base type are only cached for objects whose layout is fixed by 
+ *  their type, as otherwise the object could later define a property of the same name.
+ */
+static void fillInlineCache(Ejs *ejs, uchar *site, EjsVar *vp, EjsName *qname, EjsLookup *lookup)
+{
+    EjsInlineCacheSite  *sp;
+    EjsInlineCacheEntry *ep;
+    EjsType             *type;
+    EjsVar              *owner;
+    int                 i, exact, sealed;
+
+    type = vp->type;
+    if (lookup->slotNum < 0 || !ejsIsObject(vp) || (ejs->flags & (EJS_FLAG_COMPILER | EJS_FLAG_NO_INLINE_CACHE))) {
+        return;
+    }
+    if (type->helpers->lookupProperty != ejs->objectHelpers->lookupProperty || type->helpers->getPropertyByName || 
+            type->helpers->setPropertyByName) {
+        return;
+    }
+    sealed = type->instanceBlock && ((EjsObject*) vp)->names == type->instanceBlock->obj.names;
+    exact = 0;
+    if (lookup->obj == vp) {
+        owner = 0;
+        exact = (lookup->name.name == qname->name || strcmp(lookup->name.name, qname->name) == 0) &&
+            (lookup->name.space == qname->space || strcmp(lookup->name.space, qname->space) == 0);
+        if (!exact && !sealed) {
+            return;
+        }
+    } else if (sealed && ejsIsType(lookup->obj)) {
+        owner = lookup->obj;
+    } else {
+        return;
+    }
+    if (ejs->inlineCache == 0) {
+        ejs->inlineCache = (EjsInlineCacheSite*) mprAllocZeroed(ejs, sizeof(EjsInlineCacheSite) * EJS_INLINE_CACHE_SITES);
+        if (ejs->inlineCache == 0) {
+            return;
+        }
+    }
+    sp = &ejs->inlineCache[INLINE_CACHE_INDEX(site)];
+    if (sp->pc != site || sp->name != qname->name) {
+        memset(sp, 0, sizeof(EjsInlineCacheSite));
+        sp->pc = site;
+        sp->name = qname->name;
+    }
+    /*
+     *  Prefer replacing stale entries, otherwise replace entries in turn
+     */
+    for (i = 0; i < EJS_INLINE_CACHE_WAYS; i++) {
+        if (sp->entries[i].version != ejs->service->typeVersion || sp->entries[i].type == 0) {
+            break;
+        }
+    }
+    if (i == EJS_INLINE_CACHE_WAYS) {
+        i = sp->next;
+        sp->next = (sp->next + 1) % EJS_INLINE_CACHE_WAYS;
+    }
+    ep = &sp->entries[i];
+    ep->type = type;
+    ep->owner = owner;
+    ep->slotNum = lookup->slotNum;
+    ep->version = ejs->service->typeVersion;
+    ep->exact = exact;
+}
+
+
 /*
  *  Attend to unusual circumstances. Memory allocation errors, exceptions and forced exits.
  */
@@ -27045,7 +28984,7 @@ static bool payAttention(Ejs *ejs)
     ejs->attention = 0;
 
     if (ejs->gcRequired) {
-        ejsCollectGarbage(ejs, EJS_GEN_NEW);
+        ejsStepGarbage(ejs, EJS_GEN_NEW);
     }
     if (mprHasAllocError(ejs)) {
         mprResetAllocError(ejs);
@@ -27145,7 +29084,7 @@ EjsVar *ejsRunFunction(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, Ej
             ejsThrowArgError(ejs, "Native function is not defined");
             return 0;
         }
-        ejs->result = (fun->body.proc)(ejs, thisObj, argc, argv);
+        ejs->result = callNative(ejs, fun, thisObj, argc, argv);
         if (ejs->result == 0) {
             ejs->result = ejs->nullValue;
         }
@@ -27735,6 +29674,46 @@ static int lookupOverloadedOperator(Ejs *ejs, EjsOpCode opcode, EjsVar *lhs)
 }
 
 
+/*
+ *  Fast path for the common arithmetic and comparison operators when both operands are numbers. This avoids
+ *  dispatching via the type helpers. Return zero for other operators.
+ */
+static MPR_INLINE EjsVar *evalNumberExpr(Ejs *ejs, EjsNumber *lhs, EjsOpCode opcode, EjsNumber *rhs)
+{
+    switch (opcode) {
+    case EJS_OP_ADD:
+        return (EjsVar*) ejsCreateNumber(ejs, lhs->value + rhs->value);
+
+    case EJS_OP_SUB:
+        return (EjsVar*) ejsCreateNumber(ejs, lhs->value - rhs->value);
+
+    case EJS_OP_MUL:
+        return (EjsVar*) ejsCreateNumber(ejs, lhs->value * rhs->value);
+
+    case EJS_OP_COMPARE_EQ: case EJS_OP_COMPARE_STRICTLY_EQ:
+        return (EjsVar*) ((lhs->value == rhs->value) ? ejs->trueValue: ejs->falseValue);
+
+    case EJS_OP_COMPARE_NE: case EJS_OP_COMPARE_STRICTLY_NE:
+        return (EjsVar*) ((lhs->value != rhs->value) ? ejs->trueValue: ejs->falseValue);
+
+    case EJS_OP_COMPARE_LT:
+        return (EjsVar*) ((lhs->value < rhs->value) ? ejs->trueValue: ejs->falseValue);
+
+    case EJS_OP_COMPARE_LE:
+        return (EjsVar*) ((lhs->value <= rhs->value) ? ejs->trueValue: ejs->falseValue);
+
+    case EJS_OP_COMPARE_GT:
+        return (EjsVar*) ((lhs->value > rhs->value) ? ejs->trueValue: ejs->falseValue);
+
+    case EJS_OP_COMPARE_GE:
+        return (EjsVar*) ((lhs->value >= rhs->value) ? ejs->trueValue: ejs->falseValue);
+
+    default:
+        return 0;
+    }
+}
+
+
 /*
  *  Evaluate a binary expression.
  *  OPT -- simplify and move back inline into eval loop.
@@ -27750,6 +29729,11 @@ static EjsVar *evalBinaryExpr(Ejs *ejs, EjsVar *lhs, EjsOpCode opcode, EjsVar *r
     if (rhs == 0) {
         rhs = ejs->undefinedValue;
     }
+    if (lhs->type == ejs->numberType && rhs->type == ejs->numberType) {
+        if ((result = evalNumberExpr(ejs, (EjsNumber*) lhs, opcode, (EjsNumber*) rhs)) != 0) {
+            return result;
+        }
+    }
 
     result = ejsInvokeOperator(ejs, lhs, opcode, rhs);
 
@@ -27764,6 +29748,61 @@ static EjsVar *evalBinaryExpr(Ejs *ejs, EjsVar *lhs, EjsOpCode opcode, EjsVar *r
 }
 
 
+/*
+ *  Add a string for "local = local + value" and "local += value". The last result is kept in ejs->appendString and 
+ *  every push of it is counted. If it has been pushed only by the add that built it and as this lhs, and the local
+ *  still holds it, then the store that follows drops the only other reference and the string is extended in place. 
+ *  This makes repeated appends linear rather than quadratic. Otherwise the result is a new string which is tracked.
+ */
+static EjsVar *appendString(Ejs *ejs, EjsString *lhs, EjsVar *rhs, bool stored)
+{
+    EjsString   *sp;
+    EjsVar      *result;
+
+    if (rhs == 0 || !ejsIsA(ejs, rhs, ejs->stringType)) {
+        if ((rhs = (EjsVar*) ejsToString(ejs, rhs ? rhs : ejs->undefinedValue)) == 0) {
+            return 0;
+        }
+    }
+    sp = (EjsString*) rhs;
+    if (lhs == ejs->appendString && ejs->appendLoads == 2 && stored && sp != lhs) {
+        if (catString(ejs, lhs, sp->value, sp->length) < 0) {
+            ejsThrowMemoryError(ejs);
+            return 0;
+        }
+        result = (EjsVar*) lhs;
+
+    } else {
+        result = evalBinaryExpr(ejs, (EjsVar*) lhs, EJS_OP_ADD, rhs);
+        if (result == 0 || result == (EjsVar*) lhs || result == rhs || result->type != ejs->stringType) {
+            /* Not a new string. Can't be extended. */
+            return result;
+        }
+        ejs->appendString = (EjsString*) result;
+    }
+    /*
+     *  The caller's push of the result is the first load
+     */
+    ejs->appendLoads = 0;
+    return result;
+}
+
+
+/*
+ *  Return the local slot stored by the instruction at pc or -1 if it does not store a local
+ */
+static int getLocalStoreSlot(uchar *pc)
+{
+    if (*pc >= EJS_OP_PUT_LOCAL_SLOT_0 && *pc <= EJS_OP_PUT_LOCAL_SLOT_9) {
+        return *pc - EJS_OP_PUT_LOCAL_SLOT_0;
+    } else if (*pc == EJS_OP_PUT_LOCAL_SLOT) {
+        pc++;
+        return (int) ejsDecodeNum(&pc);
+    }
+    return -1;
+}
+
+
 /*
  *  Evaluate a unary expression.
  *  OPT -- once simplified, move back inline into eval loop.
@@ -27983,7 +30022,7 @@ static void callFunction(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc,
             ejsThrowInternalError(ejs, "Native function \"%s\" is not defined", qname.name);
             return;
         }
-        ejs->result = (fun->body.proc)(ejs, thisObj, argc, argv);
+        ejs->result = callNative(ejs, fun, thisObj, argc, argv);
         if (ejs->result == 0) {
             ejs->result = ejs->nullValue;
         }
@@ -28083,6 +30122,29 @@ static MPR_INLINE EjsVar *getNthBlock(Ejs *ejs, int nth)
 }
 
 
+/*
+ *  Invoke a native function. Native code modifies "this" without a GC write barrier, so track "this" while the 
+ *  function runs and have an incremental collection rescan it afterwards.
+ */
+static MPR_INLINE EjsVar *callNative(Ejs *ejs, EjsFunction *fun, EjsVar *thisObj, int argc, EjsVar **argv)
+{
+    EjsGC       *gc;
+    EjsVar      *result;
+
+    gc = &ejs->gc;
+    if (gc->nativeDepth < EJS_GC_MAX_NATIVES) {
+        gc->natives[gc->nativeDepth] = thisObj;
+    }
+    gc->nativeDepth++;
+    result = (fun->body.proc)(ejs, thisObj, argc, argv);
+    gc->nativeDepth--;
+    if (unlikely(gc->marking)) {
+        ejsGrayVar(ejs, thisObj);
+    }
+    return result;
+}
+
+
 /*
  *  Enter a mesage into the log file
  */
@@ -28719,22 +30781,23 @@ static int  addFixup(Ejs *ejs, int kind, EjsVar *target, int slotNum, EjsTypeFix
 static EjsTypeFixup *createFixup(Ejs *ejs, EjsName *qname, int slotNum);
 static int  fixupTypes(Ejs *ejs, MprList *list);
 static int  initializeModule(Ejs *ejs, EjsModule *mp, cchar *path);
-static int  loadBlockSection(Ejs *ejs, MprFile *file, EjsModule *mp);
-static int  loadClassSection(Ejs *ejs, MprFile *file, EjsModule *mp);
-static int  loadDependencySection(Ejs *ejs, MprFile *file, EjsModule *mp);
-static int  loadEndBlockSection(Ejs *ejs, MprFile *file, EjsModule *mp);
-static int  loadEndFunctionSection(Ejs *ejs, MprFile *file, EjsModule *mp);
-static int  loadEndClassSection(Ejs *ejs, MprFile *file, EjsModule *mp);
-static int  loadEndModuleSection(Ejs *ejs, MprFile *file, EjsModule *mp);
-static int  loadExceptionSection(Ejs *ejs, MprFile *file, EjsModule *mp);
-static int  loadFunctionSection(Ejs *ejs, MprFile *file, EjsModule *mp);
-static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int *created, int flags);
-static int  loadSections(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int flags);
-static int  loadPropertySection(Ejs *ejs, MprFile *file, EjsModule *mp, int sectionType);
-static int  loadScriptModule(Ejs *ejs, MprFile *file, cchar *path, int flags);
+static int  loadBlockSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
+static int  loadClassSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
+static int  loadDependencySection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
+static int  loadEndBlockSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
+static int  loadEndFunctionSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
+static int  loadEndClassSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
+static int  loadEndModuleSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
+static int  loadExceptionSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
+static int  loadFunctionSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
+static EjsModule *loadModuleSection(Ejs *ejs, EjsModuleReader *reader, EjsModuleHdr *hdr, int *created, int flags);
+static int  loadSections(Ejs *ejs, EjsModuleReader *reader, EjsModuleHdr *hdr, int flags);
+static int  loadPropertySection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp, int sectionType);
+static int  loadScriptModule(Ejs *ejs, EjsModuleReader *reader, cchar *path, int flags);
 static char *makeModuleName(MprCtx ctx, cchar *name);
-static int  readNumber(Ejs *ejs, MprFile *file, int *number);
-static int  readWord(Ejs *ejs, MprFile *file, int *number);
+static int  readNumber(Ejs *ejs, EjsModuleReader *reader, int *number);
+static int  readWord(Ejs *ejs, EjsModuleReader *reader, int *number);
+static EjsModuleImage *retainModuleImage(Ejs *ejs, EjsModuleImage *image);
 static char *search(Ejs *ejs, char *filename, int minVersion, int maxVersion);
 static double swapDoubleWord(Ejs *ejs, double a);
 static int  swapWord(Ejs *ejs, int word);
@@ -28745,7 +30808,7 @@ static int  loadNativeLibrary(Ejs *ejs, EjsModule *mp, cchar *path);
 #endif
 
 #if BLD_FEATURE_EJS_DOC
-static int  loadDocSection(Ejs *ejs, MprFile *file, EjsModule *mp);
+static int  loadDocSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp);
 static void setDoc(Ejs *ejs, EjsModule *mp, EjsVar *block, int slotNum);
 #endif
 
@@ -28767,7 +30830,7 @@ static void setDoc(Ejs *ejs, EjsModule *mp, EjsVar *block, int slotNum);
  */
 int ejsLoadModule(Ejs *ejs, cchar *nameArg, int minVersion, int maxVersion, int flags, MprList **modulesArg)
 {
-    MprFile         *file;
+    EjsModuleReader *reader;
     MprList         *modules;
     MprCtx          ctx;
     EjsLoadState    *ls;
@@ -28807,20 +30870,25 @@ int ejsLoadModule(Ejs *ejs, cchar *nameArg, int minVersion, int maxVersion, int
     }
     mprLog(ejs, 3, "Loading module %s", path);
 
-    if ((file = mprOpen(ctx, path, O_RDONLY | O_BINARY, 0666)) == 0) {
+    /*
+     *  Parse the module from a shared in-memory image of the file. The reader holds an image reference while loading.
+     */
+    reader = mprAllocObjZeroed(ctx, EjsModuleReader);
+    if (reader == 0 || (reader->image = ejsGetModuleImage(ejs, path)) == 0) {
         ejsThrowIOError(ejs, "Can't open module file %s", path);
         mprFree(path);
         mprFree(ctx);
         return MPR_ERR_CANT_OPEN;
     }
-    mprEnableFileBuffering(file, 0, 0);
+    reader->pos = reader->image->data;
+    reader->end = &reader->image->data[reader->image->size];
 
     if (ejs->loadState == 0) {
         ls = ejs->loadState = mprAllocObjZeroed(ejs, EjsLoadState);
         ls->typeFixups = mprCreateList(ls);
         modules = ls->modules = mprCreateList(ls);
 
-        status = loadScriptModule(ejs, file, path, flags);
+        status = loadScriptModule(ejs, reader, path, flags);
         ejs->loadState = 0;
 
         /*
@@ -28842,8 +30910,9 @@ int ejsLoadModule(Ejs *ejs, cchar *nameArg, int minVersion, int maxVersion, int
         mprFree(ls);
 
     } else {
-        status = loadScriptModule(ejs, file, path, flags);
+        status = loadScriptModule(ejs, reader, path, flags);
     }
+    ejsReleaseModuleImage(ejs, reader->image);
 
     mprFree(path);
     mprFree(ctx);
@@ -28851,6 +30920,15 @@ int ejsLoadModule(Ejs *ejs, cchar *nameArg, int minVersion, int maxVersion, int
 }
 
 
+static EjsModuleImage *retainModuleImage(Ejs *ejs, EjsModuleImage *image)
+{
+    mprLock(ejs->service->mutex);
+    image->refs++;
+    mprUnlock(ejs->service->mutex);
+    return image;
+}
+
+
 static int initializeModule(Ejs *ejs, EjsModule *mp, cchar *path)
 {
     EjsNativeCallback   moduleCallback;
@@ -28926,7 +31004,7 @@ static char *search(Ejs *ejs, char *filename, int minVersion, int maxVersion)
 /*
  *  Load the sections: classes, properties and functions. Return the first module loaded in pup.
  */
-static int loadSections(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int flags)
+static int loadSections(Ejs *ejs, EjsModuleReader *reader, EjsModuleHdr *hdr, int flags)
 {
     EjsModule   *mp, *firstModule;
     int         rc, sectionType, created;
@@ -28935,7 +31013,8 @@ static int loadSections(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int flags)
 
     firstModule = mp = 0;
 
-    while ((sectionType = mprGetc(file)) >= 0) {
+    while (reader->pos < reader->end) {
+        sectionType = *reader->pos++;
 
         if (sectionType < 0 || sectionType >= EJS_SECT_MAX) {
             mprError(ejs, "Bad section type %d in %s", sectionType, mp->name);
@@ -28947,39 +31026,39 @@ static int loadSections(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int flags)
         switch (sectionType) {
 
         case EJS_SECT_BLOCK:
-            rc = loadBlockSection(ejs, file, mp);
+            rc = loadBlockSection(ejs, reader, mp);
             break;
 
         case EJS_SECT_BLOCK_END:
-            rc = loadEndBlockSection(ejs, file, mp);
+            rc = loadEndBlockSection(ejs, reader, mp);
             break;
 
         case EJS_SECT_CLASS:
-            rc = loadClassSection(ejs, file, mp);
+            rc = loadClassSection(ejs, reader, mp);
             break;
 
         case EJS_SECT_CLASS_END:
-            rc = loadEndClassSection(ejs, file, mp);
+            rc = loadEndClassSection(ejs, reader, mp);
             break;
 
         case EJS_SECT_DEPENDENCY:
-            rc = loadDependencySection(ejs, file, mp);
+            rc = loadDependencySection(ejs, reader, mp);
             break;
 
         case EJS_SECT_EXCEPTION:
-            rc = loadExceptionSection(ejs, file, mp);
+            rc = loadExceptionSection(ejs, reader, mp);
             break;
 
         case EJS_SECT_FUNCTION:
-            rc = loadFunctionSection(ejs, file, mp);
+            rc = loadFunctionSection(ejs, reader, mp);
             break;
 
         case EJS_SECT_FUNCTION_END:
-            rc = loadEndFunctionSection(ejs, file, mp);
+            rc = loadEndFunctionSection(ejs, reader, mp);
             break;
 
         case EJS_SECT_MODULE:
-            mp = loadModuleSection(ejs, file, hdr, &created, flags);
+            mp = loadModuleSection(ejs, reader, hdr, &created, flags);
             if (mp == 0) {
                 return 0;
             }
@@ -28991,16 +31070,16 @@ static int loadSections(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int flags)
             break;
 
         case EJS_SECT_MODULE_END:
-            rc = loadEndModuleSection(ejs, file, mp);
+            rc = loadEndModuleSection(ejs, reader, mp);
             break;
 
         case EJS_SECT_PROPERTY:
-            rc = loadPropertySection(ejs, file, mp, sectionType);
+            rc = loadPropertySection(ejs, reader, mp, sectionType);
             break;
 
 #if BLD_FEATURE_EJS_DOC
         case EJS_SECT_DOC:
-            rc = loadDocSection(ejs, file, mp);
+            rc = loadDocSection(ejs, reader, mp);
             break;
 #endif
 
@@ -29025,7 +31104,7 @@ static int loadSections(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int flags)
 /*
  *  Load a module section and constant pool.
  */
-static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr, int *created, int flags)
+static EjsModule *loadModuleSection(Ejs *ejs, EjsModuleReader *reader, EjsModuleHdr *hdr, int *created, int flags)
 {
     EjsModule   *mp;
     char        *pool, *name;
@@ -29040,25 +31119,22 @@ static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr,
      *  We don't have the constant pool yet so we cant resolve the name yet.
      */
     rc = 0;
-    rc += readNumber(ejs, file, &nameToken);
-    rc += readNumber(ejs, file, &version);
-    rc += readWord(ejs, file, &checksum);
-    rc += readNumber(ejs, file, &poolSize);
+    rc += readNumber(ejs, reader, &nameToken);
+    rc += readNumber(ejs, reader, &version);
+    rc += readWord(ejs, reader, &checksum);
+    rc += readNumber(ejs, reader, &poolSize);
     if (rc < 0 || poolSize <= 0 || poolSize > EJS_MAX_POOL) {
         return 0;
     }
 
     /*
-     *  Read the string constant pool. The pool calls Steal when the module is created.
+     *  The string constant pool is used in-place from the shared image
      */
-    pool = (char*) mprAlloc(file, poolSize);
-    if (pool == 0) {
-        return 0;
-    }
-    if (mprRead(file, pool, poolSize) != poolSize) {
-        mprFree(pool);
+    if (poolSize > (reader->end - reader->pos)) {
         return 0;
     }
+    pool = (char*) reader->pos;
+    reader->pos += poolSize;
 
     /*
      *  Convert module token into a name
@@ -29068,18 +31144,26 @@ static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr,
         return 0;
     }
     name = &pool[nameToken];
-    if (name == 0) {
-        mprAssert(name);
-        mprFree(pool);
-        return 0;
-    }
 
     mp = ejsCreateModule(ejs, name, version);
     if (mp == 0) {
-        mprFree(pool);
         return 0;
     }
-    ejsSetModuleConstants(ejs, mp, pool, poolSize);
+    if (strcmp(name, EJS_DEFAULT_MODULE) == 0) {
+        /*
+         *  The default module is not locked and the compiler may add to its pool, so it needs a private copy
+         */
+        if ((pool = mprMemdup(mp, pool, poolSize)) == 0) {
+            mprFree(mp);
+            return 0;
+        }
+        ejsSetModuleConstants(ejs, mp, pool, poolSize);
+    } else {
+        mp->constants->pool = pool;
+        mp->constants->size = poolSize;
+        mp->constants->len = poolSize;
+    }
+    mp->image = retainModuleImage(ejs, reader->image);
     mp->scopeChain = ejs->globalBlock;
     mp->checksum = checksum;
     *created = 1;
@@ -29091,7 +31175,7 @@ static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr,
         mp->loaded = 1;
         mp->constants->locked = 1;
     }
-    mp->file = file;
+    mp->reader = reader;
     mp->flags = flags;
     mp->firstGlobalSlot = ejsGetPropertyCount(ejs, ejs->global);
 
@@ -29103,18 +31187,19 @@ static EjsModule *loadModuleSection(Ejs *ejs, MprFile *file, EjsModuleHdr *hdr,
 }
 
 
-static int loadEndModuleSection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadEndModuleSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     mprLog(ejs, 9, "End module section %s", mp->name);
 
     if (ejs->loaderCallback) {
         (ejs->loaderCallback)(ejs, EJS_SECT_MODULE_END, mp);
     }
+    mp->reader = 0;
     return 0;
 }
 
 
-static int loadDependencySection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadDependencySection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     EjsModule   *module;
     void        *saveCallback;
@@ -29122,7 +31207,7 @@ static int loadDependencySection(Ejs *ejs, MprFile *file, EjsModule *mp)
     int         rc, next, minVersion, maxVersion, checksum, nextModule;
 
     mprAssert(ejs);
-    mprAssert(file);
+    mprAssert(reader);
     mprAssert(mp);
 
     name = ejsModuleReadString(ejs, mp);
@@ -29170,7 +31255,7 @@ static int loadDependencySection(Ejs *ejs, MprFile *file, EjsModule *mp)
 }
 
 
-static int loadBlockSection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadBlockSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     EjsBlock    *block;
     EjsVar      *owner;
@@ -29209,7 +31294,7 @@ static int loadBlockSection(Ejs *ejs, MprFile *file, EjsModule *mp)
 }
 
 
-static int loadEndBlockSection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadEndBlockSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     mprLog(ejs, 9, "    End block section %s", mp->name);
 
@@ -29221,7 +31306,7 @@ static int loadEndBlockSection(Ejs *ejs, MprFile *file, EjsModule *mp)
 }
 
 
-static int loadClassSection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadClassSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     EjsType         *type, *baseType, *iface, *nativeType;
     EjsTypeFixup    *fixup, *ifixup;
@@ -29378,7 +31463,7 @@ static int loadClassSection(Ejs *ejs, MprFile *file, EjsModule *mp)
 }
 
 
-static int loadEndClassSection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadEndClassSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     EjsType     *type;
 
@@ -29396,7 +31481,7 @@ static int loadEndClassSection(Ejs *ejs, MprFile *file, EjsModule *mp)
 }
 
 
-static int loadFunctionSection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadFunctionSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     EjsType         *returnType;
     EjsTypeFixup    *fixup;
@@ -29434,17 +31519,14 @@ static int loadFunctionSection(Ejs *ejs, MprFile *file, EjsModule *mp)
     mprLog(ejs, 9, "Loading function %s:%s at slot %d", qname.space, qname.name, slotNum);
 
     /*
-     *  Read the code. We pass ownership of the code to createMethod i.e. don't free.
+     *  The code is used in-place from the shared module image. It is paged in on first use.
      */
     if (codeLen > 0) {
-        code = (uchar*) mprAlloc(ejsGetAllocCtx(ejs), codeLen);
-        if (code == 0) {
-            return MPR_ERR_NO_MEMORY;
-        }
-        if (mprRead(file, code, codeLen) != codeLen) {
-            mprFree(code);
+        if (codeLen > (reader->end - reader->pos)) {
             return MPR_ERR_CANT_READ;
         }
+        code = reader->pos;
+        reader->pos += codeLen;
         block->hasScriptFunctions = 1;
     } else {
         code = 0;
@@ -29479,12 +31561,9 @@ static int loadFunctionSection(Ejs *ejs, MprFile *file, EjsModule *mp)
     fun = ejsCreateFunction(ejs, code, codeLen, numArgs, numExceptions, returnType, attributes, mp->constants, 
         mp->scopeChain, lang);
     if (fun == 0) {
-        mprFree(code);
         return MPR_ERR_NO_MEMORY;
     }
-    if (code) {
-        mprStealBlock(fun, code);
-    }
+    fun->sharedCode = 1;
 
     ejsSetDebugName(fun, qname.name);
 
@@ -29542,7 +31621,7 @@ static int loadFunctionSection(Ejs *ejs, MprFile *file, EjsModule *mp)
 }
 
 
-static int loadEndFunctionSection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadEndFunctionSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     EjsTrait            *trait;
     EjsFunction         *fun;
@@ -29568,7 +31647,7 @@ static int loadEndFunctionSection(Ejs *ejs, MprFile *file, EjsModule *mp)
 }
 
 
-static int loadExceptionSection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadExceptionSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     EjsFunction         *fun;
     EjsType             *catchType;
@@ -29614,7 +31693,7 @@ static int loadExceptionSection(Ejs *ejs, MprFile *file, EjsModule *mp)
 /*
  *  Define a global, class or block property. Not used for function locals or args.
  */
-static int loadPropertySection(Ejs *ejs, MprFile *file, EjsModule *mp, int sectionType)
+static int loadPropertySection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp, int sectionType)
 {
     EjsType         *type;
     EjsTypeFixup    *fixup;
@@ -29693,7 +31772,7 @@ static int loadPropertySection(Ejs *ejs, MprFile *file, EjsModule *mp, int secti
 
 
 #if BLD_FEATURE_EJS_DOC
-static int loadDocSection(Ejs *ejs, MprFile *file, EjsModule *mp)
+static int loadDocSection(Ejs *ejs, EjsModuleReader *reader, EjsModule *mp)
 {
     char        *doc;
 
@@ -29760,7 +31839,7 @@ static int loadNativeLibrary(Ejs *ejs, EjsModule *mp, cchar *dir)
 /*
  *  Load a scripted module file. Return a modified list of modules.
  */
-static int loadScriptModule(Ejs *ejs, MprFile *file, cchar *path, int flags)
+static int loadScriptModule(Ejs *ejs, EjsModuleReader *reader, cchar *path, int flags)
 {
     EjsModuleHdr    hdr;
     int             status;
@@ -29770,10 +31849,12 @@ static int loadScriptModule(Ejs *ejs, MprFile *file, cchar *path, int flags)
     /*
      *  Read module file header
      */
-    if ((mprRead(file, &hdr, sizeof(hdr))) != sizeof(hdr)) {
+    if ((reader->end - reader->pos) < (int) sizeof(hdr)) {
         ejsThrowIOError(ejs, "Error reading module file %s, corrupt header", path);
         return EJS_ERR;
     }
+    memcpy(&hdr, reader->pos, sizeof(hdr));
+    reader->pos += sizeof(hdr);
     if ((int) swapWord(ejs, hdr.magic) != EJS_MODULE_MAGIC) {
         ejsThrowIOError(ejs, "Bad module file format in %s", path);
         return EJS_ERR;
@@ -29790,7 +31871,7 @@ static int loadScriptModule(Ejs *ejs, MprFile *file, cchar *path, int flags)
     /*
      *  Load the sections: classes, properties and functions. This may load multiple modules.
      */
-    if ((status = loadSections(ejs, file, &hdr, flags)) < 0) {
+    if ((status = loadSections(ejs, reader, &hdr, flags)) < 0) {
         if (ejs->exception == 0) {
             ejsThrowReferenceError(ejs, "Can't load module file %s", path);
         }
@@ -30298,38 +32379,40 @@ int64 ejsDecodeNum(uchar **pp)
 
 
 /*
- *  Decode a 4 byte number from a file
+ *  Decode a 4 byte number from a module image
  */
-static int readWord(Ejs *ejs, MprFile *file, int *number)
+static int readWord(Ejs *ejs, EjsModuleReader *reader, int *number)
 {
-    uchar   buf[4], *pp;
+    uchar   *pp;
 
-    mprAssert(file);
+    mprAssert(reader);
     mprAssert(number);
 
-    if (mprRead(file, buf, 4) != 4) {
+    if ((reader->end - reader->pos) < 4) {
         return MPR_ERR_CANT_READ;
     }
-    pp = buf;
+    pp = reader->pos;
     *number = ejsDecodeWord(&pp);
+    reader->pos += 4;
     return 0;
 }
 
 
 /*
- *  Decode a number from a file. Same as ejsDecodeNum but reading from a file.
+ *  Decode a number from a module image. Same as ejsDecodeNum but checks for the end of the image.
  */
-static int readNumber(Ejs *ejs, MprFile *file, int *number)
+static int readNumber(Ejs *ejs, EjsModuleReader *reader, int *number)
 {
     uint    t;
     int     c, sign, shift;
 
-    mprAssert(file);
+    mprAssert(reader);
     mprAssert(number);
 
-    if ((c = mprGetc(file)) < 0) {
+    if (reader->pos >= reader->end) {
         return MPR_ERR_CANT_READ;
     }
+    c = *reader->pos++;
 
     /*
      *  Map sign bit (0,1) to 1,-1
@@ -30339,9 +32422,10 @@ static int readNumber(Ejs *ejs, MprFile *file, int *number)
     shift = 6;
     
     while (c & 0x80) {
-        if ((c = mprGetc(file)) < 0) {
+        if (reader->pos >= reader->end) {
             return MPR_ERR_CANT_READ;
         }
+        c = *reader->pos++;
         t |= (c & 0x7f) << shift;
         shift += 7;
     }
@@ -30477,7 +32561,7 @@ int ejsModuleReadNumber(Ejs *ejs, EjsModule *mp, int *number)
     mprAssert(mp);
     mprAssert(number);
 
-    if (readNumber(ejs, mp->file, number) < 0) {
+    if (readNumber(ejs, mp->reader, number) < 0) {
         mp->hasError = 1;
         return -1;
     }
@@ -30492,11 +32576,11 @@ int ejsModuleReadByte(Ejs *ejs, EjsModule *mp, int *number)
     mprAssert(mp);
     mprAssert(number);
 
-    if ((c = mprGetc(mp->file)) < 0) {
+    if (mp->reader->pos >= mp->reader->end) {
         mp->hasError = 1;
         return MPR_ERR_CANT_READ;
     }
-    *number = c;
+    *number = *mp->reader->pos++;
     return 0;
 }
 
@@ -30627,13 +32711,23 @@ static double swapDoubleWord(Ejs *ejs, double a)
 
 
 
+static int destroyModule(EjsModule *mp)
+{
+    if (mp->image) {
+        ejsReleaseModuleImage(mp, mp->image);
+        mp->image = 0;
+    }
+    return 0;
+}
+
+
 EjsModule *ejsCreateModule(Ejs *ejs, cchar *name, int version)
 {
     EjsModule   *mp;
 
     mprAssert(version >= 0);
 
-    mp = (EjsModule*) mprAllocZeroed(ejs, sizeof(EjsModule));
+    mp = mprAllocObjWithDestructorZeroed(ejs, EjsModule, destroyModule);
     if (mp == 0) {
         mprAssert(mp);
         return 0;
@@ -30665,6 +32759,101 @@ int ejsSetModuleConstants(Ejs *ejs, EjsModule *mp, cchar *pool, int poolSize)
 }
 
 
+static int destroyModuleImage(EjsModuleImage *image)
+{
+    if (image->mapped) {
+        mprUnmapFile(image->data, image->size);
+    }
+    return 0;
+}
+
+
+/*
+ *  Map or read a module file into a new image
+ */
+static EjsModuleImage *createModuleImage(EjsService *sp, cchar *path, MprPath *info)
+{
+    EjsModuleImage  *image;
+    MprFile         *file;
+
+    image = mprAllocObjWithDestructorZeroed(sp, EjsModuleImage, destroyModuleImage);
+    if (image == 0) {
+        return 0;
+    }
+    image->path = mprStrdup(image, path);
+    image->size = (int) info->size;
+    image->mtime = info->mtime;
+    image->inode = info->inode;
+
+    if ((file = mprOpen(image, path, O_RDONLY | O_BINARY, 0)) == 0) {
+        mprFree(image);
+        return 0;
+    }
+    if ((image->data = (uchar*) mprMapFile(file, image->size)) != 0) {
+        image->mapped = 1;
+    } else if ((image->data = (uchar*) mprAlloc(image, image->size)) == 0 || 
+            mprRead(file, image->data, image->size) != image->size) {
+        mprFree(file);
+        mprFree(image);
+        return 0;
+    }
+    mprFree(file);
+    return image;
+}
+
+
+/*
+ *  Get a reference to the shared image of a module file. Images are cached by path for the life of the service and
+ *  reused until the file is replaced or modified. The compiler replaces module files by renaming, so the memory
+ *  of an existing image remains valid while modules loaded from it are in use.
+ */
+EjsModuleImage *ejsGetModuleImage(Ejs *ejs, cchar *path)
+{
+    EjsService      *sp;
+    EjsModuleImage  *image;
+    MprPath         info;
+
+    sp = ejs->service;
+    if (mprGetPathInfo(ejs, path, &info) < 0 || info.size <= 0 || info.size >= MAXINT) {
+        return 0;
+    }
+    mprLock(sp->mutex);
+    image = (EjsModuleImage*) mprLookupHash(sp->moduleImages, path);
+    if (image && (image->inode != info.inode || image->mtime != info.mtime || image->size != (int) info.size)) {
+        mprRemoveHash(sp->moduleImages, path);
+        image->stale = 1;
+        if (image->refs == 0) {
+            mprFree(image);
+        }
+        image = 0;
+    }
+    if (image == 0 && (image = createModuleImage(sp, path, &info)) != 0) {
+        mprAddHash(sp->moduleImages, path, image);
+    }
+    if (image) {
+        image->refs++;
+    }
+    mprUnlock(sp->mutex);
+    return image;
+}
+
+
+void ejsReleaseModuleImage(MprCtx ctx, EjsModuleImage *image)
+{
+    EjsService      *sp;
+
+    if ((sp = mprGetMpr(ctx)->ejsService) == 0) {
+        return;
+    }
+    mprLock(sp->mutex);
+    mprAssert(image->refs > 0);
+    if (--image->refs == 0 && image->stale) {
+        mprFree(image);
+    }
+    mprUnlock(sp->mutex);
+}
+
+
 /*
  *  Lookup a module name in the set of loaded modules
  *  If minVersion is <= 0, then any version up to, but not including maxVersion is acceptable.
@@ -31088,16 +33277,31 @@ static int configureWebModule(Ejs *ejs, EjsModule *mp, cchar *path);
 /*
  *  Initialize the EJS subsystem
  */
+/*
+ *  Module images are freed with the service. Interpreters freed after this must not release their images.
+ */
+static int destroyService(EjsService *sp)
+{
+    if (mprGetMpr(sp)->ejsService == sp) {
+        mprGetMpr(sp)->ejsService = 0;
+    }
+    return 0;
+}
+
+
 EjsService *ejsCreateService(MprCtx ctx)
 {
     EjsService  *sp;
 
-    sp = mprAllocObjZeroed(ctx, EjsService);
+    sp = mprAllocObjWithDestructorZeroed(ctx, EjsService, destroyService);
     if (sp == 0) {
         return 0;
     }
     mprGetMpr(ctx)->ejsService = sp;
     sp->nativeModules = mprCreateHash(sp, 0);
+    sp->moduleImages = mprCreateHash(sp, 0);
+    sp->pendingWorkers = mprCreateList(sp);
+    sp->mutex = mprCreateLock(sp);
 
     /*
      *  The native module callbacks are invoked after loading the module files. This allows the callback routines 
@@ -31143,7 +33347,7 @@ Ejs *ejsCreate(MprCtx ctx, Ejs *master, cchar *searchPath, int flags)
      *  Flags may include COMPILER to pretend to be compiling. Ejsmod uses this to allow compiler-style access to
      *  getters and setters.
      */
-    ejs->flags |= (flags & (EJS_FLAG_EMPTY | EJS_FLAG_COMPILER | EJS_FLAG_NO_EXE | EJS_FLAG_DOC));
+    ejs->flags |= (flags & (EJS_FLAG_EMPTY | EJS_FLAG_COMPILER | EJS_FLAG_NO_EXE | EJS_FLAG_DOC | EJS_FLAG_NO_INLINE_CACHE));
     ejs->dispatcher = mprCreateDispatcher(ejs);
 
     if (ejsInitStack(ejs) < 0) {
@@ -31526,6 +33730,7 @@ static int cloneMaster(Ejs *ejs, Ejs *master)
     ejs->trueValue = master->trueValue;
     ejs->undefinedValue = master->undefinedValue;
     ejs->zeroValue = master->zeroValue;
+    ejs->smallInts = master->smallInts;
 
     ejs->configSpace = master->configSpace;
     ejs->emptySpace = master->emptySpace;
@@ -31543,6 +33748,7 @@ static int cloneMaster(Ejs *ejs, Ejs *master)
     ejs->standardSpaces = master->standardSpaces;
 
     ejs->modules = mprDupList(ejs, master->modules);
+    ejs->workers = mprCreateList(ejs);
     ejs->sqlite = master->sqlite;
 
     //  Push this code into ejsGlobal.c. Call ejsCloneGlobal
@@ -32184,6 +34390,7 @@ int ejsDefineProperty(Ejs *ejs, EjsVar *vp, int slotNum, EjsName *name, EjsType
         name = &qname;
     }
     mprAssert(vp->type->helpers->defineProperty);
+    ejsWriteBarrier(ejs, value);
     return (vp->type->helpers->defineProperty)(ejs, vp, slotNum, name, propType, attributes, value);
 }
 
@@ -32375,6 +34582,7 @@ int ejsSetProperty(Ejs *ejs, EjsVar *vp, int slotNum, EjsVar *value)
         return EJS_ERR;
     }
     mprAssert(vp->type->helpers->setProperty);
+    ejsWriteBarrier(ejs, value);
     return (vp->type->helpers->setProperty)(ejs, vp, slotNum, value);
 }
 
@@ -32390,6 +34598,8 @@ int ejsSetPropertyByName(Ejs *ejs, EjsVar *vp, EjsName *qname, EjsVar *value)
     mprAssert(vp);
     mprAssert(qname);
 
+    ejsWriteBarrier(ejs, value);
+
     /*
      *  WARNING: Not all types implement this
      */
@@ -32509,10 +34719,15 @@ EjsString *ejsToJson(Ejs *ejs, EjsVar *vp)
     if (vp == 0) {
         return ejsCreateString(ejs, "undefined");
     }
+    /*
+     *  Primitive values cannot contain cycles and may be shared between interpreters, so don't mark them as visited
+     */
     if (vp->jsonVisited) {
         return ejsCreateString(ejs, "this");
     }
-    vp->jsonVisited = 1;
+    if (!vp->primitive) {
+        vp->jsonVisited = 1;
+    }
 
     /*
      *  Types can provide a toJSON method, a serializeVar helper. If neither are provided, toString is used as a fall-back.
@@ -32523,7 +34738,9 @@ EjsString *ejsToJson(Ejs *ejs, EjsVar *vp)
     } else {
         result = ejsToString(ejs, vp);
     }
-    vp->jsonVisited = 0;
+    if (!vp->primitive) {
+        vp->jsonVisited = 0;
+    }
     return result;
 }
 
@@ -33115,12 +35332,47 @@ static MprCtx sqliteCtx;
 #endif /* MAP_ALLOC */
     
 
+/*
+ *  Cached prepared statement. Statements are found by their SQL text and kept on a most recently used list.
+ */
+typedef struct SqliteStmt {
+    struct SqliteStmt   *next;          /* Next less recently used statement */
+    struct SqliteStmt   *prev;          /* Previous more recently used statement */
+    sqlite3_stmt        *stmt;          /* Prepared statement. Always reset when idle */
+    cchar               *sql;           /* SQL text. Owned by the statement hash */
+} SqliteStmt;
+
+
+/*
+ *  Database connection. Connections and their statement caches are process-wide and outlive interpreters.
+ */
+typedef struct SqliteConn {
+    sqlite3             *sdb;           /* Sqlite handle */
+    char                *path;          /* Database path */
+    MprPath             info;           /* Database file state when last used. Detects files changed while pooled */
+    MprHashTable        *stmts;         /* Cached statements indexed by SQL text */
+    SqliteStmt          lru;            /* Statement list head. lru.next is the most recently used */
+    int                 numStmts;       /* Count of cached statements */
+} SqliteConn;
+
+
+/*
+ *  Pool of idle database connections shared by all interpreters
+ */
+typedef struct SqlitePool {
+    MprList             *idle;          /* Idle connections */
+    MprMutex            *mutex;         /* Multithread lock */
+} SqlitePool;
+
+static SqlitePool *sqlitePool;
+
+
 /*
  *  Ejscript Sqlite class object
  */
 typedef struct EjsSqlite {
     EjsObject       obj;                /* Extends Object */
-    sqlite3         *sdb;               /* Sqlite handle */
+    SqliteConn      *conn;              /* Database connection */
     MprHeap         *arena;             /* Memory context arena */
     Ejs             *ejs;               /* Interp reference */
 } EjsSqlite;
@@ -33130,6 +35382,170 @@ typedef struct EjsSqlite {
 static int sqldbDestructor(EjsSqlite **db);
 #endif
 
+/*
+ *  In-memory and temporary databases are private to their connection and must never be shared
+ */
+static bool isPoolable(cchar *path)
+{
+    return *path && strcmp(path, ":memory:") != 0;
+}
+
+
+static void unlinkStmt(SqliteStmt *sp)
+{
+    sp->prev->next = sp->next;
+    sp->next->prev = sp->prev;
+}
+
+
+static void linkStmt(SqliteConn *conn, SqliteStmt *sp)
+{
+    sp->next = conn->lru.next;
+    sp->prev = &conn->lru;
+    conn->lru.next->prev = sp;
+    conn->lru.next = sp;
+}
+
+
+/*
+ *  Find a cached statement and make it the most recently used
+ */
+static SqliteStmt *lookupStmt(SqliteConn *conn, cchar *sql)
+{
+    SqliteStmt  *sp;
+
+    if ((sp = (SqliteStmt*) mprLookupHash(conn->stmts, sql)) != 0) {
+        unlinkStmt(sp);
+        linkStmt(conn, sp);
+    }
+    return sp;
+}
+
+
+static void removeStmt(SqliteConn *conn, SqliteStmt *sp)
+{
+    unlinkStmt(sp);
+    sqlite3_finalize(sp->stmt);
+    mprRemoveHash(conn->stmts, sp->sql);
+    mprFree(sp);
+    conn->numStmts--;
+}
+
+
+/*
+ *  Add a statement to the cache. The least recently used statement is finalized if the cache is full.
+ */
+static SqliteStmt *cacheStmt(SqliteConn *conn, cchar *sql, sqlite3_stmt *stmt)
+{
+    SqliteStmt  *sp;
+    MprHash     *hp;
+
+    if (conn->numStmts >= EJS_SQLITE_MAX_STMTS) {
+        removeStmt(conn, conn->lru.prev);
+    }
+    if ((sp = mprAllocObjZeroed(conn, SqliteStmt)) == 0) {
+        return 0;
+    }
+    if ((hp = mprAddHash(conn->stmts, sql, sp)) == 0) {
+        mprFree(sp);
+        return 0;
+    }
+    sp->sql = hp->key;
+    sp->stmt = stmt;
+    linkStmt(conn, sp);
+    conn->numStmts++;
+    return sp;
+}
+
+
+static void closeConnection(SqliteConn *conn)
+{
+    while (conn->lru.next != &conn->lru) {
+        removeStmt(conn, conn->lru.next);
+    }
+    sqlite3_close(conn->sdb);
+    mprFree(conn);
+}
+
+
+/*
+ *  Test if the database path still names the file the connection has open. Files replaced or removed while a 
+ *  connection is pooled must not be served by it. Writes by other connections change the size and modification time
+ *  but not the file. The open connection keeps the inode allocated so it cannot be reused by a replacement.
+ */
+static bool isCurrent(SqliteConn *conn, MprPath *info)
+{
+    return info->valid && conn->info.valid && info->dev == conn->info.dev && info->inode == conn->info.inode;
+}
+
+
+/*
+ *  Get a connection for a database. Idle pooled connections for the same path are reused with their statement caches.
+ */
+static SqliteConn *openConnection(Ejs *ejs, cchar *path)
+{
+    SqliteConn  *conn;
+    MprPath     info;
+    int         i;
+
+    if (isPoolable(path)) {
+        mprGetPathInfo(ejs, path, &info);
+        mprLock(sqlitePool->mutex);
+        for (i = mprGetListCount(sqlitePool->idle) - 1; i >= 0; i--) {
+            conn = (SqliteConn*) mprGetItem(sqlitePool->idle, i);
+            if (strcmp(conn->path, path) == 0) {
+                mprRemoveItemAtPos(sqlitePool->idle, i);
+                if (isCurrent(conn, &info)) {
+                    mprUnlock(sqlitePool->mutex);
+                    return conn;
+                }
+                closeConnection(conn);
+            }
+        }
+        mprUnlock(sqlitePool->mutex);
+    }
+    if ((conn = mprAllocObjZeroed(sqlitePool, SqliteConn)) == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    conn->lru.next = conn->lru.prev = &conn->lru;
+    conn->path = mprStrdup(conn, path);
+    conn->stmts = mprCreateHash(conn, EJS_SQLITE_MAX_STMTS * 2 + 1);
+    if (conn->path == 0 || conn->stmts == 0) {
+        mprFree(conn);
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    if (sqlite3_open(path, &conn->sdb) != SQLITE_OK) {
+        ejsThrowIOError(ejs, "Can't open database %s", path);
+        sqlite3_close(conn->sdb);
+        mprFree(conn);
+        return 0;
+    }
+    sqlite3_busy_timeout(conn->sdb, EJS_SQLITE_TIMEOUT);
+    return conn;
+}
+
+
+/*
+ *  Return a connection to the pool. Connections left inside a transaction are closed rather than shared.
+ */
+static void releaseConnection(Ejs *ejs, SqliteConn *conn)
+{
+    if (isPoolable(conn->path) && sqlite3_get_autocommit(conn->sdb)) {
+        mprGetPathInfo(ejs, conn->path, &conn->info);
+        mprLock(sqlitePool->mutex);
+        if (mprGetListCount(sqlitePool->idle) < EJS_SQLITE_POOL_MAX) {
+            mprAddItem(sqlitePool->idle, conn);
+            mprUnlock(sqlitePool->mutex);
+            return;
+        }
+        mprUnlock(sqlitePool->mutex);
+    }
+    closeConnection(conn);
+}
+
+
 /*
  *  DB Constructor and also used for constructor for sub classes.
  *
@@ -33137,7 +35553,6 @@ static int sqldbDestructor(EjsSqlite **db);
  */
 static EjsVar *sqliteConstructor(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **argv)
 {
-    sqlite3         *sdb;
     char            *path;
 
     path = ejsGetString(argv[0]);    
@@ -33153,11 +35568,11 @@ static EjsVar *sqliteConstructor(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **arg
     }
     SET_CTX(db->arena);
 #else
-    db->arena = mprAllocHeap(ejs, "sqlite", EJS_MAX_DB_MEM, 1, 0);
-    if (db->arena == 0) {
-        return 0;
-    }
-    SET_CTX(db->arena);
+    /*
+     *  SQLite uses its own allocator so an arena is not required. Allocating one per instance made each open reserve
+     *  EJS_MAX_DB_MEM bytes which dominated the cost of reusing pooled connections.
+     */
+    db->arena = 0;
 #endif
     
 #if UNUSED
@@ -33173,14 +35588,9 @@ static EjsVar *sqliteConstructor(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **arg
     *dbp = db;
 #endif
 
-    sdb = 0;
-    if (sqlite3_open(path, &sdb) != SQLITE_OK) {
-        ejsThrowIOError(ejs, "Can't open database %s", path);
+    if ((db->conn = openConnection(ejs, path)) == 0) {
         return 0;
     }
-    db->sdb = sdb;
-    sqlite3_busy_timeout(sdb, EJS_SQLITE_TIMEOUT);
-
     sqlite3_soft_heap_limit(2 * 1024 * 1024);
     return 0;
 }
@@ -33211,43 +35621,118 @@ static int sqliteClose(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **argv)
     mprAssert(ejs);
     mprAssert(db);
 
-    if (db->sdb) {
+    if (db->conn) {
         SET_CTX(db->arena);
-        sqlite3_close(db->sdb);
-        db->sdb = 0;
+        releaseConnection(ejs, db->conn);
+        db->conn = 0;
+    }
+    return 0;
+}
+
+
+/*
+ *  Bind the next "count" parameters starting at "offset" to the statement placeholders
+ */
+static int bindParams(Ejs *ejs, sqlite3_stmt *stmt, EjsArray *params, int offset, int count)
+{
+    EjsVar      *vp;
+    EjsString   *str;
+    MprNumber   n;
+    int         i, rc;
+
+    if (offset + count > params->length) {
+        ejsThrowArgError(ejs, "Too few SQL parameters. Expected %d, given %d", offset + count, params->length);
+        return EJS_ERR;
+    }
+    for (i = 0; i < count; i++) {
+        vp = params->data[offset + i];
+        if (vp == 0 || ejsIsNull(vp) || ejsIsUndefined(vp)) {
+            rc = sqlite3_bind_null(stmt, i + 1);
+
+        } else if (ejsIsNumber(vp)) {
+            n = ejsGetNumber(vp);
+            if (n > -1e15 && n < 1e15 && n == (sqlite3_int64) n) {
+                rc = sqlite3_bind_int64(stmt, i + 1, (sqlite3_int64) n);
+            } else {
+                rc = sqlite3_bind_double(stmt, i + 1, n);
+            }
+
+        } else if (ejsIsBoolean(vp)) {
+            rc = sqlite3_bind_int(stmt, i + 1, ejsGetBoolean(vp));
+
+        } else {
+            /*
+             *  The string is referenced until the statement is reset before returning. No GC can run meanwhile.
+             */
+            if ((str = ejsToString(ejs, vp)) == 0) {
+                return EJS_ERR;
+            }
+            rc = sqlite3_bind_text(stmt, i + 1, str->value, str->length, SQLITE_STATIC);
+        }
+        if (rc != SQLITE_OK) {
+            ejsThrowIOError(ejs, "Can't bind SQL parameter %d", i + 1);
+            return EJS_ERR;
+        }
     }
     return 0;
 }
 
 
 /*
- *  function sql(cmd: String): Array
+ *  Finish with a statement. Cached statements are reset for reuse, others are finalized. Returns the statement
+ *  result code.
+ */
+static int doneStmt(SqliteConn *conn, sqlite3_stmt *stmt, SqliteStmt *sp)
+{
+    int     rc;
+
+    if (sp == 0) {
+        return sqlite3_finalize(stmt);
+    }
+    rc = sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    if (rc == SQLITE_SCHEMA) {
+        /* Schema changed and the statement could not be recompiled. Discard so a retry prepares afresh */
+        removeStmt(conn, sp);
+    }
+    return rc;
+}
+
+
+/*
+ *  function sql(cmd: String, ...params): Array
  *
- *  Will support multiple sql cmds but will only return one result table.
+ *  Will support multiple sql cmds but will only return one result table. Params are bound in order to the "?"
+ *  placeholders of each command. Single command strings are prepared once per connection and cached.
  */
 static EjsVar *sqliteSql(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **argv)
 {
+    SqliteConn      *conn;
+    SqliteStmt      *sp;
     sqlite3         *sdb;
     sqlite3_stmt    *stmt;
-    EjsArray        *result;
+    EjsArray        *result, *params;
     EjsObject       *row;
     EjsVar          *svalue;
     EjsName         qname;
     char            *tableName;
-    cchar           *tail, *colName, *cmd, *value, *defaultTableName;
-    int             i, ncol, rc, retries, rowNum, len;
+    cchar           *tail, *colName, *cmd, *value, *defaultTableName, *cp;
+    int             i, ncol, rc, retries, rowNum, len, nextParam, count;
 
     mprAssert(ejs);
     mprAssert(db);
 
     SET_CTX(db->arena);
     cmd = ejsGetString(argv[0]);
+    params = (argc > 1 && ejsIsArray(argv[1])) ? (EjsArray*) argv[1] : 0;
+    nextParam = 0;
     retries = 0;
-    sdb = db->sdb;
-    if (sdb == 0) {
+    conn = db->conn;
+    if (conn == 0) {
         ejsThrowIOError(ejs, "Database is closed");
         return 0;
     }
+    sdb = conn->sdb;
     mprAssert(sdb);
 
     result = ejsCreateArray(ejs, 0);
@@ -33258,14 +35743,33 @@ static EjsVar *sqliteSql(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **argv)
     rc = SQLITE_OK;
     while (cmd && *cmd && (rc == SQLITE_OK || (rc == SQLITE_SCHEMA && ++retries < 2))) {
         stmt = 0;
-        rc = sqlite3_prepare_v2(sdb, cmd, -1, &stmt, &tail);
-        if (rc != SQLITE_OK) {
-            continue;
+        if ((sp = lookupStmt(conn, cmd)) != 0) {
+            stmt = sp->stmt;
+            tail = &cmd[strlen(cmd)];
+        } else {
+            rc = sqlite3_prepare_v2(sdb, cmd, -1, &stmt, &tail);
+            if (rc != SQLITE_OK) {
+                continue;
+            }
+            if (stmt == 0) {
+                /* Comment or white space */
+                cmd = tail;
+                continue;
+            }
+            for (cp = tail; isspace((int) *cp); cp++) {
+                ;
+            }
+            if (*cp == '\0') {
+                /* Only a complete single command can be reused as is */
+                sp = cacheStmt(conn, cmd, stmt);
+            }
         }
-        if (stmt == 0) {
-            /* Comment or white space */
-            cmd = tail;
-            continue;
+        if (params && (count = sqlite3_bind_parameter_count(stmt)) > 0) {
+            if (bindParams(ejs, stmt, params, nextParam, count) < 0) {
+                doneStmt(conn, stmt, sp);
+                return 0;
+            }
+            nextParam += count;
         }
         defaultTableName = 0;
         ncol = sqlite3_column_count(stmt);
@@ -33273,10 +35777,11 @@ static EjsVar *sqliteSql(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **argv)
             if ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
                 row = ejsCreateSimpleObject(ejs);
                 if (row == 0) {
-                    sqlite3_finalize(stmt);
+                    doneStmt(conn, stmt, sp);
                     return 0;
                 }
                 if (ejsSetProperty(ejs, (EjsVar*) result, rowNum, (EjsVar*) row) < 0) {
+                    doneStmt(conn, stmt, sp);
                     ejsThrowIOError(ejs, "Can't update query result set");
                     return 0;
                 }
@@ -33317,6 +35822,7 @@ static EjsVar *sqliteSql(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **argv)
                     if (ejsLookupProperty(ejs, (EjsVar*) row, &qname) < 0) {
                         svalue = (EjsVar*) ejsCreateString(ejs, mprStrdup(row->names, value));
                         if (ejsSetPropertyByName(ejs, (EjsVar*) row, &qname, svalue) < 0) {
+                            doneStmt(conn, stmt, sp);
                             ejsThrowIOError(ejs, "Can't update query result set name");
                             return 0;
                         }
@@ -33325,7 +35831,7 @@ static EjsVar *sqliteSql(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **argv)
                     }
                 }
             } else {
-                rc = sqlite3_finalize(stmt);
+                rc = doneStmt(conn, stmt, sp);
                 stmt = 0;
 
                 if (rc != SQLITE_SCHEMA) {
@@ -33338,9 +35844,6 @@ static EjsVar *sqliteSql(Ejs *ejs, EjsSqlite *db, int argc, EjsVar **argv)
             }
         }
     }
-    if (stmt) {
-        rc = sqlite3_finalize(stmt);
-    }
     if (rc != SQLITE_OK) {
         if (rc == sqlite3_errcode(sdb)) {
             ejsThrowIOError(ejs, "SQL error: %s", sqlite3_errmsg(sdb));
@@ -33360,7 +35863,7 @@ static void destroyDb(Ejs *ejs, EjsSqlite *db)
 {
     mprAssert(db);
 
-    if (db->sdb) {
+    if (db->conn) {
         sqliteClose(ejs, db, 0, 0);
     }
     ejsFreeVar(ejs, (EjsVar*) db, -1);
@@ -33521,6 +36024,20 @@ void ejsConfigureSqliteTypes(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_ejs_db_Sqlite_close, (EjsNativeFunction) sqliteClose);
     ejsBindMethod(ejs, type, ES_ejs_db_Sqlite_sql, (EjsNativeFunction) sqliteSql);
 
+    if (sqlitePool == 0) {
+        /*
+         *  Connections are pooled across interpreters so they must belong to the process and not to this interpreter.
+         *  Idle connections have no open transaction and are simply released by the O/S on exit.
+         */
+        sqlitePool = mprAllocObjZeroed(mprGetMpr(ejs), SqlitePool);
+        if (sqlitePool == 0) {
+            ejs->hasError = 1;
+            return;
+        }
+        sqlitePool->idle = mprCreateList(sqlitePool);
+        sqlitePool->mutex = mprCreateLock(sqlitePool);
+    }
+
 #if MAP_ALLOC
 #if USE_TLS
     sqliteTls = mprCreateThreadLocal(ejs);
@@ -33533,7 +36050,10 @@ void ejsConfigureSqliteTypes(Ejs *ejs)
 #endif
     sqlite3_config(SQLITE_CONFIG_MALLOC, &mem);
 #else
-    sqliteCtx = ejs;
+    /*
+     *  SQLite mutexes are allocated from here and live as long as the pooled connections
+     */
+    sqliteCtx = mprGetMpr(ejs);
 #endif
 
 #if MAP_MUTEXES
@@ -33633,93 +36153,292 @@ MprModule *ejs_db_sqliteModuleInit(Ejs *ejs, cchar *path)
 
 
 #if BLD_FEATURE_EJS_WEB
-#if 0
-static void cacheActivity(Ejs *ejs, EjsWebCache *sp);
-static void cacheTimer(EjsWebControl *control, MprEvent *event);
-#endif
- 
-static EjsVar *cacheConstructor(Ejs *ejs, EjsWebCache *cp, int argc, EjsVar **argv)
-{
-    Ejs         *master;
-    EjsType     *cacheType;
-    EjsName     qname;
+/*
+ *  Cached items are held outside any interpreter so all requests can share them without locking a VM. Strings are
+ *  stored as-is and other values are stored serialized. The store is striped into shards, each with its own lock,
+ *  LRU list and memory limit.
+ */
+typedef struct EjsWebCacheItem {
+    struct EjsWebCacheItem *prev;           /* LRU list links. Most recently used is at the front */
+    struct EjsWebCacheItem *next;
+    char            *key;                   /* Domain qualified key */
+    char            *data;                  /* String contents or serialized value */
+    int             length;                 /* Length of data */
+    int             size;                   /* Memory charged to the shard */
+    bool            isString;               /* Data is a string value and does not need deserializing */
+    MprTime         expires;                /* When the item expires. Zero for never. */
+} EjsWebCacheItem;
+
+typedef struct EjsWebCacheShard {
+    MprHashTable    *items;                 /* Items indexed by key */
+    EjsWebCacheItem lru;                    /* LRU list head */
+    MprMutex        *mutex;                 /* Multithread sync for this shard */
+    int64           memory;                 /* Memory used by items */
+    int64           hits;                   /* Successful reads */
+    int64           misses;                 /* Reads of missing or expired items */
+    int64           evictions;              /* Items discarded to stay within the memory limit */
+} EjsWebCacheShard;
+
+typedef struct EjsWebCacheStore {
+    EjsWebCacheShard shards[EJS_WEB_CACHE_SHARDS];
+    int64           maxMemory;              /* Memory limit for all shards */
+} EjsWebCacheStore;
+
+static EjsWebCacheStore *cacheStore;
+
+static EjsWebCacheStore *getCacheStore(MprCtx ctx);
+static EjsWebCacheShard *getShard(EjsWebCacheStore *store, cchar *key);
+static void linkItem(EjsWebCacheShard *shard, EjsWebCacheItem *item);
+static void removeItem(EjsWebCacheShard *shard, EjsWebCacheItem *item);
+static void unlinkItem(EjsWebCacheItem *item);
 
-    master = ejs->master ? ejs->master : ejs;
 
-    cacheType = (EjsType*) ejsGetPropertyByName(master, master->global, ejsName(&qname, "ejs.web", "Cache"));
-    if (cacheType == 0) {
-        ejsThrowTypeError(ejs, "Can't find Cache type");
-        return 0;
+static EjsVar *cacheConstructor(Ejs *ejs, EjsWebCache *cp, int argc, EjsVar **argv)
+{
+    if ((cp->store = getCacheStore(ejs)) == 0) {
+        ejsThrowMemoryError(ejs);
     }
-#if ES_ejs_web_Cache_Cache
-    cp->cache = ejsGetProperty(master, (EjsVar*) cacheType, ES_ejs_web_Cache_cache);
-#endif
     return 0;
 }
 
 
 static EjsVar *readCache(Ejs *ejs, EjsWebCache *cp, int argc, EjsVar **argv)
 {
-    Ejs         *master;
-    EjsName     qname;
-    EjsVar      *vp;
-    cchar       *domain, *key;
+    EjsWebCacheShard    *shard;
+    EjsWebCacheItem     *item;
+    EjsVar              *vp;
+    char                *key;
+    int                 isString;
 
-    master = ejs->master ? ejs->master : ejs;
-    domain = ejsGetString(argv[0]);
-    key = ejsGetString(argv[1]);
-    ejsLockVm(master);
+    key = mprAsprintf(ejs, -1, "%s::%s", ejsGetString(argv[0]), ejsGetString(argv[1]));
+    shard = getShard(cp->store, key);
+    vp = 0;
+    isString = 1;
+
+    mprLock(shard->mutex);
+    item = (EjsWebCacheItem*) mprLookupHash(shard->items, key);
+    if (item && item->expires && item->expires <= mprGetTime(ejs)) {
+        removeItem(shard, item);
+        item = 0;
+    }
+    if (item == 0) {
+        shard->misses++;
+    } else {
+        shard->hits++;
+        unlinkItem(item);
+        linkItem(shard, item);
+        vp = (EjsVar*) ejsCreateStringWithLength(ejs, item->data, item->length);
+        isString = item->isString;
+    }
+    mprUnlock(shard->mutex);
+    mprFree(key);
+
+    /*
+     *  Deserialize the private copy outside the lock so other readers of the shard are not held up
+     */
+    if (vp && !isString) {
+        vp = ejsDeserialize(ejs, (EjsString*) vp);
+    }
 
-    vp = ejsGetPropertyByName(master, cp->cache, ejsName(&qname, domain, key));
     if (vp == 0) {
-        ejsUnlockVm(master);
         return ejs->nullValue;
-    }
-    vp = ejsDeserialize(ejs, (EjsString*) vp);
-    if (vp == ejs->undefinedValue) {
+    } else if (vp == ejs->undefinedValue) {
         vp = (EjsVar*) ejs->emptyStringValue;
     }
-    ejsUnlockVm(master);
     return vp;
 }
 
 
 static EjsVar *removeCache(Ejs *ejs, EjsWebCache *cp, int argc, EjsVar **argv)
 {
-    Ejs         *master;
-    EjsName     qname;
-    cchar       *domain, *key;
+    EjsWebCacheShard    *shard;
+    EjsWebCacheItem     *item;
+    char                *key;
 
-    master = ejs->master ? ejs->master : ejs;
-    domain = ejsGetString(argv[0]);
-    key = ejsGetString(argv[1]);
+    key = mprAsprintf(ejs, -1, "%s::%s", ejsGetString(argv[0]), ejsGetString(argv[1]));
+    shard = getShard(cp->store, key);
 
-    ejsLockVm(master);
-    ejsDeletePropertyByName(master, cp->cache, ejsName(&qname, domain, key));
-    ejsUnlockVm(master);
+    mprLock(shard->mutex);
+    if ((item = (EjsWebCacheItem*) mprLookupHash(shard->items, key)) != 0) {
+        removeItem(shard, item);
+    }
+    mprUnlock(shard->mutex);
+    mprFree(key);
     return 0;
 }
 
 
+/*
+ *  Values are serialized in the caller's interpreter before taking the shard lock
+ */
 static EjsVar *writeCache(Ejs *ejs, EjsWebCache *cp, int argc, EjsVar **argv)
 {
-    Ejs         *master;
-    EjsName     qname;
-    EjsVar      *value;
-    cchar       *domain, *key;
+    EjsWebCacheStore    *store;
+    EjsWebCacheShard    *shard;
+    EjsWebCacheItem     *item, *prior;
+    EjsString           *value;
+    EjsName             qname;
+    EjsVar              *vp;
+    int64               maxMemory;
+    int                 lifetime;
 
-    master = ejs->master ? ejs->master : ejs;
-    domain = ejsGetString(argv[0]);
-    key = ejsGetString(argv[1]);
-    ejsLockVm(master);
+    store = cp->store;
+    lifetime = 0;
+    if (argc >= 4 && ejsIsObject(argv[3])) {
+        vp = ejsGetPropertyByName(ejs, argv[3], ejsName(&qname, "", "lifetime"));
+        if (vp && ejsIsNumber(vp)) {
+            lifetime = (int) ejsGetNumber(vp);
+        }
+    }
+    if (ejsIsString(argv[2])) {
+        value = (EjsString*) argv[2];
+    } else if ((value = (EjsString*) ejsSerialize(ejs, argv[2], 0, 0, 0)) == 0) {
+        return 0;
+    }
+    item = mprAllocObjZeroed(store, EjsWebCacheItem);
+    if (item == 0) {
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    item->key = mprAsprintf(item, -1, "%s::%s", ejsGetString(argv[0]), ejsGetString(argv[1]));
+    item->data = mprMemdup(item, value->value, value->length + 1);
+    if (item->key == 0 || item->data == 0) {
+        mprFree(item);
+        ejsThrowMemoryError(ejs);
+        return 0;
+    }
+    item->length = value->length;
+    item->size = (int) (sizeof(EjsWebCacheItem) + strlen(item->key) + value->length);
+    item->isString = ejsIsString(argv[2]);
+    item->expires = (lifetime > 0) ? (mprGetTime(ejs) + (MprTime) lifetime * MPR_TICKS_PER_SEC) : 0;
+
+    shard = getShard(store, item->key);
+    maxMemory = store->maxMemory / EJS_WEB_CACHE_SHARDS;
 
-    value = (EjsVar*) ejsSerialize(master, argv[2], 0, 0, 0);
-    ejsSetPropertyByName(master, cp->cache, ejsName(&qname, domain, key), value);
-    ejsUnlockVm(master);
+    mprLock(shard->mutex);
+    if ((prior = (EjsWebCacheItem*) mprLookupHash(shard->items, item->key)) != 0) {
+        removeItem(shard, prior);
+    }
+    if (item->size > maxMemory) {
+        /* Too big to ever fit. Discard rather than flush the entire shard. */
+        shard->evictions++;
+        mprFree(item);
+    } else {
+        while (shard->memory + item->size > maxMemory && shard->lru.prev != &shard->lru) {
+            removeItem(shard, shard->lru.prev);
+            shard->evictions++;
+        }
+        mprAddHash(shard->items, item->key, item);
+        linkItem(shard, item);
+        shard->memory += item->size;
+    }
+    mprUnlock(shard->mutex);
     return 0;
 }
 
 
+/*
+ *  Create the process wide cache store on first use
+ */
+static EjsWebCacheStore *getCacheStore(MprCtx ctx)
+{
+    EjsWebCacheStore    *store;
+    EjsWebCacheShard    *shard;
+    Mpr                 *mpr;
+    int                 i;
+
+    if (cacheStore) {
+        return cacheStore;
+    }
+    mpr = mprGetMpr(ctx);
+    mprGlobalLock(mpr);
+    if (cacheStore == 0) {
+        if ((store = mprAllocObjZeroed(mpr, EjsWebCacheStore)) != 0) {
+            store->maxMemory = EJS_WEB_CACHE_MEMORY;
+            for (i = 0; i < EJS_WEB_CACHE_SHARDS; i++) {
+                shard = &store->shards[i];
+                shard->items = mprCreateHash(store, 0);
+                shard->mutex = mprCreateLock(store);
+                shard->lru.next = shard->lru.prev = &shard->lru;
+            }
+            cacheStore = store;
+        }
+    }
+    mprGlobalUnlock(mpr);
+    return cacheStore;
+}
+
+
+static EjsWebCacheShard *getShard(EjsWebCacheStore *store, cchar *key)
+{
+    uint    hash;
+
+    for (hash = 0; *key; key++) {
+        hash = (hash * 33) + (uchar) *key;
+    }
+    return &store->shards[hash & (EJS_WEB_CACHE_SHARDS - 1)];
+}
+
+
+static void linkItem(EjsWebCacheShard *shard, EjsWebCacheItem *item)
+{
+    item->next = shard->lru.next;
+    item->prev = &shard->lru;
+    shard->lru.next->prev = item;
+    shard->lru.next = item;
+}
+
+
+static void unlinkItem(EjsWebCacheItem *item)
+{
+    item->prev->next = item->next;
+    item->next->prev = item->prev;
+}
+
+
+/*
+ *  Remove an item from its shard and free it. Must hold the shard lock.
+ */
+static void removeItem(EjsWebCacheShard *shard, EjsWebCacheItem *item)
+{
+    unlinkItem(item);
+    mprRemoveHash(shard->items, item->key);
+    shard->memory -= item->size;
+    mprFree(item);
+}
+
+
+void ejsSetWebCacheLimits(MprCtx ctx, int64 maxMemory)
+{
+    EjsWebCacheStore    *store;
+
+    if ((store = getCacheStore(ctx)) != 0 && maxMemory > 0) {
+        store->maxMemory = maxMemory;
+    }
+}
+
+
+void ejsGetWebCacheStats(MprCtx ctx, int64 *hits, int64 *misses, int64 *evictions, int64 *memory)
+{
+    EjsWebCacheShard    *shard;
+    int                 i;
+
+    *hits = *misses = *evictions = *memory = 0;
+    if (cacheStore == 0) {
+        return;
+    }
+    for (i = 0; i < EJS_WEB_CACHE_SHARDS; i++) {
+        shard = &cacheStore->shards[i];
+        mprLock(shard->mutex);
+        *hits += shard->hits;
+        *misses += shard->misses;
+        *evictions += shard->evictions;
+        *memory += shard->memory;
+        mprUnlock(shard->mutex);
+    }
+}
+
+
 void ejsConfigureWebCacheType(Ejs *ejs)
 {
     EjsType     *type;
@@ -34115,6 +36834,22 @@ static EjsVar *writeMethod(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
 }
 
 
+/*
+ *  Write an object to the client as JSON. Output is passed to the web server in chunks as it is serialized.
+ *
+ *  function writeJSON(data: Object): Void
+ */
+static EjsVar *writeJSON(Ejs *ejs, EjsVar *unused, int argc, EjsVar **argv)
+{
+    mprAssert(argc == 1);
+
+    if (ejsWriteJson(ejs, argv[0], ejsWriteBlock) < 0 && !ejs->exception) {
+        ejsThrowIOError(ejs, "Can't write JSON to client");
+    }
+    return 0;
+}
+
+
 /*
  *  The controller type is a scripted class augmented by native methods.
  */
@@ -34144,6 +36879,7 @@ void ejsConfigureWebControllerType(Ejs *ejs)
     ejsBindMethod(ejs, type, ES_ejs_web_Controller_ejs_web_setHttpCode, (EjsNativeFunction) setHttpCode);
     ejsBindMethod(ejs, type, ES_ejs_web_Controller_ejs_web_setMimeType, (EjsNativeFunction) setMimeType);
     ejsBindMethod(ejs, type, ES_ejs_web_Controller_ejs_web_write, (EjsNativeFunction) writeMethod);
+    ejsBindMethod(ejs, type, ES_ejs_web_Controller_ejs_web_writeJSON, (EjsNativeFunction) writeJSON);
 }
 
 #endif /* BLD_FEATURE_EJS_WEB */
@@ -34224,18 +36960,51 @@ static EjsWebControl *webControl;
 #endif
 
 #if AUTO_COMPILE
-static int  compile(EjsWeb *web, cchar *shell, cchar *kind, cchar *name);
+/*
+ *  Modules to preload when compiling pages. Same as "ejsc --web".
+ */
+#if BLD_FEATURE_EJS_DB
+    #define EJS_WEB_COMPILE_MODULES "ejs.db ejs.web"
+#else
+    #define EJS_WEB_COMPILE_MODULES "ejs.web"
+#endif
+
+#define EJS_WEB_DEFAULT_LAYOUT  "views/layouts/default.ejs"
+
+static int  compile(EjsWeb *web, cchar *kind, cchar *name, cchar *module, cchar *source, int force);
 static char *locateShell(EjsWeb *web);
 #endif
 
+/*
+ *  Component module loaded by a pooled interpreter
+ */
+typedef struct EjsWebModule {
+    char        *source;                /* Source file (may be null) */
+    MprTime     mtime;                  /* Module modification time when loaded */
+} EjsWebModule;
+
 static int caselessmatch(cchar *url, cchar *ext);
+static bool checkedRecently(EjsWeb *web, cchar *module);
+static void collectInterp(EjsWebInterp *interp, MprWorker *worker);
 static void createCookie(Ejs *ejs, EjsVar *cookies, cchar *name, cchar *value, cchar *domain, cchar *path);
+static void gcTimer(EjsWebControl *control, MprEvent *event);
+static EjsWebInterp *getInterp(EjsWeb *web, cchar *searchPath);
+static char *getSourcePath(EjsWeb *web, cchar *kind, cchar *module, cchar *sourceExtension);
+static bool holdsMutableState(Ejs *ejs, int first);
 static int  initInterp(Ejs *ejs, EjsWebControl *control);
+static bool isMutable(EjsVar *vp);
 static int  loadApplication(EjsWeb *web);
 static int  loadController(EjsWeb *web);
 static int  loadComponent(EjsWeb *web, cchar *kind, cchar *name, cchar *sourceExtension);
 static int  build(EjsWeb *web, cchar *kind, cchar *name, cchar *module, cchar *sourceExtension, int force);
 static int  parseControllerAction(EjsWeb *web);
+static bool needsCollection(Ejs *ejs);
+static void poolInterp(EjsWebInterp *interp);
+static void recordModule(EjsWeb *web, cchar *kind, cchar *module, cchar *sourceExtension, int globalCount);
+static void releaseInterp(EjsWeb *web);
+static void setChecked(EjsWeb *web, cchar *module);
+static bool validInterp(EjsWebControl *control, EjsWebInterp *interp);
+static int  webDestructor(EjsWeb *web);
 
 /*
  *  Create and configure web framework types
@@ -34296,6 +37065,12 @@ int ejsOpenWebFramework(EjsWebControl *control, bool useMaster)
         if (initInterp(control->master, control) < 0) {
             return MPR_ERR_CANT_INITIALIZE;
         }
+        if (ejsCreateWebSessionStore(control) < 0) {
+            return MPR_ERR_NO_MEMORY;
+        }
+        control->pools = mprCreateHash(control, 0);
+        control->poolMutex = mprCreateLock(control);
+        control->checked = mprCreateHash(control, 0);
     }
     webControl = control;
     return 0;
@@ -34304,8 +37079,6 @@ int ejsOpenWebFramework(EjsWebControl *control, bool useMaster)
 
 static int initInterp(Ejs *ejs, EjsWebControl *control)
 {
-    EjsVar      *sessions;
-
 #if !BLD_FEATURE_STATIC
     if (ejsLoadModule(ejs, "ejs.web", -1, -1, 0, NULL) < 0) {
         mprError(control, "Can't load ejs.web.mod: %s", ejsGetErrorMsg(ejs, 1));
@@ -34325,16 +37098,6 @@ static int initInterp(Ejs *ejs, EjsWebControl *control)
 #endif
 #endif
     control->sessionTimeout = EJS_SESSION_TIMEOUT;
-#if ES_ejs_web_sessions
-    sessions = ejsGetProperty(ejs, ejs->global, ES_ejs_web_sessions);
-#else
-{
-    EjsName qname;
-    sessions = ejsGetPropertyByName(ejs, ejs->global, ejsName(&qname, "ejs.web", "sessions"));
-}
-#endif
-    ejs->sessions = sessions;
-    control->sessions = (EjsObject*) sessions;
     ejs->dontExit = 1;
     return 0;
 }
@@ -34364,7 +37127,7 @@ EjsWeb *ejsCreateWebRequest(MprCtx ctx, EjsWebControl *control, void *handle, cc
     EjsWeb          *web;
     cchar           *appUrl;
 
-    web = (EjsWeb*) mprAllocObjZeroed(ctx, EjsWeb);
+    web = (EjsWeb*) mprAllocObjWithDestructorZeroed(ctx, EjsWeb, webDestructor);
     if (web == 0) {
         return 0;
     }
@@ -34385,7 +37148,14 @@ EjsWeb *ejsCreateWebRequest(MprCtx ctx, EjsWebControl *control, void *handle, cc
 
     mprLog(ctx, 3, "ejs: CreateWebRequest: AppDir %s, AppUrl %s, URL %s", web->appDir, web->appUrl, web->url);
 
-    if (control->master) {
+    if (control->master && control->poolMax > 0) {
+        if ((web->interp = getInterp(web, searchPath)) == 0) {
+            mprFree(web);
+            return 0;
+        }
+        ejs = web->ejs = web->interp->ejs;
+
+    } else if (control->master) {
         ejs = web->ejs = ejsCreate(ctx, control->master, searchPath, 0);
         ejs->master = control->master;
     } else {
@@ -34404,6 +37174,272 @@ EjsWeb *ejsCreateWebRequest(MprCtx ctx, EjsWebControl *control, void *handle, cc
 }
 
 
+static int webDestructor(EjsWeb *web)
+{
+    if (web->interp) {
+        releaseInterp(web);
+    }
+    return 0;
+}
+
+
+/*
+ *  Get an interpreter from the application's pool or clone a new interpreter from the master. Pooled interpreters 
+ *  are only reused if none of the component modules they have loaded have since changed.
+ */
+static EjsWebInterp *getInterp(EjsWeb *web, cchar *searchPath)
+{
+    EjsWebControl   *control;
+    EjsWebInterp    *interp;
+    MprList         *pool;
+    MprHeap         *heap;
+    char            *key;
+
+    control = web->control;
+    key = mprStrcat(web, -1, web->appDir, MPR_SEARCH_SEP, searchPath, NULL);
+
+    /*
+     *  The pool lock only guards the pool lists. Interpreters are validated (which may stat files) and freed unlocked.
+     */
+    for (;;) {
+        mprLock(control->poolMutex);
+        if ((pool = (MprList*) mprLookupHash(control->pools, key)) == 0) {
+            pool = mprCreateList(control->pools);
+            mprAddHash(control->pools, key, pool);
+        }
+        if ((interp = mprGetLastItem(pool)) != 0) {
+            mprRemoveLastItem(pool);
+        }
+        mprUnlock(control->poolMutex);
+        if (interp == 0 || validInterp(control, interp)) {
+            break;
+        }
+        mprLog(web, 4, "ejs: Discard pooled interpreter for %s, modules have changed", web->appDir);
+        mprFree(interp->heap);
+    }
+    mprFree(key);
+    mprLock(control->poolMutex);
+    if (interp) {
+        control->poolHits++;
+        mprUnlock(control->poolMutex);
+        interp->requests++;
+        return interp;
+    }
+    control->poolMisses++;
+    heap = mprAllocHeap(control, "Ejs Interpreter", 1, 0, NULL);
+    mprUnlock(control->poolMutex);
+
+    if (heap == 0 || (interp = mprAllocObjZeroed(heap, EjsWebInterp)) == 0) {
+        mprFree(heap);
+        return 0;
+    }
+    interp->heap = heap;
+    interp->control = control;
+    interp->pool = pool;
+    interp->modules = mprCreateHash(interp, 0);
+    interp->requests = 1;
+    if ((interp->ejs = ejsCreate(heap, control->master, searchPath, 0)) == 0) {
+        mprFree(heap);
+        return 0;
+    }
+    interp->ejs->master = control->master;
+    ejsSaveGlobalState(interp->ejs);
+    return interp;
+}
+
+
+/*
+ *  Test if the component modules loaded by a pooled interpreter are still current
+ */
+static bool validInterp(EjsWebControl *control, EjsWebInterp *interp)
+{
+    EjsWebModule    *mp;
+    MprHash         *hp;
+    MprPath         info;
+    MprTime         now;
+
+    now = mprGetTime(interp);
+    if (control->checkInterval > 0 && (now - interp->checked) < control->checkInterval) {
+        return 1;
+    }
+    for (hp = mprGetFirstHash(interp->modules); hp; hp = mprGetNextHash(interp->modules, hp)) {
+        mp = (EjsWebModule*) hp->data;
+        if (mprGetPathInfo(interp, hp->key, &info) < 0 || !info.valid || info.mtime != mp->mtime) {
+            return 0;
+        }
+#if AUTO_COMPILE
+        if (mp->source && mprGetPathInfo(interp, mp->source, &info) == 0 && info.valid && info.mtime > mp->mtime) {
+            return 0;
+        }
+#endif
+    }
+    interp->checked = now;
+    return 1;
+}
+
+
+/*
+ *  Reset a pooled interpreter and return it to its pool. Transient globals are removed and saved globals and type 
+ *  properties restored. The garbage left by the request is collected on a worker thread before the interpreter rejoins
+ *  the pool, so the collection is off the request path. If no worker is free, the interpreter is pooled immediately
+ *  and collected in steps by gcTimer while the server is idle. Interpreters that failed, loaded modules outside of the component loader,
+ *  loaded modules holding mutable state (see recordModule) or have served their quota are discarded.
+ */
+static void releaseInterp(EjsWeb *web)
+{
+    EjsWebInterp    *interp;
+    Ejs             *ejs;
+
+    interp = web->interp;
+    ejs = interp->ejs;
+    web->interp = 0;
+
+    if (web->error || ejs->exception || interp->requests >= EJS_WEB_POOL_MAX_REQUESTS) {
+        interp->retire = 1;
+    }
+    if (mprGetListCount(ejs->modules) > ejs->savedModuleCount) {
+        /*
+         *  Modules loaded by the request itself can be forgotten but not freed. Don't let them accumulate.
+         */
+        interp->retire = 1;
+    }
+    if (interp->retire) {
+        mprFree(interp->heap);
+        return;
+    }
+    ejsSetHandle(ejs, 0);
+    ejs->result = 0;
+    ejs->exceptionArg = 0;
+    ejsRestoreGlobalState(ejs);
+    if (mprStartWorker(interp->control, (MprWorkerProc) collectInterp, (void*) interp, MPR_NORMAL_PRIORITY) < 0) {
+        ejs->gcRequired = 1;
+        ejs->attention = 1;
+        poolInterp(interp);
+    }
+}
+
+
+/*
+ *  Worker to collect a released interpreter and then pool it
+ */
+static void collectInterp(EjsWebInterp *interp, MprWorker *worker)
+{
+    ejsCollectGarbage(interp->ejs, EJS_GEN_ETERNAL);
+    poolInterp(interp);
+}
+
+
+static void poolInterp(EjsWebInterp *interp)
+{
+    EjsWebControl   *control;
+
+    control = interp->control;
+    mprLock(control->poolMutex);
+    if (mprGetListCount(interp->pool) < control->poolMax) {
+        mprAddItem(interp->pool, interp);
+        if (needsCollection(interp->ejs) && control->gcTimer == 0) {
+            control->gcTimer = mprCreateTimerEvent(mprGetDispatcher(control), (MprEventProc) gcTimer, 
+                EJS_WEB_GC_PERIOD, MPR_NORMAL_PRIORITY, control, MPR_EVENT_CONTINUOUS);
+        }
+        interp = 0;
+    }
+    mprUnlock(control->poolMutex);
+    if (interp) {
+        mprFree(interp->heap);
+    }
+}
+
+
+/*
+ *  Test if an interpreter has garbage waiting to be collected or a collection in progress
+ */
+static bool needsCollection(Ejs *ejs)
+{
+    return ejs->gcRequired || ejs->gc.clearing || ejs->gc.marking || ejs->gc.sweeping;
+}
+
+
+/*
+ *  Step the pending collections of pooled interpreters while the server is idle. This is the web server equivalent
+ *  of the idle collection done by ejsServiceEvents. Interpreters are taken from their pools while being collected so
+ *  requests can't use them at the same time. The timer stops when no pooled interpreter has collection work.
+ */
+static void gcTimer(EjsWebControl *control, MprEvent *event)
+{
+    MprDispatcher   *dispatcher;
+    EjsWebInterp    *interp;
+    MprList         *pool, *collect;
+    MprHash         *hp;
+    Ejs             *ejs;
+    int             next, pending;
+
+    dispatcher = mprGetDispatcher(control);
+    if ((collect = mprCreateList(control)) == 0) {
+        return;
+    }
+    mprLock(control->poolMutex);
+    for (hp = mprGetFirstHash(control->pools); hp; hp = mprGetNextHash(control->pools, hp)) {
+        pool = (MprList*) hp->data;
+        for (next = 0; (interp = mprGetNextItem(pool, &next)) != 0; ) {
+            if (needsCollection(interp->ejs)) {
+                mprRemoveItem(pool, interp);
+                mprAddItem(collect, interp);
+                next--;
+            }
+        }
+    }
+    mprUnlock(control->poolMutex);
+
+    for (next = 0; (interp = mprGetNextItem(collect, &next)) != 0; ) {
+        ejs = interp->ejs;
+        while (mprGetIdleTime(dispatcher) > ejs->gc.pauseBudget && !ejsStepGarbage(ejs, EJS_GEN_NEW)) {
+            ;
+        }
+        poolInterp(interp);
+    }
+    mprFree(collect);
+
+    /*
+     *  Rescan under the lock as other threads may have pooled interpreters with work since the first scan
+     */
+    pending = 0;
+    mprLock(control->poolMutex);
+    for (hp = mprGetFirstHash(control->pools); hp && !pending; hp = mprGetNextHash(control->pools, hp)) {
+        pool = (MprList*) hp->data;
+        for (next = 0; (interp = mprGetNextItem(pool, &next)) != 0 && !pending; ) {
+            pending = needsCollection(interp->ejs);
+        }
+    }
+    if (!pending && control->gcTimer == event) {
+        control->gcTimer = 0;
+        mprFree(event);
+    }
+    mprUnlock(control->poolMutex);
+}
+
+
+/*
+ *  Return the interpreter pool statistics
+ */
+void ejsGetWebPoolStats(EjsWebControl *control, int64 *hits, int64 *misses, int *idle)
+{
+    MprHash     *hp;
+
+    *hits = *misses = 0;
+    *idle = 0;
+    if (control->pools == 0) {
+        return;
+    }
+    mprLock(control->poolMutex);
+    *hits = control->poolHits;
+    *misses = control->poolMisses;
+    for (hp = mprGetFirstHash(control->pools); hp; hp = mprGetNextHash(control->pools, hp)) {
+        *idle += mprGetListCount((MprList*) hp->data);
+    }
+    mprUnlock(control->poolMutex);
+}
+
+
 /*
  *  Parse the request URI and create the controller and action names. URI is in the form: "controller/action"
  */
@@ -34642,29 +37678,40 @@ static int loadComponent(EjsWeb *web, cchar *kind, cchar *name, cchar *sourceExt
 {
     Ejs         *ejs;
     char        *module, *pluralKind, *soloPage;
-    int         rc, retry, loaded;
+    int         rc, retry, loaded, globalCount;
 
     ejs = web->ejs;
     module = 0;
     rc = 0;
 
+    if (strcmp(kind, "app") == 0) {
+        module = mprJoinPath(web, web->appDir, "App" EJS_MODULE_EXT);
+    } else if (*kind) {
+        /* Note we pluralize the kind (e.g. view to views) */
+        pluralKind = mprStrcat(web, -1, kind, "s", NULL);
+        module = mprJoinPathExt(web, mprJoinPath(web, mprJoinPath(web, web->appDir, pluralKind), name), EJS_MODULE_EXT);
+        mprFree(pluralKind);
+    } else {
+        module = mprJoinPathExt(web, mprJoinPath(web, web->appDir, name), EJS_MODULE_EXT);
+    }
+    if (web->interp && mprLookupHash(web->interp->modules, module)) {
+        /* Already loaded by this pooled interpreter and validated when the interpreter was taken from the pool */
+        mprFree(module);
+        return 0;
+    }
+    globalCount = ejsGetPropertyCount(ejs, ejs->global);
+
     for (loaded = retry = 0; retry < 2 && !loaded; retry++) {
         if (strcmp(kind, "app") == 0) {
-            module = mprJoinPath(web, web->appDir, "App" EJS_MODULE_EXT);
             rc = build(web, kind, NULL, module, sourceExtension, retry);
 
         } else if (*kind) {
-            /* Note we pluralize the kind (e.g. view to views) */
-            pluralKind = mprStrcat(web, -1, kind, "s", NULL);
-            module = mprJoinPathExt(web, mprJoinPath(web, mprJoinPath(web, web->appDir, pluralKind), name), EJS_MODULE_EXT);
             rc = build(web, kind, name, module, sourceExtension, retry);
-            mprFree(pluralKind);
 
         } else {
             /*
              *  Solo web pages
              */
-            module = mprJoinPathExt(web, mprJoinPath(web, web->appDir, name), EJS_MODULE_EXT);
             soloPage = mprJoinPathExt(web, mprGetNativePath(web, name), sourceExtension);
             rc = build(web, kind, soloPage, module, sourceExtension, retry);
             mprFree(soloPage);
@@ -34684,11 +37731,112 @@ static int loadComponent(EjsWeb *web, cchar *kind, cchar *name, cchar *sourceExt
             loaded = 1;
         }
     }
+    if (loaded && web->interp) {
+        recordModule(web, kind, module, sourceExtension, globalCount);
+    }
     mprFree(module);
     return rc;
 }
 
 
+/*
+ *  Record a component module loaded by a pooled interpreter so it can be revalidated when the interpreter is reused.
+ *  The module's global definitions become part of the interpreter's saved global state. Globals the request defined 
+ *  before the module was loaded precede the module's definitions and can't be moved as type IDs are slot numbers. 
+ *  These are saved too, but with undefined values so no request state is carried over.
+ */
+static void recordModule(EjsWeb *web, cchar *kind, cchar *module, cchar *sourceExtension, int globalCount)
+{
+    Ejs             *ejs;
+    EjsWebInterp    *interp;
+    EjsWebModule    *mp;
+    MprPath         info;
+    int             first, i;
+
+    ejs = web->ejs;
+    interp = web->interp;
+    first = ejs->globalStateCount;
+    if (ejsSaveGlobalState(ejs) < 0) {
+        interp->retire = 1;
+        return;
+    }
+    for (i = first; i < globalCount; i++) {
+        ejs->globalState[i] = ejs->undefinedValue;
+    }
+    if (holdsMutableState(ejs, first)) {
+        /*
+         *  Saved state is restored by reference. A request could modify these objects and the next request would 
+         *  see the changes, so the interpreter must not be reused.
+         */
+        mprLog(web, 4, "ejs: Module %s holds mutable state, interpreter will not be pooled", module);
+        interp->retire = 1;
+    }
+
+    if ((mp = mprAllocObjZeroed(interp->modules, EjsWebModule)) == 0) {
+        interp->retire = 1;
+        return;
+    }
+    mprGetPathInfo(web, module, &info);
+    mp->mtime = info.mtime;
+#if AUTO_COMPILE
+    mp->source = getSourcePath(web, kind, module, sourceExtension);
+    mprStealBlock(mp, mp->source);
+#endif
+    mprAddHash(interp->modules, module, mp);
+}
+
+
+/*
+ *  Test if a value is an object a request could modify. Values shared with the master are not considered as they are
+ *  shared by all interpreters whether pooled or not.
+ */
+static bool isMutable(EjsVar *vp)
+{
+    if (vp == 0 || vp->master || ejsIsType(vp)) {
+        return 0;
+    }
+    return !(ejsIsFunction(vp) || ejsIsString(vp) || ejsIsNumber(vp) || ejsIsBoolean(vp) || ejsIsNull(vp) || 
+        ejsIsUndefined(vp) || ejsIsNamespace(vp));
+}
+
+
+/*
+ *  Test if the saved globals from the given slot onward or the saved type properties reference mutable objects
+ */
+static bool holdsMutableState(Ejs *ejs, int first)
+{
+    EjsSavedBlock   *sp;
+    int             i, j;
+
+    for (i = first; i < ejs->globalStateCount; i++) {
+        if (isMutable(ejs->globalState[i])) {
+            return 1;
+        }
+    }
+    for (i = 0; i < ejs->savedBlockCount; i++) {
+        sp = &ejs->savedBlocks[i];
+        for (j = 0; j < sp->numProp; j++) {
+            if (isMutable(sp->slots[j])) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+/*
+ *  Return the source file for a component module
+ */
+static char *getSourcePath(EjsWeb *web, cchar *kind, cchar *module, cchar *sourceExtension)
+{
+    if (strcmp(kind, "app") == 0) {
+        return mprJoinPath(web, web->appDir, "src/App.es");
+    }
+    return mprJoinPathExt(web, mprTrimPathExtension(web, module), sourceExtension);
+}
+
+
 #if AUTO_COMPILE
 /*
  *  Find the ejs program
@@ -34709,11 +37857,11 @@ static char *locateShell(EjsWeb *web)
 
 
 /*
- *  Compile a component into a loadable module. Return true if the compile succeeded.
+ *  Compile a component by running the ejsweb program. Used if the compiler is not linked with the web server or if 
+ *  the application defines its own compiler command via config/compiler.ecf. Return zero if the compile succeeded.
  */
-static int compile(EjsWeb *web, cchar *shell, cchar *kind, cchar *name)
+static int runCompiler(EjsWeb *web, cchar *shell, cchar *kind, cchar *name)
 {
-    Ejs         *ejs;
     MprCmd      *cmd;
     char        *commandLine, *err, *dir, *ejsweb;
     int         status;
@@ -34736,25 +37884,294 @@ static int compile(EjsWeb *web, cchar *shell, cchar *kind, cchar *name)
     } else {
         commandLine = mprAsprintf(web, -1, "\"%s\" \"%s\" --quiet compile %s \"%s\"", shell, ejsweb, kind, name);
     }
-    ejs = (web->ejs->master) ? web->ejs->master : web->ejs;
-
-    /*
-     *  Must be thread-safe so that multiple threads don't try to compile the same file
-     */
-    lock(ejs);
     mprLog(web, 3, "ejs cmd: cd %s; %s", web->appDir, commandLine);
     status = mprRunCmd(cmd, commandLine, NULL, &err, 0);
     if (status) {
         web->error = mprStrdup(web, err);
         mprLog(web, 3, "Compilation failure for %s\n%s", commandLine, err);
     }
-    unlock(ejs);
     mprFree(cmd);
     return status;
 }
+
+
+/*
+ *  Add the Ejscript source files under an application directory to the list of files to compile
+ */
+static void addSourceFiles(EjsWeb *web, MprList *files, cchar *dir, cchar *suffix)
+{
+    MprDirEntry     *dp;
+    MprList         *entries;
+    char            *path;
+    int             next, len;
+
+    if (suffix == 0) {
+        suffix = ".es";
+    }
+    entries = mprGetPathFiles(files, dir, 1);
+    for (next = 0; entries && (dp = mprGetNextItem(entries, &next)) != 0; ) {
+        path = mprJoinPath(files, dir, dp->name);
+        if (dp->isDir) {
+            addSourceFiles(web, files, path, suffix);
+            continue;
+        }
+        len = (int) strlen(path) - (int) strlen(suffix);
+        if (len >= 0 && strcmp(&path[len], suffix) == 0) {
+            mprAddItem(files, path);
+        }
+    }
+    mprFree(entries);
+}
+
+
+/*
+ *  Convert an Ejs page into a view class and write it to an Ejscript source file. The page is parsed by the ejs.web 
+ *  EjsParser class, which is the same parser used by the ejsweb program. Views are compiled with the application and 
+ *  their controller, which is built first if required. Stand-alone pages in an application are compiled with the 
+ *  application.
+ */
+static char *buildPageSource(EjsWeb *web, cchar *kind, cchar *name, cchar *source, MprList *files)
+{
+    Ejs         *ejs;
+    EjsName     qname;
+    EjsVar      *parser, *fun, *result, *argv[5];
+    MprFile     *file;
+    char        *controller, *controllerSource, *controllerModule, *view, *prefix, *layout, *script, *path, *cp;
+    int         len;
+
+    ejs = web->ejs;
+    layout = 0;
+    if (strcmp(kind, "view") == 0) {
+        /* Views are named "controller/view" */
+        controller = mprStrdup(files, name);
+        if ((cp = strpbrk(controller, "/\\")) != 0) {
+            *cp = '\0';
+        }
+        controller[0] = toupper((int) controller[0]);
+        view = mprGetPathBase(files, name);
+        prefix = mprStrcat(files, -1, controller, "_", NULL);
+        path = mprJoinPath(files, web->appDir, EJS_WEB_DEFAULT_LAYOUT);
+        if (mprPathExists(files, path, R_OK)) {
+            layout = path;
+        }
+        controllerModule = mprJoinPathExt(files, mprJoinPath(files, mprJoinPath(files, web->appDir, "controllers"), 
+            controller), EJS_MODULE_EXT);
+        controllerSource = mprJoinPathExt(files, mprTrimPathExtension(files, controllerModule), ".es");
+        if (!mprPathExists(files, controllerSource, R_OK)) {
+            web->error = mprAsprintf(web, -1, "Can't find controller %s for view %s", controllerSource, source);
+            return 0;
+        }
+        if (build(web, "controller", controller, controllerModule, ".es", 0) < 0) {
+            return 0;
+        }
+        mprAddItem(files, mprJoinPath(files, web->appDir, "App" EJS_MODULE_EXT));
+        mprAddItem(files, controllerModule);
+
+    } else {
+        /* Solo pages are named by their path relative to the application directory */
+        view = mprTrimPathExtension(files, name);
+        for (cp = view; *cp; cp++) {
+            if (*cp == '/' || *cp == '\\') {
+                *cp = '_';
+            }
+        }
+        prefix = "_Solo_";
+        if (web->flags & EJS_WEB_FLAG_APP) {
+            mprAddItem(files, mprJoinPath(files, web->appDir, "App" EJS_MODULE_EXT));
+        }
+    }
+
+    parser = ejsGetPropertyByName(ejs, ejs->global, ejsName(&qname, "ejs.web", "EjsParser"));
+    fun = (parser) ? ejsGetPropertyByName(ejs, parser, ejsName(&qname, EJS_PUBLIC_NAMESPACE, "buildView")) : 0;
+    if (fun == 0 || !ejsIsFunction(fun)) {
+        web->error = mprStrdup(web, "Can't find the ejs.web EjsParser class");
+        return 0;
+    }
+    argv[0] = (EjsVar*) ejsCreateString(ejs, source);
+    argv[1] = (EjsVar*) ejsCreateString(ejs, web->appDir);
+    argv[2] = (layout) ? (EjsVar*) ejsCreateString(ejs, layout) : ejs->undefinedValue;
+    argv[3] = (EjsVar*) ejsCreateString(ejs, prefix);
+    argv[4] = (EjsVar*) ejsCreateString(ejs, view);
+    result = ejsRunFunction(ejs, (EjsFunction*) fun, parser, 5, argv);
+    if (ejs->exception || result == 0 || !ejsIsString(result)) {
+        web->error = mprAsprintf(web, -1, "Can't parse page %s\n%s", source, ejsGetErrorMsg(ejs, 0));
+        ejsClearException(ejs);
+        return 0;
+    }
+    script = ((EjsString*) result)->value;
+
+    path = mprJoinPathExt(web, mprTrimPathExtension(files, source), ".es");
+    if ((file = mprOpen(web, path, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, EJS_FILE_PERMS)) == 0) {
+        web->error = mprAsprintf(web, -1, "Can't write %s. Ensure directory is writable.", path);
+        mprFree(path);
+        return 0;
+    }
+    len = (int) strlen(script);
+    if (mprWrite(file, script, len) != len) {
+        web->error = mprAsprintf(web, -1, "Can't write %s", path);
+        mprFree(file);
+        mprDeletePath(web, path);
+        mprFree(path);
+        return 0;
+    }
+    mprFree(file);
+    mprAddItem(files, path);
+    return path;
+}
+
+
+/*
+ *  Compile a component into a loadable module using the compiler linked with the web server. The module is written 
+ *  to a temporary file and renamed into place so that other requests never load a partially written module.
+ *  Return zero if the compile succeeded.
+ */
+static int compileModule(EjsWeb *web, cchar *kind, cchar *name, cchar *module, cchar *source)
+{
+    Ejs         *ejs;
+    MprList     *files;
+    char        *out, *page;
+    int         rc;
+
+    ejs = web->ejs;
+    files = mprCreateList(web);
+    page = 0;
+
+    if (strcmp(kind, "app") == 0) {
+        addSourceFiles(web, files, mprJoinPath(files, web->appDir, "config"), NULL);
+        addSourceFiles(web, files, mprJoinPath(files, web->appDir, "src"), NULL);
+        addSourceFiles(web, files, mprJoinPath(files, web->appDir, "models"), NULL);
+        addSourceFiles(web, files, mprJoinPath(files, web->appDir, "controllers"), "Base.es");
+
+    } else if (strcmp(kind, "controller") == 0) {
+        mprAddItem(files, source);
+
+    } else if ((page = buildPageSource(web, kind, name, source, files)) == 0) {
+        mprFree(files);
+        return MPR_ERR_CANT_CREATE;
+    }
+    if (mprGetListCount(files) == 0) {
+        web->error = mprAsprintf(web, -1, "No source files to compile for %s", module);
+        mprFree(files);
+        return MPR_ERR_NOT_FOUND;
+    }
+    out = mprJoinPathExt(files, mprTrimPathExtension(files, module), ".tmod");
+
+    mprLog(web, 3, "ejs: Compile %s", module);
+    rc = ejs->service->compileModule(ejs, out, EJS_WEB_COMPILE_MODULES, files->length, (char**) files->items);
+    if (rc < 0) {
+        web->error = mprStrdup(web, ejsGetErrorMsg(ejs, 0));
+        mprLog(web, 3, "Compilation failure for %s\n%s", module, web->error);
+        ejsClearException(ejs);
+        mprDeletePath(web, out);
+
+    } else {
+        mprDeletePath(web, module);
+        if (rename(out, module) < 0) {
+            web->error = mprAsprintf(web, -1, "Can't rename %s to %s", out, module);
+            mprDeletePath(web, out);
+            rc = MPR_ERR_CANT_WRITE;
+        }
+    }
+    if (page) {
+        mprDeletePath(web, page);
+        mprFree(page);
+    }
+    mprFree(files);
+    return rc;
+}
+
+
+/*
+ *  Compile a component into a loadable module. Compiles are serialized and a module that was rebuilt by another 
+ *  request while waiting is not compiled again. Return zero if the compile succeeded.
+ */
+static int compile(EjsWeb *web, cchar *kind, cchar *name, cchar *module, cchar *source, int force)
+{
+    Ejs         *ejs;
+    MprPath     moduleInfo, sourceInfo;
+    char        *shell, *ecf;
+    int         rc;
+
+    ejs = (web->ejs->master) ? web->ejs->master : web->ejs;
+    rc = 0;
+
+    /*
+     *  Must be thread-safe so that multiple threads don't try to compile the same file
+     */
+    lock(ejs);
+    mprGetPathInfo(web, module, &moduleInfo);
+    mprGetPathInfo(web, source, &sourceInfo);
+    if (!force && moduleInfo.valid && sourceInfo.valid && sourceInfo.mtime <= moduleInfo.mtime) {
+        mprLog(web, 5, "Using module %s - compiled by another request", module);
+        unlock(ejs);
+        return 0;
+    }
+    ecf = mprJoinPath(web, web->appDir, "config/compiler.ecf");
+    if (web->ejs->service->compileModule && !mprPathExists(web, ecf, R_OK)) {
+        rc = compileModule(web, kind, name, module, source);
+
+    } else if ((shell = locateShell(web)) == 0) {
+        if (!moduleInfo.valid) {
+            mprError(web, "Can't find shell: %s to compile %s", EJS_EJSWEB_EXE, source);
+            rc = MPR_ERR_CANT_ACCESS;
+        } else {
+            /* Use existing module even though out of date -- no shell */
+            mprLog(web, 5, "Using module %s - missing shell", module);
+        }
+
+    } else if (runCompiler(web, shell, kind, name) != 0) {
+        rc = MPR_ERR_BAD_STATE;
+    }
+    unlock(ejs);
+    mprFree(ecf);
+    return rc;
+}
 #endif /* AUTO_COMPILE */
 
 
+/*
+ *  Test if a module was found to be current within the check interval
+ */
+static bool checkedRecently(EjsWeb *web, cchar *module)
+{
+    EjsWebControl   *control;
+    MprTime         *when;
+    bool            recent;
+
+    control = web->control;
+    if (control->checkInterval <= 0 || control->checked == 0) {
+        return 0;
+    }
+    mprLock(control->poolMutex);
+    when = (MprTime*) mprLookupHash(control->checked, module);
+    recent = when && (mprGetTime(web) - *when) < control->checkInterval;
+    mprUnlock(control->poolMutex);
+    return recent;
+}
+
+
+static void setChecked(EjsWeb *web, cchar *module)
+{
+    EjsWebControl   *control;
+    MprTime         *when;
+
+    control = web->control;
+    if (control->checkInterval <= 0 || control->checked == 0) {
+        return;
+    }
+    mprLock(control->poolMutex);
+    if ((when = (MprTime*) mprLookupHash(control->checked, module)) == 0) {
+        if ((when = mprAllocObj(control->checked, MprTime)) != 0) {
+            mprAddHash(control->checked, module, when);
+        }
+    }
+    if (when) {
+        *when = mprGetTime(web);
+    }
+    mprUnlock(control->poolMutex);
+}
+
+
 /*
  *  Build a resource.
  *  Path has a ".mod" extension.
@@ -34765,18 +38182,17 @@ static int build(EjsWeb *web, cchar *kind, cchar *name, cchar *module, cchar *so
     int         rc;
 
     rc = 0;
+    if (!force && checkedRecently(web, module)) {
+        return 0;
+    }
     mprGetPathInfo(web, module, &moduleInfo);
 
 #if AUTO_COMPILE
 {
     MprPath     sourceInfo;
-    char        *source, *shell;
+    char        *source;
 
-    if (strcmp(kind, "app") == 0) {
-        source = mprJoinPath(web, web->appDir, "src/App.es");
-    } else {
-        source = mprJoinPathExt(web, mprTrimPathExtension(web, module), sourceExtension);
-    }
+    source = getSourcePath(web, kind, module, sourceExtension);
     mprGetPathInfo(web, source, &sourceInfo);
 
     if (!moduleInfo.valid && !sourceInfo.valid) {
@@ -34794,17 +38210,7 @@ static int build(EjsWeb *web, cchar *kind, cchar *name, cchar *module, cchar *so
 
     } else {
         /* Either module out of date or not present with source present or forced rebuild */
-        if ((shell = locateShell(web)) == 0) {
-            if (!moduleInfo.valid) {
-                mprError(web, "Can't find shell: %s to compile %s", EJS_EJSWEB_EXE, source);
-                return MPR_ERR_CANT_ACCESS;
-            }
-            mprLog(web, 5, "Using module %s - missing shell", module);
-            /* Use existing module even though out of date -- no shell */
-
-        } else if (compile(web, shell, kind, name) != 0) {
-            rc = MPR_ERR_BAD_STATE;
-        }
+        rc = compile(web, kind, name, module, source, force);
     }
     mprFree(source);
 }
@@ -34814,6 +38220,9 @@ static int build(EjsWeb *web, cchar *kind, cchar *name, cchar *module, cchar *so
         rc = MPR_ERR_NOT_FOUND;
     }
 #endif
+    if (rc == 0) {
+        setChecked(web, module);
+    }
     return rc;
 }
 
@@ -35800,161 +39209,790 @@ void ejsConfigureWebResponseType(Ejs *ejs)
 
 #if BLD_FEATURE_EJS_WEB
 
-static void sessionActivity(Ejs *ejs, EjsWebSession *sp);
+#if BLD_FEATURE_SQLITE
+#include    "sqlite3.h"
+#endif
+
+/*
+ *  Session state is held in a native store outside any interpreter. Each request sees a Session object in its own
+ *  interpreter whose properties read and write the store. Property values are stored serialized.
+ *
+ *  The store is sharded by session ID. Each shard has a timing wheel with one bucket per timer period. Activity only
+ *  updates the expiry time. When a bucket comes due, sessions that are still active are moved to a later bucket.
+ */
+typedef struct EjsWebSessionData {
+    struct EjsWebSessionData *next;         /* Timing wheel bucket links */
+    struct EjsWebSessionData *prev;
+    char            *id;                    /* Session ID */
+    MprHashTable    *values;                /* Serialized property values indexed by name */
+    MprTime         expire;                 /* When the session expires */
+    MprTime         saved;                  /* Expiry time last written to the backing store */
+    int             timeout;                /* Inactivity timeout in seconds */
+    int             bucket;                 /* Timing wheel bucket */
+    bool            dirty;                  /* Modified since last written to the backing store */
+} EjsWebSessionData;
+
+typedef struct EjsWebSessionShard {
+    MprMutex            *mutex;             /* Multithread sync for this shard */
+    MprHashTable        *sessions;          /* Sessions indexed by ID */
+    EjsWebSessionData   *wheel[EJS_SESSION_WHEEL];  /* Timing wheel expiry buckets */
+    MprList             *dirty;             /* IDs of sessions to write to the backing store */
+    MprList             *deleted;           /* IDs of sessions to delete from the backing store */
+    int                 count;              /* Number of sessions */
+} EjsWebSessionShard;
+
+typedef struct EjsWebSessionStore {
+    EjsWebSessionShard  shards[EJS_SESSION_SHARDS];
+    MprMutex            *mutex;             /* Sync for the timer, session ID counter and backing store */
+    MprTime             lastTick;           /* Last timing wheel tick processed */
+    int                 nextSession;        /* Session ID counter */
+    bool                flushing;           /* A write-behind flush is in progress */
+#if BLD_FEATURE_SQLITE
+    sqlite3             *db;                /* Backing store. Null if sessions are not persisted. */
+#endif
+} EjsWebSessionStore;
+
+/*
+ *  Snapshot of a session to write to the backing store
+ */
+typedef struct EjsWebSessionRow {
+    char            *id;
+    MprHashTable    *values;                /* Null if the session is to be deleted */
+    MprTime         expire;
+    int             timeout;
+} EjsWebSessionRow;
+
+#define wheelBucket(when) ((int) (((when) / EJS_TIMER_PERIOD) % EJS_SESSION_WHEEL))
+
+static void collectSessionRows(EjsWebSessionShard *shard, MprList *rows);
+static EjsWebSessionData *createSessionData(EjsWebSessionStore *store, cchar *id, int timeout, MprTime expire);
+static EjsWebSession *createSessionObject(Ejs *ejs, EjsWebSessionStore *store, cchar *id);
+#if BLD_FEATURE_SQLITE
+static void flushSessions(MprList *rows, MprWorker *worker);
+#endif
+static EjsWebSessionShard *getSessionShard(EjsWebSessionStore *store, cchar *id);
+static EjsType *getSessionType(Ejs *ejs);
+static void linkSession(EjsWebSessionShard *shard, EjsWebSessionData *data);
+static void markSessionDirty(EjsWebSessionShard *shard, EjsWebSessionData *data);
+static EjsWebSessionData *lookupSession(EjsWebSessionStore *store, EjsWebSessionShard *shard, cchar *id, MprTime now);
+static void removeSession(EjsWebSessionStore *store, EjsWebSessionShard *shard, EjsWebSessionData *data);
+static void sessionActivity(EjsWebSessionStore *store, EjsWebSessionShard *shard, EjsWebSessionData *data, 
+        MprTime now);
 static void sessionTimer(EjsWebControl *control, MprEvent *event);
+static void startSessionTimer(EjsWebControl *control);
+static void unlinkSession(EjsWebSessionShard *shard, EjsWebSessionData *data);
 
 
-static EjsVar *getSessionProperty(Ejs *ejs, EjsWebSession *sp, int slotNum)
+static EjsVar *getSessionValue(Ejs *ejs, EjsWebSession *sp, cchar *name)
 {
-    EjsVar      *vp;
-    EjsWeb      *web;
-    Ejs         *master;
+    EjsWebSessionStore  *store;
+    EjsWebSessionShard  *shard;
+    EjsWebSessionData   *data;
+    EjsWeb              *web;
+    EjsVar              *vp;
+    cchar               *value;
 
     web = ejs->handle;
-    if (web->session != sp) {
+    if (web->session != sp || name == 0) {
         return (EjsVar*) ejs->emptyStringValue;
     }
+    store = web->control->sessionStore;
+    shard = getSessionShard(store, sp->id);
+    vp = 0;
 
-    master = ejs->master ? ejs->master : ejs;
-    ejsLockVm(master);
+    mprLock(shard->mutex);
+    if ((data = lookupSession(store, shard, sp->id, mprGetTime(ejs))) != 0) {
+        if ((value = mprLookupHash(data->values, name)) != 0) {
+            vp = (EjsVar*) ejsCreateString(ejs, value);
+        }
+        sessionActivity(store, shard, data, mprGetTime(ejs));
+    }
+    mprUnlock(shard->mutex);
 
-    vp = ejs->objectHelpers->getProperty(ejs, (EjsVar*) sp, slotNum);
     if (vp) {
         vp = ejsDeserialize(ejs, (EjsString*) vp);
     }
-    if (vp == ejs->undefinedValue) {
+    if (vp == 0 || vp == ejs->undefinedValue) {
+        /*
+         *  Return empty string so that web pages can access session values without having to test for null/undefined
+         */
         vp = (EjsVar*) ejs->emptyStringValue;
     }
-    sessionActivity(ejs, sp);
-    ejsUnlockVm(master);
     return vp;
 }
 
 
-static EjsVar *getSessionPropertyByName(Ejs *ejs, EjsWebSession *sp, EjsName *qname)
+/*
+ *  Update a session value. Set value to null to remove the value.
+ */
+static int setSessionValue(Ejs *ejs, EjsWebSession *sp, cchar *name, EjsVar *value)
 {
-    EjsVar      *vp;
-    EjsWeb      *web;
-    Ejs         *master;
-    int         slotNum;
+    EjsWebSessionStore  *store;
+    EjsWebSessionShard  *shard;
+    EjsWebSessionData   *data;
+    EjsWeb              *web;
+    EjsString           *str;
+    char                *prior;
 
     web = ejs->handle;
-    if (web->session != sp) {
-        return (EjsVar*) ejs->emptyStringValue;
+    if (web->session != sp || name == 0) {
+        mprAssert(0);
+        return EJS_ERR;
     }
-    qname->space = EJS_EMPTY_NAMESPACE;
-
-    master = ejs->master ? ejs->master : ejs;
-    ejsLockVm(master);
+    str = 0;
+    if (value && (str = (EjsString*) ejsSerialize(ejs, value, 0, 0, 0)) == 0) {
+        return EJS_ERR;
+    }
+    store = web->control->sessionStore;
+    shard = getSessionShard(store, sp->id);
 
-    slotNum = ejs->objectHelpers->lookupProperty(ejs, (EjsVar*) sp, qname);
-    if (slotNum < 0) {
-        /*
-         *  Return empty string so that web pages can access session values without having to test for null/undefined
-         */
-        vp = (EjsVar*) ejs->emptyStringValue;
-    } else {
-        vp = ejs->objectHelpers->getProperty(ejs, (EjsVar*) sp, slotNum);
-        if (vp) {
-            vp = ejsDeserialize(ejs, (EjsString*) vp);
+    mprLock(shard->mutex);
+    if ((data = lookupSession(store, shard, sp->id, mprGetTime(ejs))) != 0) {
+        prior = (char*) mprLookupHash(data->values, name);
+        if (str) {
+            mprAddHash(data->values, name, mprStrdup(data->values, str->value));
+        } else {
+            mprRemoveHash(data->values, name);
         }
+        mprFree(prior);
+        sessionActivity(store, shard, data, mprGetTime(ejs));
+        markSessionDirty(shard, data);
     }
-    sessionActivity(ejs, sp);
-    ejsUnlockVm(master);
-    return vp;
+    mprUnlock(shard->mutex);
+    return 0;
+}
+
+
+static EjsVar *getSessionProperty(Ejs *ejs, EjsWebSession *sp, int slotNum)
+{
+    EjsName     qname;
+
+    qname = ejs->objectHelpers->getPropertyName(ejs, (EjsVar*) sp, slotNum);
+    return getSessionValue(ejs, sp, qname.name);
+}
+
+
+static EjsVar *getSessionPropertyByName(Ejs *ejs, EjsWebSession *sp, EjsName *qname)
+{
+    return getSessionValue(ejs, sp, qname->name);
 }
 
 
 static int setSessionProperty(Ejs *ejs, EjsWebSession *sp, int slotNum, EjsVar *value)
 {
-    Ejs     *master;
-    EjsWeb  *web;
-    
-    web = ejs->handle;
-    if (web->session != sp) {
-        mprAssert(0);
+    EjsName     qname;
+
+    qname = ejs->objectHelpers->getPropertyName(ejs, (EjsVar*) sp, slotNum);
+    if (qname.name == 0 || setSessionValue(ejs, sp, qname.name, value) < 0) {
         return EJS_ERR;
     }
+    return slotNum;
+}
 
-    /*
-     *  Allocate the serialized object using the master interpreter
-     */
-    master = ejs->master ? ejs->master : ejs;
-    ejsLockVm(master);
 
-    value = (EjsVar*) ejsSerialize(master, value, 0, 0, 0);
-    slotNum = master->objectHelpers->setProperty(master, (EjsVar*) sp, slotNum, value);
-    sessionActivity(ejs, sp);
-    ejsUnlockVm(master);
+/*
+ *  Values are kept in the store. The local object only records property names so sessions can be enumerated.
+ */
+static int setSessionPropertyByName(Ejs *ejs, EjsWebSession *sp, EjsName *qname, EjsVar *value)
+{
+    EjsName     local;
+    int         slotNum;
+
+    if (setSessionValue(ejs, sp, qname->name, value) < 0) {
+        return EJS_ERR;
+    }
+    ejsName(&local, EJS_EMPTY_NAMESPACE, qname->name);
+    slotNum = ejs->objectHelpers->lookupProperty(ejs, (EjsVar*) sp, &local);
+    if (slotNum < 0) {
+        slotNum = ejs->objectHelpers->setProperty(ejs, (EjsVar*) sp, -1, ejs->nullValue);
+        if (slotNum >= 0) {
+            local.name = mprStrdup(sp, qname->name);
+            sp->obj.var.noPool = 1;
+            ejs->objectHelpers->setPropertyName(ejs, (EjsVar*) sp, slotNum, &local);
+        }
+    }
     return slotNum;
 }
 
 
+static int deleteSessionPropertyByName(Ejs *ejs, EjsWebSession *sp, EjsName *qname)
+{
+    EjsName     local;
+
+    setSessionValue(ejs, sp, qname->name, NULL);
+    ejsName(&local, EJS_EMPTY_NAMESPACE, qname->name);
+    ejs->objectHelpers->deletePropertyByName(ejs, (EjsVar*) sp, &local);
+    return 0;
+}
+
+
 /*
- *  Update the session expiration time due to activity
+ *  Update the session expiration time due to activity. The session stays in its wheel bucket until that comes due.
+ *  For persisted sessions, rewrite the expiry time once it has moved by a quarter of the timeout.
  */
-static void sessionActivity(Ejs *ejs, EjsWebSession *sp)
+static void sessionActivity(EjsWebSessionStore *store, EjsWebSessionShard *shard, EjsWebSessionData *data, MprTime now)
 {
-    sp->expire = mprGetTime(ejs) + sp->timeout * MPR_TICKS_PER_SEC;
+    data->expire = now + data->timeout * MPR_TICKS_PER_SEC;
+    if ((data->expire - data->saved) > data->timeout * (MPR_TICKS_PER_SEC / 4)) {
+        markSessionDirty(shard, data);
+    }
+}
+
+
+/*
+ *  Queue a session to be written to the backing store, if sessions are being persisted
+ */
+static void markSessionDirty(EjsWebSessionShard *shard, EjsWebSessionData *data)
+{
+    if (shard->dirty && !data->dirty) {
+        data->dirty = 1;
+        mprAddItem(shard->dirty, mprStrdup(shard->dirty, data->id));
+    }
+}
+
+
+static EjsWebSessionShard *getSessionShard(EjsWebSessionStore *store, cchar *id)
+{
+    uint    hash;
+
+    for (hash = 0; *id; id++) {
+        hash = (hash * 33) + (uchar) *id;
+    }
+    return &store->shards[hash & (EJS_SESSION_SHARDS - 1)];
 }
 
 
 /*
- *  Check for expired sessions
+ *  Find a session. Expired sessions are removed. Must hold the shard lock.
+ */
+static EjsWebSessionData *lookupSession(EjsWebSessionStore *store, EjsWebSessionShard *shard, cchar *id, MprTime now)
+{
+    EjsWebSessionData   *data;
+
+    data = (EjsWebSessionData*) mprLookupHash(shard->sessions, id);
+    if (data && data->expire <= now) {
+        removeSession(store, shard, data);
+        data = 0;
+    }
+    return data;
+}
+
+
+static void linkSession(EjsWebSessionShard *shard, EjsWebSessionData *data)
+{
+    data->bucket = wheelBucket(data->expire);
+    data->prev = 0;
+    data->next = shard->wheel[data->bucket];
+    if (data->next) {
+        data->next->prev = data;
+    }
+    shard->wheel[data->bucket] = data;
+}
+
+
+static void unlinkSession(EjsWebSessionShard *shard, EjsWebSessionData *data)
+{
+    if (data->prev) {
+        data->prev->next = data->next;
+    } else {
+        shard->wheel[data->bucket] = data->next;
+    }
+    if (data->next) {
+        data->next->prev = data->prev;
+    }
+}
+
+
+/*
+ *  Remove a session from the store and free it. Must hold the shard lock.
+ */
+static void removeSession(EjsWebSessionStore *store, EjsWebSessionShard *shard, EjsWebSessionData *data)
+{
+    mprLog(store, 4, "Remove session %s", data->id);
+    unlinkSession(shard, data);
+    mprRemoveHash(shard->sessions, data->id);
+    if (shard->deleted) {
+        mprAddItem(shard->deleted, mprStrdup(shard->deleted, data->id));
+    }
+    shard->count--;
+    mprFree(data);
+}
+
+
+static EjsWebSessionData *createSessionData(EjsWebSessionStore *store, cchar *id, int timeout, MprTime expire)
+{
+    EjsWebSessionShard  *shard;
+    EjsWebSessionData   *data;
+
+    shard = getSessionShard(store, id);
+    if ((data = mprAllocObjZeroed(store, EjsWebSessionData)) == 0) {
+        return 0;
+    }
+    data->id = mprStrdup(data, id);
+    data->values = mprCreateHash(data, 0);
+    data->timeout = timeout;
+    data->expire = expire;
+
+    mprLock(shard->mutex);
+    mprAddHash(shard->sessions, data->id, data);
+    linkSession(shard, data);
+    shard->count++;
+    mprUnlock(shard->mutex);
+    return data;
+}
+
+
+/*
+ *  Process timing wheel buckets that have come due. Also start writing modified sessions to the backing store.
  */
 static void sessionTimer(EjsWebControl *control, MprEvent *event)
 {
-    Ejs             *master;
-    EjsObject       *sessions;
-    EjsWebSession   *session;
-    MprTime         now;
-    int             i, count, deleted;
+    EjsWebSessionStore  *store;
+    EjsWebSessionShard  *shard;
+    EjsWebSessionData   *data, *nextData;
+    MprList             *rows;
+    MprTime             now, tick, t;
+    int                 i, bucket, count, pending;
 
+    store = control->sessionStore;
     now = mprGetTime(control);
 
-    sessions = control->sessions;
-    master = control->master;
-    if (master == 0) {
-        mprAssert(master);
-        return;
-    }
+    /*
+     *  Only process buckets for periods that have fully elapsed. Sessions in the current period's bucket may not be
+     *  due until the end of the period and would otherwise wait a full turn of the wheel.
+     */
+    tick = now / EJS_TIMER_PERIOD - 1;
 
     /*
      *  This could be on the primary event thread. Can't block long.
      */
-    if (mprTryLock(master->mutex)) {
-        count = ejsGetPropertyCount(master, (EjsVar*) sessions);
-        deleted = 0;
-        for (i = count - 1; i >= 0; i--) {
-            session = (EjsWebSession*) ejsGetProperty(master, (EjsVar*) sessions, i);
-            if (session->obj.var.type == control->sessionType) {
-                if (session && session->expire <= now) {
-                    ejsDeleteProperty(master, (EjsVar*) sessions, i);
-                    ejsRemoveSlot(master, sessions, i, 1);
-                    deleted++;
+    if (!mprTryLock(store->mutex)) {
+        return;
+    }
+    if (store->lastTick == 0 || (tick - store->lastTick) > EJS_SESSION_WHEEL) {
+        store->lastTick = tick - EJS_SESSION_WHEEL;
+    }
+    rows = (store->flushing) ? 0 : mprCreateList(store);
+    count = pending = 0;
+
+    for (i = 0; i < EJS_SESSION_SHARDS; i++) {
+        shard = &store->shards[i];
+        mprLock(shard->mutex);
+        for (t = store->lastTick + 1; t <= tick; t++) {
+            bucket = (int) (t % EJS_SESSION_WHEEL);
+            for (data = shard->wheel[bucket]; data; data = nextData) {
+                nextData = data->next;
+                if (data->expire <= now) {
+                    removeSession(store, shard, data);
+                } else if (wheelBucket(data->expire) != bucket) {
+                    unlinkSession(shard, data);
+                    linkSession(shard, data);
                 }
             }
         }
-        if (deleted) {
-            ejsCollectGarbage(master, EJS_GEN_NEW);
+        if (shard->dirty) {
+            if (rows) {
+                collectSessionRows(shard, rows);
+            }
+            pending += mprGetListCount(shard->dirty) + mprGetListCount(shard->deleted);
+        }
+        count += shard->count;
+        mprUnlock(shard->mutex);
+    }
+    store->lastTick = tick;
+
+#if BLD_FEATURE_SQLITE
+    if (rows && mprGetListCount(rows) > 0) {
+        store->flushing = 1;
+        if (mprStartWorker(store, (MprWorkerProc) flushSessions, (void*) rows, MPR_NORMAL_PRIORITY) < 0) {
+            store->flushing = 0;
+            mprFree(rows);
+        }
+    } else
+#endif
+    mprFree(rows);
+    if (count == 0 && pending == 0 && !store->flushing) {
+        control->sessionTimer = 0;
+        mprFree(event);
+    }
+    mprUnlock(store->mutex);
+}
+
+
+/*
+ *  Snapshot the dirty and deleted sessions of a shard into rows for the backing store. Must hold the shard lock.
+ */
+static void collectSessionRows(EjsWebSessionShard *shard, MprList *rows)
+{
+    EjsWebSessionData   *data;
+    EjsWebSessionRow    *row;
+    MprHash             *hp;
+    cchar               *id;
+    int                 next;
+
+    for (next = 0; (id = mprGetNextItem(shard->dirty, &next)) != 0; ) {
+        data = (EjsWebSessionData*) mprLookupHash(shard->sessions, id);
+        if (data && (row = mprAllocObjZeroed(rows, EjsWebSessionRow)) != 0) {
+            row->id = mprStrdup(row, data->id);
+            row->expire = data->expire;
+            row->timeout = data->timeout;
+            row->values = mprCreateHash(row, 0);
+            for (hp = mprGetFirstHash(data->values); hp; hp = mprGetNextHash(data->values, hp)) {
+                mprAddHash(row->values, hp->key, mprStrdup(row->values, hp->data));
+            }
+            mprAddItem(rows, row);
+            data->dirty = 0;
+            data->saved = data->expire;
         }
-        if (count == 0) {
-            control->sessionTimer = 0;
-            mprFree(event);
+        mprFree((char*) id);
+    }
+    for (next = 0; (id = mprGetNextItem(shard->deleted, &next)) != 0; ) {
+        if ((row = mprAllocObjZeroed(rows, EjsWebSessionRow)) != 0) {
+            row->id = mprStrdup(row, id);
+            mprAddItem(rows, row);
         }
-        mprUnlock(master->mutex);
+        mprFree((char*) id);
     }
+    mprClearList(shard->dirty);
+    mprClearList(shard->deleted);
 }
 
 
-void ejsParseWebSessionCookie(EjsWeb *web)
+/*
+ *  Must hold the store lock
+ */
+static void startSessionTimer(EjsWebControl *control)
 {
+    if (control->sessionTimer == 0) {
+        control->sessionTimer = mprCreateTimerEvent(mprGetDispatcher(control), (MprEventProc) sessionTimer, 
+            EJS_TIMER_PERIOD, MPR_NORMAL_PRIORITY, control, MPR_EVENT_CONTINUOUS);
+    }
+}
+
+
+#if BLD_FEATURE_SQLITE
+static int execSql(sqlite3 *db, cchar *sql)
+{
+    char    *msg;
+
+    if (sqlite3_exec(db, sql, NULL, NULL, &msg) != SQLITE_OK) {
+        mprError(mprGetMpr(NULL), "Session store SQL error: %s", msg);
+        sqlite3_free(msg);
+        return MPR_ERR_CANT_WRITE;
+    }
+    return 0;
+}
+
+
+/*
+ *  Write session snapshots to the backing store. This runs on a worker thread so requests never wait on the database.
+ */
+static void flushSessions(MprList *rows, MprWorker *worker)
+{
+    EjsWebSessionStore  *store;
+    EjsWebSessionRow    *row;
+    sqlite3             *db;
+    sqlite3_stmt        *save, *remove, *removeValues, *saveValue;
+    MprHash             *hp;
+    int                 next;
+
+    store = (EjsWebSessionStore*) mprGetParent(rows);
+    db = store->db;
+    save = remove = removeValues = saveValue = 0;
+
+    if (execSql(db, "BEGIN") == 0 &&
+            sqlite3_prepare_v2(db, "INSERT OR REPLACE INTO sessions (id, expire, timeout) VALUES (?, ?, ?)", -1, 
+                &save, NULL) == SQLITE_OK &&
+            sqlite3_prepare_v2(db, "DELETE FROM sessions WHERE id = ?", -1, &remove, NULL) == SQLITE_OK &&
+            sqlite3_prepare_v2(db, "DELETE FROM sessionValues WHERE id = ?", -1, &removeValues, NULL) == SQLITE_OK &&
+            sqlite3_prepare_v2(db, "INSERT INTO sessionValues (id, name, value) VALUES (?, ?, ?)", -1, 
+                &saveValue, NULL) == SQLITE_OK) {
+        for (next = 0; (row = mprGetNextItem(rows, &next)) != 0; ) {
+            sqlite3_bind_text(removeValues, 1, row->id, -1, SQLITE_STATIC);
+            sqlite3_step(removeValues);
+            sqlite3_reset(removeValues);
+            if (row->values == 0) {
+                sqlite3_bind_text(remove, 1, row->id, -1, SQLITE_STATIC);
+                sqlite3_step(remove);
+                sqlite3_reset(remove);
+                continue;
+            }
+            sqlite3_bind_text(save, 1, row->id, -1, SQLITE_STATIC);
+            sqlite3_bind_int64(save, 2, row->expire);
+            sqlite3_bind_int(save, 3, row->timeout);
+            sqlite3_step(save);
+            sqlite3_reset(save);
+            for (hp = mprGetFirstHash(row->values); hp; hp = mprGetNextHash(row->values, hp)) {
+                sqlite3_bind_text(saveValue, 1, row->id, -1, SQLITE_STATIC);
+                sqlite3_bind_text(saveValue, 2, hp->key, -1, SQLITE_STATIC);
+                sqlite3_bind_text(saveValue, 3, hp->data, -1, SQLITE_STATIC);
+                sqlite3_step(saveValue);
+                sqlite3_reset(saveValue);
+            }
+        }
+        execSql(db, "COMMIT");
+    } else {
+        mprError(store, "Can't write sessions: %s", sqlite3_errmsg(db));
+        execSql(db, "ROLLBACK");
+    }
+    sqlite3_finalize(save);
+    sqlite3_finalize(remove);
+    sqlite3_finalize(removeValues);
+    sqlite3_finalize(saveValue);
+
+    mprLock(store->mutex);
+    store->flushing = 0;
+    mprUnlock(store->mutex);
+    mprFree(rows);
+}
+
+
+/*
+ *  Persist sessions in a SQLite database. Unexpired sessions saved by a prior run are restored. Changes are written
+ *  behind by the session timer.
+ */
+int ejsOpenWebSessionStore(EjsWebControl *control, cchar *path)
+{
+    EjsWebSessionStore  *store;
+    EjsWebSessionShard  *shard;
+    EjsWebSessionData   *data;
+    sqlite3             *db;
+    sqlite3_stmt        *stmt;
+    char                *sql;
+    int                 i, count;
+
+    if ((store = control->sessionStore) == 0) {
+        return MPR_ERR_BAD_STATE;
+    }
+    if (sqlite3_open(path, &db) != SQLITE_OK) {
+        mprError(control, "Can't open session store %s", path);
+        sqlite3_close(db);
+        return MPR_ERR_CANT_OPEN;
+    }
+    sqlite3_busy_timeout(db, EJS_SQLITE_TIMEOUT);
+    sql = mprAsprintf(control, -1, 
+        "CREATE TABLE IF NOT EXISTS sessions (id TEXT PRIMARY KEY, expire INTEGER, timeout INTEGER);"
+        "CREATE TABLE IF NOT EXISTS sessionValues (id TEXT, name TEXT, value TEXT, PRIMARY KEY (id, name));"
+        "DELETE FROM sessions WHERE expire <= %Ld;"
+        "DELETE FROM sessionValues WHERE id NOT IN (SELECT id FROM sessions);", mprGetTime(control));
+    if (execSql(db, sql) < 0) {
+        mprFree(sql);
+        sqlite3_close(db);
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    mprFree(sql);
+
+    /*
+     *  Restore saved sessions
+     */
+    count = 0;
+    if (sqlite3_prepare_v2(db, "SELECT id, expire, timeout FROM sessions", -1, &stmt, NULL) == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            data = createSessionData(store, (cchar*) sqlite3_column_text(stmt, 0), sqlite3_column_int(stmt, 2), 
+                sqlite3_column_int64(stmt, 1));
+            if (data) {
+                data->saved = data->expire;
+                count++;
+            }
+        }
+        sqlite3_finalize(stmt);
+    }
+    if (sqlite3_prepare_v2(db, "SELECT id, name, value FROM sessionValues", -1, &stmt, NULL) == SQLITE_OK) {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            shard = getSessionShard(store, (cchar*) sqlite3_column_text(stmt, 0));
+            data = (EjsWebSessionData*) mprLookupHash(shard->sessions, (cchar*) sqlite3_column_text(stmt, 0));
+            if (data) {
+                mprAddHash(data->values, (cchar*) sqlite3_column_text(stmt, 1), 
+                    mprStrdup(data->values, (cchar*) sqlite3_column_text(stmt, 2)));
+            }
+        }
+        sqlite3_finalize(stmt);
+    }
+    mprLog(control, 2, "Restored %d sessions from %s", count, path);
+
+    mprLock(store->mutex);
+    for (i = 0; i < EJS_SESSION_SHARDS; i++) {
+        shard = &store->shards[i];
+        shard->dirty = mprCreateList(store);
+        shard->deleted = mprCreateList(store);
+    }
+    store->db = db;
+    if (count > 0) {
+        startSessionTimer(control);
+    }
+    mprUnlock(store->mutex);
+    return 0;
+}
+
+
+/*
+ *  Write back all sessions not yet saved by the session timer and close the backing store. Called when the service
+ *  stops after the worker threads have exited, so the writes are done synchronously.
+ */
+void ejsCloseWebSessionStore(EjsWebControl *control)
+{
+    EjsWebSessionStore  *store;
+    EjsWebSessionShard  *shard;
+    MprList             *rows;
+    MprTime             mark;
+    int                 i;
+
+    if ((store = control->sessionStore) == 0 || store->db == 0) {
+        return;
+    }
+    /*
+     *  Wait for a write started by the session timer to complete
+     */
+    mark = mprGetTime(control);
+    mprLock(store->mutex);
+    while (store->flushing && mprGetElapsedTime(control, mark) < MPR_TIMEOUT_STOP_TASK) {
+        mprUnlock(store->mutex);
+        mprSleep(control, 10);
+        mprLock(store->mutex);
+    }
+    if (store->flushing) {
+        mprError(control, "Session store is busy. Unsaved sessions are discarded");
+        mprUnlock(store->mutex);
+        return;
+    }
+    if ((rows = mprCreateList(store)) != 0) {
+        for (i = 0; i < EJS_SESSION_SHARDS; i++) {
+            shard = &store->shards[i];
+            mprLock(shard->mutex);
+            collectSessionRows(shard, rows);
+            mprFree(shard->dirty);
+            mprFree(shard->deleted);
+            shard->dirty = shard->deleted = 0;
+            mprUnlock(shard->mutex);
+        }
+        mprLog(control, 2, "Saving %d sessions", mprGetListCount(rows));
+        flushSessions(rows, NULL);
+    }
+    sqlite3_close(store->db);
+    store->db = 0;
+    mprUnlock(store->mutex);
+}
+#endif /* BLD_FEATURE_SQLITE */
+
+
+/*
+ *  Create the session store. Sessions are only supported when using a master interpreter.
+ */
+int ejsCreateWebSessionStore(EjsWebControl *control)
+{
+    EjsWebSessionStore  *store;
+    EjsWebSessionShard  *shard;
+    int                 i;
+
+    if ((store = mprAllocObjZeroed(control, EjsWebSessionStore)) == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    store->mutex = mprCreateLock(store);
+    for (i = 0; i < EJS_SESSION_SHARDS; i++) {
+        shard = &store->shards[i];
+        shard->mutex = mprCreateLock(store);
+        shard->sessions = mprCreateHash(store, EJS_SESSION_HASH_SIZE);
+    }
+    control->sessionStore = store;
+    return 0;
+}
+
+
+int ejsGetWebSessionCount(EjsWebControl *control)
+{
+    EjsWebSessionStore  *store;
+    int                 i, count;
+
+    count = 0;
+    if ((store = control->sessionStore) != 0) {
+        for (i = 0; i < EJS_SESSION_SHARDS; i++) {
+            count += store->shards[i].count;
+        }
+    }
+    return count;
+}
+
+
+static EjsType *getSessionType(Ejs *ejs)
+{
+    EjsWebControl   *control;
     EjsName         qname;
+
+    control = ((EjsWeb*) ejsGetHandle(ejs))->control;
+    if (control->sessionType == 0) {
+#if ES_ejs_web_Session
+        control->sessionType = ejsGetType(ejs, ES_ejs_web_Session);
+#else
+        control->sessionType = (EjsType*) ejsGetPropertyByName(ejs, ejs->global, ejsName(&qname, "ejs.web", "Session"));
+#endif
+    }
+    return control->sessionType;
+}
+
+
+/*
+ *  Create the request's Session object for a stored session. Property names are defined locally so the session 
+ *  can be enumerated. Their values are always read from the store.
+ */
+static EjsWebSession *createSessionObject(Ejs *ejs, EjsWebSessionStore *store, cchar *id)
+{
+    EjsWebSessionShard  *shard;
+    EjsWebSessionData   *data;
+    EjsWebSession       *session;
+    EjsType             *sessionType;
+    EjsName             qname;
+    MprHash             *hp;
+    MprList             *names;
+    char                *name;
+    int                 next, slotNum, timeout;
+
+    if ((sessionType = getSessionType(ejs)) == 0) {
+        mprAssert(0);
+        return 0;
+    }
+    names = mprCreateList(ejs);
+    shard = getSessionShard(store, id);
+
+    mprLock(shard->mutex);
+    if ((data = lookupSession(store, shard, id, mprGetTime(ejs))) == 0) {
+        mprUnlock(shard->mutex);
+        mprFree(names);
+        return 0;
+    }
+    for (hp = mprGetFirstHash(data->values); hp; hp = mprGetNextHash(data->values, hp)) {
+        mprAddItem(names, mprStrdup(names, hp->key));
+    }
+    timeout = data->timeout;
+    sessionActivity(store, shard, data, mprGetTime(ejs));
+    mprUnlock(shard->mutex);
+
+    if ((session = (EjsWebSession*) ejsCreateObject(ejs, sessionType, 0)) == 0) {
+        mprFree(names);
+        return 0;
+    }
+    session->id = mprStrdup(session, id);
+    session->timeout = timeout;
+    for (next = 0; (name = mprGetNextItem(names, &next)) != 0; ) {
+        slotNum = ejs->objectHelpers->setProperty(ejs, (EjsVar*) session, -1, ejs->nullValue);
+        if (slotNum >= 0) {
+            ejs->objectHelpers->setPropertyName(ejs, (EjsVar*) session, slotNum, 
+                ejsName(&qname, EJS_EMPTY_NAMESPACE, mprStrdup(session, name)));
+        }
+    }
+    session->obj.var.noPool = 1;
+    mprFree(names);
+    return session;
+}
+
+
+void ejsParseWebSessionCookie(EjsWeb *web)
+{
     EjsWebControl   *control;
     char            *cookie, *id, *cp, *value;
     int             quoted, len;
 
     cookie = web->cookie;
+    control = web->control;
 
     while (cookie && (value = strstr(cookie, EJS_SESSION)) != 0) {
         value += strlen(EJS_SESSION);
@@ -35977,129 +40015,97 @@ void ejsParseWebSessionCookie(EjsWeb *web)
                 }
             }
         }
-        control = web->control;
-
         len = (int) (cp - value);
         id = mprMemdup(web, value, len + 1);
         id[len] = '\0';
 
-        if (control->master) {
-            ejsName(&qname, "", id);
-            web->session = (EjsWebSession*) ejsGetPropertyByName(control->master, (EjsVar*) control->sessions, &qname);
+        if (control->sessionStore) {
+            web->session = createSessionObject(web->ejs, control->sessionStore, id);
         }
         mprFree(id);
         cookie = value;
     }
 }
 
+
 /*
- *  Create a new session object. This is created in the master interpreter and will persist past the life 
- *  of the current request. This will allocate a new session ID. Timeout is in seconds.
+ *  Create a new session. The session state is kept in the session store and will persist past the life of the 
+ *  current request. This will allocate a new session ID. Timeout is in seconds.
  */
 EjsWebSession *ejsCreateSession(Ejs *ejs, int timeout, bool secure)
 {
-    Ejs             *master;
-    EjsWeb          *web;
-    EjsWebControl   *control;
-    EjsWebSession   *session;
-    EjsType         *sessionType;
-    EjsName         qname;
-    EjsVar          *vp;
-    MprTime         now, expire;
-    char            idBuf[64], *id;
-    int             slotNum, next, count;
+    EjsWeb              *web;
+    EjsWebControl       *control;
+    EjsWebSessionStore  *store;
+    EjsWebSession       *session;
+    MprTime             now, expire;
+    char                idBuf[64], *id;
+    int                 next;
 
-    master = ejs->master;
-    if (master == 0) {
-        return 0;
-    }
     web = ejsGetHandle(ejs);
     control = web->control;
-
+    if ((store = control->sessionStore) == 0) {
+        return 0;
+    }
     if (timeout <= 0) {
         timeout = control->sessionTimeout;
     }
-
-#if ES_ejs_web_Session
-    sessionType = ejsGetType(ejs, ES_ejs_web_Session);
-#else
-    sessionType = (EjsType*) ejsGetPropertyByName(ejs, ejs->global, ejsName(&qname, "ejs.web", "Session"));
-#endif
-    if (sessionType == 0) {
-        mprAssert(0);
-        return 0;
-    }
-    web->control->sessionType = sessionType;
-
     now = mprGetTime(ejs);
     expire = now + timeout * MPR_TICKS_PER_SEC;
 
-    ejsLockVm(master);
-    web->session = session = (EjsWebSession*) ejsCreateObject(master, sessionType, 0);
-    if (session == 0) {
-        ejsUnlockVm(master);
-        return 0;
-    }
-    session->timeout = timeout;
-    session->expire = mprGetTime(ejs) + timeout * MPR_TICKS_PER_SEC;
+    mprLock(store->mutex);
+    next = store->nextSession++;
 
     /*
      *  Use an MD5 prefix of "x" to avoid the hash being interpreted as a numeric index.
      */
-    next = control->nextSession++;
     mprSprintf(idBuf, sizeof(idBuf), "%08x%08x%d", PTOI(ejs) + PTOI(web) + PTOI(expire), (int) now, next);
-    id = mprGetMD5Hash(session, idBuf, sizeof(idBuf), "x");
-    if (id == 0) {
-        mprFree(session);
-        ejsUnlockVm(master);
+    id = mprGetMD5Hash(web, idBuf, sizeof(idBuf), "x");
+    if (id == 0 || createSessionData(store, id, timeout, expire) == 0) {
+        mprUnlock(store->mutex);
+        mprFree(id);
         return 0;
     }
-    session->id = mprStrdup(session, id);
+    startSessionTimer(control);
+    mprUnlock(store->mutex);
 
-    /*
-        Scan for a null property or use next free slot
-     */
-    count = ejsGetPropertyCount(ejs, (EjsVar*) control->sessions);
-    for (slotNum = 0; slotNum < count; slotNum++) {
-        vp = ejsGetProperty(ejs, (EjsVar*) control->sessions, slotNum);
-        if (vp == 0 || vp == ejs->nullValue) {
-            break;
-        }
-    }
-    ejsSetProperty(control->master, (EjsVar*) control->sessions, slotNum, (EjsVar*) session);
-    ejsSetPropertyName(control->master, (EjsVar*) control->sessions, slotNum, EN(&qname, session->id));
-    session->index = slotNum;
-
-    if (control->sessionTimer == 0) {
-        control->sessionTimer = mprCreateTimerEvent(mprGetDispatcher(ejs), (MprEventProc) sessionTimer, EJS_TIMER_PERIOD, 
-            MPR_NORMAL_PRIORITY, control, MPR_EVENT_CONTINUOUS);
+    if ((session = createSessionObject(ejs, store, id)) == 0) {
+        mprFree(id);
+        return 0;
     }
-    ejsUnlockVm(master);
-
+    web->session = session;
     mprLog(ejs, 3, "Created new session %s", id);
 
     /*
      *  Create a cookie that will only live while the browser is not exited. (Set timeout to zero).
      */
     ejsSetCookie(ejs, EJS_SESSION, id, "/", NULL, 0, secure);
+    mprFree(id);
     return session;
 }
 
 
 bool ejsDestroySession(Ejs *ejs)
 {
-    EjsWeb          *web;
-    EjsWebControl   *control;
-    EjsName         qname;
-    int             rc;
+    EjsWeb              *web;
+    EjsWebSessionStore  *store;
+    EjsWebSessionShard  *shard;
+    EjsWebSessionData   *data;
+    int                 rc;
 
     web = ejs->handle;
-    control = web->control;
-
-    if (web->session == 0) {
+    if (web->session == 0 || (store = web->control->sessionStore) == 0) {
         return 0;
     }
-    rc = ejsDeletePropertyByName(control->master, (EjsVar*) control->sessions, ejsName(&qname, "", web->session->id));
+    shard = getSessionShard(store, web->session->id);
+    rc = 0;
+
+    mprLock(shard->mutex);
+    if ((data = (EjsWebSessionData*) mprLookupHash(shard->sessions, web->session->id)) != 0) {
+        removeSession(store, shard, data);
+        rc = 1;
+    }
+    mprUnlock(shard->mutex);
     web->session = 0;
     return rc;
 }
@@ -36137,9 +40143,12 @@ void ejsConfigureWebSessionType(Ejs *ejs)
     type->helpers->getProperty = (EjsGetPropertyHelper) getSessionProperty;
     type->helpers->getPropertyByName = (EjsGetPropertyByNameHelper) getSessionPropertyByName;
     type->helpers->setProperty = (EjsSetPropertyHelper) setSessionProperty;
+    type->helpers->setPropertyByName = (EjsSetPropertyByNameHelper) setSessionPropertyByName;
+    type->helpers->deletePropertyByName = (EjsDeletePropertyByNameHelper) deleteSessionPropertyByName;
     type->helpers->destroyVar = (EjsDestroyVarHelper) destroySession;
 }
 
+
 #endif /* BLD_FEATURE_EJS_WEB */
 
 /*
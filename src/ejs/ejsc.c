@@ -47,7 +47,7 @@ static int preloadModules(EcCompiler *cp, MprList *modules);
     EjsService      *vmService;
     MprList         *useModules;
     char            *argp, *searchPath, *outputFile, *certFile, *name, *tok, *modules, *spec;
-    int             nextArg, err, ejsFlags, ecFlags, bind, debug, doc, empty, merge;
+    int             nextArg, err, ejsFlags, ecFlags, bind, debug, doc, empty, merge, optimize;
     int             warnLevel, noout, parseOnly, tabWidth, optimizeLevel, compilerMode, strip, lang;
 
     /*
@@ -73,6 +73,7 @@ static int preloadModules(EcCompiler *cp, MprList *modules);
     empty = 0;
     merge = 0;
     noout = 0;
+    optimize = 0;
     parseOnly = 0;
     tabWidth = 4;
     warnLevel = 1;
@@ -139,9 +140,11 @@ static int preloadModules(EcCompiler *cp, MprList *modules);
             compilerMode = PRAGMA_MODE_STRICT;
 
         } else if (strcmp(argp, "--optimize") == 0) {
-            if (nextArg >= argc) {
-                err++;
-            } else {
+            /*
+             *  The level is optional. Explicitly requesting optimization also enables the byte code optimizer.
+             */
+            optimize = 1;
+            if ((nextArg + 1) < argc && isdigit((int) argv[nextArg + 1][0])) {
                 optimizeLevel = atoi(argv[++nextArg]);
             }
 
@@ -245,7 +248,7 @@ static int preloadModules(EcCompiler *cp, MprList *modules);
             "  --empty              # Create empty interpreter\n"
             "  --merge              # Merge dependent input modules into the output\n"
             "  --noout              # Do not generate any output\n"
-            "  --optimize level     # Set optimization level (0-9)\n"
+            "  --optimize [level]   # Optimize byte code and set optimization level (0-9)\n"
             "  --out filename       # Name a single output module (default: \"default.mod\")\n"
             "  --parse              # Just parse source. No output\n"
             "  --search ejsPath     # Module search path\n"
@@ -289,6 +292,7 @@ static int preloadModules(EcCompiler *cp, MprList *modules);
     ecFlags |= (merge) ? EC_FLAGS_MERGE: 0;
     ecFlags |= (bind) ? EC_FLAGS_BIND: 0;
     ecFlags |= (noout) ? EC_FLAGS_NO_OUT: 0;
+    ecFlags |= (optimize) ? EC_FLAGS_OPTIMIZE: 0;
     ecFlags |= (parseOnly) ? EC_FLAGS_PARSE_ONLY: 0;
 
     cp = ecCreateCompiler(ejs, ecFlags, lang);
@@ -555,10 +555,7 @@ class EjsWeb {
         if (verbose > 1) {
             trace("[PARSE]", file)
         }
-        let ep: EjsParser = new EjsParser
-        results = Templates.ViewHeader + ep.parse(file, App.dir, layoutPage) + Templates.ViewFooter
-        results = results.replace(/\${CONTROLLER}/g, controllerPrefix)
-        results = results.replace(/\${VIEW}/g, viewName)
+        results = EjsParser.buildView(file, App.dir, layoutPage, controllerPrefix, viewName)
 
         let esfile = sansExt + ".es"
 
@@ -1855,25 +1852,6 @@ These files are also created:
 '
 
 
-    /*
-     ***************************  View header and footer templates ******************
-     */
-    public static const ViewHeader = 
-'
-
-public dynamic class ${CONTROLLER}${VIEW}View extends View {
-    function ${CONTROLLER}${VIEW}View(c: Controller) {
-        super(c)
-    }
-
-    override public function render() {
-'
-
-    public static const ViewFooter = '
-    }
-}
-'
-
     /*
      ***************************  src/App.es ****************************
      */
@@ -1922,257 +1900,6 @@ module App {
 }
 
 
-/*
- *  Ejsweb Parser - Parse an ejs file and emit a Ejscript compiled version
- *
- *  This parser handles embedded Ejscript using <% %> directives. It supports:
- *
- *    <%                    Begin an ejs directive section containing statements
- *    <%=                   Begin an ejs directive section that contains an expression to evaluate and substitute
- *    %>                    End an ejs directive
- *    <%@ include "file" %> Include an ejs file
- *    <%@ layout "file" %>  Specify a layout page to use. Use layout "" to disable layout management.
- *
- *  Directives for use outside of <% %> 
- *    @@var                 To expand the value of "var". Var can also be simple expressions (without spaces).
- */
-
-/*
- *  Parser tokens
- */
-class Token {
-    public static const Err         = -1        /* Any input error */
-    public static const Eof         = 0         /* End of file */
-    public static const EjsTag      = 1         /* <% text %> */
-    public static const Var         = 2         /* @@var */
-    public static const Literal     = 3         /* literal HTML */
-    public static const Equals      = 4         /* <%= expression */
-    public static const Control     = 6         /* <%@ control */
-
-    public static var tokens = [ "Err", "Eof", "EjsTag", "Var", "Literal", "Equals", "Control" ]
-}
-
-
-class EjsParser {
-
-    private const ContentMarker: String         = "__ejs:CONTENT:ejs__"
-    private const ContentPattern: RegExp        = new RegExp(ContentMarker)
-    private const LayoutsDir: String            = "views/layouts"
-
-    private var appBaseDir: String
-    private var script: String
-    private var pos: Number                     = 0
-    private var lineNumber: Number              = 0
-    private var layoutPage: String
-
-    /*
-     *  Main parser. Parse the script and return the compiled (Ejscript) result
-     */
-    public function parse(file: String, appDir: String, layout: string): String {
-
-        var token: ByteArray = new ByteArray
-        var out: ByteArray = new ByteArray
-        var tid: Number
-
-        appBaseDir = appDir;
-        layoutPage = layout
-        script = Path(file).readString()
-
-        while ((tid = getToken(token)) != Token.Eof) {
-
-            switch (tid) {
-            case Token.Literal:
-                out.write("\nwrite(\"" + token + "\");\n")
-                break
-
-            case Token.Var:
-                /*
-                 *  Trick to get undefined variables to evaluate to "".
-                 *  Catenate with "" to cause toString to run.
-                 */
-                out.write("\nwrite(\"\" + ", token, ");\n")
-                break
-
-            case Token.Equals:
-                out.write("\nwrite(\"\" + (", token, "));\n")
-                break
-
-            case Token.EjsTag:
-                /*
-                 *  Just copy the Ejscript code straight through
-                 */
-                out.write(token.toString())
-                break
-
-            case Token.Control:
-                let args: Array = token.toString().split(/\s/g)
-                let cmd: String = args[0]
-
-                switch (cmd) {
-                case "include":
-                    let path = args[1].trim("'").trim('"')
-                    let incPath = dirname(file).join(path)
-                    /*
-                     *  Recurse and process the include script
-                     */
-                    let inc: EjsParser = new EjsParser
-                    out.write(inc.parse(incPath, appBaseDir, undefined))
-                    break
-
-                case "layout":
-                    let path = args[1]
-                    if (path == "" || path == '""') {
-                        layoutPage = undefined
-                    } else {
-                        path = args[1].trim("'").trim('"').trim('.ejs') + ".ejs"
-                        if (Path(path).isAbsolute) {
-                            layoutPage = path
-                        } else {
-                            layoutPage = Path(LayoutsDir).join(path)
-                        }
-                        if (! exists(layoutPage)) {
-                            abort("Can't find layout page " + layoutPage)
-                        }
-                    }
-                    break
-
-                case "content":
-                    out.write(ContentMarker)
-                    break
-
-                default:
-                    abort("Bad control directive: " + cmd)
-                }
-                break
-
-            default:
-            case Token.Err:
-                abort("Bad input token: " + token)
-
-            }
-        }
-
-        if (layoutPage != undefined && layoutPage != file) {
-            let layoutText: String = new EjsParser().parse(layoutPage, appBaseDir, layoutPage)
-            return layoutText.replace(ContentPattern, out.toString().replace(/\$/g, "$$$$"))
-        }
-        return out.toString()
-    }
-
-    /*
-     *  Get the next input token. Read from script[pos]. Return the next token ID and update the token byte array
-     */
-    function getToken(token: ByteArray): Number {
-
-        var tid = Token.Literal
-
-        token.flush()
-
-        var c
-        while (pos < script.length) {
-            c = script[pos++]
-
-            switch (c) {
-
-            case '<':
-                if (script[pos] == '%' && (pos < 2 || script[pos - 2] != '\\')) {
-                    if (token.available > 0) {
-                        pos--
-                        return Token.Literal
-                    }
-                    pos++
-                    eatSpace()
-                    if (script[pos] == '=') {
-                        /*
-                         *  <%=  directive
-                         */
-                        pos++
-                        eatSpace()
-                        while ((c = script[pos]) != undefined && 
-                                (c != '%' || script[pos+1] != '>' || script[pos-1] == '\\')) {
-                            token.write(c)
-                            pos++
-                        }
-                        pos += 2
-                        return Token.Equals
-
-                    } else if (script[pos] == '@') {
-                        /*
-                         *  <%@  directive
-                         */
-                        pos++
-                        eatSpace()
-                        while ((c = script[pos]) != undefined && (c != '%' || script[pos+1] != '>')) {
-                            token.write(c)
-                            pos++
-                        }
-                        pos += 2
-                        return Token.Control
-
-                    } else {
-                        while ((c = script[pos]) != undefined && 
-                                (c != '%' || script[pos+1] != '>' || script[pos-1] == '\\')) {
-                            token.write(c)
-                            pos++
-                        }
-                        pos += 2
-                        return Token.EjsTag
-                    }
-                }
-                token.write(c)
-                break
-
-            case '@':
-                if (script[pos] == '@' && (pos < 1 || script[pos-1] != '\\')) {
-                    if (token.available > 0) {
-                        pos--
-                        return Token.Literal
-                    }
-                    pos++
-                    c = script[pos++]
-                    while (c.isAlpha || c.isDigit || c == '[' || c == ']' || c == '.' || c == '$' || 
-                            c == '_' || c == "'") {
-                        token.write(c)
-                        c = script[pos++]
-                    }
-                    pos--
-                    return Token.Var
-                }
-                token.write(c)
-                break
-
-            case "\r":
-            case "\n":
-                lineNumber++
-                token.write(c)
-                tid = Token.Literal
-                break
-
-            default:
-                if (c == '\"' || c == '\\') {
-                    token.write('\\')
-                }
-                token.write(c)
-                break
-            }
-        }
-        if (token.available == 0 && pos >= script.length) {
-            return Token.Eof
-        }
-        return tid
-    }
-
-    function eatSpace(): Void {
-        while (script[pos].isSpace) {
-            pos++
-        }
-    }
-
-    function abort(msg: String): Void {
-        throw "ejsweb: " + msg + ". At line " + lineNumber
-    }
-}
-
 /*
  *  Main program
  */
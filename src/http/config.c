@@ -643,6 +643,22 @@ static int processSetting(MaServer *server, char *key, char *value, MaConfigStat
             mprFree(prefix);
             return 1;
 
+        } else if (mprStrcmpAnyCase(key, "AccessLogBuffer") == 0) {
+#if BLD_FEATURE_ACCESS_LOG
+            /* Scope: server, host. AccessLogBuffer size [block|drop] */
+            char *size, *policy;
+            size = mprStrTok(value, " \t", &policy);
+            if (size == 0 || !isdigit((int) *size)) {
+                return MPR_ERR_BAD_SYNTAX;
+            }
+            policy = (policy) ? mprStrTrim(policy, " \t") : "drop";
+            if (mprStrcmpAnyCase(policy, "block") != 0 && mprStrcmpAnyCase(policy, "drop") != 0) {
+                return MPR_ERR_BAD_SYNTAX;
+            }
+            maSetAccessLogBuffer(host, atoi(size), mprStrcmpAnyCase(policy, "block") == 0);
+#endif
+            return 1;
+
         } else if (mprStrcmpAnyCase(key, "AddFilter") == 0) {
             /* Scope: server, host, location */
             name = mprStrTok(value, " \t", &extensions);
@@ -1195,6 +1211,25 @@ static int processSetting(MaServer *server, char *key, char *value, MaConfigStat
             maInsertAlias(host, alias);
             return 1;
 
+        } else if (mprStrcmpAnyCase(key, "RequestTiming") == 0) {
+            /* Scope: server, host. RequestTiming on|off [threshold msec] */
+            cp = mprStrTok(value, " \t", &tok);
+            if (cp == 0) {
+                return MPR_ERR_BAD_SYNTAX;
+            }
+            if (mprStrcmpAnyCase(cp, "on") == 0) {
+                cp = mprStrTok(0, " \t", &tok);
+                if (cp && !isdigit((int) *cp)) {
+                    return MPR_ERR_BAD_SYNTAX;
+                }
+                maSetRequestTiming(host, 1, cp ? atoi(cp) : 0);
+            } else if (mprStrcmpAnyCase(cp, "off") == 0) {
+                maSetRequestTiming(host, 0, 0);
+            } else {
+                return MPR_ERR_BAD_SYNTAX;
+            }
+            return 1;
+
         } else if (mprStrcmpAnyCase(key, "ResetPipeline") == 0) {
             maResetPipeline(location);
             return 1;
@@ -122,6 +122,7 @@ void maPrepConnection(MaConn *conn)
     conn->request = 0;
     conn->response = 0;
     conn->trace = 0;
+    conn->timing = 0;
     conn->state =  MPR_HTTP_STATE_BEGIN;
     conn->flags &= ~MA_CONN_CLEAN_MASK;
     conn->expire = mprGetTime(conn) + conn->host->keepAliveTimeout;
@@ -205,6 +206,12 @@ static int ioEvent(MaConn *conn, int mask)
     conn->time = mprGetTime(conn);
 
     mprLog(conn, 7, "ioEvent for fd %d, mask %d\n", conn->sock->fd);
+    if (mprGetSocketHandshakeMask(conn->sock)) {
+        /*
+         *  An SSL handshake is in progress. The read path advances the handshake whichever way the socket is ready.
+         */
+        mask = MPR_READABLE;
+    }
     if (mask & MPR_WRITABLE) {
         maProcessWriteEvent(conn);
     }
@@ -241,14 +248,24 @@ static int ioEvent(MaConn *conn, int mask)
  */
 void maEnableConnEvents(MaConn *conn, int eventMask)
 {
-    if (conn->request) {
-        if (conn->response->queue[MA_QUEUE_SEND].prevQ->first) {
-            eventMask |= MPR_WRITABLE;
+    int     handshakeMask;
+
+    if ((handshakeMask = mprGetSocketHandshakeMask(conn->sock)) != 0) {
+        /*
+         *  Wait only for the I/O the SSL handshake needs. The handshake must complete within the handshake timeout.
+         */
+        eventMask = handshakeMask;
+        conn->expire = conn->started + conn->host->handshakeTimeout;
+    } else {
+        if (conn->request) {
+            if (conn->response->queue[MA_QUEUE_SEND].prevQ->first) {
+                eventMask |= MPR_WRITABLE;
+            }
         }
+        conn->expire = mprGetTime(conn);
+        conn->expire += (conn->state == MPR_HTTP_STATE_BEGIN) ? conn->host->keepAliveTimeout : conn->host->timeout;
     }
     mprLog(conn, 7, "Enable conn events mask %x", eventMask);
-    conn->expire = mprGetTime(conn);
-    conn->expire += (conn->state == MPR_HTTP_STATE_BEGIN) ? conn->host->keepAliveTimeout : conn->host->timeout;
     eventMask &= conn->eventMask;
     mprSetSocketCallback(conn->sock, (MprSocketProc) ioEvent, conn, eventMask, MPR_NORMAL_PRIORITY);
 }
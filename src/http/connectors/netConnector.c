@@ -15,9 +15,13 @@
 /**************************** Forward Declarations ****************************/
 
 static void addPacketForNet(MaQueue *q, MaPacket *packet);
+static void addToNetVector(MaQueue *q, char *ptr, int bytes);
 static void adjustNetVec(MaQueue *q, int written);
 static int64  buildNetVec(MaQueue *q);
 static void freeNetPackets(MaQueue *q, int64 written);
+#if BLD_HAS_SPLICE
+static int spliceNetPacket(MaQueue *q, MaPacket *packet);
+#endif
 
 /*********************************** Code *************************************/
 
@@ -25,22 +29,38 @@ static void netOutgoingService(MaQueue *q)
 {
     MaConn      *conn;
     MaResponse  *resp;
-    int         written, errCode;
+#if BLD_HAS_SPLICE
+    MaPacket    *packet;
+#endif
+    int         written, errCode, spliced;
 
     conn = q->conn;
     resp = conn->response;
     
     while (q->first || q->ioIndex) {
         written = 0;
-        if (q->ioIndex == 0 && buildNetVec(q) <= 0) {
-            break;
+        spliced = 0;
+#if BLD_HAS_SPLICE
+        packet = q->first;
+        if (q->ioIndex == 0 && packet && packet->flags & MA_PACKET_SPLICE && packet->prefixLen == 0) {
+            /*
+             *  Entity data still in the handler's pipe. Splice it to the socket without copying through user space.
+             */
+            written = spliceNetPacket(q, packet);
+            spliced = 1;
+        } else
+#endif
+        {
+            if (q->ioIndex == 0 && buildNetVec(q) <= 0) {
+                break;
+            }
+            /*
+             *  Issue a single I/O request to write all the blocks in the I/O vector
+             */
+            errCode = mprGetOsError();
+            mprAssert(q->ioIndex > 0);
+            written = mprWriteSocketVector(conn->sock, q->iovec, q->ioIndex);
         }
-        /*
-         *  Issue a single I/O request to write all the blocks in the I/O vector
-         */
-        errCode = mprGetOsError();
-        mprAssert(q->ioIndex > 0);
-        written = mprWriteSocketVector(conn->sock, q->iovec, q->ioIndex);
         mprLog(q, 5, "Net connector written %d", written);
         if (written < 0) {
             errCode = mprGetOsError();
@@ -66,8 +86,10 @@ static void netOutgoingService(MaQueue *q)
 
         } else if (written > 0) {
             resp->bytesWritten += written;
-            freeNetPackets(q, written);
-            adjustNetVec(q, written);
+            if (!spliced) {
+                freeNetPackets(q, written);
+                adjustNetVec(q, written);
+            }
         }
     }
     if (q->ioCount == 0 && q->flags & MA_QUEUE_EOF) {
@@ -101,9 +123,18 @@ static int64 buildNetVec(MaQueue *q)
             maFillHeaders(conn, packet);
             q->count += maGetPacketLength(packet);
 
+        } else if (packet->flags & MA_PACKET_SPLICE) {
+            /*
+             *  Write any chunk prefix now. The entity data is spliced once the vector has been written.
+             */
+            if (packet->prefixLen && q->ioIndex < (MA_MAX_IOVEC - 2)) {
+                addToNetVector(q, packet->prefix, packet->prefixLen);
+            }
+            break;
+
         } else if (maGetPacketLength(packet) == 0) {
             q->flags |= MA_QUEUE_EOF;
-            if (packet->prefix == NULL) {
+            if (packet->prefixLen == 0) {
                 break;
             }
             
@@ -152,8 +183,8 @@ static void addPacketForNet(MaQueue *q, MaPacket *packet)
     mprAssert(q->count >= 0);
     mprAssert(q->ioIndex < (MA_MAX_IOVEC - 2));
 
-    if (packet->prefix) {
-        addToNetVector(q, mprGetBufStart(packet->prefix), mprGetBufLength(packet->prefix));
+    if (packet->prefixLen) {
+        addToNetVector(q, packet->prefix, packet->prefixLen);
     }
     if (maGetPacketLength(packet) > 0) {
         addToNetVector(q, mprGetBufStart(packet->content), mprGetBufLength(packet->content));
@@ -175,18 +206,17 @@ static void freeNetPackets(MaQueue *q, int64 bytes)
     mprAssert(bytes >= 0);
 
     while ((packet = q->first) != 0) {
-        if (packet->prefix) {
-            len = mprGetBufLength(packet->prefix);
-            len = (int) min(len, bytes);
-            mprAdjustBufStart(packet->prefix, len);
+        if (packet->prefixLen) {
+            len = (int) min(packet->prefixLen, bytes);
+            packet->prefix += len;
+            packet->prefixLen -= len;
             bytes -= len;
             /* Prefixes don't count in the q->count. No need to adjust */
-            if (mprGetBufLength(packet->prefix) == 0) {
-                mprFree(packet->prefix);
-                packet->prefix = 0;
-            }
         }
-
+        if (packet->flags & MA_PACKET_SPLICE) {
+            /* Spliced entity data is written separately by spliceNetPacket */
+            break;
+        }
         if (packet->content) {
             len = mprGetBufLength(packet->content);
             len = (int) min(len, bytes);
@@ -211,6 +241,34 @@ static void freeNetPackets(MaQueue *q, int64 bytes)
 }
 
 
+#if BLD_HAS_SPLICE
+/*
+ *  Splice entity data from the response splice pipe to the socket. The packet is freed once all its data is written.
+ */
+static int spliceNetPacket(MaQueue *q, MaPacket *packet)
+{
+    MaConn      *conn;
+    MaResponse  *resp;
+    int         written;
+
+    conn = q->conn;
+    resp = conn->response;
+
+    written = mprSpliceToSocket(conn->sock, resp->spliceFd, (int) min(packet->esize, MAXINT));
+    if (written > 0) {
+        packet->esize -= written;
+        packet->epos += written;
+        resp->splicePending -= written;
+        mprAssert(packet->esize >= 0 && resp->splicePending >= 0);
+        if (packet->esize == 0 && (packet = maGet(q)) != 0) {
+            maFreePacket(q, packet);
+        }
+    }
+    return written;
+}
+#endif
+
+
 /*
  *  Clear entries from the IO vector that have actually been transmitted. Support partial writes.
  */
@@ -138,7 +138,7 @@ static int64 buildSendVec(MaQueue *q)
 
         } else if (maGetPacketLength(packet) == 0 && packet->esize == 0) {
             q->flags |= MA_QUEUE_EOF;
-            if (packet->prefix == NULL) {
+            if (packet->prefixLen == 0) {
                 break;
             }
         } else if (resp->flags & MA_RESP_NO_BODY) {
@@ -185,8 +185,8 @@ static void addPacketForSend(MaQueue *q, MaPacket *packet)
     mprAssert(q->count >= 0);
     mprAssert(q->ioIndex < (MA_MAX_IOVEC - 2));
 
-    if (packet->prefix) {
-        addToSendVector(q, mprGetBufStart(packet->prefix), mprGetBufLength(packet->prefix));
+    if (packet->prefixLen) {
+        addToSendVector(q, packet->prefix, packet->prefixLen);
     }
     if (packet->esize > 0) {
         mprAssert(q->ioFile == 0);
@@ -221,16 +221,12 @@ static void freeSentPackets(MaQueue *q, int64 bytes)
     mprAssert(bytes >= 0);
 
     while ((packet = q->first) != 0) {
-        if (packet->prefix) {
-            len = mprGetBufLength(packet->prefix);
-            len = min(len, bytes);
-            mprAdjustBufStart(packet->prefix, (int) len);
+        if (packet->prefixLen) {
+            len = min(packet->prefixLen, bytes);
+            packet->prefix += len;
+            packet->prefixLen -= (int) len;
             bytes -= len;
             /* Prefixes don't count in the q->count. No need to adjust */
-            if (mprGetBufLength(packet->prefix) == 0) {
-                mprFree(packet->prefix);
-                packet->prefix = 0;
-            }
         }
         if (packet->esize) {
             len = min(packet->esize, bytes);
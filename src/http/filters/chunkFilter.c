@@ -41,6 +41,31 @@ static bool matchChunk(MaConn *conn, MaStage *handler, cchar *uri)
 }
 
 
+/*
+ *  Parse a hex chunk size terminated by a chunk extension or the line end. Return -1 if the size is missing or too big.
+ */
+static int parseChunkSize(cchar *cp)
+{
+    int     c, size, digits;
+
+    for (size = 0, digits = 0; ; cp++, digits++) {
+        c = *cp;
+        if (c >= '0' && c <= '9') {
+            c -= '0';
+        } else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+            c = (c | 0x20) - 'a' + 10;
+        } else {
+            break;
+        }
+        if (size > (MAXINT >> 4)) {
+            return -1;
+        }
+        size = (size << 4) | c;
+    }
+    return (digits == 0) ? -1 : size;
+}
+
+
 /*
  *  Get the next chunk size. Chunked data format is:
  *      Chunk spec <CRLF>
@@ -57,7 +82,7 @@ static void incomingChunkData(MaQueue *q, MaPacket *packet)
     MaRequest   *req;
     MprBuf      *buf;
     char        *start, *cp;
-    int         bad;
+    int         len, size;
 
     conn = q->conn;
     req = conn->request;
@@ -86,21 +111,19 @@ static void incomingChunkData(MaQueue *q, MaPacket *packet)
             break;
         }
         start = mprGetBufStart(buf);
-        bad = (start[0] != '\r' || start[1] != '\n');
-        for (cp = &start[2]; cp < buf->end && *cp != '\n'; cp++) {}
-        if (*cp != '\n' && (cp - start) < 80) {
-            break;
-        }
-        bad += (cp[-1] != '\r' || cp[0] != '\n');
-        if (bad) {
+        len = mprGetBufLength(buf);
+        if ((cp = memchr(&start[2], '\n', len - 2)) == 0) {
+            if (len < 80) {
+                break;
+            }
             maFailConnection(conn, MPR_HTTP_CODE_BAD_REQUEST, "Bad chunk specification");
             return;
         }
-        req->chunkSize = (int) mprAtoi(&start[2], 16);
-        if (!isxdigit((int) start[2]) || req->chunkSize < 0) {
+        if (start[0] != '\r' || start[1] != '\n' || cp[-1] != '\r' || (size = parseChunkSize(&start[2])) < 0) {
             maFailConnection(conn, MPR_HTTP_CODE_BAD_REQUEST, "Bad chunk specification");
             return;
         }
+        req->chunkSize = size;
         mprAdjustBufStart(buf, (int) (cp - start + 1));
         req->remainingContent = req->chunkSize;
         if (req->chunkSize == 0) {
@@ -149,7 +172,7 @@ static void incomingChunkData(MaQueue *q, MaPacket *packet)
 static void outgoingChunkService(MaQueue *q)
 {
     MaConn      *conn;
-    MaPacket    *packet;
+    MaPacket    *packet, *tail;
     MaResponse  *resp;
 
     conn = q->conn;
@@ -180,7 +203,14 @@ static void outgoingChunkService(MaQueue *q)
         for (packet = maGet(q); packet; packet = maGet(q)) {
             if (!(packet->flags & MA_PACKET_HEADER)) {
                 if (maGetPacketLength(packet) > resp->chunkSize) {
-                    maResizePacket(q, packet, resp->chunkSize);
+                    /*
+                     *  Slice off a chunk by reference rather than copying the remainder into a new packet. The slice
+                     *  is written before the remainder, so the remainder buffer outlives the slice.
+                     */
+                    if ((tail = maSlicePacket(conn->request, packet, resp->chunkSize)) != 0) {
+                        maPutBack(q, packet);
+                        packet = tail;
+                    }
                 }
             }
             if (!maWillNextQueueAccept(q, packet)) {
@@ -196,24 +226,42 @@ static void outgoingChunkService(MaQueue *q)
 }
 
 
+/*
+ *  Set the chunk framing for a packet. The framing is formatted into the packet's inline prefix storage or refers to 
+ *  a static trailer, so no per-chunk allocation is required.
+ */
 static void setChunkPrefix(MaQueue *q, MaPacket *packet)
 {
-    MaConn      *conn;
-
-    conn = q->conn;
+    static char trailer[] = "\r\n0\r\n\r\n";
+    static char hex[] = "0123456789abcdef";
+    char        *cp, *end;
+    uint        len;
+    int         digits;
 
     if (packet->prefix) {
         return;
     }
-    packet->prefix = mprCreateBuf(packet, 32, 32);
     /*
-     *  NOTE: prefixes don't count in the queue length. No need to adjust q->count
+     *  NOTE: prefixes don't count in the queue length. No need to adjust q->count. Spliced packets have no content 
+     *  so use the entity length.
      */
-    if (maGetPacketLength(packet)) {
-        mprPutFmtToBuf(packet->prefix, "\r\n%x\r\n", maGetPacketLength(packet));
-    } else {
-        mprPutStringToBuf(packet->prefix, "\r\n0\r\n\r\n");
+    len = (uint) maGetPacketEntityLength(packet);
+    if (len == 0) {
+        packet->prefix = trailer;
+        packet->prefixLen = sizeof(trailer) - 1;
+        return;
+    }
+    for (digits = 1; digits < 8 && (len >> (digits * 4)); digits++) {}
+    end = &packet->prefixBuf[2 + digits];
+    for (cp = end; cp > &packet->prefixBuf[2]; len >>= 4) {
+        *--cp = hex[len & 0xF];
     }
+    packet->prefixBuf[0] = '\r';
+    packet->prefixBuf[1] = '\n';
+    end[0] = '\r';
+    end[1] = '\n';
+    packet->prefix = packet->prefixBuf;
+    packet->prefixLen = digits + 4;
 }
 
 
@@ -30,6 +30,8 @@ typedef struct Upload {
     MprFile         *file;              /* Current file I/O object */
     char            *boundary;          /* Boundary signature */
     int             boundaryLen;        /* Length of boundary */
+    int             skip[256];          /* Boyer-Moore-Horspool skip table for the boundary */
+    int             scanned;            /* Buffered data already scanned for a boundary */
     int             contentState;       /* Input states */
     char            *clientFilename;    /* Current file filename */
     char            *tmpPath;           /* Current temp filename for upload data */
@@ -38,7 +40,8 @@ typedef struct Upload {
 
 /********************************** Forwards **********************************/
 
-static char *getBoundary(void *buf, int bufLen, void *boundary, int boundaryLen);
+static char *getBoundary(Upload *up, char *buf, int bufLen, int offset);
+static void initBoundary(Upload *up);
 static int  processContentBoundary(MaQueue *q, char *line);
 static int  processContentHeader(MaQueue *q, char *line);
 static int  processContentData(MaQueue *q);
@@ -109,6 +112,7 @@ static void openUpload(MaQueue *q)
         maFailRequest(conn, MPR_HTTP_CODE_BAD_REQUEST, "Bad boundary");
         return;
     }
+    initBoundary(up);
 #if KEEP
     maSetFormVar(conn, "UPLOAD_DIR", location->uploadDir);
 #endif
@@ -209,7 +213,7 @@ static void incomingUploadData(MaQueue *q, MaPacket *packet)
 
         case MA_UPLOAD_CONTENT_DATA:
             rc = processContentData(q);
-            if (rc < 0) {
+            if (rc <= 0) {
                 done++;
             }
             if (mprGetBufLength(content) < up->boundaryLen) {
@@ -354,6 +358,10 @@ static int processContentHeader(MaQueue *q, char *line)
                     maFailRequest(conn, MPR_HTTP_CODE_INTERNAL_SERVER_ERROR, "Can't open upload temp file %s", up->tmpPath);
                     return MPR_ERR_BAD_STATE;
                 }
+                /*
+                 *  Aggregate file data so it is written in large blocks rather than per packet
+                 */
+                mprEnableFileBuffering(up->file, MA_UPLOAD_BUFSIZE, MA_UPLOAD_BUFSIZE);
 
                 /*
                  *  Create the files[id]
@@ -471,7 +479,7 @@ static int processContentData(MaQueue *q)
         /*  Incomplete boundary. Return and get more data */
         return 0;
     }
-    bp = getBoundary(mprGetBufStart(content), size, up->boundary, up->boundaryLen);
+    bp = getBoundary(up, mprGetBufStart(content), size, up->scanned);
     if (bp == 0) {
         mprLog(q, 6, "uploadFilter: Got boundary filename %x", up->clientFilename);
         if (up->clientFilename) {
@@ -484,15 +492,17 @@ static int processContentData(MaQueue *q)
                 return MPR_ERR_CANT_WRITE;
             }
             mprAdjustBufStart(content, dataLen);
-            return 0;       /* Get more data */
+        } else {
+            /*
+             *  Form variable split across packets. Remember where to resume scanning when more data arrives.
+             */
+            up->scanned = size - (up->boundaryLen - 1);
         }
+        return 0;       /* Get more data */
     }
+    up->scanned = 0;
     data = mprGetBufStart(content);
-    if (bp) {
-        dataLen = (int) (bp - data);
-    } else {
-        dataLen = mprGetBufLength(content);
-    }
+    dataLen = (int) (bp - data);
     if (dataLen > 0) {
         mprAdjustBufStart(content, dataLen);
         /*
@@ -539,6 +549,11 @@ static int processContentData(MaQueue *q)
          *  Now have all the data (we've seen the boundary)
          */
         mprLog(q, 4, "Close upload file %s, size %d", up->tmpPath, up->file->size);
+        if (mprFlush(up->file) < 0) {
+            maFailRequest(conn, MPR_HTTP_CODE_INTERNAL_SERVER_ERROR, "Can't write to upload temp file %s, errno %d\n", 
+                up->tmpPath, mprGetOsError());
+            return MPR_ERR_CANT_WRITE;
+        }
         mprFree(up->file);
         up->file = 0;
         mprFree(up->clientFilename);
@@ -553,33 +568,50 @@ static int processContentData(MaQueue *q)
 
 
 /*
- *  Find the boundary signature in memory. Returns pointer to the first match.
+ *  Build the Boyer-Moore-Horspool skip table for the boundary. Each byte value maps to the distance the search can 
+ *  advance when that byte is the last byte of the current window.
+ */
+static void initBoundary(Upload *up)
+{
+    uchar   *boundary;
+    int     i, last;
+
+    boundary = (uchar*) up->boundary;
+    last = up->boundaryLen - 1;
+    for (i = 0; i < 256; i++) {
+        up->skip[i] = up->boundaryLen;
+    }
+    for (i = 0; i < last; i++) {
+        up->skip[boundary[i]] = last - i;
+    }
+}
+
+
+/*
+ *  Find the boundary signature in memory starting at offset. Returns pointer to the first match.
  */ 
-static char *getBoundary(void *buf, int bufLen, void *boundary, int boundaryLen)
+static char *getBoundary(Upload *up, char *buf, int bufLen, int offset)
 {
-    char    *cp, *endp;
-    char    first;
+    uchar   *cp, *endp, *boundary;
+    int     last;
 
     mprAssert(buf);
-    mprAssert(boundary);
-    mprAssert(boundaryLen > 0);
+    mprAssert(up->boundaryLen > 0);
+    mprAssert(offset >= 0);
 
-    first = *((char*) boundary);
-    cp = (char*) buf;
-
-    if (bufLen < boundaryLen) {
+    if (bufLen < up->boundaryLen) {
         return 0;
     }
-    endp = cp + (bufLen - boundaryLen) + 1;
-    while (cp < endp) {
-        cp = (char *) memchr(cp, first, endp - cp);
-        if (!cp) {
-            return 0;
-        }
-        if (memcmp(cp, boundary, boundaryLen) == 0) {
-            return cp;
+    boundary = (uchar*) up->boundary;
+    last = up->boundaryLen - 1;
+    cp = (uchar*) &buf[offset];
+    endp = (uchar*) &buf[bufLen - up->boundaryLen];
+
+    while (cp <= endp) {
+        if (cp[last] == boundary[last] && memcmp(cp, boundary, last) == 0) {
+            return (char*) cp;
         }
-        cp++;
+        cp += up->skip[cp[last]];
     }
     return 0;
 }
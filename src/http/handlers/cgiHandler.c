@@ -22,6 +22,10 @@ static bool parseFirstCgiResponse(MaConn *conn, MprCmd *cmd);
 static bool parseHeader(MaConn *conn, MprCmd *cmd);
 static void writeToCGI(MaQueue *q);
 static void startCgi(MaQueue *q);
+#if BLD_HAS_SPLICE
+static bool canSplice(MaConn *conn);
+static int spliceToClient(MaQueue *q, MprCmd *cmd);
+#endif
 
 #if BLD_DEBUG
 static void traceCGIData(MprCmd *cmd, char *src, int size);
@@ -350,6 +354,9 @@ static void cgiEvent(MaQueue *q, MprCmd *cmd, int channel)
     MaResponse  *resp;
     MprBuf      *buf;
     int         space, nbytes, err;
+#if BLD_HAS_SPLICE
+    int         rc;
+#endif
 
     mprLog(cmd, 6, "CGI callback channel %d", channel);
     
@@ -380,6 +387,18 @@ static void cgiEvent(MaQueue *q, MprCmd *cmd, int channel)
         Come here for CGI stdout, stderr events. ie. reading data from the CGI program.
      */
     while (mprGetCmdFd(cmd, channel) >= 0) {
+#if BLD_HAS_SPLICE
+        if (cmd->userFlags & MA_CGI_SPLICE && channel == MPR_CMD_STDOUT && mprGetBufLength(buf) == 0) {
+            /*
+                Headers have been parsed and all buffered data written. Splice the rest straight to the client.
+             */
+            if ((rc = spliceToClient(q, cmd)) > 0) {
+                continue;
+            } else if (rc < 0) {
+                return;
+            }
+        }
+#endif
         /*
             Read as much data from the CGI as possible
          */
@@ -583,10 +602,82 @@ static bool parseHeader(MaConn *conn, MprCmd *cmd)
         maPutForService(q, maCreateEndPacket(q), 1);
     }
     cmd->userFlags |= MA_CGI_SEEN_HEADER;
+#if BLD_HAS_SPLICE
+    if (!location && canSplice(conn)) {
+        cmd->userFlags |= MA_CGI_SPLICE;
+        resp->spliceFd = mprGetCmdFd(cmd, MPR_CMD_STDOUT);
+    }
+#endif
     return 1;
 }
 
 
+#if BLD_HAS_SPLICE
+/*
+    Test if the CGI output can be spliced from the CGI stdout pipe directly to the client socket. This requires a plain
+    socket and a pipeline where no stage other than the chunk filter needs to see the response data.
+ */
+static bool canSplice(MaConn *conn)
+{
+    MaResponse  *resp;
+    MaStage     *stage;
+    int         next;
+
+    resp = conn->response;
+
+    if (conn->requestFailed || conn->trace || conn->sock == 0 || mprIsSocketSecure(conn->sock) || 
+            resp->flags & MA_RESP_NO_BODY || resp->connector != conn->http->netConnector) {
+        return 0;
+    }
+    for (next = 0; (stage = mprGetNextItem(resp->outputPipeline, &next)) != 0; ) {
+        if (stage != resp->handler && stage != resp->connector && stage != conn->http->chunkFilter) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+
+/*
+    Queue the data waiting in the CGI stdout pipe as a splice packet. The net connector moves the data to the client 
+    socket without copying it through user space. The socket is in blocking mode as the thread is dedicated, so this 
+    provides flow control. Return 1 if data was written, 0 if the pipe is empty and -1 if the client is blocked.
+ */
+static int spliceToClient(MaQueue *q, MprCmd *cmd)
+{
+    MaConn      *conn;
+    MaResponse  *resp;
+    MaPacket    *packet;
+    int         count;
+
+    conn = q->conn;
+    resp = conn->response;
+
+    if (conn->requestFailed) {
+        /* Revert to reading the pipe so the CGI output can be discarded */
+        cmd->userFlags &= ~MA_CGI_SPLICE;
+        resp->splicePending = 0;
+        return 0;
+    }
+    if (resp->splicePending > 0) {
+        return -1;
+    }
+    if (ioctl(resp->spliceFd, FIONREAD, &count) < 0 || count <= 0) {
+        return 0;
+    }
+    if ((packet = maCreateEntityPacket(q, 0, count, NULL)) == 0) {
+        return 0;
+    }
+    packet->flags |= MA_PACKET_SPLICE;
+    resp->splicePending += count;
+    mprLog(q, 5, "CGI: splice %d bytes to client", count);
+    maPutForService(q, packet, 1);
+    maServiceQueues(conn);
+    return (resp->splicePending > 0) ? -1 : 1;
+}
+#endif
+
+
 /*
     Build the command arguments. NOTE: argv is untrusted input.
  */
@@ -29,7 +29,7 @@ static void openFile(MaQueue *q)
     MaResponse      *resp;
     MaLocation      *location;
     MaConn          *conn;
-    char            *date;
+    char            date[MA_DATE_SIZE];
 
     conn = q->conn;
     resp = conn->response;
@@ -41,9 +41,8 @@ static void openFile(MaQueue *q)
     case MA_REQ_HEAD:
     case MA_REQ_POST:
         if (resp->fileInfo.valid && resp->fileInfo.mtime) {
-            date = maGetDateString(conn->arena, &resp->fileInfo);
-            maSetHeader(conn, 0, "Last-Modified", date);
-            mprFree(date);
+            maSetHeader(conn, 0, "Last-Modified", maGetModifiedDate(conn->http, resp->fileInfo.mtime, date, 
+                sizeof(date)));
         }
         if (maContentNotModified(conn)) {
             maSetResponseCode(conn, MPR_HTTP_CODE_NOT_MODIFIED);
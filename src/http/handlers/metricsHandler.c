@@ -0,0 +1,357 @@
+/*
+ *  metricsHandler.c -- Report server metrics
+ *
+ *  This handler reports request metrics for each host and handler along with worker thread and memory usage. If 
+ *  RequestTiming is enabled, the time per request phase and per stage service routine is also reported. The report 
+ *  is in the Prometheus text format unless JSON is requested via "?format=json" or an Accept header. Secure hosts 
+ *  also report full and resumed SSL handshakes. Stages may append their own metrics via MaStage.reportMetrics.
+ *
+ *      <Location /metrics>
+ *          SetHandler metricsHandler
+ *      </Location>
+ *
+ *  Copyright (c) All Rights Reserved. See copyright notice at the bottom of the file.
+ */
+
+/********************************* Includes ***********************************/
+
+#include    "http.h"
+
+/*********************************** Code *************************************/
+
+static cchar *getHostName(MaHost *host)
+{
+    if (host->name) {
+        return host->name;
+    }
+    return (host->ipAddrPort) ? host->ipAddrPort : "default";
+}
+
+
+/*
+ *  Escape a name for use as a Prometheus label value or a JSON string. Over-long names are truncated.
+ */
+static cchar *escapeName(char *dest, int size, cchar *name, bool json)
+{
+    char        *dp, *end;
+    int         c;
+
+    end = &dest[size - 7];
+    for (dp = dest; *name && dp < end; name++) {
+        c = (uchar) *name;
+        if (c == '\\' || c == '"') {
+            *dp++ = '\\';
+            *dp++ = c;
+        } else if (c == '\n') {
+            *dp++ = '\\';
+            *dp++ = 'n';
+        } else if (json && c < 0x20) {
+            mprSprintf(dp, 7, "\\u%04x", c);
+            dp += 6;
+        } else {
+            *dp++ = c;
+        }
+    }
+    *dp = '\0';
+    return dest;
+}
+
+
+static void textCounters(MprBuf *buf, cchar *label, cchar *name, MaMetricCounters *cp)
+{
+    int64       total;
+    int         i;
+
+    mprPutFmtToBuf(buf, "appweb_requests_total{%s=\"%s\"} %Ld\n", label, name, cp->requests);
+    mprPutFmtToBuf(buf, "appweb_bytes_received_total{%s=\"%s\"} %Ld\n", label, name, cp->bytesIn);
+    mprPutFmtToBuf(buf, "appweb_bytes_sent_total{%s=\"%s\"} %Ld\n", label, name, cp->bytesOut);
+    mprPutFmtToBuf(buf, "appweb_keep_alive_requests_total{%s=\"%s\"} %Ld\n", label, name, cp->keepAlive);
+    for (i = 0; i < MA_METRICS_STATUS; i++) {
+        mprPutFmtToBuf(buf, "appweb_responses_total{%s=\"%s\",status=\"%dxx\"} %Ld\n", label, name, i + 1, 
+            cp->status[i]);
+    }
+    for (total = 0, i = 0; i < MA_METRICS_BUCKETS; i++) {
+        if (cp->latency[i]) {
+            total += cp->latency[i];
+            mprPutFmtToBuf(buf, "appweb_request_msec_bucket{%s=\"%s\",le=\"%Ld\"} %Ld\n", label, name, 
+                maGetMetricsBucketLimit(i), total);
+        }
+    }
+    mprPutFmtToBuf(buf, "appweb_request_msec_bucket{%s=\"%s\",le=\"+Inf\"} %Ld\n", label, name, cp->requests);
+    mprPutFmtToBuf(buf, "appweb_request_msec_sum{%s=\"%s\"} %Ld\n", label, name, cp->latencySum);
+    mprPutFmtToBuf(buf, "appweb_request_msec_count{%s=\"%s\"} %Ld\n", label, name, cp->requests);
+    if (cp->timed) {
+        mprPutFmtToBuf(buf, "appweb_timed_requests_total{%s=\"%s\"} %Ld\n", label, name, cp->timed);
+        for (i = 0; i < MA_TIMING_PHASES; i++) {
+            mprPutFmtToBuf(buf, "appweb_request_phase_usec_total{%s=\"%s\",phase=\"%s\"} %Ld\n", label, name, 
+                maGetTimingPhaseName(i), cp->phase[i]);
+        }
+    }
+}
+
+
+#if BLD_FEATURE_SSL
+/*
+ *  Report full and resumed SSL handshakes for a secure host
+ */
+static void sslCounters(MprBuf *buf, MaHost *host, bool json)
+{
+    char        name[MPR_MAX_STRING];
+    int64       full, resumed;
+
+    if (!host->secure || host->location == 0 || host->location->ssl == 0) {
+        return;
+    }
+    mprGetSslStats(host->location->ssl, &full, &resumed);
+    if (json) {
+        mprPutFmtToBuf(buf, ",\"ssl\":{\"fullHandshakes\":%Ld,\"resumedHandshakes\":%Ld}", full, resumed);
+    } else {
+        escapeName(name, sizeof(name), getHostName(host), 0);
+        mprPutFmtToBuf(buf, "appweb_ssl_handshakes_total{host=\"%s\",type=\"full\"} %Ld\n", name, full);
+        mprPutFmtToBuf(buf, "appweb_ssl_handshakes_total{host=\"%s\",type=\"resumed\"} %Ld\n", name, resumed);
+    }
+}
+#endif
+
+
+static void jsonCounters(MprBuf *buf, MaHost *host, cchar *name, MaMetricCounters *cp)
+{
+    int         i, count;
+
+    mprPutFmtToBuf(buf, "{\"name\":\"%s\",\"requests\":%Ld,\"bytesIn\":%Ld,\"bytesOut\":%Ld,\"keepAlive\":%Ld,", 
+        name, cp->requests, cp->bytesIn, cp->bytesOut, cp->keepAlive);
+    mprPutStringToBuf(buf, "\"status\":{");
+    for (i = 0; i < MA_METRICS_STATUS; i++) {
+        mprPutFmtToBuf(buf, "%s\"%dxx\":%Ld", (i > 0) ? "," : "", i + 1, cp->status[i]);
+    }
+    mprPutFmtToBuf(buf, "},\"latency\":{\"sum\":%Ld,\"max\":%Ld,\"p50\":%Ld,\"p90\":%Ld,\"p99\":%Ld,\"buckets\":[", 
+        cp->latencySum, cp->latencyMax, maGetMetricsPercentile(cp, 50), maGetMetricsPercentile(cp, 90), 
+        maGetMetricsPercentile(cp, 99));
+    for (count = 0, i = 0; i < MA_METRICS_BUCKETS; i++) {
+        if (cp->latency[i]) {
+            mprPutFmtToBuf(buf, "%s[%Ld,%Ld]", (count++ > 0) ? "," : "", maGetMetricsBucketLimit(i), cp->latency[i]);
+        }
+    }
+    mprPutStringToBuf(buf, "]}");
+    if (cp->timed) {
+        mprPutFmtToBuf(buf, ",\"timing\":{\"timed\":%Ld", cp->timed);
+        for (i = 0; i < MA_TIMING_PHASES; i++) {
+            mprPutFmtToBuf(buf, ",\"%s\":%Ld", maGetTimingPhaseName(i), cp->phase[i]);
+        }
+        mprPutCharToBuf(buf, '}');
+    }
+#if BLD_FEATURE_SSL
+    if (host) {
+        sslCounters(buf, host, 1);
+    }
+#endif
+    mprPutCharToBuf(buf, '}');
+}
+
+
+static bool wantJson(MaConn *conn)
+{
+    MaRequest   *req;
+    cchar       *accept;
+
+    req = conn->request;
+    if (req->parsedUri->query && strstr(req->parsedUri->query, "format=json")) {
+        return 1;
+    }
+    accept = (cchar*) mprLookupHash(req->headers, "HTTP_ACCEPT");
+    return accept && strstr(accept, "application/json") != 0;
+}
+
+
+static void runMetrics(MaQueue *q)
+{
+    MaConn              *conn;
+    MaHttp              *http;
+    MaServer            *server;
+    MaHost              *host;
+    MaStage             *stage;
+    MprHash             *hp;
+    MprBuf              *buf;
+    MaMetricCounters    counters;
+    MprAlloc            *alloc;
+    char                name[MPR_MAX_STRING];
+    bool                json;
+    int                 next, nextHost, count;
+#if BLD_FEATURE_MULTITHREAD
+    MprWorkerStats      workers;
+#endif
+
+    conn = q->conn;
+    http = conn->http;
+    json = wantJson(conn);
+    buf = mprCreateBuf(q, MA_BUFSIZE, -1);
+
+    if (json) {
+        mprPutStringToBuf(buf, "{\"hosts\":[");
+    }
+    count = 0;
+    for (next = 0; (server = mprGetNextItem(http->servers, &next)) != 0; ) {
+        for (nextHost = 0; (host = mprGetNextItem(server->hosts, &nextHost)) != 0; ) {
+            if (host->metrics == 0) {
+                continue;
+            }
+            maGetMetrics(host->metrics, &counters);
+            escapeName(name, sizeof(name), getHostName(host), json);
+            if (json) {
+                if (count++ > 0) {
+                    mprPutCharToBuf(buf, ',');
+                }
+                jsonCounters(buf, host, name, &counters);
+            } else {
+                textCounters(buf, "host", name, &counters);
+                mprPutFmtToBuf(buf, "appweb_connections{host=\"%s\"} %d\n", name, mprGetListCount(host->connections));
+#if BLD_FEATURE_SSL
+                sslCounters(buf, host, 0);
+#endif
+            }
+        }
+    }
+    if (json) {
+        mprPutStringToBuf(buf, "],\"handlers\":[");
+    }
+    count = 0;
+    for (hp = mprGetFirstHash(http->stages); hp; hp = mprGetNextHash(http->stages, hp)) {
+        stage = (MaStage*) hp->data;
+        if (stage->metrics == 0) {
+            continue;
+        }
+        maGetMetrics(stage->metrics, &counters);
+        if (counters.requests == 0) {
+            continue;
+        }
+        escapeName(name, sizeof(name), stage->name, json);
+        if (json) {
+            if (count++ > 0) {
+                mprPutCharToBuf(buf, ',');
+            }
+            jsonCounters(buf, NULL, name, &counters);
+        } else {
+            textCounters(buf, "handler", name, &counters);
+        }
+    }
+    if (json) {
+        mprPutStringToBuf(buf, "],\"stages\":[");
+    }
+    count = 0;
+    for (hp = mprGetFirstHash(http->stages); hp; hp = mprGetNextHash(http->stages, hp)) {
+        stage = (MaStage*) hp->data;
+        if (stage->metrics == 0) {
+            continue;
+        }
+        maGetMetrics(stage->metrics, &counters);
+        if (counters.serviceCount == 0) {
+            continue;
+        }
+        escapeName(name, sizeof(name), stage->name, json);
+        if (json) {
+            mprPutFmtToBuf(buf, "%s{\"name\":\"%s\",\"serviceTime\":%Ld,\"serviceCount\":%Ld}", 
+                (count++ > 0) ? "," : "", name, counters.serviceTime, counters.serviceCount);
+        } else {
+            mprPutFmtToBuf(buf, "appweb_stage_service_usec_total{stage=\"%s\"} %Ld\n", name, counters.serviceTime);
+            mprPutFmtToBuf(buf, "appweb_stage_service_calls_total{stage=\"%s\"} %Ld\n", name, counters.serviceCount);
+        }
+    }
+    if (json) {
+        mprPutStringToBuf(buf, "]");
+    }
+    for (hp = mprGetFirstHash(http->stages); hp; hp = mprGetNextHash(http->stages, hp)) {
+        stage = (MaStage*) hp->data;
+        if (stage->reportMetrics) {
+            if (json) {
+                mprPutFmtToBuf(buf, ",\"%s\":{", escapeName(name, sizeof(name), stage->name, 1));
+            }
+            stage->reportMetrics(stage, buf, json);
+            if (json) {
+                mprPutCharToBuf(buf, '}');
+            }
+        }
+    }
+
+#if BLD_FEATURE_MULTITHREAD
+    mprGetWorkerServiceStats(mprGetMpr(conn)->workerService, &workers);
+    if (json) {
+        mprPutFmtToBuf(buf, ",\"workers\":{\"max\":%d,\"min\":%d,\"threads\":%d,\"busy\":%d,\"idle\":%d,\"maxUsed\":%d}", 
+            workers.maxThreads, workers.minThreads, workers.numThreads, workers.busyThreads, workers.idleThreads, 
+            workers.maxUse);
+    } else {
+        mprPutFmtToBuf(buf, "appweb_workers_max %d\n", workers.maxThreads);
+        mprPutFmtToBuf(buf, "appweb_workers_threads %d\n", workers.numThreads);
+        mprPutFmtToBuf(buf, "appweb_workers_busy %d\n", workers.busyThreads);
+        mprPutFmtToBuf(buf, "appweb_workers_idle %d\n", workers.idleThreads);
+        mprPutFmtToBuf(buf, "appweb_workers_max_used %d\n", workers.maxUse);
+    }
+#endif
+    alloc = mprGetAllocStats(conn);
+    if (json) {
+        mprPutFmtToBuf(buf, ",\"memory\":{\"allocated\":%Ld,\"peak\":%Ld,\"rss\":%Ld,\"errors\":%d}}\n", 
+            alloc->bytesAllocated, alloc->peakAllocated, alloc->rss, alloc->errors);
+    } else {
+        mprPutFmtToBuf(buf, "appweb_memory_allocated_bytes %Ld\n", alloc->bytesAllocated);
+        mprPutFmtToBuf(buf, "appweb_memory_peak_bytes %Ld\n", alloc->peakAllocated);
+        mprPutFmtToBuf(buf, "appweb_memory_rss_bytes %Ld\n", alloc->rss);
+        mprPutFmtToBuf(buf, "appweb_memory_errors_total %d\n", alloc->errors);
+    }
+
+    conn->response->mimeType = (json) ? "application/json" : "text/plain; version=0.0.4";
+    maDontCacheResponse(conn);
+    maSetEntityLength(conn, mprGetBufLength(buf));
+    maPutForService(q, maCreateHeaderPacket(q), 0);
+    maWriteBlock(q, mprGetBufStart(buf), mprGetBufLength(buf), 1);
+    maPutForService(q, maCreateEndPacket(q), 1);
+    mprFree(buf);
+}
+
+
+int maOpenMetricsHandler(MaHttp *http)
+{
+    MaStage     *stage;
+
+    stage = maCreateHandler(http, "metricsHandler", MA_STAGE_GET | MA_STAGE_HEAD | MA_STAGE_VIRTUAL);
+    if (stage == 0) {
+        return MPR_ERR_CANT_CREATE;
+    }
+    stage->run = runMetrics;
+    return 0;
+}
+
+
+/*
+ *  @copy   default
+ *
+ *  Copyright (c) Embedthis Software LLC, 2003-2011. All Rights Reserved.
+ *  Copyright (c) Michael O'Brien, 1993-2011. All Rights Reserved.
+ *
+ *  This software is distributed under commercial and open source licenses.
+ *  You may use the GPL open source license described below or you may acquire
+ *  a commercial license from Embedthis Software. You agree to be fully bound
+ *  by the terms of either license. Consult the LICENSE.TXT distributed with
+ *  this software for full details.
+ *
+ *  This software is open source; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 2 of the License, or (at your
+ *  option) any later version. See the GNU General Public License for more
+ *  details at: http://www.embedthis.com/downloads/gplLicense.html
+ *
+ *  This program is distributed WITHOUT ANY WARRANTY; without even the
+ *  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  This GPL license does NOT permit incorporating this software into
+ *  proprietary programs. If you are unable to comply with the GPL, you must
+ *  acquire a commercial license to use this software. Commercial licenses
+ *  for this software and support services are available from Embedthis
+ *  Software at http://www.embedthis.com
+ *
+ *  Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
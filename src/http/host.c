@@ -21,6 +21,7 @@
 static bool appwebIsIdle(MprCtx ctx);
 static int  getRandomBytes(MaHost *host, char *buf, int bufsize);
 static void hostTimer(MaHost *host, MprEvent *event);
+static void setKeepAliveHeader(MaHost *host);
 static void updateCurrentDate(MaHost *host);
 
 /*********************************** Code *************************************/
@@ -59,12 +60,15 @@ MaHost *maCreateHost(MaServer *server, cchar *ipAddrPort, MaLocation *location)
     host->traceMaxLength = INT_MAX;
 
     host->keepAliveTimeout = MA_KEEP_TIMEOUT;
+    host->handshakeTimeout = MA_HANDSHAKE_TIMEOUT;
     host->maxKeepAlive = MA_MAX_KEEP_ALIVE;
     host->keepAlive = 1;
+    setKeepAliveHeader(host);
 
     host->location = (location) ? location : maCreateBareLocation(host);
     maAddLocation(host, host->location);
     updateCurrentDate(host);
+    host->metrics = maCreateMetrics(host);
 
 #if BLD_FEATURE_AUTH
     host->location->auth = maCreateAuth(host->location, host->location->auth);
@@ -113,15 +117,23 @@ MaHost *maCreateVirtualHost(MaServer *server, cchar *ipAddrPort, MaHost *parent)
     host->timeout = parent->timeout;
     host->limits = parent->limits;
     host->keepAliveTimeout = parent->keepAliveTimeout;
+    host->handshakeTimeout = parent->handshakeTimeout;
+    setKeepAliveHeader(host);
     host->maxKeepAlive = parent->maxKeepAlive;
     host->keepAlive = parent->keepAlive;
     host->accessLog = parent->accessLog;
     host->mimeTypes = parent->mimeTypes;
     host->location = maCreateLocation(host, parent->location);
     host->logHost = parent->logHost;
+#if BLD_FEATURE_ACCESS_LOG
+    host->logBufSize = parent->logBufSize;
+    host->logBlock = parent->logBlock;
+#endif
 
     host->traceMask = parent->traceMask;
     host->traceLevel = parent->traceLevel;
+    host->timing = parent->timing;
+    host->timingThreshold = parent->timingThreshold;
     host->traceMaxLength = parent->traceMaxLength;
     if (parent->traceInclude) {
         host->traceInclude = mprCopyHash(host, parent->traceInclude);
@@ -132,6 +144,7 @@ MaHost *maCreateVirtualHost(MaServer *server, cchar *ipAddrPort, MaHost *parent)
 
     maAddLocation(host, host->location);
     updateCurrentDate(host);
+    host->metrics = maCreateMetrics(host);
 
 #if BLD_FEATURE_MULTITHREAD
     host->mutex = mprCreateLock(host);
@@ -222,9 +235,28 @@ void maSetKeepAlive(MaHost *host, bool on)
 }
 
 
+void maSetHandshakeTimeout(MaHost *host, int timeout)
+{
+    host->handshakeTimeout = timeout;
+}
+
+
 void maSetKeepAliveTimeout(MaHost *host, int timeout)
 {
     host->keepAliveTimeout = timeout;
+    setKeepAliveHeader(host);
+}
+
+
+/*
+ *  Precompute the constant part of the keep-alive response headers. Only the max count varies per request.
+ */
+static void setKeepAliveHeader(MaHost *host)
+{
+    mprFree(host->keepAliveHeader);
+    host->keepAliveHeader = mprAsprintf(host, -1, "Connection: keep-alive\r\nKeep-Alive: timeout=%d, max=", 
+        host->keepAliveTimeout / 1000);
+    host->keepAliveHeaderLen = (int) strlen(host->keepAliveHeader);
 }
 
 
@@ -283,6 +315,13 @@ void maSetHostTrace(MaHost *host, int level, int mask)
 }
 
 
+void maSetRequestTiming(MaHost *host, bool on, int threshold)
+{
+    host->timing = on;
+    host->timingThreshold = threshold;
+}
+
+
 void maSetHostTraceFilter(MaHost *host, int len, cchar *include, cchar *exclude)
 {
     char    *word, *tok, *line;
@@ -737,14 +776,14 @@ void maAddConn(MaHost *host, MaConn *conn)
 }
 
 
+/*
+ *  The date string is owned by the date cache. It is immutable and remains valid for MA_DATE_RETAIN seconds, which is
+ *  well beyond the timer period that refreshes it.
+ */
 static void updateCurrentDate(MaHost *host)
 {
-    char        *oldDate;
-
-    oldDate = host->currentDate;
     host->now = mprGetTime(host);
-    host->currentDate = maGetDateString(host, 0);
-    mprFree(oldDate);
+    host->currentDate = maGetCurrentDate(host->server->http);
 }
 
 
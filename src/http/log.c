@@ -128,15 +128,95 @@ int maStopLogging(MprCtx ctx)
 }
 
 #if BLD_FEATURE_ACCESS_LOG
+/*
+ *  Compiled access log format operations. Other op types are the format character itself (e.g. 'h').
+ */
+#define LOG_LITERAL     0               /* Literal text */
+#define LOG_HEADER      1               /* Request header value */
+#define LOG_CODE        2               /* Final response code (%>s) */
+
+typedef struct LogOp {
+    int             type;               /* Operation type */
+    char            *text;              /* Literal text or header key */
+    int             len;                /* Length of text */
+} LogOp;
+
+/*
+ *  Buffered access log writer. Request threads append formatted entries to a ring buffer which is drained in batches
+ *  by a background writer thread. This keeps the log file I/O out of the request path.
+ */
+typedef struct MaAccessLog {
+    MaHost          *host;              /* Host owning the log */
+    char            *ring;              /* Ring buffer of formatted entries */
+    int             size;               /* Size of the ring */
+    int             start;              /* Index of the first unwritten byte */
+    int             length;             /* Count of unwritten bytes */
+    int             dropped;            /* Entries dropped because the ring was full */
+    int             rotate;             /* Rotate the log after the next write */
+    int             stopping;           /* Writer is being stopped */
+    MprTime         dateSecs;           /* Time (in seconds) of the cached date */
+    char            date[64];           /* Cached local time text */
+#if BLD_FEATURE_MULTITHREAD
+    MprMutex        *mutex;
+    MprCond         *wakeup;            /* Wake the writer thread */
+    MprCond         *space;             /* Space available in the ring */
+    MprCond         *done;              /* Writer thread has exited */
+    MprThread       *thread;
+#endif
+} MaAccessLog;
+
+/*
+ *  Formatted log entry
+ */
+typedef struct LogLine {
+    char            *buf;
+    int             len;
+    int             size;
+} LogLine;
+
+static void rotateAccessLog(MaHost *host);
+#if BLD_FEATURE_MULTITHREAD
+static void flushAccessLog(MaAccessLog *log);
+static void logWriterMain(MaAccessLog *log, MprThread *tp);
+#endif
+
 
 int maStartAccessLogging(MaHost *host)
 {
 #if !BLD_FEATURE_ROMFS
+#if BLD_FEATURE_MULTITHREAD
+    MaAccessLog     *log;
+#endif
+
     if (host->logPath) {
         host->accessLog = mprOpen(host, host->logPath, O_CREAT | O_APPEND | O_WRONLY | O_TEXT, 0664);
         if (host->accessLog == 0) {
             mprError(host, "Can't open log file %s", host->logPath);
+            return 0;
+        }
+#if BLD_FEATURE_MULTITHREAD
+        if ((log = mprAllocObjZeroed(host, MaAccessLog)) == 0) {
+            return MPR_ERR_NO_MEMORY;
         }
+        log->host = host;
+        log->size = (host->logBufSize > 0) ? host->logBufSize : MA_ACCESS_LOG_BUFSIZE;
+        log->ring = (char*) mprAlloc(log, log->size);
+        log->mutex = mprCreateLock(log);
+        log->wakeup = mprCreateCond(log);
+        log->space = mprCreateCond(log);
+        log->done = mprCreateCond(log);
+        if (log->ring == 0 || log->mutex == 0 || log->wakeup == 0 || log->space == 0 || log->done == 0) {
+            mprFree(log);
+            return MPR_ERR_NO_MEMORY;
+        }
+        log->thread = mprCreateThread(log, "accessLog", (MprThreadProc) logWriterMain, log, MPR_NORMAL_PRIORITY, 0);
+        if (log->thread == 0 || mprStartThread(log->thread) < 0) {
+            mprError(host, "Can't start access log writer, using synchronous writes");
+            mprFree(log);
+            return 0;
+        }
+        host->logWriter = log;
+#endif
     }
 #endif
     return 0;
@@ -145,6 +225,21 @@ int maStartAccessLogging(MaHost *host)
 
 int maStopAccessLogging(MaHost *host)
 {
+    MaAccessLog     *log;
+
+    if ((log = host->logWriter) != 0) {
+#if BLD_FEATURE_MULTITHREAD
+        lock(log);
+        log->stopping = 1;
+        unlock(log);
+        mprSignalCond(log->wakeup);
+        if (mprWaitForCond(log->done, MPR_TIMEOUT_STOP) < 0) {
+            mprError(host, "Timeout waiting for the access log writer to exit");
+        }
+#endif
+        host->logWriter = 0;
+        mprFree(log);
+    }
     if (host->accessLog) {
         mprFree(host->accessLog);
         host->accessLog = 0;
@@ -153,6 +248,102 @@ int maStopAccessLogging(MaHost *host)
 }
 
 
+/*
+ *  Compile the log format into a list of operations so requests don't need to parse the format
+ */
+static void compileLogFormat(MaHost *host, cchar *fmt)
+{
+    LogOp       *op;
+    cchar       *start, *cp;
+    char        key[80], *kp;
+    int         c, len;
+
+    mprFree(host->logOps);
+    host->logOps = mprCreateList(host);
+
+    while (*fmt) {
+        op = mprAllocObjZeroed(host->logOps, LogOp);
+        if (op == 0) {
+            return;
+        }
+        mprAddItem(host->logOps, op);
+        if (*fmt != '%' || fmt[1] == '%' || fmt[1] == '\0') {
+            start = fmt;
+            if (*fmt == '%') {
+                op->type = LOG_LITERAL;
+                op->len = 1;
+                op->text = mprStrdup(op, "%");
+                if (fmt[1] == '\0') {
+                    /* Trailing percent */
+                    break;
+                }
+                /* Escaped percent */
+                fmt += 2;
+                continue;
+            }
+            while (*fmt && *fmt != '%') {
+                fmt++;
+            }
+            op->type = LOG_LITERAL;
+            op->len = (int) (fmt - start);
+            op->text = mprMemdup(op, start, op->len);
+            continue;
+        }
+        fmt++;
+        switch (c = *fmt++) {
+        case 'a': case 'A': case 'b': case 'B': case 'h': case 'n': case 'l': case 'O': case 'r': case 's': case 't': 
+        case 'u':
+            op->type = c;
+            break;
+
+        case '{':                           /* Header line */
+            if ((cp = strchr(fmt, '}')) != 0) {
+                if (cp[1] == 'i') {
+                    len = min((int) (cp - fmt), (int) sizeof(key) - 6);
+                    mprStrcpy(key, sizeof(key), "HTTP_");
+                    memcpy(&key[5], fmt, len);
+                    key[len + 5] = '\0';
+                    mprStrUpper(key);
+                    for (kp = key; *kp; kp++) {
+                        if (*kp == '-') {
+                            *kp = '_';
+                        }
+                    }
+                    op->type = LOG_HEADER;
+                    op->text = mprStrdup(op, key);
+                } else {
+                    op->type = LOG_LITERAL;
+                    op->len = (int) (cp - fmt);
+                    op->text = mprMemdup(op, fmt, op->len);
+                }
+                fmt = (cp[1]) ? &cp[2] : &cp[1];
+            } else {
+                op->type = LOG_LITERAL;
+                op->text = mprStrdup(op, "{");
+                op->len = 1;
+            }
+            break;
+
+        case '>':
+            if (*fmt == 's') {
+                fmt++;
+                op->type = LOG_CODE;
+            } else {
+                op->type = LOG_LITERAL;
+                op->text = mprStrdup(op, "");
+            }
+            break;
+
+        default:
+            op->type = LOG_LITERAL;
+            op->text = mprMemdup(op, &fmt[-1], 1);
+            op->len = 1;
+            break;
+        }
+    }
+}
+
+
 void maSetAccessLog(MaHost *host, cchar *path, cchar *format)
 {
     char    *src, *dest;
@@ -178,6 +369,17 @@ void maSetAccessLog(MaHost *host, cchar *path, cchar *format)
         *dest++ = *src;
     }
     *dest = '\0';
+    compileLogFormat(host, host->logFormat);
+}
+
+
+/*
+ *  Set the size of the access log ring buffer and whether requests block or drop entries when it is full
+ */
+void maSetAccessLogBuffer(MaHost *host, int size, bool block)
+{
+    host->logBufSize = max(size, MPR_BUFSIZE);
+    host->logBlock = block;
 }
 
 
@@ -187,20 +389,86 @@ void maSetLogHost(MaHost *host, MaHost *logHost)
 }
 
 
+/*
+ *  Queue an entry for the access log writer. If there is no writer, the entry is written immediately.
+ */
 void maWriteAccessLogEntry(MaHost *host, cchar *buf, int len)
 {
-    static int once = 0;
+    MaAccessLog     *log;
+    static int      once = 0;
+#if BLD_FEATURE_MULTITHREAD
+    int             end, count, need;
+#endif
 
-    if (mprWrite(host->accessLog, (char*) buf, len) != len && once++ == 0) {
-        mprError(host, "Can't write to access log %s", host->logPath);
+    if ((log = host->logWriter) == 0) {
+        if (mprWrite(host->accessLog, (char*) buf, len) != len && once++ == 0) {
+            mprError(host, "Can't write to access log %s", host->logPath);
+        }
+        return;
+    }
+#if BLD_FEATURE_MULTITHREAD
+    /*
+        An entry larger than the ring waits for the ring to drain and is then written directly under the lock.
+        The writer thread only writes while the ring is non-empty, so entries stay in order.
+     */
+    need = min(len, log->size);
+    lock(log);
+    while ((log->size - log->length) < need) {
+        if (!host->logBlock || log->stopping) {
+            log->dropped++;
+            unlock(log);
+            return;
+        }
+        unlock(log);
+        mprSignalCond(log->wakeup);
+        mprWaitForCond(log->space, MA_ACCESS_LOG_FLUSH);
+        lock(log);
     }
+    if (len > log->size) {
+        if (mprWrite(host->accessLog, (char*) buf, len) != len && once++ == 0) {
+            mprError(host, "Can't write to access log %s", host->logPath);
+        }
+        unlock(log);
+        return;
+    }
+    end = (log->start + log->length) % log->size;
+    count = min(len, log->size - end);
+    memcpy(&log->ring[end], buf, count);
+    if (count < len) {
+        memcpy(log->ring, &buf[count], len - count);
+    }
+    log->length += len;
+    count = log->length;
+    unlock(log);
+
+    if (count >= (log->size / 2)) {
+        mprSignalCond(log->wakeup);
+    }
+#endif
 }
 
 
 /*
- *  Called to rotate the access log
+ *  Called to rotate the access log. If there is a writer thread, it rotates the log after writing pending entries.
  */
 void maRotateAccessLog(MaHost *host)
+{
+#if BLD_FEATURE_MULTITHREAD
+    MaAccessLog     *log;
+
+    if ((log = host->logWriter) != 0) {
+        lock(log);
+        log->rotate = 1;
+        unlock(log);
+        mprSignalCond(log->wakeup);
+        return;
+    }
+#endif
+    rotateAccessLog(host);
+}
+
+
+static void rotateAccessLog(MaHost *host)
 {
     MprPath         info;
     struct tm       tm;
@@ -220,137 +488,212 @@ void maRotateAccessLog(MaHost *host)
 }
 
 
+#if BLD_FEATURE_MULTITHREAD
+/*
+ *  Access log writer thread. Wake periodically or when the ring is half full and write all pending entries.
+ */
+static void logWriterMain(MaAccessLog *log, MprThread *tp)
+{
+    int     stopping;
+
+    do {
+        mprWaitForCond(log->wakeup, MA_ACCESS_LOG_FLUSH);
+        lock(log);
+        stopping = log->stopping;
+        flushAccessLog(log);
+        unlock(log);
+    } while (!stopping);
+    mprSignalCond(log->done);
+}
+
+
+/*
+ *  Write all pending entries. Called locked. The lock is released while writing so requests can continue to append.
+ */
+static void flushAccessLog(MaAccessLog *log)
+{
+    MaHost      *host;
+    MprIOVec    iovec[2];
+    int         count, len, written, dropped;
+
+    host = log->host;
+    while (log->length > 0) {
+        len = log->length;
+        iovec[0].start = &log->ring[log->start];
+        iovec[0].len = min(len, log->size - log->start);
+        iovec[1].start = log->ring;
+        iovec[1].len = len - iovec[0].len;
+        count = (iovec[1].len > 0) ? 2 : 1;
+        dropped = log->dropped;
+        log->dropped = 0;
+        unlock(log);
+
+        if (dropped) {
+            mprLog(host, 2, "Access log buffer full, dropped %d entries", dropped);
+        }
+#if BLD_UNIX_LIKE
+        written = (int) writev(host->accessLog->fd, (struct iovec*) iovec, count);
+#else
+        written = mprWrite(host->accessLog, iovec[0].start, (int) iovec[0].len);
+        if (written == (int) iovec[0].len && count > 1) {
+            written += mprWrite(host->accessLog, iovec[1].start, (int) iovec[1].len);
+        }
+#endif
+        lock(log);
+        if (written != len) {
+            mprError(host, "Can't write to access log %s", host->logPath);
+            written = len;
+        }
+        log->start = (log->start + written) % log->size;
+        log->length -= written;
+        mprSignalCond(log->space);
+    }
+    if (log->rotate) {
+        log->rotate = 0;
+        rotateAccessLog(host);
+    }
+}
+#endif
+
+
+static void putLog(LogLine *lp, cchar *str, int len)
+{
+    if (len < 0) {
+        len = (int) strlen(str);
+    }
+    len = min(len, lp->size - lp->len);
+    memcpy(&lp->buf[lp->len], str, len);
+    lp->len += len;
+}
+
+
+static void putLogNumber(LogLine *lp, int64 value)
+{
+    char    numBuf[32];
+
+    putLog(lp, mprItoa(numBuf, sizeof(numBuf), value, 10), -1);
+}
+
+
+/*
+ *  Return the local time text. This is cached as it only changes each second.
+ */
+static void putLogDate(MaConn *conn, LogLine *lp, MaAccessLog *log)
+{
+    MprTime     now;
+    char        *timeText;
+
+    now = mprGetTime(conn);
+    if (log == 0) {
+        timeText = mprFormatLocalTime(conn, now);
+        putLog(lp, timeText, -1);
+        mprFree(timeText);
+        return;
+    }
+    lock(log);
+    if ((now / MPR_TICKS_PER_SEC) != log->dateSecs) {
+        log->dateSecs = now / MPR_TICKS_PER_SEC;
+        timeText = mprFormatLocalTime(log, now);
+        mprStrcpy(log->date, sizeof(log->date), timeText);
+        mprFree(timeText);
+    }
+    putLog(lp, log->date, -1);
+    unlock(log);
+}
+
+
 void maLogRequest(MaConn *conn)
 {
     MaHost      *logHost, *host;
     MaResponse  *resp;
     MaRequest   *req;
-    MprBuf      *buf;
-    char        keyBuf[80], *timeText, *fmt, *cp, *qualifier, *value, c;
-    int         len;
+    LogLine     line;
+    LogOp       *op;
+    char        buf[MPR_MAX_URL + 256], *value;
+    int         next;
 
     resp = conn->response;
     req = conn->request;
     host = req->host;
 
     logHost = host->logHost;
-    if (logHost == 0) {
-        return;
-    }
-    fmt = logHost->logFormat;
-    if (fmt == 0) {
+    if (logHost == 0 || logHost->logOps == 0 || logHost->accessLog == 0) {
         return;
     }
     if (req->method == 0) {
         return;
     }
+    line.buf = buf;
+    line.len = 0;
+    line.size = sizeof(buf) - 1;
+
+    for (next = 0; (op = mprGetNextItem(logHost->logOps, &next)) != 0; ) {
+        switch (op->type) {
+        case LOG_LITERAL:
+            putLog(&line, op->text, op->len);
+            break;
 
-    len = MPR_MAX_URL + 256;
-    buf = mprCreateBuf(resp, len, len);
-
-    while ((c = *fmt++) != '\0') {
-        if (c != '%' || (c = *fmt++) == '%') {
-            mprPutCharToBuf(buf, c);
-            continue;
-        }
-
-        switch (c) {
         case 'a':                           /* Remote IP */
-            mprPutStringToBuf(buf, conn->remoteIpAddr);
+        case 'h':                           /* Remote host */
+            putLog(&line, conn->remoteIpAddr, -1);
             break;
 
         case 'A':                           /* Local IP */
-            mprPutStringToBuf(buf, conn->sock->listenSock->ipAddr);
+            putLog(&line, conn->sock->listenSock->ipAddr, -1);
             break;
 
         case 'b':
             if (resp->bytesWritten == 0) {
-                mprPutCharToBuf(buf, '-');
+                putLog(&line, "-", 1);
             } else {
-                mprPutIntToBuf(buf, resp->bytesWritten);
+                putLogNumber(&line, resp->bytesWritten);
             } 
             break;
 
         case 'B':                           /* Bytes written (minus headers) */
-            mprPutIntToBuf(buf, resp->bytesWritten - resp->headerSize);
-            break;
-
-        case 'h':                           /* Remote host */
-            mprPutStringToBuf(buf, conn->remoteIpAddr);
+            putLogNumber(&line, resp->bytesWritten - resp->headerSize);
             break;
 
         case 'n':                           /* Local host */
-            mprPutStringToBuf(buf, req->parsedUri->host);
+            putLog(&line, req->parsedUri->host, -1);
             break;
 
         case 'l':                           /* Supplied in authorization */
-            mprPutStringToBuf(buf, req->user ? req->user : "-");
+        case 'u':                           /* Remote username */
+            putLog(&line, req->user ? req->user : "-", -1);
             break;
 
         case 'O':                           /* Bytes written (including headers) */
-            mprPutIntToBuf(buf, resp->bytesWritten);
+            putLogNumber(&line, resp->bytesWritten);
             break;
 
         case 'r':                           /* First line of request */
-            mprPutFmtToBuf(buf, "%s %s %s", req->methodName, req->parsedUri->originalUri, req->httpProtocol);
+            putLog(&line, req->methodName, -1);
+            putLog(&line, " ", 1);
+            putLog(&line, req->parsedUri->originalUri, -1);
+            putLog(&line, " ", 1);
+            putLog(&line, req->httpProtocol, -1);
             break;
 
         case 's':                           /* Response code */
-            mprPutIntToBuf(buf, resp->code);
+        case LOG_CODE:
+            putLogNumber(&line, resp->code);
             break;
 
         case 't':                           /* Time */
-            mprPutCharToBuf(buf, '[');
-            timeText = mprFormatLocalTime(conn, mprGetTime(conn));
-            mprPutStringToBuf(buf, timeText);
-            mprFree(timeText);
-            mprPutCharToBuf(buf, ']');
+            putLog(&line, "[", 1);
+            putLogDate(conn, &line, logHost->logWriter);
+            putLog(&line, "]", 1);
             break;
 
-        case 'u':                           /* Remote username */
-            mprPutStringToBuf(buf, req->user ? req->user : "-");
-            break;
-
-        case '{':                           /* Header line */
-            qualifier = fmt;
-            if ((cp = strchr(qualifier, '}')) != 0) {
-                fmt = &cp[1];
-                *cp = '\0';
-                c = *fmt++;
-                mprStrcpy(keyBuf, sizeof(keyBuf), "HTTP_");
-                mprStrcpy(&keyBuf[5], sizeof(keyBuf) - 5, qualifier);
-                mprStrUpper(keyBuf);
-                switch (c) {
-                case 'i':
-                    value = (char*) mprLookupHash(req->headers, keyBuf);
-                    mprPutStringToBuf(buf, value ? value : "-");
-                    break;
-                default:
-                    mprPutStringToBuf(buf, qualifier);
-                }
-                *cp = '}';
-
-            } else {
-                mprPutCharToBuf(buf, c);
-            }
-            break;
-
-        case '>':
-            if (*fmt == 's') {
-                fmt++;
-                mprPutIntToBuf(buf, resp->code);
-            }
-            break;
-
-        default:
-            mprPutCharToBuf(buf, c);
+        case LOG_HEADER:                    /* Header line */
+            value = (char*) mprLookupHash(req->headers, op->text);
+            putLog(&line, value ? value : "-", -1);
             break;
         }
     }
-    mprPutCharToBuf(buf, '\n');
-    mprAddNullToBuf(buf);
-
-    mprWrite(logHost->accessLog, mprGetBufStart(buf), mprGetBufLength(buf));
+    line.buf[line.len++] = '\n';
+    maWriteAccessLogEntry(logHost, line.buf, line.len);
 }
 
 #else
@@ -0,0 +1,401 @@
+/*
+ *  metrics.c -- Request metrics
+ *
+ *  Metrics are accumulated per host and per handler for each completed request. To minimize contention, counters are 
+ *  split into shards and each thread updates the shard selected by its thread ID. The shards are merged when read.
+ *
+ *  If RequestTiming is enabled, high resolution timestamps are also recorded at each pipeline transition and around
+ *  each queue service routine. Requests slower than the host threshold are traced to the log as a single line of
+ *  "key=value" fields (times in usec). Queue service times may overlap the run phase if the handler services the
+ *  queues itself.
+ *
+ *  Copyright (c) All Rights Reserved. See copyright notice at the bottom of the file.
+ */
+
+/********************************* Includes ***********************************/
+
+#include    "http.h"
+
+/*********************************** Defines **********************************/
+
+#define SUB_BUCKETS     (1 << MA_METRICS_SUB_BITS)
+
+/*********************************** Locals ***********************************/
+
+static cchar *timingPhases[MA_TIMING_PHASES] = {
+    "parse", "match", "pipeline", "content", "run", "output", "blocked"
+};
+
+/*********************************** Code *************************************/
+
+MaMetrics *maCreateMetrics(MprCtx ctx)
+{
+    MaMetrics   *metrics;
+#if BLD_FEATURE_MULTITHREAD
+    int         i;
+#endif
+
+    if ((metrics = mprAllocObjZeroed(ctx, MaMetrics)) == 0) {
+        return 0;
+    }
+#if BLD_FEATURE_MULTITHREAD
+    for (i = 0; i < MA_METRICS_SHARDS; i++) {
+        mprInitSpinLock(metrics, &metrics->shards[i].lock);
+    }
+#endif
+    return metrics;
+}
+
+
+/*
+ *  Map a latency to a log-linear histogram bucket. Values below SUB_BUCKETS have their own bucket. Above that, each 
+ *  power of two is split into SUB_BUCKETS linear buckets.
+ */
+static int getBucket(int64 value)
+{
+    int     msb, bucket;
+
+    if (value < SUB_BUCKETS) {
+        return (value < 0) ? 0 : (int) value;
+    }
+    for (msb = MA_METRICS_SUB_BITS; (value >> (msb + 1)) != 0; msb++) ;
+    bucket = (msb - MA_METRICS_SUB_BITS + 1) * SUB_BUCKETS + (int) ((value >> (msb - MA_METRICS_SUB_BITS)) & 
+        (SUB_BUCKETS - 1));
+    return min(bucket, MA_METRICS_BUCKETS - 1);
+}
+
+
+int64 maGetMetricsBucketLimit(int bucket)
+{
+    int     shift;
+
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    shift = (bucket / SUB_BUCKETS) - 1;
+    return ((int64) (SUB_BUCKETS + (bucket % SUB_BUCKETS) + 1) << shift) - 1;
+}
+
+
+static MaMetricShard *getShard(MaMetrics *metrics)
+{
+#if MA_METRICS_SHARDS > 1
+    uint64      id;
+
+    id = (uint64) (size_t) mprGetCurrentOsThread();
+    id ^= id >> 17;
+    id *= 0x9E3779B97F4A7C15LL;
+    return &metrics->shards[(id >> 32) % MA_METRICS_SHARDS];
+#else
+    return &metrics->shards[0];
+#endif
+}
+
+
+static void updateCounters(MaMetrics *metrics, int64 bytesIn, int64 bytesOut, int status, int keepAlive, int64 elapsed)
+{
+    MaMetricShard       *shard;
+    MaMetricCounters    *cp;
+
+    shard = getShard(metrics);
+#if BLD_FEATURE_MULTITHREAD
+    mprSpinLock(&shard->lock);
+#endif
+    cp = &shard->counters;
+    cp->requests++;
+    cp->bytesIn += bytesIn;
+    cp->bytesOut += bytesOut;
+    cp->keepAlive += keepAlive;
+    if (status >= 0) {
+        cp->status[status]++;
+    }
+    cp->latencySum += elapsed;
+    if (elapsed > cp->latencyMax) {
+        cp->latencyMax = elapsed;
+    }
+    cp->latency[getBucket(elapsed)]++;
+#if BLD_FEATURE_MULTITHREAD
+    mprSpinUnlock(&shard->lock);
+#endif
+}
+
+
+/*
+ *  Record a completed request against its host and handler
+ */
+void maUpdateMetrics(MaConn *conn)
+{
+    MaRequest   *req;
+    MaResponse  *resp;
+    MaHost      *host;
+    int64       bytesIn, elapsed;
+    int         status, keepAlive;
+
+    req = conn->request;
+    resp = conn->response;
+    host = req->host;
+
+    if (req->method == 0) {
+        return;
+    }
+    bytesIn = req->headerSize + req->receivedContent;
+    status = (resp->code >= 100 && resp->code < 600) ? (resp->code / 100) - 1 : -1;
+    keepAlive = conn->requestCount > 1;
+    elapsed = mprGetTime(conn) - req->startTime;
+
+    if (host && host->metrics) {
+        updateCounters(host->metrics, bytesIn, resp->bytesWritten, status, keepAlive, elapsed);
+    }
+    if (resp->handler && resp->handler->metrics) {
+        updateCounters(resp->handler->metrics, bytesIn, resp->bytesWritten, status, keepAlive, elapsed);
+    }
+}
+
+
+void maGetMetrics(MaMetrics *metrics, MaMetricCounters *counters)
+{
+    MaMetricShard       *shard;
+    MaMetricCounters    *cp;
+    int                 i, j;
+
+    memset(counters, 0, sizeof(MaMetricCounters));
+    for (i = 0; i < MA_METRICS_SHARDS; i++) {
+        shard = &metrics->shards[i];
+#if BLD_FEATURE_MULTITHREAD
+        mprSpinLock(&shard->lock);
+#endif
+        cp = &shard->counters;
+        counters->requests += cp->requests;
+        counters->bytesIn += cp->bytesIn;
+        counters->bytesOut += cp->bytesOut;
+        counters->keepAlive += cp->keepAlive;
+        for (j = 0; j < MA_METRICS_STATUS; j++) {
+            counters->status[j] += cp->status[j];
+        }
+        counters->latencySum += cp->latencySum;
+        counters->latencyMax = max(counters->latencyMax, cp->latencyMax);
+        for (j = 0; j < MA_METRICS_BUCKETS; j++) {
+            counters->latency[j] += cp->latency[j];
+        }
+        counters->timed += cp->timed;
+        for (j = 0; j < MA_TIMING_PHASES; j++) {
+            counters->phase[j] += cp->phase[j];
+        }
+        counters->serviceTime += cp->serviceTime;
+        counters->serviceCount += cp->serviceCount;
+#if BLD_FEATURE_MULTITHREAD
+        mprSpinUnlock(&shard->lock);
+#endif
+    }
+}
+
+
+int64 maGetMetricsPercentile(MaMetricCounters *counters, int percent)
+{
+    int64       total, target;
+    int         i;
+
+    if (counters->requests == 0) {
+        return 0;
+    }
+    target = (counters->requests * percent + 99) / 100;
+    for (total = 0, i = 0; i < MA_METRICS_BUCKETS; i++) {
+        total += counters->latency[i];
+        if (total >= target) {
+            return min(maGetMetricsBucketLimit(i), counters->latencyMax);
+        }
+    }
+    return counters->latencyMax;
+}
+
+
+cchar *maGetTimingPhaseName(int phase)
+{
+    mprAssert(0 <= phase && phase < MA_TIMING_PHASES);
+    return timingPhases[phase];
+}
+
+
+/*
+ *  Start timing the current request. The timing object is freed with the request.
+ */
+void maStartTiming(MaConn *conn)
+{
+    MaTiming    *timing;
+
+    if ((timing = mprAllocObjZeroed(conn->request, MaTiming)) == 0) {
+        return;
+    }
+    timing->start = timing->mark = mprGetHiResTime(conn);
+    conn->timing = timing;
+}
+
+
+/*
+ *  Charge the time since the last transition to the given phase
+ */
+void maMarkTiming(MaConn *conn, int phase)
+{
+    MaTiming    *timing;
+    MprTime     now;
+
+    timing = conn->timing;
+    now = mprGetHiResTime(conn);
+    timing->phase[phase] += now - timing->mark;
+    timing->mark = now;
+}
+
+
+/*
+ *  Run a queue service routine and accumulate the time spent
+ */
+void maTimeService(MaQueue *q)
+{
+    MprTime     start;
+
+    start = mprGetHiResTime(q);
+    q->service(q);
+    q->serviceTime += mprGetHiResTime(q) - start;
+    q->serviceCount++;
+}
+
+
+void maTimeWriteBlocked(MaConn *conn, bool blocked)
+{
+    MaTiming    *timing;
+
+    timing = conn->timing;
+    if (blocked) {
+        if (timing->blockedStart == 0) {
+            timing->blockedStart = mprGetHiResTime(conn);
+            timing->blockedCount++;
+        }
+    } else if (timing->blockedStart) {
+        timing->phase[MA_TIMING_BLOCKED] += mprGetHiResTime(conn) - timing->blockedStart;
+        timing->blockedStart = 0;
+    }
+}
+
+
+static void updateTiming(MaMetrics *metrics, MaTiming *timing, MprTime serviceTime, int serviceCount)
+{
+    MaMetricShard       *shard;
+    MaMetricCounters    *cp;
+    int                 i;
+
+    shard = getShard(metrics);
+#if BLD_FEATURE_MULTITHREAD
+    mprSpinLock(&shard->lock);
+#endif
+    cp = &shard->counters;
+    if (timing) {
+        cp->timed++;
+        for (i = 0; i < MA_TIMING_PHASES; i++) {
+            cp->phase[i] += timing->phase[i];
+        }
+    }
+    cp->serviceTime += serviceTime;
+    cp->serviceCount += serviceCount;
+#if BLD_FEATURE_MULTITHREAD
+    mprSpinUnlock(&shard->lock);
+#endif
+}
+
+
+/*
+ *  Complete timing for a request. Add the phase times to the host metrics and the queue service times to the stage
+ *  metrics. Trace the request if it took longer than the host threshold.
+ */
+void maCompleteTiming(MaConn *conn)
+{
+    MaRequest   *req;
+    MaResponse  *resp;
+    MaHost      *host;
+    MaTiming    *timing;
+    MaQueue     *q, *qhead;
+    MprBuf      *buf;
+    MprTime     total;
+    int         i, dir;
+
+    req = conn->request;
+    resp = conn->response;
+    host = req->host;
+    timing = conn->timing;
+
+    maMarkTiming(conn, MA_TIMING_OUTPUT);
+    maTimeWriteBlocked(conn, 0);
+    total = timing->mark - timing->start;
+
+    if (host->metrics) {
+        updateTiming(host->metrics, timing, 0, 0);
+    }
+    for (dir = 0; dir < MA_MAX_QUEUE; dir++) {
+        qhead = &resp->queue[dir];
+        for (q = qhead->nextQ; q != qhead; q = q->nextQ) {
+            if (q->serviceCount && q->stage->metrics) {
+                updateTiming(q->stage->metrics, 0, q->serviceTime, q->serviceCount);
+            }
+        }
+    }
+    if (total < ((MprTime) host->timingThreshold * 1000)) {
+        return;
+    }
+    buf = mprCreateBuf(req, MA_BUFSIZE, -1);
+    mprPutFmtToBuf(buf, "timing: conn=%d method=%s url=%s status=%d total=%Ld", conn->seqno, 
+        req->methodName ? req->methodName : "-", req->url ? req->url : "-", resp->code, total);
+    for (i = 0; i < MA_TIMING_PHASES; i++) {
+        mprPutFmtToBuf(buf, " %s=%Ld", timingPhases[i], timing->phase[i]);
+    }
+    mprPutFmtToBuf(buf, " blockedCount=%d service=", timing->blockedCount);
+    for (i = 0, dir = 0; dir < MA_MAX_QUEUE; dir++) {
+        qhead = &resp->queue[dir];
+        for (q = qhead->nextQ; q != qhead; q = q->nextQ) {
+            if (q->serviceCount) {
+                mprPutFmtToBuf(buf, "%s%s%s:%Ld/%d", (i++ > 0) ? "," : "", q->stage->name, 
+                    (dir == MA_QUEUE_RECEIVE) ? ".rx" : "", q->serviceTime, q->serviceCount);
+            }
+        }
+    }
+    if (i == 0) {
+        mprPutCharToBuf(buf, '-');
+    }
+    mprAddNullToBuf(buf);
+    mprLog(conn, 0, "%s", mprGetBufStart(buf));
+    mprFree(buf);
+}
+
+/*
+ *  @copy   default
+ *  
+ *  Copyright (c) Embedthis Software LLC, 2003-2011. All Rights Reserved.
+ *  Copyright (c) Michael O'Brien, 1993-2011. All Rights Reserved.
+ *  
+ *  This software is distributed under commercial and open source licenses.
+ *  You may use the GPL open source license described below or you may acquire 
+ *  a commercial license from Embedthis Software. You agree to be fully bound 
+ *  by the terms of either license. Consult the LICENSE.TXT distributed with 
+ *  this software for full details.
+ *  
+ *  This software is open source; you can redistribute it and/or modify it 
+ *  under the terms of the GNU General Public License as published by the 
+ *  Free Software Foundation; either version 2 of the License, or (at your 
+ *  option) any later version. See the GNU General Public License for more 
+ *  details at: http://www.embedthis.com/downloads/gplLicense.html
+ *  
+ *  This program is distributed WITHOUT ANY WARRANTY; without even the 
+ *  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+ *  
+ *  This GPL license does NOT permit incorporating this software into 
+ *  proprietary programs. If you are unable to comply with the GPL, you must
+ *  acquire a commercial license to use this software. Commercial licenses 
+ *  for this software and support services are available from Embedthis 
+ *  Software at http://www.embedthis.com 
+ *  
+ *  Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
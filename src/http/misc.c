@@ -8,22 +8,216 @@
 
 #include    "http.h"
 
+/*********************************** Locals ***********************************/
+/*
+ *  Date cache. The current date is formatted once per second into a new immutable entry that is published by 
+ *  swapping a pointer. Last-Modified dates are cached in a small direct mapped table of immutable entries published
+ *  the same way. Readers never lock. Replaced entries are retired and only freed after MA_DATE_RETAIN seconds, so 
+ *  readers may safely use a date string for at least that long.
+ */
+typedef struct MaDateEntry {
+    struct MaDateEntry *next;               /* Next retired entry */
+    MprTime         when;                   /* Time in seconds. For Last-Modified entries, the modification time */
+    MprTime         retired;                /* When the entry was replaced in seconds */
+    int             len;                    /* Length of the headers */
+    char            date[MA_DATE_SIZE];     /* Formatted date */
+    char            headers[MA_DATE_SIZE + sizeof(MA_SERVER_NAME) + 20];   /* Date and Server header lines */
+} MaDateEntry;
+
+typedef struct MaDateCache {
+    MaDateEntry * volatile current;         /* Current date entry */
+    MaDateEntry * volatile modified[MA_DATE_MODIFIED];   /* Last-Modified date entries */
+    MaDateEntry     *retired;               /* Replaced entries, most recently retired first */
+    MprHeap         *heap;                  /* Thread-safe heap for entries */
+#if BLD_FEATURE_MULTITHREAD
+    MprSpin         lock;                   /* Lock for writers */
+#endif
+} MaDateCache;
+
+#if BLD_FEATURE_MULTITHREAD
+    #define lockDates(cache) mprSpinLock(&(cache)->lock)
+    #define unlockDates(cache) mprSpinUnlock(&(cache)->lock)
+#else
+    #define lockDates(cache)
+    #define unlockDates(cache)
+#endif
+
 /************************************ Code ************************************/
+
+static void formatDate(MprCtx ctx, MprTime when, char *buf, int bufsize)
+{
+    struct tm   tm;
+    char        *date;
+
+    mprDecodeUniversalTime(ctx, &tm, when);
+    date = mprFormatTime(ctx, MPR_HTTP_DATE, &tm);
+    mprStrcpy(buf, bufsize, date);
+    mprFree(date);
+}
+
+
+/*
+ *  Format a new current date entry. Returns null if memory is exhausted.
+ */
+static MaDateEntry *createCurrentDate(MaHttp *http, MaDateCache *cache, MprTime now)
+{
+    MaDateEntry     *ep;
+
+    if ((ep = mprAllocObjZeroed(cache->heap, MaDateEntry)) == 0) {
+        return 0;
+    }
+    formatDate(http, now, ep->date, sizeof(ep->date));
+    mprSprintf(ep->headers, sizeof(ep->headers), "Date: %s\r\nServer: %s\r\n", ep->date, MA_SERVER_NAME);
+    ep->len = (int) strlen(ep->headers);
+    ep->when = now / MPR_TICKS_PER_SEC;
+    return ep;
+}
+
+
+int maCreateDateCache(MaHttp *http)
+{
+    MaDateCache     *cache;
+
+    if ((cache = mprAllocObjZeroed(http, MaDateCache)) == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    if ((cache->heap = mprAllocHeap(cache, "dates", 1, 1, NULL)) == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+    if ((cache->current = createCurrentDate(http, cache, mprGetTime(http))) == 0) {
+        return MPR_ERR_NO_MEMORY;
+    }
+#if BLD_FEATURE_MULTITHREAD
+    mprInitSpinLock(cache, &cache->lock);
+#endif
+    http->dateCache = cache;
+    return 0;
+}
+
+
+/*
+ *  Retire a replaced entry and free entries retired more than MA_DATE_RETAIN seconds ago. Must hold the lock.
+ */
+static void retireDate(MaDateCache *cache, MaDateEntry *ep, MprTime when)
+{
+    MaDateEntry     **pp, *np;
+
+    ep->retired = when;
+    ep->next = cache->retired;
+    cache->retired = ep;
+
+    for (pp = &cache->retired; *pp; pp = &(*pp)->next) {
+        if ((*pp)->retired + MA_DATE_RETAIN < when) {
+            for (ep = *pp; ep; ep = np) {
+                np = ep->next;
+                mprFree(ep);
+            }
+            *pp = 0;
+            break;
+        }
+    }
+}
+
+
+static MaDateEntry *getCurrentDate(MaHttp *http)
+{
+    MaDateCache     *cache;
+    MaDateEntry     *ep, *prior;
+    MprTime         now, when;
+
+    cache = http->dateCache;
+    now = mprGetTime(http);
+    when = now / MPR_TICKS_PER_SEC;
+
+    ep = cache->current;
+    if (likely(ep->when == when)) {
+        return ep;
+    }
+    lockDates(cache);
+    prior = cache->current;
+    if (prior->when == when) {
+        ep = prior;
+    } else if ((ep = createCurrentDate(http, cache, now)) == 0) {
+        ep = prior;
+    } else {
+        mprAtomicBarrier();
+        cache->current = ep;
+        retireDate(cache, prior, when);
+    }
+    unlockDates(cache);
+    return ep;
+}
+
+
+cchar *maGetCurrentDate(MaHttp *http)
+{
+    return getCurrentDate(http)->date;
+}
+
+
+cchar *maGetDateHeaders(MaHttp *http, int *len)
+{
+    MaDateEntry     *ep;
+
+    ep = getCurrentDate(http);
+    *len = ep->len;
+    return ep->headers;
+}
+
+
+char *maGetModifiedDate(MaHttp *http, MprTime mtime, char *buf, int bufsize)
+{
+    MaDateCache     *cache;
+    MaDateEntry     *ep, *prior;
+    int             index;
+
+    cache = http->dateCache;
+    index = (int) ((uint64) mtime % MA_DATE_MODIFIED);
+
+    ep = cache->modified[index];
+    if (ep && ep->when == mtime) {
+        mprStrcpy(buf, bufsize, ep->date);
+        return buf;
+    }
+    formatDate(http, mtime * MPR_TICKS_PER_SEC, buf, bufsize);
+
+    lockDates(cache);
+    if ((ep = mprAllocObjZeroed(cache->heap, MaDateEntry)) != 0) {
+        ep->when = mtime;
+        mprStrcpy(ep->date, sizeof(ep->date), buf);
+        mprAtomicBarrier();
+        prior = cache->modified[index];
+        cache->modified[index] = ep;
+        if (prior) {
+            retireDate(cache, prior, mprGetTime(http) / MPR_TICKS_PER_SEC);
+        }
+    }
+    unlockDates(cache);
+    return buf;
+}
+
+
 /*
  *  Build an ASCII time string.  If sbuf is NULL we use the current time, else we use the last modified time of sbuf
  */
 char *maGetDateString(MprCtx ctx, MprPath *sbuf)
 {
-    MprTime     when;
-    struct tm   tm;
+    MaHttp      *http;
+    char        date[MA_DATE_SIZE];
 
+    http = (MaHttp*) mprGetMpr(ctx)->appwebHttpService;
+    if (http && http->dateCache) {
+        if (sbuf == 0) {
+            return mprStrdup(ctx, maGetCurrentDate(http));
+        }
+        return mprStrdup(ctx, maGetModifiedDate(http, (MprTime) sbuf->mtime, date, sizeof(date)));
+    }
     if (sbuf == 0) {
-        when = mprGetTime(ctx);
+        formatDate(ctx, mprGetTime(ctx), date, sizeof(date));
     } else {
-        when = (MprTime) sbuf->mtime * MPR_TICKS_PER_SEC;
+        formatDate(ctx, (MprTime) sbuf->mtime * MPR_TICKS_PER_SEC, date, sizeof(date));
     }
-    mprDecodeUniversalTime(ctx, &tm, when);
-    return mprFormatTime(ctx, MPR_HTTP_DATE, &tm);
+    return mprStrdup(ctx, date);
 }
 
 /*
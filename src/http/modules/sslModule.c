@@ -81,6 +81,53 @@ static int parseSsl(MaHttp *http, cchar *key, char *value, MaConfigState *state)
         mprFree(path);
         return 1;
 
+    } else if (mprStrcmpAnyCase(key, "SSLSessionCache") == 0) {
+        mprFree(path);
+        word = mprStrTok(value, " \t", &tok);
+        enable = mprStrTok(0, " \t", &tok);
+        if (word == 0 || !isdigit((int) *word)) {
+            return -1;
+        }
+        mprSetSslSessionCache(location->ssl, atoi(word), enable ? atoi(enable) : 0);
+        return 1;
+
+    } else if (mprStrcmpAnyCase(key, "SSLKernelTLS") == 0) {
+        mprFree(path);
+        if (mprStrcmpAnyCase(value, "on") == 0) {
+            mprSetSslKernelTls(location->ssl, 1);
+        } else if (mprStrcmpAnyCase(value, "off") == 0) {
+            mprSetSslKernelTls(location->ssl, 0);
+        } else {
+            return -1;
+        }
+        return 1;
+
+    } else if (mprStrcmpAnyCase(key, "SSLHandshakeTimeout") == 0) {
+        mprFree(path);
+        if (!isdigit((int) *value)) {
+            return -1;
+        }
+        maSetHandshakeTimeout(host, atoi(value) * 1000);
+        return 1;
+
+    } else if (mprStrcmpAnyCase(key, "SSLSessionTickets") == 0) {
+        mprFree(path);
+        enable = mprStrTok(value, " \t", &tok);
+        word = mprStrTok(0, " \t", &tok);
+        if (mprStrcmpAnyCase(enable, "on") == 0) {
+            mprSetSslSessionTickets(location->ssl, 1, word ? atoi(word) : -1);
+        } else if (mprStrcmpAnyCase(enable, "off") == 0) {
+            mprSetSslSessionTickets(location->ssl, 0, -1);
+        } else {
+            return -1;
+        }
+        return 1;
+
+    } else if (mprStrcmpAnyCase(key, "SSLSessionTicketKeyFile") == 0) {
+        mprSetSslTicketKeyFile(location->ssl, path);
+        mprFree(path);
+        return 1;
+
     } else if (mprStrcmpAnyCase(key, "SSLVerifyClient") == 0) {
         mprFree(path);
         if (mprStrcmpAnyCase(value, "require") == 0) {
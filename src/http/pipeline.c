@@ -120,7 +120,6 @@ static bool rewriteRequest(MaConn *conn)
 void maCreatePipeline(MaConn *conn)
 {
     MaHttp          *http;
-    MaHost          *host;
     MaResponse      *resp;
     MaRequest       *req;
     MaStage         *handler;
@@ -132,7 +131,6 @@ void maCreatePipeline(MaConn *conn)
 
     req = conn->request;
     resp = conn->response;
-    host = req->host;
     location = req->location;
     handler = resp->handler;
     http = conn->http;
@@ -184,10 +182,11 @@ void maCreatePipeline(MaConn *conn)
     }
 #if BLD_FEATURE_SEND
     if (resp->handler == http->fileHandler && connector == http->netConnector && req->method == MA_REQ_GET && 
-            http->sendConnector && !req->ranges && !host->secure && resp->chunkSize <= 0 && !conn->trace) {
+            http->sendConnector && !req->ranges && mprCanSocketSendFile(conn->sock) && resp->chunkSize <= 0 && 
+            !conn->trace) {
         /*
             Switch (transparently) to the send connector if serving whole static file content via the net connector
-            and not tracing.
+            and not tracing. Secure connections qualify only if the kernel is performing the record encryption.
         */
         connector = http->sendConnector;
     }
@@ -339,7 +338,9 @@ bool maRunPipeline(MaConn *conn)
     q = conn->response->queue[MA_QUEUE_SEND].nextQ;
     
     if (q->stage->run) {
+        MA_TIMING(conn, MA_TIMING_CONTENT);
         MEASURE(conn, q->stage->name, "run", q->stage->run(q));
+        MA_TIMING(conn, MA_TIMING_RUN);
     }
     if (conn->request) {
         return maServiceQueues(conn);
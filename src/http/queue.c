@@ -521,7 +521,11 @@ void maServiceQueue(MaQueue *q)
         maGetNextQueueForService(&q->conn->serviceq);
     }
     if (!(q->flags & MA_QUEUE_DISABLED)) {
-        q->service(q);
+        if (unlikely(q->conn->timing)) {
+            maTimeService(q);
+        } else {
+            q->service(q);
+        }
         q->flags |= MA_QUEUE_SERVICED;
     }
 }
@@ -774,6 +778,42 @@ MaPacket *maSplitPacket(MprCtx ctx, MaPacket *orig, int offset)
 }
 
 
+/*
+ *  Slice the first "size" bytes from a packet into a new packet. The slice content buffer is a view onto the original
+ *  packet buffer -- it does not own the data, so the original packet must outlive the slice.
+ */
+MaPacket *maSlicePacket(MprCtx ctx, MaPacket *orig, int size)
+{
+    MaPacket    *packet;
+    MprBuf      *buf;
+
+    if (orig->esize) {
+        if ((packet = maCreateEntityPacket(ctx, orig->epos, size, orig->fill)) == 0) {
+            return 0;
+        }
+        orig->epos += size;
+        orig->esize -= size;
+
+    } else {
+        mprAssert(size < maGetPacketLength(orig));
+        if ((packet = maCreatePacket(ctx, 0)) == 0) {
+            return 0;
+        }
+        if ((buf = mprAllocObjZeroed(packet, MprBuf)) == 0) {
+            mprFree(packet);
+            return 0;
+        }
+        buf->data = buf->start = mprGetBufStart(orig->content);
+        buf->end = buf->endbuf = buf->start + size;
+        buf->buflen = buf->maxsize = size;
+        packet->content = buf;
+        mprAdjustBufStart(orig->content, size);
+    }
+    packet->flags = orig->flags;
+    return packet;
+}
+
+
 void maAdjustPacketStart(MaPacket *packet, MprOff size)
 {
     if (packet->esize) {
@@ -95,6 +95,9 @@ void maProcessWriteEvent(MaConn *conn)
         return;
     }
     if (conn->response) {
+        if (unlikely(conn->timing)) {
+            maTimeWriteBlocked(conn, 0);
+        }
         /*
          *  Enable the queue upstream from the connector
          */
@@ -175,16 +178,21 @@ static bool parseRequest(MaConn *conn, MaPacket *packet)
         return 0;
     }
     if (parseFirstLine(conn, packet)) {
+        conn->request->headerSize = len + 4;
+        conn->requestCount++;
         parseHeaders(conn, packet);
     } else {
         return 0;
     }
+    MA_TIMING(conn, MA_TIMING_PARSE);
     maMatchHandler(conn);
+    MA_TIMING(conn, MA_TIMING_MATCH);
     
     /*
      *  Have read the headers. Create the request pipeline. This calls the open() stage entry routines.
      */
     maCreatePipeline(conn);
+    MA_TIMING(conn, MA_TIMING_PIPELINE);
 
     req = conn->request;
     if (conn->connectionFailed) {
@@ -225,10 +233,13 @@ static bool parseFirstLine(MaConn *conn, MaPacket *packet)
     resp = conn->response = maCreateResponse(conn);
     host = conn->host;
 
-#if BLD_DEBUG    
     req->startTime = mprGetTime(conn);
+#if BLD_DEBUG    
     req->startTicks = mprGetTicks();
 #endif
+    if (unlikely(host->timing)) {
+        maStartTiming(conn);
+    }
 
     methodName = getToken(conn, " ");
     if (*methodName == '\0') {
@@ -512,6 +523,11 @@ static bool parseHeaders(MaConn *conn, MaPacket *packet)
                     host = hp;
                     conn->host = hp;
                     maAddConn(hp, conn);
+                    if (hp->timing && conn->timing == 0) {
+                        maStartTiming(conn);
+                    } else if (!hp->timing) {
+                        conn->timing = 0;
+                    }
                 }
             }
             break;
@@ -668,10 +684,9 @@ static int getChunkPacketSize(MaConn *conn, MprBuf *buf)
             maFailConnection(conn, MPR_HTTP_CODE_BAD_REQUEST, "Bad chunk specification");
             return 0;
         }
-        for (cp = &start[2]; cp < (char*) buf->end && *cp != '\n'; cp++) {}
-        if ((cp - start) < 2 || (cp[-1] != '\r' || cp[0] != '\n')) {
+        if ((cp = memchr(&start[2], '\n', mprGetBufLength(buf) - 2)) == 0 || cp[-1] != '\r') {
             /* Insufficient data */
-            if ((cp - start) > 80) {
+            if (mprGetBufLength(buf) > 80) {
                 maFailConnection(conn, MPR_HTTP_CODE_BAD_REQUEST, "Bad chunk specification");
                 return 0;
             }
@@ -820,6 +835,10 @@ bool maProcessCompletion(MaConn *conn)
     resp = conn->response;
 
     maLogRequest(conn);
+    maUpdateMetrics(conn);
+    if (unlikely(conn->timing)) {
+        maCompleteTiming(conn);
+    }
 
 #if BLD_DEBUG
     mprLog(req, 4, "Request complete used %,d K, conn usage %,d K, mpr usage %,d K, page usage %,d K", 
@@ -903,10 +922,9 @@ void maTraceContent(MaConn *conn, MaPacket *packet, int64 size, int64 offset, in
     if (size <= 0) {
         size = INT_MAX;
     }
-    if (packet->prefix) {
-        len = mprGetBufLength(packet->prefix);
-        len = (int) min(len, size);
-        traceBuf(conn, mprGetBufStart(packet->prefix), len, mask);
+    if (packet->prefixLen) {
+        len = (int) min(packet->prefixLen, size);
+        traceBuf(conn, packet->prefix, len, mask);
     }
     if (packet->content) {
         len = mprGetBufLength(packet->content);
@@ -1191,6 +1209,9 @@ void maRequestWriteBlocked(MaConn *conn)
 {
     mprLog(conn, 7, "Write blocked");
     conn->canProceed = 0;
+    if (unlikely(conn->timing)) {
+        maTimeWriteBlocked(conn, 1);
+    }
 }
 
 
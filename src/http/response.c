@@ -35,6 +35,7 @@ MaResponse *maCreateResponse(MaConn *conn)
     resp->length = -1;
     resp->entityLength = -1;
     resp->chunkSize = -1;
+    resp->spliceFd = -1;
 
     resp->headers = mprCreateHash(resp, MA_HEADER_HASH_SIZE);
     maInitQueue(http, &resp->queue[MA_QUEUE_SEND], "responseSendHead");
@@ -60,8 +61,9 @@ void maFillHeaders(MaConn *conn, MaPacket *packet)
     MprHash         *hp;
     MprBuf          *buf;
     struct tm       tm;
+    cchar           *headers;
     char            *hdr;
-    int             expires;
+    int             expires, len;
 
     mprAssert(packet->flags == MA_PACKET_HEADER);
 
@@ -83,8 +85,11 @@ void maFillHeaders(MaConn *conn, MaPacket *packet)
     mprPutStringToBuf(buf, mprGetHttpCodeString(resp, resp->code));
     mprPutStringToBuf(buf, "\r\n");
 
-    putHeader(conn, packet, "Date", req->host->currentDate);
-    putHeader(conn, packet, "Server", MA_SERVER_NAME);
+    /*
+     *  The Date and Server headers are formatted once per second and the keep-alive headers once per host
+     */
+    headers = maGetDateHeaders(conn->http, &len);
+    mprPutBlockToBuf(buf, headers, len);
 
     if (mprLookupHash(resp->headers, "Expires") || mprLookupHash(resp->headers, "Cache-Control")) {
         /* User defined expiry */;
@@ -143,11 +148,11 @@ void maFillHeaders(MaConn *conn, MaPacket *packet)
     }
 
     if (--conn->keepAliveCount > 0) {
-        putHeader(conn, packet, "Connection", "keep-alive");
-        putFormattedHeader(conn, packet, "Keep-Alive", "timeout=%d, max=%d", 
-            host->keepAliveTimeout / 1000, conn->keepAliveCount);
+        mprPutBlockToBuf(buf, host->keepAliveHeader, host->keepAliveHeaderLen);
+        mprPutIntToBuf(buf, conn->keepAliveCount);
+        mprPutStringToBuf(buf, "\r\n");
     } else {
-        putHeader(conn, packet, "Connection", "close");
+        mprPutStringToBuf(buf, "Connection: close\r\n");
     }
 
     /*
@@ -142,6 +142,7 @@ MaHttp *maCreateHttp(MprCtx ctx)
     mprGetMpr(ctx)->appwebHttpService = http;
     http->servers = mprCreateList(http);
     http->stages = mprCreateHash(http, 0);
+    maCreateDateCache(http);
 
 #if BLD_FEATURE_MULTITHREAD
     http->mutex = mprCreateLock(http);
@@ -179,6 +180,7 @@ MaHttp *maCreateHttp(MprCtx ctx)
     maOpenNetConnector(http);
 #endif
     maOpenPassHandler(http);
+    maOpenMetricsHandler(http);
     return http;
 }
 
@@ -272,6 +274,10 @@ int maStopHttp(MaHttp *http)
     for (next = 0; (server = mprGetNextItem(http->servers, &next)) != 0; ) {
         maStopServer(server);
     }
+    /*
+     *  Let modules save their state. The process may exit without stopping the MPR.
+     */
+    mprStopModuleService(mprGetMpr(http)->moduleService);
     return 0;
 }
 
@@ -119,6 +119,7 @@ MaStage *maCreateStage(MaHttp *http, cchar *name, int flags)
     }
     stage->flags = flags;
     stage->name = mprStrdup(stage, name);
+    stage->metrics = maCreateMetrics(stage);
 
     /*
      *  Caller will selectively override
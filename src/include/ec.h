@@ -528,6 +528,7 @@ typedef struct EcNode {
 #define EC_FLAGS_PARSE_ONLY      0x20                   /* Just parse source. Don't generate code */
 #define EC_FLAGS_RUN             0x40                   /* Code generated will be run immediately */
 #define EC_FLAGS_THROW           0x80                   /* Throw errors when compiling. Used for eval() */
+#define EC_FLAGS_OPTIMIZE        0x100                  /* Optimize byte code before writing module files */
 
 /*
  *  Lexical tokens (must start at 1)
@@ -1016,6 +1017,7 @@ typedef struct EcCompiler {
     bool        bind;                       /* Don't bind properties to slots */
     bool        noout;                      /* Don't generate any module output files */
     int         optimizeLevel;              /* Optimization factor (0-9) */
+    bool        optimize;                   /* Run the byte code optimizer before writing module files */
     bool        shbang;                     /* Observe #!/path as the first line of a script */
     int         warnLevel;                  /* Warning level factor (0-9) */
 
@@ -1023,6 +1025,7 @@ typedef struct EcCompiler {
     int         lang;                       /* Language compliance level: ecma|plus|fixed */
     char        *outputFile;                /* Output module file name override */
     MprFile     *file;                      /* Current output file handle */
+    char        *filePath;                  /* Path of the current output file. Written via a temporary file */
 
     int         parseOnly;                  /* Run the compiled code */
     int         run;                        /* Run the compiled code */
@@ -1099,6 +1102,7 @@ extern void         ecSetOutputFile(EcCompiler *cp, cchar *outputFile);
 extern void         ecSetCertFile(EcCompiler *cp, cchar *certFile);
 
 extern int          ecAstProcess(struct EcCompiler *cp, int argc,  struct EcNode **nodes);
+extern int          ecOptimizeFunction(EcCompiler *cp, EjsFunction *fun);
 
 /*
  *  Module file creation routines.
@@ -136,9 +136,20 @@ extern "C" {
  */
 #define EJS_NUM_CROSS_GEN           (EJS_GC_WORK_QUOTA * 12 / 10) 
 #define EJS_MAX_TYPE_POOL           200             /* Number of objects to pool per type */
+#define EJS_JSON_CHUNK              8192            /* Streamed JSON output chunk size */
+#define EJS_JSON_STACK              64              /* Initial JSON parser array element stack */
 
 #define EJS_SQLITE_TIMEOUT          30000           /* Database busy timeout */
+#define EJS_SQLITE_MAX_STMTS        64              /* Prepared statements cached per database connection */
+#define EJS_SQLITE_POOL_MAX         16              /* Idle database connections kept for reuse by the process */
 #define EJS_SESSION_TIMEOUT         1800
+#define EJS_SESSION_SHARDS          16              /* Lock stripes for the session store. Must be a power of 2. */
+#define EJS_SESSION_HASH_SIZE       1021            /* Session hash table size per shard */
+#define EJS_SESSION_WHEEL           256             /* Session expiry timing wheel buckets. One per timer period. */
+#define EJS_WEB_POOL_MAX_REQUESTS   1000            /* Requests served by a pooled interpreter before it is retired */
+#define EJS_WEB_GC_PERIOD           100             /* Msec between idle GC steps of pooled interpreters */
+#define EJS_WEB_CACHE_SHARDS        16              /* Lock stripes for the web cache. Must be a power of 2. */
+#define EJS_WEB_CACHE_MEMORY        (8 * 1024 * 1024) /* Default memory limit for the web cache */
 #define EJS_TIMER_PERIOD            1000            /* Timer checks ever 1 second */
 #define EJS_FILE_PERMS              0664            /* Default file perms */
 #define EJS_DIR_PERMS               0775            /* Default dir perms */
@@ -885,6 +896,8 @@ struct EjsWorker;
 #define EJS_FLAG_DOC            0x40        /**< Load documentation from modules */
 #define EJS_FLAG_EXIT           0x80        /**< Interpreter should exit */
 #define EJS_FLAG_NOEXIT         0x200       /**< App should service events and not exit */
+#define EJS_FLAG_NO_INLINE_CACHE 0x800      /**< Don't use inline caches for named property access */
+#define EJS_FLAG_WORKER         0x1000      /**< Interpreter runs a worker on a worker thread */
 
 #define EJS_FLAG_DYNAMIC        0x400       /* Make a type that is dynamic itself */
 #define EJS_STACK_ARG           -1          /* Offset to locate first arg */
@@ -972,11 +985,68 @@ typedef struct EjsLookup {
 } EjsLookup;
 
 
+/*
+ *  Inline caches for named property access. Each bytecode site that gets, puts or calls a property by name 
+ *  remembers the (type, slot) pairs it has resolved so later executions can skip the name lookup. Sites are 
+ *  polymorphic and hold up to EJS_INLINE_CACHE_WAYS entries. Entries are invalidated when any type's property 
+ *  layout changes.
+ */
+#define EJS_INLINE_CACHE_SITES      256     /* Cached sites per interpreter (power of 2) */
+#define EJS_INLINE_CACHE_WAYS       4       /* Entries per site */
+
+typedef struct EjsInlineCacheEntry {
+    struct EjsType  *type;                  /* Type of the object accessed at the site */
+    struct EjsVar   *owner;                 /* Base type owning the property. Null if the object's own property */
+    int             slotNum;                /* Property slot in the object or owner */
+    int             version;                /* Type layout version when the entry was resolved */
+    int             exact;                  /* Property name and namespace exactly match the site's name */
+} EjsInlineCacheEntry;
+
+typedef struct EjsInlineCacheSite {
+    uchar           *pc;                    /* Bytecode address of the site's name operand */
+    cchar           *name;                  /* Property name at the site */
+    int             next;                   /* Next entry to replace */
+    EjsInlineCacheEntry entries[EJS_INLINE_CACHE_WAYS];
+} EjsInlineCacheSite;
+
+/*
+ *  Saved property values of a type or instance block (see ejsSaveGlobalState)
+ */
+typedef struct EjsSavedBlock {
+    struct EjsBlock *block;                 /* Type or instance block */
+    struct EjsVar   **slots;                /* Saved property values */
+    int             numProp;                /* Number of saved properties */
+} EjsSavedBlock;
+
+
 /*
  *  Default GC thresholds (not tunable)
  */
 #define EJS_MIN_TIME_FOR_GC         300     /* Need 1/3 sec for GC */
 #define EJS_GC_SHORT_WORK_QUOTA      50     /* Predict GC short of a full work quota */
+
+/*
+ *  Incremental GC tuning. The pause budget may be modified at run-time via GC.pauseBudget. Zero disables
+ *  incremental collection so every collection stops the world.
+ */
+#define EJS_GC_PAUSE_BUDGET           1     /* Max msec for one incremental GC step */
+#define EJS_GC_STEP_WORK            256     /* Allocations between incremental GC steps */
+#define EJS_GC_CHECK_WORK            64     /* Objects scanned between pause budget checks */
+#define EJS_GC_PAUSE_BUCKETS         10     /* Buckets in the GC pause time histogram */
+#define EJS_GC_MAX_NATIVES           64     /* Nested native calls tracked for incremental GC */
+
+/*
+ *  Integer number values in this range are preallocated and shared so arithmetic on them does not allocate
+ */
+#define EJS_MIN_SMALL_INT          -256
+#define EJS_MAX_SMALL_INT          1024
+
+/*
+ *  Identifier-like property names created at run-time are interned per interpreter so objects can share them
+ */
+#define EJS_MAX_INTERN_LENGTH       32      /* Longest name to intern */
+#define EJS_MAX_INTERNED_NAMES      4096    /* Names interned per interpreter before falling back to copies */
+#define EJS_INTERN_HASH_SIZE        509     /* Interned name hash table size */
     
 /*
  *  GC Object generations
@@ -1040,6 +1110,25 @@ typedef struct EjsGC {
     uint        totalOverflows;         /* Total overflows  */
     uint        totalRedlines;          /* Total times redline limit exceeded */
     uint        totalSweeps;            /* Total sweeps */
+    bool        clearing;               /* Clearing elder generation marks before an incremental mark */
+    int         clearGeneration;        /* Generation being cleared */
+    struct MprBlk *clearNext;           /* Next block to clear */
+    bool        marking;                /* Incremental mark in progress. Write barriers are active */
+    bool        sweeping;               /* Incremental sweep in progress */
+    int         markGeneration;         /* Generation being collected by the incremental mark */
+    int         sweepGeneration;        /* Generation being swept */
+    struct MprBlk *sweepNext;           /* Next block to sweep */
+    int         pauseBudget;            /* Max msec for an incremental step. Zero for stop the world GC */
+    struct EjsVar **gray;               /* Stack of marked objects waiting to be scanned */
+    int         grayCount;              /* Count of objects in gray */
+    int         graySize;               /* Allocated size of gray */
+    uint        totalCycles;            /* Total completed collections */
+    uint        totalSteps;             /* Total incremental steps */
+    int64       totalPause;             /* Total usec the mutator was paused for GC */
+    int64       maxPause;               /* Longest single GC pause in usec */
+    uint        pauses[EJS_GC_PAUSE_BUCKETS];   /* Pause time histogram. See ejsGetGCPauseLimits */
+    struct EjsVar *natives[EJS_GC_MAX_NATIVES]; /* "this" objects of executing native methods */
+    int         nativeDepth;            /* Count of executing native methods */
 #if BLD_DEBUG
     int         indent;                 /* Indent formatting in GC reports */
 #endif
@@ -1053,10 +1142,16 @@ extern void     ejsDestroyGCService(struct Ejs *ejs);
 extern int      ejsIsTimeForGC(struct Ejs *ejs, int timeTillNextEvent);
 extern void     ejsCollectEverything(struct Ejs *ejs);
 extern void     ejsCollectGarbage(struct Ejs *ejs, int gen);
+extern int      ejsStepGarbage(struct Ejs *ejs, int gen);
 extern int      ejsEnableGC(struct Ejs *ejs, bool on);
+extern int      ejsSetGCPauseBudget(struct Ejs *ejs, int msec);
+extern int      *ejsGetGCPauseLimits(struct Ejs *ejs);
+extern void     ejsResetGCPauses(struct Ejs *ejs);
+extern void     ejsGrayVar(struct Ejs *ejs, struct EjsVar *vp);
 extern void     ejsTraceMark(struct Ejs *ejs, struct EjsVar *vp);
 extern void     ejsGracefulDegrade(struct Ejs *ejs);
 extern void     ejsPrintAllocReport(struct Ejs *ejs);
+extern void     ejsPrintPauseReport(struct Ejs *ejs);
 extern void     ejsMakeEternalPermanent(struct Ejs *ejs);
 extern void     ejsMakePermanent(struct Ejs *ejs, struct EjsVar *vp);
 extern void     ejsMakeTransient(struct Ejs *ejs, struct EjsVar *vp);
@@ -1085,7 +1180,9 @@ typedef void (*EjsLoaderCallback)(struct Ejs *ejs, int kind, ...);
 typedef struct Ejs {
     struct EjsVar       *exception;         /**< Pointer to exception object */
     struct EjsVar       *result;            /**< Last expression result */
-    struct EjsState     *state;             /**< Current evaluation state and stack */
+    struct EjsString    *appendString;      /**< Last string built by "local += string" */
+    int                 appendLoads;        /**< Times appendString has been pushed since it was built */
+    struct EjsState     *state;            /**< Current evaluation state and stack */
     struct EjsState     *masterState;       /**< Owns the eval stack */
 
     struct EjsService   *service;           /**< Back pointer to the service */
@@ -1142,6 +1239,7 @@ typedef struct Ejs {
     struct EjsBoolean   *trueValue;         /**< The "true" value */
     struct EjsVar       *undefinedValue;    /**< The "void" value */
     struct EjsNumber    *zeroValue;         /**< The 0 number value */
+    struct EjsNumber    **smallInts;        /**< Shared small integer values */
     struct EjsFunction  *memoryCallback;    /**< Memory.readline callback */
 
     struct EjsNamespace *configSpace;       /**< CONFIG namespace */
@@ -1163,6 +1261,7 @@ typedef struct Ejs {
     int                 exitStatus;         /**< Status to exit() */
     int                 serializeDepth;     /**< Serialization depth */
     int                 joining;            /**< In Worker.join */
+    int                 waiting;            /**< Nested Worker.join and waitForMessage calls */
 
     int                 workQuota;          /* Quota of work before GC */
     int                 workDone;           /**< Count of allocations to determining if GC needed */
@@ -1174,7 +1273,13 @@ typedef struct Ejs {
     uint                exiting: 1;         /**< VM should exit */
 
     struct EjsVar       *exceptionArg;      /**< Exception object for catch block */
-    struct EjsVar       *sessions;          /**< Sessions object in the master interpreter*/
+    struct EjsVar       **globalState;      /**< Saved global property values (see ejsSaveGlobalState) */
+    int                 globalStateCount;   /**< Number of saved global properties */
+    EjsSavedBlock       *savedBlocks;       /**< Saved static and instance properties of interpreter types */
+    int                 savedBlockCount;    /**< Number of saved type blocks */
+    int                 savedModuleCount;   /**< Number of loaded modules when the global state was saved */
+    EjsInlineCacheSite  *inlineCache;       /**< Inline caches for named property access sites */
+    MprHashTable        *internedNames;     /**< Interned identifier-like property names */
 
     bool                attention;          /**< VM needs attention */
 
@@ -1212,10 +1317,25 @@ typedef struct EjsService {
     MprHashTable        *nativeModules;     /**< Native module initialization callbacks */
     struct EjsVar       *(*loadScriptLiteral)(struct Ejs *ejs, cchar *script);
     struct EjsVar       *(*loadScriptFile)(struct Ejs *ejs, cchar *path);
+    int                 (*compileModule)(struct Ejs *ejs, cchar *out, cchar *use, int argc, char **files);
+    volatile int        typeVersion;        /**< Type property layout version. Validates inline cache entries */
+    MprHashTable        *moduleImages;      /**< Shared module file images indexed by path */
+    MprMutex            *mutex;             /**< Multithread sync for module images and workers */
+    struct Ejs          *workerMaster;      /**< Master interpreter cloned for Worker interpreters */
+    MprList             *pendingWorkers;    /**< Workers waiting for a free pool thread */
+    int                 runningWorkers;     /**< Threads running workers */
+    int                 blockedWorkers;     /**< Threads running workers that are blocked in join or waitForMessage */
+    int                 addedWorkers;       /**< Pool threads added so blocked workers can't deadlock */
 } EjsService;
 
 #define ejsGetAllocCtx(ejs) ejs->currentGeneration
 
+/*
+ *  Invalidate all inline cache entries. Called when the property layout of a type or instance block changes. The 
+ *  version is shared by all interpreters of the service, so it is updated atomically.
+ */
+#define ejsInvalidateInlineCaches(ejs) mprAtomicAdd(&(ejs)->service->typeVersion, 1)
+
 /**
  *  Open the Ejscript service
  *  @description One Ejscript service object is required per application. From this service, interpreters
@@ -1241,11 +1361,35 @@ extern EjsService *ejsCreateService(MprCtx ctx);
  *      @li    EJS_FLAG_MASTER         - Create a master interpreter
  *      @li    EJS_FLAG_DOC            - Load documentation from modules
  *      @li    EJS_FLAG_NOEXIT         - App should service events and not exit unless explicitly instructed
+ *      @li    EJS_FLAG_NO_INLINE_CACHE - Don't use inline caches for named property access
  *  @return A new interpreter
  *  @ingroup Ejs
  */
 extern Ejs *ejsCreate(MprCtx ctx, struct Ejs *master, cchar *searchPath, int flags);
 
+/**
+ *  Save the state of the global object
+ *  @description Record the global properties so they can be restored by #ejsRestoreGlobalState after running
+ *      transient code. Only global properties defined since the last save are recorded, so this may be called 
+ *      incrementally after loading each module. The static and instance properties of types owned by this interpreter
+ *      and the list of loaded modules are also recorded. Types shared with the master interpreter are not.
+ *  @param ejs Ejs interpreter
+ *  @return The number of saved global properties
+ *  @ingroup Ejs
+ */
+extern int ejsSaveGlobalState(Ejs *ejs);
+
+/**
+ *  Restore the state of the global object
+ *  @description Remove global properties defined since the last call to #ejsSaveGlobalState and restore the values
+ *      of the saved properties. Type static and instance properties are restored in the same way and modules loaded
+ *      since the save are removed from the module list. This permits an interpreter to be reused for a new request.
+ *      Objects referenced by saved properties are not themselves restored.
+ *  @param ejs Ejs interpreter
+ *  @ingroup Ejs
+ */
+extern void ejsRestoreGlobalState(Ejs *ejs);
+
 /**
  *  Append to the module search path
  *  @description Append a path to the ejs module search path.
@@ -1783,6 +1927,7 @@ typedef struct EjsVar {
     uint    separateSlots     :  1;     /**< Has a separate memory allocation for slots */
     uint    survived          :  1;     /**< Object has survived one GC pass */
     uint    visited           :  1;     /**< Has been traversed */
+    uint    gray              :  1;     /**< Queued for scanning by an incremental GC */
 
 } EjsVar;
 
@@ -2040,6 +2185,22 @@ extern int ejsLookupProperty(Ejs *ejs, EjsVar *vp, EjsName *qname);
  */
 extern void ejsMarkVar(Ejs *ejs, EjsVar *parent, EjsVar *vp);
 
+/**
+ *  GC write barrier
+ *  @description While an incremental collection is marking, a value stored into an object that has already been
+ *      scanned would otherwise be missed. Code that stores object references without using #ejsSetProperty must
+ *      invoke the write barrier on the stored value.
+ *  @param ejs Interpreter instance returned from #ejsCreate
+ *  @param vp Variable being stored
+ *  @ingroup EjsVar
+ */
+#define ejsWriteBarrier(ejs, vp) \
+    if (1) { \
+        if (unlikely((ejs)->gc.marking) && (vp)) { \
+            ejsMarkVar(ejs, NULL, (EjsVar*) (vp)); \
+        } \
+    } else
+
 /**
  *  Set a property's value
  *  @description Set a value for a property at a given slot in the specified variable.
@@ -2113,6 +2274,40 @@ extern EjsVar *ejsSerialize(Ejs *ejs, EjsVar *value, int maxDepth, bool showAll,
  */
 extern EjsVar *ejsDeserialize(Ejs *ejs, struct EjsString *value);
 
+/**
+ *  JSON output callback
+ *  @description Receives serialized JSON text from #ejsWriteJson in chunks of about EJS_JSON_CHUNK bytes
+ *  @param ejs Interpreter instance returned from #ejsCreate
+ *  @param buf Buffer of JSON text
+ *  @param len Length of the text in buf
+ *  @return The number of bytes written. Short writes abort serialization.
+ *  @ingroup EjsVar
+ */
+typedef int (*EjsJsonWriter)(Ejs *ejs, cchar *buf, int len);
+
+/**
+ *  Serialize a variable into JSON and stream the output
+ *  @description Serialize a variable using the same encoding as #ejsSerialize without building the result as a
+ *      string. Output is passed to the writer in chunks as it is produced.
+ *  @param ejs Interpreter instance returned from #ejsCreate
+ *  @param value Value to serialize
+ *  @param writer Callback to receive the JSON text
+ *  @return Zero if successful, otherwise a negative MPR error code
+ *  @ingroup EjsVar
+ */
+extern int ejsWriteJson(Ejs *ejs, EjsVar *value, EjsJsonWriter writer);
+
+/**
+ *  Encode an object or array as JSON
+ *  @description This is the default Object.toJSON encoding. Nested plain objects, arrays and strings are encoded
+ *      in a single pass into one buffer.
+ *  @param ejs Interpreter instance returned from #ejsCreate
+ *  @param value Object to encode
+ *  @return A JSON string or null if an exception is thrown.
+ *  @ingroup EjsVar
+ */
+extern struct EjsString *ejsObjectToJson(Ejs *ejs, EjsVar *value);
+
 /**
     Parse a string into a variable
  *  @description Parse a string into the most natural data object
@@ -2667,7 +2862,8 @@ typedef struct EjsFunction {
     /* Word boundary */
 
     uint            inException: 1;         /**< Executing catch/finally exception processing */
-    uint            reserved: 15;           /* Unused */
+    uint            sharedCode: 1;          /**< Byte code is in a shared module image and is not owned */
+    uint            reserved: 14;           /* Unused */
 
     int             nextSlot: 16;           /**< Next multimethod or getter/setter */
 } EjsFunction;
@@ -3598,6 +3794,7 @@ typedef struct EjsRegExp {
     EjsObject       var;                /**< NEW: Extends Object - Property storage */
     char            *pattern;           /**< Pattern to match with */
     void            *compiled;          /**< Compiled pattern */
+    struct MprRegex *regex;             /**< Cached compiled pattern. Owns compiled */
     bool            global;             /**< Search for pattern globally (multiple times) */
     bool            ignoreCase;         /**< Do case insensitive matching */
     bool            multiline;          /**< Match patterns over multiple lines */
@@ -3720,6 +3917,18 @@ extern EjsString *ejsDupString(Ejs *ejs, EjsString *sp);
 extern int ejsStrdup(MprCtx ctx, uchar **dest, const void *src, int nbytes);
 extern int ejsStrcat(Ejs *ejs, EjsString *dest, EjsVar *src);
 
+/**
+ *  Get a persistent copy of a property name
+ *  @description Identifier-like names are interned and shared by all objects in the interpreter. Other names are 
+ *      copied and owned by the given object which can then no longer be pooled.
+ *  @param ejs Ejs reference returned from #ejsCreate
+ *  @param owner Object that will own the name if it cannot be interned
+ *  @param name Property name
+ *  @return A name that is valid for the life of the owner
+ *  @ingroup EjsString
+ */
+extern cchar *ejsInternName(Ejs *ejs, EjsVar *owner, cchar *name);
+
 
 /**
  *  Timer Class
@@ -4291,6 +4500,32 @@ typedef struct EjsModuleHdr {
 } EjsModuleHdr;
 
 
+/*
+ *  Module file image. Module files are mapped (or read) into memory once per service and shared read-only by all
+ *  interpreters that load them. Constant pools and function byte code reference the image directly.
+ */
+typedef struct EjsModuleImage {
+    char        *path;                      /* Module file path */
+    uchar       *data;                      /* Module file contents */
+    int         size;                       /* Length of data */
+    MprTime     mtime;                      /* Modification time of the file when loaded */
+    int64       inode;                      /* Inode of the file when loaded */
+    int         refs;                       /* Count of modules and loads using the image */
+    int         mapped;                     /* Data is memory mapped */
+    int         stale;                      /* File has since been modified. Free when no longer referenced */
+} EjsModuleImage;
+
+
+/*
+ *  Read position in a module image while loading
+ */
+typedef struct EjsModuleReader {
+    EjsModuleImage  *image;                 /* Image being read */
+    uchar       *pos;                       /* Next byte to read */
+    uchar       *end;                       /* End of image data */
+} EjsModuleReader;
+
+
 /*
  *  Structure for the string constant pool
  */
@@ -4331,6 +4566,8 @@ typedef struct EjsModule {
      */
     EjsBlock        *scopeChain;            /* Scope of nested types/functions/blocks, being loaded */
     EjsConst        *constants;             /* Constant pool */
+    EjsModuleReader *reader;                /* Module image reader */
+    EjsModuleImage  *image;                 /* Shared module file image. Holds a reference. */
     int             nameToken;              /* */
     int             firstGlobalSlot;        /* First global slot (if used) */
     struct EjsFunction  *currentMethod;     /* Current method being loaded */
@@ -4390,6 +4627,8 @@ typedef struct EjsDoc {
 extern EjsModule    *ejsCreateModule(struct Ejs *ejs, cchar *name, int version);
 extern int          ejsLoadModule(struct Ejs *ejs, cchar *name, int minVer, int maxVer, int flags, MprList **modules);
 extern char         *ejsSearchForModule(Ejs *ejs, cchar *name, int minVer, int maxVer);
+extern EjsModuleImage *ejsGetModuleImage(struct Ejs *ejs, cchar *path);
+extern void         ejsReleaseModuleImage(MprCtx ctx, EjsModuleImage *image);
 
 extern int          ejsModuleReadName(struct Ejs *ejs, MprFile *file, char **name, int len);
 extern int          ejsModuleReadNumber(struct Ejs *ejs, EjsModule *module, int *number);
@@ -4581,13 +4820,28 @@ typedef struct EjsWebControl {
     EjsService  *service;                   /* EJS service */
     Ejs         *master;                    /* Master interpreter */
     EjsVar      *applications;              /* Application cache */
-    EjsObject   *sessions;                  /* Session cache */
+    struct EjsWebSessionStore *sessionStore; /* Session state store */
     EjsType     *sessionType;               /* Session type object */
-    MprEvent    *sessionTimer;              /* Session expiry timer */
+    MprEvent    *sessionTimer;              /* Session expiry and write-behind timer */
     cchar       *serverRoot;                /* Web serverRoot path */
     cchar       *searchPath;                /* Module search path */
     int         sessionTimeout;             /* Default session timeout */
-    int         nextSession;                /* Session ID counter */
+
+    /*
+     *  Pools of idle interpreters cloned from the master. Indexed by application directory and search path.
+     */
+    MprHashTable *pools;                    /* Idle interpreter lists (EjsWebInterp) */
+    MprMutex    *poolMutex;                 /* Multithread sync for the pools */
+    int         poolMax;                    /* Max idle interpreters per application. Zero to disable pooling. */
+    int64       poolHits;                   /* Requests served by a pooled interpreter */
+    int64       poolMisses;                 /* Requests that required a new interpreter */
+    MprEvent    *gcTimer;                   /* Steps pooled interpreter collections when idle */
+
+    /*
+     *  Throttled module freshness checks
+     */
+    MprHashTable *checked;                  /* Time each module was last found to be current */
+    int         checkInterval;              /* Msec between checks that modules are current. Zero to always check. */
 
     void        (*defineParams)(void *handle);
     void        (*discardOutput)(void *handle);
@@ -4619,11 +4873,27 @@ typedef struct EjsWebControl {
 #define EJS_WEB_FLAG_APP                 0x4    /* Request for content inside an Ejscript Application*/
 #define EJS_WEB_FLAG_SOLO                0x8    /* Solo ejs file */
 
+/*
+ *  Pooled interpreter. The interpreter is reset and returned to its pool at the end of each request.
+ */
+typedef struct EjsWebInterp {
+    Ejs             *ejs;           /* Interpreter cloned from the master */
+    MprHeap         *heap;          /* Heap owning the interpreter */
+    EjsWebControl   *control;       /* Web framework control block */
+    MprList         *pool;          /* Idle list to return to */
+    MprHashTable    *modules;       /* Component modules loaded by this interpreter (EjsWebModule) */
+    MprTime         checked;        /* Time the modules were last found to be current */
+    int             requests;       /* Requests served */
+    bool            retire;         /* Discard rather than return to the pool */
+} EjsWebInterp;
+
+
 /*
  *  Per request control block
  */
 typedef struct EjsWeb {
     Ejs             *ejs;           /* Ejscript interpreter handle */
+    EjsWebInterp    *interp;        /* Pooled interpreter (if pooling) */
     cchar           *appDir;        /* Directory containing the application */
     cchar           *appUrl;        /* Base url for the application. No trailing "/" */
     void            *handle;        /* Web server connection/request handle */
@@ -4696,21 +4966,21 @@ typedef struct EjsWebResponse
 } EjsWebResponse;
 
 
+/*
+ *  Session object for a request. Property values are held in the session store.
+ */
 typedef struct EjsWebSession
 {
     EjsObject   obj;
-    MprTime     expire;                     /* When the session should expire */
     char        *id;                        /* Session ID */
     int         timeout;                    /* Session inactivity lifespan */
-    int         index;                      /* Index in sesssions[] */
 } EjsWebSession;
 
 
 typedef struct EjsWebCache
 {
     EjsObject   obj;                        /* Base object */
-    EjsVar      *cache;                     /* Cache object */
-    int         timeout;                    /* Session inactivity lifespan */
+    struct EjsWebCacheStore *store;         /* Native cache store shared by all interpreters */
 } EjsWebCache;
 
 
@@ -4730,6 +5000,9 @@ extern void         ejsConfigureWebCacheType(Ejs *ejs);
 extern EjsWeb       *ejsCreateWebRequest(MprCtx ctx, EjsWebControl *control, void *req, cchar *scriptName, cchar *uri,
                         cchar *dir, cchar *searchPath, int flags);
 extern int          ejsRunWebRequest(EjsWeb *web);
+extern void         ejsGetWebPoolStats(EjsWebControl *control, int64 *hits, int64 *misses, int *idle);
+extern void         ejsSetWebCacheLimits(MprCtx ctx, int64 maxMemory);
+extern void         ejsGetWebCacheStats(MprCtx ctx, int64 *hits, int64 *misses, int64 *evictions, int64 *memory);
 extern EjsWebRequest *ejsCreateWebRequestObject(Ejs *ejs, void *handle);
 extern EjsWebHost   *ejsCreateWebHostObject(Ejs *ejs, void *handle);
 extern EjsWebResponse *ejsCreateWebResponseObject(Ejs *ejs, void *handle);
@@ -4739,6 +5012,10 @@ extern void         ejsDefineWebParam(Ejs *ejs, cchar *key, cchar *value);
 
 extern int          ejsLoadView(Ejs *ejs);
 extern void         ejsParseWebSessionCookie(EjsWeb *web);
+extern int          ejsCreateWebSessionStore(EjsWebControl *control);
+extern int          ejsOpenWebSessionStore(EjsWebControl *control, cchar *path);
+extern void         ejsCloseWebSessionStore(EjsWebControl *control);
+extern int          ejsGetWebSessionCount(EjsWebControl *control);
 
 #ifdef  __cplusplus
 extern "C" {
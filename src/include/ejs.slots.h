@@ -173,10 +173,10 @@
 #define ES_ejs_web_Controller                                          152
 #define ES_ejs_web__SoloController                                     153
 #define ES_ejs_web_Cookie                                              154
-#define ES_ejs_web_Host                                                155
-#define ES_ejs_web_Request                                             156
-#define ES_ejs_web_Response                                            157
-#define ES_ejs_web_sessions                                            158
+#define ES_ejs_web_EjsParser                                           155
+#define ES_ejs_web_Host                                                156
+#define ES_ejs_web_Request                                             157
+#define ES_ejs_web_Response                                            158
 #define ES_ejs_web_Session                                             159
 #define ES_ejs_web_UploadFile                                          160
 #define ES_ejs_web_View                                                161
@@ -267,6 +267,7 @@
 #define ES_write_file                                                  0
 #define ES_write_items                                                 1
 #define ES_ejs_sys_worker_postMessage_data                             0
+#define ES_ejs_sys_worker_postMessage_transfer                         1
 #define ES_ejs_sys_worker_set_onerror_fun                              0
 #define ES_ejs_sys_worker_set_onmessage_fun                            0
 
@@ -1180,20 +1181,22 @@
  */
 #define ES_RegExp__origin                                              6
 #define ES_RegExp_RegExp                                               6
-#define ES_RegExp_lastIndex                                            7
-#define ES_RegExp_set_lastIndex                                        8
-#define ES_RegExp_exec                                                 9
-#define ES_RegExp_global                                               10
-#define ES_RegExp_ignoreCase                                           11
-#define ES_RegExp_multiline                                            12
-#define ES_RegExp_source                                               13
-#define ES_RegExp_matched                                              14
-#define ES_RegExp_replace                                              15
-#define ES_RegExp_split                                                16
-#define ES_RegExp_start                                                17
-#define ES_RegExp_sticky                                               18
-#define ES_RegExp_test                                                 19
-#define ES_RegExp_NUM_CLASS_PROP                                       20
+#define ES_RegExp_cache                                                7
+#define ES_RegExp_lastIndex                                            8
+#define ES_RegExp_set_lastIndex                                        9
+#define ES_RegExp_exec                                                 10
+#define ES_RegExp_global                                               11
+#define ES_RegExp_ignoreCase                                           12
+#define ES_RegExp_multiline                                            13
+#define ES_RegExp_setCacheLimit                                        14
+#define ES_RegExp_source                                               15
+#define ES_RegExp_matched                                              16
+#define ES_RegExp_replace                                              17
+#define ES_RegExp_split                                                18
+#define ES_RegExp_start                                                19
+#define ES_RegExp_sticky                                               20
+#define ES_RegExp_test                                                 21
+#define ES_RegExp_NUM_CLASS_PROP                                       22
 
 /**
  * Instance slots for "RegExp" type 
@@ -1209,6 +1212,7 @@
 #define ES_RegExp_set_lastIndex_value                                  0
 #define ES_RegExp_exec_str                                             0
 #define ES_RegExp_exec_start                                           1
+#define ES_RegExp_setCacheLimit_max                                    0
 #define ES_RegExp_replace_str                                          0
 #define ES_RegExp_replace_replacement                                  1
 #define ES_RegExp_split_target                                         0
@@ -1411,7 +1415,7 @@
 #define ES_XMLList_attribute_name                                      0
 #define ES_XMLList_elements_name                                       0
 
-#define _ES_CHECKSUM_ejs 484862
+#define _ES_CHECKSUM_ejs 487043
 
 #endif
 /*
@@ -1568,6 +1572,7 @@
 #define ES_ejs_db_Database_renameTable_oldTable                        0
 #define ES_ejs_db_Database_renameTable_newTable                        1
 #define ES_ejs_db_Database_sql_cmd                                     0
+#define ES_ejs_db_Database_sql_params                                  1
 #define ES_ejs_db_Database_sqlTypeToDataType_sqlType                   0
 #define ES_ejs_db_Database_sqlTypeToEjsType_sqlType                    0
 #define ES_ejs_db_Database_trace_on                                    0
@@ -1643,6 +1648,7 @@
 #define ES_ejs_db_DatabaseConnector_renameTable_oldTable               0
 #define ES_ejs_db_DatabaseConnector_renameTable_newTable               1
 #define ES_ejs_db_DatabaseConnector_sql_cmd                            0
+#define ES_ejs_db_DatabaseConnector_sql_params                         1
 #define ES_ejs_db_DatabaseConnector_sqlTypeToDataType_sqlType          0
 #define ES_ejs_db_DatabaseConnector_sqlTypeToEjsType_sqlType           0
 
@@ -1850,7 +1856,7 @@
 #define ES_ejs_db_Record_makeLazyReader_model                          2
 #define ES_ejs_db_Record_makeLazyReader_key                            3
 #define ES_ejs_db_Record_makeLazyReader_options                        4
-#define ES_ejs_db_Record_makeLazyReader___fun_8169__                   5
+#define ES_ejs_db_Record_makeLazyReader___fun_8205__                   5
 #define ES_ejs_db_Record_makeLazyReader_lazyReader                     6
 #define ES_ejs_db_Record_mapSqlTypeToEjs_sqlType                       0
 #define ES_ejs_db_Record_mapSqlTypeToEjs_ejsType                       1
@@ -1925,7 +1931,7 @@
 #define ES_ejs_db_Column_Column_ejsType                                2
 #define ES_ejs_db_Column_Column_sqlType                                3
 
-#define _ES_CHECKSUM_ejs_db 306963
+#define _ES_CHECKSUM_ejs_db 308246
 
 #endif
 /*
@@ -2091,10 +2097,11 @@
 #define ES_ejs_db_Sqlite_query_tag                                     1
 #define ES_ejs_db_Sqlite_query_trace                                   2
 #define ES_ejs_db_Sqlite_sql_cmd                                       0
+#define ES_ejs_db_Sqlite_sql_params                                    1
 #define ES_ejs_db_Sqlite_sqlTypeToDataType_sqlType                     0
 #define ES_ejs_db_Sqlite_sqlTypeToEjsType_sqlType                      0
 
-#define _ES_CHECKSUM_ejs_db_sqlite 74253
+#define _ES_CHECKSUM_ejs_db_sqlite 74899
 
 #endif
 /*
@@ -2353,8 +2360,8 @@
  *    Local slots for methods in type BinaryStream 
  */
 #define ES_ejs_io_BinaryStream_BinaryStream_stream                     0
-#define ES_ejs_io_BinaryStream_BinaryStream___fun_11417__              1
-#define ES_ejs_io_BinaryStream_BinaryStream___fun_11438__              2
+#define ES_ejs_io_BinaryStream_BinaryStream___fun_11455__              1
+#define ES_ejs_io_BinaryStream_BinaryStream___fun_11476__              2
 #define ES_ejs_io_BinaryStream_close_graceful                          0
 #define ES_ejs_io_BinaryStream_set_endian_value                        0
 #define ES_ejs_io_BinaryStream_flush_graceful                          0
@@ -2529,26 +2536,29 @@
 #define ES_ejs_io_Http_set_method                                      79
 #define ES_ejs_io_Http_mimeType                                        80
 #define ES_ejs_io_Http_options                                         81
-#define ES_ejs_io_Http_post                                            82
-#define ES_ejs_io_Http_put                                             83
-#define ES_ejs_io_Http_read                                            84
-#define ES_ejs_io_Http_readString                                      85
-#define ES_ejs_io_Http_readLines                                       86
-#define ES_ejs_io_Http_readXml                                         87
-#define ES_ejs_io_Http_response                                        88
-#define ES_ejs_io_Http_retries                                         89
-#define ES_ejs_io_Http_set_retries                                     90
-#define ES_ejs_io_Http_setCallback                                     91
-#define ES_ejs_io_Http_setCredentials                                  92
-#define ES_ejs_io_Http_timeout                                         93
-#define ES_ejs_io_Http_set_timeout                                     94
-#define ES_ejs_io_Http_trace                                           95
-#define ES_ejs_io_Http_upload                                          96
-#define ES_ejs_io_Http_uri                                             97
-#define ES_ejs_io_Http_set_uri                                         98
-#define ES_ejs_io_Http_wait                                            99
-#define ES_ejs_io_Http_write                                           100
-#define ES_ejs_io_Http_NUM_CLASS_PROP                                  101
+#define ES_ejs_io_Http_pipeline                                        82
+#define ES_ejs_io_Http_pool                                            83
+#define ES_ejs_io_Http_post                                            84
+#define ES_ejs_io_Http_put                                             85
+#define ES_ejs_io_Http_read                                            86
+#define ES_ejs_io_Http_readString                                      87
+#define ES_ejs_io_Http_readLines                                       88
+#define ES_ejs_io_Http_readXml                                         89
+#define ES_ejs_io_Http_response                                        90
+#define ES_ejs_io_Http_retries                                         91
+#define ES_ejs_io_Http_set_retries                                     92
+#define ES_ejs_io_Http_setCallback                                     93
+#define ES_ejs_io_Http_setCredentials                                  94
+#define ES_ejs_io_Http_setPoolLimits                                   95
+#define ES_ejs_io_Http_timeout                                         96
+#define ES_ejs_io_Http_set_timeout                                     97
+#define ES_ejs_io_Http_trace                                           98
+#define ES_ejs_io_Http_upload                                          99
+#define ES_ejs_io_Http_uri                                             100
+#define ES_ejs_io_Http_set_uri                                         101
+#define ES_ejs_io_Http_wait                                            102
+#define ES_ejs_io_Http_write                                           103
+#define ES_ejs_io_Http_NUM_CLASS_PROP                                  104
 
 /**
  * Instance slots for "Http" type 
@@ -2585,6 +2595,7 @@
 #define ES_ejs_io_Http_set_method_name                                 0
 #define ES_ejs_io_Http_mimeType_path                                   0
 #define ES_ejs_io_Http_options_uri                                     0
+#define ES_ejs_io_Http_pipeline_uris                                   0
 #define ES_ejs_io_Http_post_uri                                        0
 #define ES_ejs_io_Http_post_data                                       1
 #define ES_ejs_io_Http_put_uri                                         0
@@ -2599,6 +2610,8 @@
 #define ES_ejs_io_Http_setCallback_cb                                  1
 #define ES_ejs_io_Http_setCredentials_username                         0
 #define ES_ejs_io_Http_setCredentials_password                         1
+#define ES_ejs_io_Http_setPoolLimits_maxPerHost                        0
+#define ES_ejs_io_Http_setPoolLimits_timeout                           1
 #define ES_ejs_io_Http_set_timeout_timeout                             0
 #define ES_ejs_io_Http_trace_uri                                       0
 #define ES_ejs_io_Http_upload_url                                      0
@@ -2607,7 +2620,7 @@
 #define ES_ejs_io_Http_upload_boundary                                 3
 #define ES_ejs_io_Http_upload_buf                                      4
 #define ES_ejs_io_Http_upload_http                                     5
-#define ES_ejs_io_Http_upload___fun_12894__                            6
+#define ES_ejs_io_Http_upload___fun_12964__                            6
 #define ES_ejs_io_Http_upload__hoisted_7_key                           7
 #define ES_ejs_io_Http_upload__hoisted_8_key                           8
 #define ES_ejs_io_Http_set_uri_newUri                                  0
@@ -2875,7 +2888,7 @@
 #define ES_ejs_io_XMLHttp_callback_hp                                  1
 #define ES_ejs_io_XMLHttp_callback_count                               2
 
-#define _ES_CHECKSUM_ejs_io 354747
+#define _ES_CHECKSUM_ejs_io 359987
 
 #endif
 /*
@@ -3021,8 +3034,12 @@
 #define ES_ejs_sys_GC_set_enabled                                      7
 #define ES_ejs_sys_GC_workQuota                                        8
 #define ES_ejs_sys_GC_set_workQuota                                    9
-#define ES_ejs_sys_GC_run                                              10
-#define ES_ejs_sys_GC_NUM_CLASS_PROP                                   11
+#define ES_ejs_sys_GC_pauseBudget                                      10
+#define ES_ejs_sys_GC_set_pauseBudget                                  11
+#define ES_ejs_sys_GC_pauses                                           12
+#define ES_ejs_sys_GC_resetPauses                                      13
+#define ES_ejs_sys_GC_run                                              14
+#define ES_ejs_sys_GC_NUM_CLASS_PROP                                   15
 
 /**
  * Instance slots for "GC" type 
@@ -3035,6 +3052,7 @@
  */
 #define ES_ejs_sys_GC_set_enabled_on                                   0
 #define ES_ejs_sys_GC_set_workQuota_quota                              0
+#define ES_ejs_sys_GC_set_pauseBudget_msec                             0
 #define ES_ejs_sys_GC_run_deep                                         0
 
 
@@ -3142,10 +3160,10 @@
 #define ES_ejs_sys_Worker_preload_path                                 0
 #define ES_ejs_sys_Worker_lookup_name                                  0
 #define ES_ejs_sys_Worker_postMessage_data                             0
-#define ES_ejs_sys_Worker_postMessage_ports                            1
+#define ES_ejs_sys_Worker_postMessage_transfer                         1
 #define ES_ejs_sys_Worker_waitForMessage_timeout                       0
 
-#define _ES_CHECKSUM_ejs_sys 135088
+#define _ES_CHECKSUM_ejs_sys 141235
 
 #endif
 /*
@@ -3184,12 +3202,10 @@
  */
 #define ES_ejs_web_Cache__origin                                       6
 #define ES_ejs_web_Cache_Cache                                         6
-#define ES_ejs_web_Cache__initializer__Cache_initializer               7
-#define ES_ejs_web_Cache_cache                                         8
-#define ES_ejs_web_Cache_read                                          9
-#define ES_ejs_web_Cache_write                                         10
-#define ES_ejs_web_Cache_remove                                        11
-#define ES_ejs_web_Cache_NUM_CLASS_PROP                                12
+#define ES_ejs_web_Cache_read                                          7
+#define ES_ejs_web_Cache_write                                         8
+#define ES_ejs_web_Cache_remove                                        9
+#define ES_ejs_web_Cache_NUM_CLASS_PROP                                10
 
 /**
  * Instance slots for "Cache" type 
@@ -3461,19 +3477,21 @@
 #define ES_ejs_web_Controller_ejs_web_render                           29
 #define ES_ejs_web_Controller_ejs_web_renderFile                       30
 #define ES_ejs_web_Controller_ejs_web_renderRaw                        31
-#define ES_ejs_web_Controller_ejs_web_renderView                       32
-#define ES_ejs_web_Controller_reportError                              33
-#define ES_ejs_web_Controller_ejs_web_setCookie                        34
-#define ES_ejs_web_Controller_ejs_web_setHeader                        35
-#define ES_ejs_web_Controller_ejs_web_setHttpCode                      36
-#define ES_ejs_web_Controller_ejs_web_setMimeType                      37
-#define ES_ejs_web_Controller_ejs_web_unescapeHtml                     38
-#define ES_ejs_web_Controller_ejs_web_warn                             39
-#define ES_ejs_web_Controller_ejs_web_write                            40
-#define ES_ejs_web_Controller_ejs_web_writeHtml                        41
-#define ES_ejs_web_Controller_ejs_web_writeRaw                         42
-#define ES_ejs_web_Controller_action_missing                           43
-#define ES_ejs_web_Controller_NUM_CLASS_PROP                           44
+#define ES_ejs_web_Controller_ejs_web_renderJSON                       32
+#define ES_ejs_web_Controller_ejs_web_renderView                       33
+#define ES_ejs_web_Controller_reportError                              34
+#define ES_ejs_web_Controller_ejs_web_setCookie                        35
+#define ES_ejs_web_Controller_ejs_web_setHeader                        36
+#define ES_ejs_web_Controller_ejs_web_setHttpCode                      37
+#define ES_ejs_web_Controller_ejs_web_setMimeType                      38
+#define ES_ejs_web_Controller_ejs_web_unescapeHtml                     39
+#define ES_ejs_web_Controller_ejs_web_warn                             40
+#define ES_ejs_web_Controller_ejs_web_write                            41
+#define ES_ejs_web_Controller_ejs_web_writeJSON                        42
+#define ES_ejs_web_Controller_ejs_web_writeHtml                        43
+#define ES_ejs_web_Controller_ejs_web_writeRaw                         44
+#define ES_ejs_web_Controller_action_missing                           45
+#define ES_ejs_web_Controller_NUM_CLASS_PROP                           46
 
 /**
  * Instance slots for "Controller" type 
@@ -3560,6 +3578,7 @@
 #define ES_ejs_web_Controller_ejs_web_renderFile_file                  1
 #define ES_ejs_web_Controller_ejs_web_renderFile__hoisted_2_e          2
 #define ES_ejs_web_Controller_ejs_web_renderRaw_args                   0
+#define ES_ejs_web_Controller_ejs_web_renderJSON_data                  0
 #define ES_ejs_web_Controller_ejs_web_renderView_viewName              0
 #define ES_ejs_web_Controller_ejs_web_renderView_viewClass             1
 #define ES_ejs_web_Controller_ejs_web_renderView__hoisted_2_name       2
@@ -3584,6 +3603,7 @@
 #define ES_ejs_web_Controller_ejs_web_unescapeHtml_s                   0
 #define ES_ejs_web_Controller_ejs_web_warn_msg                         0
 #define ES_ejs_web_Controller_ejs_web_write_args                       0
+#define ES_ejs_web_Controller_ejs_web_writeJSON_data                   0
 #define ES_ejs_web_Controller_ejs_web_writeHtml_args                   0
 #define ES_ejs_web_Controller_ejs_web_writeRaw_args                    0
 
@@ -3591,9 +3611,9 @@
 /**
  *   Class property slots for the "_SoloController" class 
  */
-#define ES_ejs_web__SoloController__origin                             44
-#define ES_ejs_web__SoloController__SoloController                     44
-#define ES_ejs_web__SoloController_NUM_CLASS_PROP                      45
+#define ES_ejs_web__SoloController__origin                             46
+#define ES_ejs_web__SoloController__SoloController                     46
+#define ES_ejs_web__SoloController_NUM_CLASS_PROP                      47
 
 /**
  * Instance slots for "_SoloController" type 
@@ -3618,6 +3638,70 @@
 #define ES_ejs_web_Cookie_NUM_INSTANCE_PROP                            4
 
 
+/**
+ *   Class property slots for the "EjsParser" class 
+ */
+#define ES_ejs_web_EjsParser__origin                                   6
+#define ES_ejs_web_EjsParser_EjsParser                                 6
+#define ES_ejs_web_EjsParser__initializer__EjsParser_initializer       7
+#define ES_ejs_web_EjsParser_Err                                       8
+#define ES_ejs_web_EjsParser_Eof                                       9
+#define ES_ejs_web_EjsParser_EjsTag                                    10
+#define ES_ejs_web_EjsParser_Var                                       11
+#define ES_ejs_web_EjsParser_Literal                                   12
+#define ES_ejs_web_EjsParser_Equals                                    13
+#define ES_ejs_web_EjsParser_Control                                   14
+#define ES_ejs_web_EjsParser_ViewHeader                                15
+#define ES_ejs_web_EjsParser_ViewFooter                                16
+#define ES_ejs_web_EjsParser_buildView                                 17
+#define ES_ejs_web_EjsParser_parse                                     18
+#define ES_ejs_web_EjsParser_getToken                                  19
+#define ES_ejs_web_EjsParser_eatSpace                                  20
+#define ES_ejs_web_EjsParser_abort                                     21
+#define ES_ejs_web_EjsParser_NUM_CLASS_PROP                            22
+
+/**
+ * Instance slots for "EjsParser" type 
+ */
+#define ES_ejs_web_EjsParser_ContentMarker                             0
+#define ES_ejs_web_EjsParser_ContentPattern                            1
+#define ES_ejs_web_EjsParser_LayoutsDir                                2
+#define ES_ejs_web_EjsParser_appBaseDir                                3
+#define ES_ejs_web_EjsParser_script                                    4
+#define ES_ejs_web_EjsParser_pos                                       5
+#define ES_ejs_web_EjsParser_lineNumber                                6
+#define ES_ejs_web_EjsParser_layoutPage                                7
+#define ES_ejs_web_EjsParser_NUM_INSTANCE_PROP                         8
+
+/**
+ * 
+ *    Local slots for methods in type EjsParser 
+ */
+#define ES_ejs_web_EjsParser_buildView_file                            0
+#define ES_ejs_web_EjsParser_buildView_appDir                          1
+#define ES_ejs_web_EjsParser_buildView_layout                          2
+#define ES_ejs_web_EjsParser_buildView_prefix                          3
+#define ES_ejs_web_EjsParser_buildView_view                            4
+#define ES_ejs_web_EjsParser_buildView_result                          5
+#define ES_ejs_web_EjsParser_parse_file                                0
+#define ES_ejs_web_EjsParser_parse_appDir                              1
+#define ES_ejs_web_EjsParser_parse_layout                              2
+#define ES_ejs_web_EjsParser_parse_token                               3
+#define ES_ejs_web_EjsParser_parse_out                                 4
+#define ES_ejs_web_EjsParser_parse_tid                                 5
+#define ES_ejs_web_EjsParser_parse__hoisted_6_args                     6
+#define ES_ejs_web_EjsParser_parse__hoisted_7_cmd                      7
+#define ES_ejs_web_EjsParser_parse__hoisted_8_path                     8
+#define ES_ejs_web_EjsParser_parse__hoisted_9_incPath                  9
+#define ES_ejs_web_EjsParser_parse__hoisted_10_inc                     10
+#define ES_ejs_web_EjsParser_parse__hoisted_11_path                    11
+#define ES_ejs_web_EjsParser_parse__hoisted_12_layoutText              12
+#define ES_ejs_web_EjsParser_getToken_token                            0
+#define ES_ejs_web_EjsParser_getToken_tid                              1
+#define ES_ejs_web_EjsParser_getToken_c                                2
+#define ES_ejs_web_EjsParser_abort_msg                                 0
+
+
 /**
  *   Class property slots for the "Host" class 
  */
@@ -3774,20 +3858,21 @@
 #define ES_ejs_web_View_ejs_web_setMimeType                            47
 #define ES_ejs_web_View_ejs_web_write                                  48
 #define ES_ejs_web_View_ejs_web_writeHtml                              49
-#define ES_ejs_web_View_ejs_web_writeRaw                               50
-#define ES_ejs_web_View_ejs_web_d                                      51
-#define ES_ejs_web_View_addHelper                                      52
-#define ES_ejs_web_View_getConnector                                   53
-#define ES_ejs_web_View_setOptions                                     54
-#define ES_ejs_web_View_ejs_web_getValue                               55
-#define ES_ejs_web_View_ejs_web_date                                   56
-#define ES_ejs_web_View_ejs_web_currency                               57
-#define ES_ejs_web_View_ejs_web_number                                 58
-#define ES_ejs_web_View_htmlOptions                                    59
-#define ES_ejs_web_View_ejs_web_getOptions                             60
-#define ES_ejs_web_View_pivot                                          61
-#define ES_ejs_web_View_filter                                         62
-#define ES_ejs_web_View_NUM_CLASS_PROP                                 63
+#define ES_ejs_web_View_ejs_web_writeJSON                              50
+#define ES_ejs_web_View_ejs_web_writeRaw                               51
+#define ES_ejs_web_View_ejs_web_d                                      52
+#define ES_ejs_web_View_addHelper                                      53
+#define ES_ejs_web_View_getConnector                                   54
+#define ES_ejs_web_View_setOptions                                     55
+#define ES_ejs_web_View_ejs_web_getValue                               56
+#define ES_ejs_web_View_ejs_web_date                                   57
+#define ES_ejs_web_View_ejs_web_currency                               58
+#define ES_ejs_web_View_ejs_web_number                                 59
+#define ES_ejs_web_View_htmlOptions                                    60
+#define ES_ejs_web_View_ejs_web_getOptions                             61
+#define ES_ejs_web_View_pivot                                          62
+#define ES_ejs_web_View_filter                                         63
+#define ES_ejs_web_View_NUM_CLASS_PROP                                 64
 
 /**
  * Instance slots for "View" type 
@@ -3931,6 +4016,7 @@
 #define ES_ejs_web_View_ejs_web_setMimeType_format                     0
 #define ES_ejs_web_View_ejs_web_write_args                             0
 #define ES_ejs_web_View_ejs_web_writeHtml_args                         0
+#define ES_ejs_web_View_ejs_web_writeJSON_data                         0
 #define ES_ejs_web_View_ejs_web_writeRaw_args                          0
 #define ES_ejs_web_View_ejs_web_d_args                                 0
 #define ES_ejs_web_View_ejs_web_d_e                                    1
@@ -3952,11 +4038,11 @@
 #define ES_ejs_web_View_ejs_web_getValue_fmt                           5
 #define ES_ejs_web_View_ejs_web_getValue__hoisted_6_part               6
 #define ES_ejs_web_View_ejs_web_date_fmt                               0
-#define ES_ejs_web_View_ejs_web_date___fun_26427__                     1
+#define ES_ejs_web_View_ejs_web_date___fun_27670__                     1
 #define ES_ejs_web_View_ejs_web_currency_fmt                           0
-#define ES_ejs_web_View_ejs_web_currency___fun_26461__                 1
+#define ES_ejs_web_View_ejs_web_currency___fun_27704__                 1
 #define ES_ejs_web_View_ejs_web_number_fmt                             0
-#define ES_ejs_web_View_ejs_web_number___fun_26491__                   1
+#define ES_ejs_web_View_ejs_web_number___fun_27734__                   1
 #define ES_ejs_web_View_ejs_web_getOptions_options                     0
 #define ES_ejs_web_View_ejs_web_getOptions_result                      1
 #define ES_ejs_web_View_ejs_web_getOptions__hoisted_2_option           2
@@ -4181,7 +4267,7 @@
 #define ES_LocalModel_makeLazyReader_model                             2
 #define ES_LocalModel_makeLazyReader_key                               3
 #define ES_LocalModel_makeLazyReader_options                           4
-#define ES_LocalModel_makeLazyReader___fun_8169__                      5
+#define ES_LocalModel_makeLazyReader___fun_8205__                      5
 #define ES_LocalModel_makeLazyReader_lazyReader                        6
 #define ES_LocalModel_mapSqlTypeToEjs_sqlType                          0
 #define ES_LocalModel_mapSqlTypeToEjs_ejsType                          1
@@ -4233,6 +4319,6 @@
 #define ES_LocalModel_ejs_db_constructor_fields                        0
 #define ES_LocalModel_LocalModel_fields                                0
 
-#define _ES_CHECKSUM_ejs_web 459061
+#define _ES_CHECKSUM_ejs_web 492746
 
 #endif
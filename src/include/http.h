@@ -104,6 +104,7 @@ typedef struct MaHttp {
     char            *groupname;             /**< Http server group name */
     int             uid;                    /**< User Id */
     int             gid;                    /**< Group Id */
+    struct MaDateCache *dateCache;          /**< Cached HTTP date strings */
 
 #if BLD_FEATURE_MULTITHREAD
     MprMutex        *mutex;                 /**< Multi-thread sync */
@@ -640,6 +641,125 @@ typedef struct MaMimeType {
     char            *actionProgram;
 } MaMimeType;
 
+/*********************************** MaMetrics ********************************/
+/*
+ *  Response status classes
+ */
+#define MA_METRICS_STATUS       5           /* 1xx, 2xx, 3xx, 4xx, 5xx */
+
+/*
+ *  Request timing phases. Blocked time is also included in the output phase.
+ */
+#define MA_TIMING_PARSE         0           /* Parse the request line and headers */
+#define MA_TIMING_MATCH         1           /* Match the handler (maMatchHandler) */
+#define MA_TIMING_PIPELINE      2           /* Create the pipeline and open the stages (maCreatePipeline) */
+#define MA_TIMING_CONTENT       3           /* Receive request content before running the handler */
+#define MA_TIMING_RUN           4           /* Handler run routine */
+#define MA_TIMING_OUTPUT        5           /* Service the queues and write the response */
+#define MA_TIMING_BLOCKED       6           /* Connector write blocked waiting for the client */
+#define MA_TIMING_PHASES        7
+
+/**
+ *  Request metric counters
+ *  @description Counters accumulated for completed requests. Request latency is recorded in a log-linear 
+ *      histogram with (1 << MA_METRICS_SUB_BITS) buckets per power of two milliseconds.
+ *  @stability Prototype
+ *  @defgroup MaMetrics MaMetrics
+ *  @see MaMetrics maCreateMetrics maGetMetrics maUpdateMetrics maOpenMetricsHandler
+ */
+typedef struct MaMetricCounters {
+    int64           requests;               /**< Completed requests */
+    int64           bytesIn;                /**< Request bytes received including headers */
+    int64           bytesOut;               /**< Response bytes written including headers */
+    int64           keepAlive;              /**< Requests that reused a keep-alive connection */
+    int64           status[MA_METRICS_STATUS]; /**< Requests by response status class */
+    int64           latencySum;             /**< Total request latency in msec */
+    int64           latencyMax;             /**< Maximum request latency in msec */
+    int64           latency[MA_METRICS_BUCKETS]; /**< Request latency histogram */
+    int64           timed;                  /**< Requests with stage timing */
+    int64           phase[MA_TIMING_PHASES];/**< Time in each request phase in usec (hosts only) */
+    int64           serviceTime;            /**< Time in queue service routines in usec */
+    int64           serviceCount;           /**< Queue service routine invocations */
+} MaMetricCounters;
+
+/*
+ *  Counter shard. Each thread updates the shard selected by its thread ID so updates rarely contend.
+ */
+typedef struct MaMetricShard {
+    MaMetricCounters counters;
+#if BLD_FEATURE_MULTITHREAD
+    MprSpin         lock;
+#endif
+} MaMetricShard;
+
+typedef struct MaMetrics {
+    MaMetricShard   shards[MA_METRICS_SHARDS];
+} MaMetrics;
+
+/**
+ *  Create a metrics object
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @return A new metrics object
+ *  @ingroup MaMetrics
+ */
+extern MaMetrics *maCreateMetrics(MprCtx ctx);
+
+/**
+ *  Get the current metrics
+ *  @description Merge the metric shards into a single set of counters
+ *  @param metrics Metrics object
+ *  @param counters Counters to receive the merged totals
+ *  @ingroup MaMetrics
+ */
+extern void maGetMetrics(MaMetrics *metrics, MaMetricCounters *counters);
+
+/**
+ *  Get the upper bound of a latency histogram bucket
+ *  @param bucket Bucket index
+ *  @return The largest latency in msec recorded in the bucket
+ *  @ingroup MaMetrics
+ */
+extern int64 maGetMetricsBucketLimit(int bucket);
+
+/**
+ *  Get a latency percentile
+ *  @param counters Merged metric counters
+ *  @param percent Percentile to compute (0-100)
+ *  @return The latency in msec (upper bound of the containing histogram bucket)
+ *  @ingroup MaMetrics
+ */
+extern int64 maGetMetricsPercentile(MaMetricCounters *counters, int percent);
+
+extern void maUpdateMetrics(struct MaConn *conn);
+extern int maOpenMetricsHandler(MaHttp *http);
+
+/**
+ *  Per-request stage timing
+ *  @description When RequestTiming is enabled for a host, high resolution timestamps are recorded at each pipeline
+ *      transition and around each queue service routine. Requests slower than the host threshold are traced and all
+ *      timed requests are added to the host and stage metrics.
+ *  @ingroup MaMetrics
+ */
+typedef struct MaTiming {
+    MprTime         start;                  /**< Request start time in usec */
+    MprTime         mark;                   /**< Time of the last phase transition in usec */
+    MprTime         blockedStart;           /**< When the connector became write blocked (zero if not blocked) */
+    MprTime         phase[MA_TIMING_PHASES];/**< Elapsed time in each phase in usec */
+    int             blockedCount;           /**< Number of times the connector was write blocked */
+} MaTiming;
+
+extern cchar *maGetTimingPhaseName(int phase);
+extern void maStartTiming(struct MaConn *conn);
+extern void maMarkTiming(struct MaConn *conn, int phase);
+extern void maTimeService(struct MaQueue *q);
+extern void maTimeWriteBlocked(struct MaConn *conn, bool blocked);
+extern void maCompleteTiming(struct MaConn *conn);
+
+/*
+ *  Record a timing phase transition. When timing is disabled, this is a single test.
+ */
+#define MA_TIMING(conn, phase) do { if (unlikely((conn)->timing)) { maMarkTiming(conn, phase); } } while (0)
+
 /************************************ MaHost **********************************/
 /*
  *  Flags
@@ -689,11 +809,18 @@ typedef struct MaHost {
 #if BLD_FEATURE_ACCESS_LOG
     char            *logFormat;             /**< Access log format */
     char            *logPath;               /**< Access log filename */
+    MprList         *logOps;                /**< Compiled access log format */
+    struct MaAccessLog *logWriter;          /**< Buffered access log writer */
+    int             logBufSize;             /**< Size of the access log ring buffer */
+    bool            logBlock;               /**< Block requests rather than drop entries if the log buffer is full */
 #endif
 
     int             keepAlive;              /**< Keep alive supported */
     int             keepAliveTimeout;       /**< Timeout for keep-alive */
+    int             handshakeTimeout;       /**< Timeout to complete an SSL handshake */
     int             maxKeepAlive;           /**< Max keep-alive requests */
+    char            *keepAliveHeader;       /**< Precomputed Connection and Keep-Alive headers (without max) */
+    int             keepAliveHeaderLen;     /**< Length of keepAliveHeader */
 
     int             connCount;              /**< Connect sequence number */
     int             traceLevel;             /**< Trace activation level */
@@ -704,7 +831,10 @@ typedef struct MaHost {
 
     MprHashTable    *mimeTypes;             /**< Hash table of mime types (key is extension) */
     MprTime         now;                    /**< When was the current date last computed */
-    char            *currentDate;           /**< Date string for HTTP response headers */
+    cchar           *currentDate;           /**< Date string for HTTP response headers */
+    MaMetrics       *metrics;               /**< Request metrics */
+    bool            timing;                 /**< Record per-request stage timing */
+    int             timingThreshold;        /**< Trace timed requests that take longer than this (msec) */
 
 #if BLD_FEATURE_MULTITHREAD
     MprMutex        *mutex;
@@ -739,10 +869,12 @@ extern void         maRemoveConn(MaHost *host, struct MaConn *conn);
 extern int          maSetupTrace(MaHost *host, cchar *ext);
 extern void         maSetMaxKeepAlive(MaHost *host, int timeout);
 extern void         maSetDocumentRoot(MaHost *host, cchar *dir) ;
+extern void         maSetHandshakeTimeout(MaHost *host, int timeout);
 extern void         maSetHostFilter(MaHost *host, int length, cchar *include, cchar *exclude);
 extern void         maSetHostIpAddrPort(MaHost *host, cchar *ipAddrPort);
 extern void         maSetHostName(MaHost *host, cchar *name);
 extern void         maSetHostTrace(MaHost *host, int level, int mask);
+extern void         maSetRequestTiming(MaHost *host, bool on, int threshold);
 extern void         maSetHostTraceFilter(MaHost *host, int len, cchar *include, cchar *exclude);
 extern void         maSetHttpVersion(MaHost *host, int version);
 extern void         maSetKeepAlive(MaHost *host, bool on);
@@ -806,6 +938,7 @@ extern bool maFixRangeLength(struct MaConn *conn);
 #define MA_PACKET_RANGE     0x2             /**< Packet is a range boundary packet */
 #define MA_PACKET_DATA      0x4             /**< Packet contains actual content data */
 #define MA_PACKET_END       0x8             /**< End of stream packet */
+#define MA_PACKET_SPLICE    0x10            /**< Entity data is spliced from the response splice pipe */
 
 /**
  *  Data packet. 
@@ -822,7 +955,9 @@ extern bool maFixRangeLength(struct MaConn *conn);
  *      maGetPacketLength maCreateHeaderPacket
  */
 typedef struct MaPacket {
-    MprBuf          *prefix;                /**< Prefix message to be emitted before the content */
+    char            *prefix;                /**< Prefix message to be emitted before the content */
+    int             prefixLen;              /**< Length of the remaining prefix */
+    char            prefixBuf[MA_PREFIX_SIZE];  /**< Inline storage for short prefixes (chunk framing) */
     MprBuf          *content;               /**< Chunk content */
     int             flags;                  /**< Packet flags */
     MprOff          esize;                  /**< Data size in entity */
@@ -903,6 +1038,21 @@ extern int maJoinPacket(MaPacket *packet, MaPacket *other);
  */
 extern MaPacket *maSplitPacket(MprCtx ctx, MaPacket *packet, int offset);
 
+/**
+ *  Slice the front of a data packet without copying
+ *  @description Detach the first "size" bytes of a packet into a new packet that references the original packet
+ *      buffer rather than copying the data. The original packet retains the remaining data. This is cheaper than
+ *      maSplitPacket for large packets, but the new packet must be consumed before the original packet is freed. 
+ *      Use this only when the slice will be written ahead of the original, as when a connector writes queued packets 
+ *      in order. Entity packets are split by adjusting their entity position and length.
+ *  @param ctx A conn or request memory context object to own the packet.
+ *  @param packet Packet to slice
+ *  @param size Number of bytes to slice from the front of the packet
+ *  @return New MaPacket object containing the first "size" bytes.
+ *  @ingroup MaPacket
+ */
+extern MaPacket *maSlicePacket(MprCtx ctx, MaPacket *packet, int size);
+
 #if DOXYGEN
 /**
  *  Get the length of the packet data contents
@@ -916,7 +1066,7 @@ extern int maGetPacketLength(MaPacket *packet);
 #else
 #define maGetPacketLength(p) (p->content ? mprGetBufLength(p->content) : 0)
 #endif
-#define maGetPacketEntityLength(p) (p->content ? mprGetBufLength(p->content) : packet->esize)
+#define maGetPacketEntityLength(p) (p->content ? mprGetBufLength(p->content) : p->esize)
 
 extern void maAdjustPacketEnd(MaPacket *packet, MprOff size);
 extern void maAdjustPacketStart(MaPacket *packet, MprOff size);
@@ -994,6 +1144,8 @@ typedef struct MaQueue {
     int             packetSize;             /**< Maximum acceptable packet size */
     int             direction;              /**< Flow direction */
     void            *queueData;             /**< Stage instance data */
+    MprTime         serviceTime;            /**< Time in the service routine in usec (if timing) */
+    int             serviceCount;           /**< Service routine invocations (if timing) */
 
     /*
      *  Connector instance data. Put here to save a memory allocation.
@@ -1292,6 +1444,7 @@ extern void maJoinPackets(MaQueue *q);
 typedef struct MaStage {
     char            *name;                  /**< Stage name */
     int             flags;                  /**< Stage flags */
+    MaMetrics       *metrics;               /**< Request and service time metrics */
 
     /**
      *  Parse configuration data.
@@ -1392,6 +1545,16 @@ typedef struct MaStage {
      */
     void            (*incomingService)(MaQueue *q);
 
+    /**
+     *  Report stage specific metrics
+     *  @description Append stage metrics to the metrics handler report
+     *  @param stage Stage object
+     *  @param buf Buffer to receive the metrics
+     *  @param json Set to true to report in JSON format. Otherwise use the Prometheus text format.
+     *  @ingroup MaStage
+     */
+    void            (*reportMetrics)(struct MaStage *stage, MprBuf *buf, bool json);
+
     MprModule       *module;                /**< Backing module */
     char            *path;                  /**< Backing module path (from LoadModule) */
     void            *stageData;             /**< Per-stage data */
@@ -1567,9 +1730,11 @@ typedef struct MaConn {
     int             keepAliveCount;         /**< Count of remaining keep alive requests for this connection */
     int             protocol;               /**< HTTP protocol version 0 == HTTP/1.0, 1 == HTTP/1.1*/
     int             remotePort;             /**< Remote client IP port number */
+    int             requestCount;           /**< Count of requests received on this connection */
     int             seqno;                  /**< Unique connection sequence number */
     int             timeout;                /**< Timeout period in msec */
     int             trace;                  /**< Current request should be traced */
+    MaTiming        *timing;                /**< Stage timing for the current request (null if not timing) */
 #if BLD_FEATURE_MULTITHREAD
     MprMutex        *mutex;                 /**< Optional multi-thread sync */
 #endif
@@ -1713,8 +1878,9 @@ typedef struct MaRequest {
     MprTime         since;                  /**< If-Modified date */
     bool            ifModified;             /**< If-Modified processing requested */
     bool            ifMatch;                /**< If-Match processing requested */
-#if BLD_DEBUG
     MprTime         startTime;              /**< Start time of request */
+    int             headerSize;             /**< Size of the request headers */
+#if BLD_DEBUG
     uint64          startTicks;             /**< Start tick time of request */
 #endif
 } MaRequest;
@@ -1893,6 +2059,9 @@ typedef struct MaResponse {
     char            *rangeBoundary;         /**< Inter-range boundary */
     MprOff          rangePos;               /**< Current range I/O position */
 
+    int             spliceFd;               /**< Pipe from which MA_PACKET_SPLICE entity data is read */
+    MprOff          splicePending;          /**< Bytes queued for splicing but not yet written */
+
     MaRedirectCallback redirectCallback;    /**< Redirect callback */
     MaEnvCallback   envCallback;            /**< SetEnv callback */
 
@@ -2004,7 +2173,40 @@ extern void maSetHeader(MaConn *conn, bool allowMultiple, cchar *key, cchar *fmt
 
 extern MaResponse   *maCreateResponse(MaConn *conn);
 extern int          maDateParse(cchar *cmd);
+extern int          maCreateDateCache(MaHttp *http);
 extern char         *maGetDateString(MprCtx ctx, MprPath *sbuf);
+
+/**
+ *  Get the current date
+ *  @description Get the current date formatted for HTTP headers. The date is formatted once per second and cached. 
+ *      The returned string is immutable and remains valid for at least MA_DATE_RETAIN seconds.
+ *  @param http Http service object
+ *  @return The current date string
+ *  @ingroup MaResponse
+ */
+extern cchar *maGetCurrentDate(MaHttp *http);
+
+/**
+ *  Get the standard date and server response headers
+ *  @description Get the "Date" and "Server" response header lines for the current second
+ *  @param http Http service object
+ *  @param len Set to the length of the returned headers
+ *  @return The header lines including the trailing "\r\n"
+ *  @ingroup MaResponse
+ */
+extern cchar *maGetDateHeaders(MaHttp *http, int *len);
+
+/**
+ *  Format a Last-Modified date
+ *  @description Format a file modification time for HTTP headers. Recently formatted dates are cached.
+ *  @param http Http service object
+ *  @param mtime Modification time in seconds since 1970
+ *  @param buf Buffer to receive the date
+ *  @param bufsize Size of buf. Should be at least MA_DATE_SIZE.
+ *  @return buf
+ *  @ingroup MaResponse
+ */
+extern char *maGetModifiedDate(MaHttp *http, MprTime mtime, char *buf, int bufsize);
 extern void         maLogRequest(MaConn *conn);
 extern char         *maMakePath(MaHost *host, cchar *file);
 extern void         maOmitResponseBody(MaConn *conn);
@@ -2019,6 +2221,7 @@ extern int          maStartAccessLogging(MaHost *host);
 extern int          maStopAccessLogging(MaHost *host);
 extern void         maSetAccessLog(MaHost *host, cchar *path, cchar *format);
 extern void         maSetLogHost(MaHost *host, MaHost *logHost);
+extern void         maSetAccessLogBuffer(MaHost *host, int size, bool block);
 extern void         maTraceOptions(MaConn *conn);
 extern void         maWriteAccessLogEntry(MaHost *host, cchar *buf, int len);
 extern char         *maMakeFilename(MaConn *conn, MaAlias *alias, cchar *url, bool skipAliasPrefix);
@@ -2030,6 +2233,7 @@ extern void         maSetEnvCallback(MaConn *conn, MaEnvCallback envCallback);
 
 #define MA_CGI_SEEN_HEADER          0x1
 #define MA_CGI_FLOW_CONTROL         0x2     /* Output to client is flow controlled */
+#define MA_CGI_SPLICE               0x4     /* Output is spliced from the CGI stdout pipe to the client socket */
 
 /************************************ EGI *************************************/
 
@@ -76,6 +76,8 @@
     #define MA_MAX_UPLOAD_SIZE      (10 * 1024 * 1024)  /* Max size of uploaded document */
     #define MA_MAX_PASS             64                  /**< Size of password */
     #define MA_MAX_SECRET           32                  /**< Number of random bytes to use */
+    #define MA_METRICS_SHARDS       1                   /**< Number of metrics counter shards */
+    #define MA_DATE_MODIFIED        16                  /**< Cached Last-Modified date strings */
 
 #elif BLD_TUNE == MPR_TUNE_BALANCED
     /*
@@ -95,6 +97,8 @@
 
     #define MA_MAX_PASS             128
     #define MA_MAX_SECRET           32
+    #define MA_METRICS_SHARDS       4
+    #define MA_DATE_MODIFIED        64
 #else
     /*
      *  Tune for speed
@@ -113,6 +117,8 @@
 
     #define MA_MAX_PASS             128
     #define MA_MAX_SECRET           32
+    #define MA_METRICS_SHARDS       8
+    #define MA_DATE_MODIFIED        256
 #endif
 
 #if !BLD_FEATURE_VMALLOC
@@ -124,11 +130,20 @@
 #define MA_PACKET_ALIGN(x)      (((x) + 0x3FF) & ~0x3FF)
 #define MA_DEFAULT_MAX_THREADS  10              /**< Default number of threads */
 #define MA_KEEP_TIMEOUT         60000           /**< Keep connection alive timeout */
+#define MA_HANDSHAKE_TIMEOUT    10000           /**< Time allowed to complete an SSL handshake */
 #define MA_CGI_TIMEOUT          4000            /**< Time to wait to reap exit status */
 #define MA_MAX_KEEP_ALIVE       100             /**< Default requests per TCP conn */
 #define MA_TIMER_PERIOD         1000            /**< Timer checks ever 1 second */
 #define MA_CGI_PERIOD           20              /**< CGI poll period (only for windows) */
 #define MA_MAX_ACCESS_LOG       (20971520)      /**< Access file size (20 MB) */
+#define MA_ACCESS_LOG_BUFSIZE   (64 * 1024)     /**< Access log ring buffer size */
+#define MA_ACCESS_LOG_FLUSH     (1000)          /**< Access log flush period (msec) */
+#define MA_METRICS_SUB_BITS     (2)             /**< Log2 of latency histogram sub-buckets per power of two */
+#define MA_DATE_RETAIN          30              /**< Seconds a replaced cached date string remains valid */
+#define MA_DATE_SIZE            40              /**< Buffer size for a formatted HTTP date */
+#define MA_UPLOAD_BUFSIZE       (64 * 1024)     /**< Upload file write buffer size */
+#define MA_PREFIX_SIZE          16              /**< Inline packet prefix storage. Holds "\r\nXXXXXXXX\r\n" */
+#define MA_METRICS_BUCKETS      (96)            /**< Latency histogram buckets (up to ~9 hours in msec) */
 #define MA_SERVER_TIMEOUT       (300 * 1000)
 #define MA_MAX_CONFIG_DEPTH     (16)            /* Max nest of directives in config file */
 #define MA_RANGE_BUFSIZE        (128)           /* Size of a range boundary */
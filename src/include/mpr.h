@@ -1151,6 +1151,7 @@ extern "C" {
     #define MPR_XML_BUFSIZE         4096        /**< XML read buffer size */
     #define MPR_HTTP_BUFSIZE        4096        /**< HTTP buffer size. Must fit complete HTTP headers */
     #define MPR_SSL_BUFSIZE         4096        /**< SSL has 16K max*/
+    #define MPR_SSL_RECORD_SIZE     4096        /**< Size to coalesce vectored writes into SSL records */
     #define MPR_LIST_INCR           8           /**< Default list growth inc */
     #define MPR_FILES_HASH_SIZE     29          /** Hash size for rom file system */
     #define MPR_TIME_HASH_SIZE      67          /** Hash size for time token lookup */
@@ -1178,6 +1179,7 @@ extern "C" {
     #define MPR_XML_BUFSIZE         4096
     #define MPR_HTTP_BUFSIZE        4096
     #define MPR_SSL_BUFSIZE         4096
+    #define MPR_SSL_RECORD_SIZE     (16 * 1024)
     #define MPR_LIST_INCR           16
     #define MPR_FILES_HASH_SIZE     61
     #define MPR_TIME_HASH_SIZE      89
@@ -1204,6 +1206,7 @@ extern "C" {
     #define MPR_XML_BUFSIZE         4096
     #define MPR_HTTP_BUFSIZE        8192
     #define MPR_SSL_BUFSIZE         8192
+    #define MPR_SSL_RECORD_SIZE     (16 * 1024)
     #define MPR_LIST_INCR           16
     #define MPR_BUF_INCR            1024
     #define MPR_FILES_HASH_SIZE     61
@@ -1302,6 +1305,13 @@ extern "C" {
  *  HTTP
  */
 #define MPR_HTTP_RETRIES        (2)
+#define MPR_HTTP_POOL_MAX       8           /* Max idle keep-alive connections pooled per host */
+#define MPR_HTTP_POOL_TIMEOUT   30000       /* Idle pooled connection timeout. Less than the server keep-alive timeout */
+
+/*
+ *  Regular expressions
+ */
+#define MPR_REGEX_CACHE_MAX     256         /* Max compiled patterns kept in the process-wide regex cache */
 
 #ifdef __cplusplus
 }
@@ -1634,6 +1644,12 @@ typedef struct MprString { int dummy; } MprString;
  */
 extern char *mprDtoa(MprCtx ctx, double value, int ndigits, int mode, int flags);
 
+/**
+    Initialize number conversion for multithreaded use. This is called by mprCreate.
+    @param ctx Any memory context allocated by the MPR.
+ */
+extern void mprInitDtoa(MprCtx ctx);
+
 extern int mprIsInfinite(double value);
 extern int mprIsZero(double value);
 extern int mprIsNan(double value);
@@ -2365,6 +2381,16 @@ extern MprTime  mprGetTime(MprCtx ctx);
 
 extern uint64 mprGetTicks();
 
+/**
+ *  Get a high resolution time
+ *  @description Get a monotonic time in microseconds suitable for measuring short intervals. The value is not 
+ *      related to the time of day.
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @return Returns the time in microseconds.
+ *  @ingroup MprDate
+ */
+extern MprTime  mprGetHiResTime(MprCtx ctx);
+
 /**
  *  Return the time remaining until a timeout has elapsed
  *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
@@ -3137,7 +3163,7 @@ extern void mprSetPathNewline(MprCtx ctx, cchar *path, cchar *newline);
  *       created when a file is created or opened via #mprOpen.
  *  @stability Evolving.
  *  @see MprFile mprClose mprGets mprOpen mprPutc mprPuts mprRead mprSeek mprWrite mprWriteString mprWriteFormat
- *      mprFlush MprFile mprGetc mprDisableFileBuffering mprEnableFileBuffering mprGetFileSize 
+ *      mprFlush MprFile mprGetc mprDisableFileBuffering mprEnableFileBuffering mprGetFileSize mprMapFile
  *      mprGetFilePosition mprPeekc
  *
  *  @defgroup MprFile MprFile
@@ -3296,6 +3322,26 @@ extern MprFile *mprGetStderr(MprCtx ctx);
  */
 extern MprFile *mprOpen(MprCtx ctx, cchar *filename, int omode, int perms);
 
+/**
+ *  Map a file into memory
+ *  @description Map the contents of an open file read-only into the application's address space. The mapping
+ *      remains valid after the file is closed and must be released via #mprUnmapFile.
+ *  @param file Pointer to an MprFile object returned via MprOpen.
+ *  @param size Number of bytes to map from the start of the file.
+ *  @return The address of the mapped data. Returns NULL if the file system or platform does not support mapping.
+ *      Callers should then read the file instead.
+ *  @ingroup MprFile
+ */
+extern void *mprMapFile(MprFile *file, uint size);
+
+/**
+ *  Release a file mapping
+ *  @param ptr Address returned from #mprMapFile
+ *  @param size Size given to #mprMapFile
+ *  @ingroup MprFile
+ */
+extern void mprUnmapFile(void *ptr, uint size);
+
 /**
  *  Non-destructively read a character from the file.
  *  @description Read a single character from the file without advancing the read position.
@@ -3403,6 +3449,7 @@ typedef struct MprPath {
     MprTime         mtime;              /**< Modified time */
     int64           size;               /**< File length */
     int64           inode;              /**< Inode number */
+    int64           dev;                /**< Device number */
     bool            isDir;              /**< Set if directory */
     bool            isLink;             /**< Set if symbolic link */
     bool            isReg;              /**< Set if a regular file */
@@ -4675,6 +4722,23 @@ typedef void *MprThread;
 
 extern cchar *mprGetCurrentThreadName(MprCtx ctx);
 
+/**
+ *  Apply a full memory barrier
+ *  @description Memory writes before the barrier are visible to other threads before any writes after the barrier.
+ *      Use this before publishing a pointer to newly initialized data.
+ *  @ingroup MprSynch
+ */
+extern void mprAtomicBarrier();
+
+/**
+ *  Atomically add to an integer
+ *  @param ptr Address of the integer to update
+ *  @param value Value to add
+ *  @return The updated value
+ *  @ingroup MprSynch
+ */
+extern int mprAtomicAdd(volatile int *ptr, int value);
+
 /*
  *  Magic number to identify blocks. Only used in debug mode.
  */
@@ -5623,6 +5687,9 @@ extern int mprSetMaxSocketClients(MprCtx ctx, int max);
 #define MPR_SOCKET_CLIENT       0x800       /**< Socket is a client */
 #define MPR_SOCKET_PENDING      0x1000      /**< Pending buffered read data */
 #define MPR_SOCKET_RUNNING      0x2000      /**< Socket is running callback */
+#define MPR_SOCKET_HANDSHAKING  0x4000      /**< Secure socket handshake in progress */
+#define MPR_SOCKET_WANT_WRITE   0x8000      /**< Secure socket needs a writable event to make progress */
+#define MPR_SOCKET_KERNEL_TLS   0x10000     /**< Secure socket record encryption is performed by the kernel */
 
 /**
  *  Socket Service
@@ -5846,6 +5913,16 @@ extern bool mprHasSocketPendingData(MprSocket *sp);
  */
 extern bool mprIsSocketEof(MprSocket *sp);
 
+/**
+ *  Get the I/O events required to progress a secure socket handshake
+ *  @description Secure sockets perform their handshake incrementally as the socket is read. While the handshake
+ *      is in progress, the socket should be waited on for the returned events and then read again.
+ *  @param sp Socket object returned from #mprCreateSocket
+ *  @return Zero if no handshake is in progress. Otherwise MPR_READABLE or MPR_WRITABLE.
+ *  @ingroup MprSocket
+ */
+extern int mprGetSocketHandshakeMask(MprSocket *sp);
+
 /**
  *  Get the socket file descriptor.
  *  @description Get the file descriptor associated with a socket.
@@ -5917,6 +5994,27 @@ extern MprOffset mprSendFileToSocket(MprSocket *sock, MprFile *file, MprOffset o
     int beforeCount, MprIOVec *afterVec, int afterCount);
 #endif
 
+#if LINUX && !__UCLIBC__
+    #define BLD_HAS_SPLICE      1
+#else
+    #define BLD_HAS_SPLICE      0
+#endif
+
+#if BLD_HAS_SPLICE
+/**
+ *  Splice data from a pipe to a socket
+ *  @description Move data from a pipe directly to a socket without copying it through user space. This is only
+ *      supported for non-secure sockets. If the socket is in non-blocking mode (the default), the write may return
+ *      having written less than the required bytes.
+ *  @param sock Socket object returned from #mprCreateSocket
+ *  @param fd Pipe file descriptor from which to read data
+ *  @param len Length of data to transfer
+ *  @return A count of bytes actually written. Return a negative MPR error code on errors.
+ *  @ingroup MprSocket
+ */
+extern int mprSpliceToSocket(MprSocket *sock, int fd, int len);
+#endif
+
 /**
  *  Set an EOF condition on the socket
  *  @param sp Socket object returned from #mprCreateSocket
@@ -5933,6 +6031,16 @@ extern void mprSetSocketEof(MprSocket *sp, bool eof);
  */
 extern bool mprIsSocketSecure(MprSocket *sp);
 
+/**
+ *  Determine if file data can be sent directly to the socket
+ *  @description Plain sockets and secure sockets whose encryption has been offloaded to the kernel can use 
+ *      #mprSendFileToSocket without passing the file data through user space.
+ *  @param sp Socket object returned from #mprCreateSocket
+ *  @return True if the socket can use sendfile.
+ *  @ingroup MprSocket
+ */
+extern bool mprCanSocketSendFile(MprSocket *sp);
+
 /**
  *  Write a vector to a socket
  *  @description Do scatter/gather I/O by writing a vector of buffers to a socket.
@@ -5987,6 +6095,14 @@ extern MprModule *mprLoadSsl(MprCtx ctx, bool lazy);
  *  @param ssl MprSsl configuration
  */
 extern void mprConfigureSsl(struct MprSsl *ssl);
+
+/**
+ *  Get SSL handshake statistics
+ *  @param ssl MprSsl configuration
+ *  @param fullHandshakes Set to the count of handshakes that negotiated a new session
+ *  @param resumedHandshakes Set to the count of handshakes that resumed a cached session or session ticket
+ */
+extern void mprGetSslStats(struct MprSsl *ssl, int64 *fullHandshakes, int64 *resumedHandshakes);
 #endif
 
 extern int mprGetSocketInfo(MprCtx ctx, cchar *host, int port, int *family, int *protocol, struct sockaddr **addr, 
@@ -6336,6 +6452,19 @@ extern char *mprValidateUrl(MprCtx ctx, char *url);
 #define MPR_HTTP_CODE_COMMS_ERROR               550
 #define MPR_HTTP_CODE_CLIENT_ERROR              551
 
+/**
+ *  Http client connection pool statistics
+ *  @ingroup MprHttp
+ */
+typedef struct MprHttpPoolStats {
+    int             opened;                                 /**< Connections opened */
+    int             reused;                                 /**< Requests issued on a pooled connection */
+    int             idle;                                   /**< Connections currently idle in the pool */
+    int             expired;                                /**< Idle connections closed by the idle timeout */
+    int             discarded;                              /**< Connections closed because stale or the pool was full */
+    int             pipelined;                              /**< Requests written ahead of prior responses */
+} MprHttpPoolStats;
+
 /*
  *  Overall HTTP service
  */
@@ -6345,8 +6474,13 @@ typedef struct MprHttpService {
     MprEvent        *timer;                                 /* Timeout event handle  */
     char            *secret;                                /* Random bytes to use in authentication */
     int             next;                                   /* Next sequence */
+    MprList         *pool;                                  /* Idle keep-alive client connections */
+    int             poolMax;                                /* Max idle connections per host. Zero disables */
+    int             poolTimeout;                            /* Idle connection timeout in msec */
+    MprHttpPoolStats stats;                                 /* Connection pool statistics */
 #if BLD_FEATURE_MULTITHREAD
     MprMutex        *mutex;                                 /* Mutli-thread sync */
+    MprMutex        *poolMutex;                             /* Pool sync. Never held while locking a http object */
 #endif
 } MprHttpService;
 
@@ -6465,7 +6599,7 @@ typedef struct MprHttpResponse {
  *      mprSetHttpChunked mprSetHttpContentLength mprSetHttpCredentials mprSetHttpDefaultHost mprSetHttpDefaultPort 
  *      mprSetHttpFollowRedirects mprSetHttpHeader mprSetHttpKeepAlive mprSetHttpProtocol mprSetHttpProxy 
  *      mprSetHttpRetries mprSetHttpTimeout mprWaitForHttp mprWaitForHttpResponse mprWriteHttp mprWriteHttpUploadData
- *      mprFinalizeHttpWriting
+ *      mprFinalizeHttpWriting mprGetHttpPoolStats mprNextHttpResponse mprPipelineHttpRequest mprSetHttpPoolLimits
  *  @defgroup MprHttp MprHttp
  */
 typedef struct MprHttp {
@@ -6511,6 +6645,8 @@ typedef struct MprHttp {
     int             bufmax;             /**< Maximum buffer size. -1 is no max */
     int             secure;             /**< Request uses SSL */
     int             protocolVersion;    /**< HTTP protocol version to request */
+    MprList         *pipeline;          /**< Urls of pipelined requests awaiting a response */
+    MprBuf          *pending;           /**< Response data read ahead for pipelined requests */
 #if BLD_FEATURE_MULTITHREAD
     MprMutex        *mutex;             /**< Mutli-thread sync */
 #endif
@@ -6611,6 +6747,41 @@ extern int mprGetHttpFlags(MprHttp *http);
  */
 extern int mprGetHttpState(MprHttp *http);
 
+/**
+ *  Get the Http client connection pool statistics
+ *  @description Http/1.1 keep-alive connections are returned to a process-wide pool when a request completes and
+ *      are reused by later requests to the same host and port from any Http object.
+ *  @param ctx Any memory allocation context created by MprAlloc
+ *  @param stats Structure to receive a copy of the pool statistics
+ *  @ingroup MprHttp
+ */
+extern void mprGetHttpPoolStats(MprCtx ctx, MprHttpPoolStats *stats);
+
+/**
+ *  Prepare to read the response to the next pipelined request
+ *  @description Call this after the prior response has been completely read. The response is then read using
+ *      the normal routines such as #mprWaitForHttp and #mprReadHttp.
+ *  @param http Http object created via #mprCreateHttp
+ *  @return Zero if successful. Returns MPR_ERR_BAD_STATE if there are no pipelined requests or the server closed
+ *      the connection. In that case, the remaining pipelined requests must be reissued.
+ *  @ingroup MprHttp
+ */
+extern int mprNextHttpResponse(MprHttp *http);
+
+/**
+ *  Pipeline a Http GET request
+ *  @description Write a GET request on the current connection without waiting for the response to the prior
+ *      request. This must be called after #mprStartHttpRequest and before waiting for its response. The request uses
+ *      the same host, headers and credentials as the current request. Responses are read in order via 
+ *      #mprNextHttpResponse.
+ *  @param http Http object created via #mprCreateHttp
+ *  @param uri Request uri. The host, port and scheme must match the current connection.
+ *  @return Zero if the request was written. Returns MPR_ERR_BAD_STATE if the request cannot be pipelined on the current
+ *      connection, including requests for a different host, port or scheme. Then the request must be issued normally.
+ *  @ingroup MprHttp
+ */
+extern int mprPipelineHttpRequest(MprHttp *http, cchar *uri);
+
 /**
  *  Get the default host
  *  @description A default host can be defined which will be used for URIs that omit a host specification.
@@ -6888,6 +7059,16 @@ extern int mprSetHttpHeader(MprHttp *http, bool overwrite, cchar *key, cchar *va
  */
 extern void mprSetHttpKeepAlive(MprHttp *http, bool on);
 
+/**
+ *  Set the Http client connection pool limits
+ *  @param ctx Any memory allocation context created by MprAlloc
+ *  @param maxPerHost Maximum number of idle connections to retain for each host and port. Set to zero to disable
+ *      pooling. Set to -1 to leave unchanged.
+ *  @param timeout Time in milliseconds an idle connection is retained. Set to -1 to leave unchanged.
+ *  @ingroup MprHttp
+ */
+extern void mprSetHttpPoolLimits(MprCtx ctx, int maxPerHost, int timeout);
+
 /**
  *  Set the Http protocol variant.
  *  @description Set the Http protocol variant to use. 
@@ -7296,6 +7477,77 @@ extern int mprWriteCmdPipe(MprCmd *cmd, int channel, char *buf, int bufsize);
 extern int mprIsCmdComplete(MprCmd *cmd);
 
 #endif /* BLD_FEATURE_CMD */
+/* ******************************** MprRegex **********************************/
+#if BLD_FEATURE_REGEXP
+/**
+ *  Regular expression cache statistics
+ *  @ingroup MprRegex
+ */
+typedef struct MprRegexStats {
+    int             hits;                   /**< Compiles satisfied from the cache */
+    int             misses;                 /**< Patterns compiled by PCRE */
+    int             entries;                /**< Patterns currently held by the cache */
+    int             evicted;                /**< Idle patterns removed to make room for new patterns */
+} MprRegexStats;
+
+/**
+ *  Compiled regular expression
+ *  @description Compiled patterns are shared via a process-wide cache keyed by the pattern and PCRE options. 
+ *      A compiled pattern is read-only and may be used by pcre_exec in multiple threads at once.
+ *  @stability Evolving
+ *  @see mprCompileRegex, mprReleaseRegex, mprGetRegexStats, mprSetRegexCacheLimit
+ *  @defgroup MprRegex MprRegex
+ */
+typedef struct MprRegex {
+    struct real_pcre *compiled;             /**< Compiled pattern to pass to pcre_exec */
+    char            *key;                   /* Cache key */
+    int             refs;                   /* Count of users holding the pattern */
+    int             cached;                 /* Held by the cache. Otherwise freed when the last user releases it */
+    int             lastUsed;               /* Cache tick when last requested */
+} MprRegex;
+
+/**
+ *  Compile a regular expression
+ *  @description Return a compiled pattern from the process-wide regex cache, compiling and caching the pattern if
+ *      required. The caller holds a reference and must call #mprReleaseRegex when the pattern is no longer needed.
+ *      This routine is thread-safe.
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @param pattern Regular expression pattern
+ *  @param options PCRE compile options
+ *  @param errMsg Set to a static error message if the pattern can't be compiled. May be null.
+ *  @param column Set to the pattern offset of the error if the pattern can't be compiled. May be null.
+ *  @return A compiled regular expression or null if the pattern can't be compiled.
+ *  @ingroup MprRegex
+ */
+extern MprRegex *mprCompileRegex(MprCtx ctx, cchar *pattern, int options, cchar **errMsg, int *column);
+
+/**
+ *  Release a compiled regular expression
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @param rp Regular expression returned from #mprCompileRegex
+ *  @ingroup MprRegex
+ */
+extern void mprReleaseRegex(MprCtx ctx, MprRegex *rp);
+
+/**
+ *  Get the regular expression cache statistics
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @param stats Statistics structure to fill
+ *  @ingroup MprRegex
+ */
+extern void mprGetRegexStats(MprCtx ctx, MprRegexStats *stats);
+
+/**
+ *  Set the regular expression cache size
+ *  @description Idle patterns beyond the limit are freed. Patterns compiled while the cache is full of patterns 
+ *      in use are not cached. 
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @param max Maximum number of cached patterns. Set to zero to disable caching. Defaults to MPR_REGEX_CACHE_MAX.
+ *  @ingroup MprRegex
+ */
+extern void mprSetRegexCacheLimit(MprCtx ctx, int max);
+
+#endif /* BLD_FEATURE_REGEXP */
 /* *********************************** Mpr ************************************/
 /*
  *  Mpr flags
@@ -7364,6 +7616,9 @@ typedef struct Mpr {
     struct MprModuleService *moduleService; /**< Module service object */
     void                    *ejsService;    /**< Ejscript service */
     void                    *appwebHttpService; /**< Appweb HTTP service object */
+#if BLD_FEATURE_REGEXP
+    struct MprRegexCache    *regexCache;    /**< Compiled regular expression cache */
+#endif
     MprIdleCallback         idleCallback;   /**< Invoked to determine if the process is idle */
 
 #if BLD_FEATURE_MULTITHREAD
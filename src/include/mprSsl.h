@@ -15,6 +15,7 @@
     #undef OCSP_RESPONSE
     #include    <openssl/ssl.h>
     #include    <openssl/evp.h>
+    #include    <openssl/hmac.h>
     #include    <openssl/rand.h>
     #include    <openssl/err.h>
 #endif
@@ -44,6 +45,22 @@ extern "C" {
 #define MPR_DEFAULT_SERVER_KEY_FILE     "server.key.pem"
 #define MPR_DEFAULT_CLIENT_CERT_FILE    "client.crt"
 #define MPR_DEFAULT_CLIENT_CERT_PATH    "certs"
+#define MPR_DEFAULT_SESSION_CACHE_SIZE  1024            /* Sessions held by the server session cache */
+#define MPR_DEFAULT_SESSION_TIMEOUT     300             /* Session lifespan in seconds */
+#define MPR_DEFAULT_TICKET_ROTATION     3600            /* Session ticket key rotation period in seconds */
+#define MPR_SSL_TICKET_NAME_SIZE        16
+#define MPR_SSL_TICKET_KEY_SIZE         32
+
+/*
+ *  Session ticket (RFC 5077) encryption keys. The current key encrypts new tickets. The previous key is retained 
+ *  after rotation so tickets issued before the rotation can still be decrypted (and are then renewed).
+ */
+typedef struct MprSslTicketKey {
+    uchar           name[MPR_SSL_TICKET_NAME_SIZE];
+    uchar           hmacKey[MPR_SSL_TICKET_KEY_SIZE];
+    uchar           aesKey[MPR_SSL_TICKET_KEY_SIZE];
+    bool            valid;
+} MprSslTicketKey;
 
 typedef struct MprSsl {
     /*
@@ -65,6 +82,27 @@ typedef struct MprSsl {
     bool            initialized;
     bool            connTraced;
 
+    /*
+     *  Session resumption. Set sessionCacheSize to zero to disable the server session cache.
+     */
+    int             sessionCacheSize;       /* Maximum number of cached server sessions */
+    int             sessionTimeout;         /* Session lifespan in seconds */
+    bool            sessionTickets;         /* Issue and accept RFC 5077 session tickets */
+    int             ticketRotation;         /* Ticket key rotation period in seconds. Zero for no rotation. */
+    char            *ticketKeyFile;         /* Shared ticket key file (for multiple processes or servers) */
+    MprSslTicketKey ticketKeys[2];          /* Current and previous ticket keys */
+    MprTime         ticketRotated;          /* When the ticket keys were last rotated */
+    MprHashTable    *clientSessions;        /* Client sessions for reuse, indexed by "host:port" */
+    MprMutex        *mutex;                 /* Multithread sync for keys, client sessions and statistics */
+
+    bool            kernelTls;              /* Offload record encryption to the kernel (Linux kTLS) if supported */
+
+    /*
+     *  Handshake statistics
+     */
+    int64           fullHandshakes;         /* Handshakes that negotiated a new session */
+    int64           resumedHandshakes;      /* Handshakes that resumed a cached session or ticket */
+
     /*
      *  Per-SSL provider context information
      */
@@ -109,6 +147,11 @@ extern void mprSetSslCaFile(MprSsl *ssl, cchar *caFile);
 extern void mprSetSslCaPath(MprSsl *ssl, cchar *caPath);
 extern void mprSetSslProtocols(MprSsl *ssl, int protocols);
 extern void mprVerifySslClients(MprSsl *ssl, bool on);
+extern void mprSetSslSessionCache(MprSsl *ssl, int size, int timeout);
+extern void mprSetSslSessionTickets(MprSsl *ssl, bool on, int rotation);
+extern void mprSetSslTicketKeyFile(MprSsl *ssl, cchar *path);
+extern void mprSetSslKernelTls(MprSsl *ssl, bool on);
+extern void mprGetSslStats(MprSsl *ssl, int64 *fullHandshakes, int64 *resumedHandshakes);
 
 #if BLD_FEATURE_OPENSSL
 extern int mprCreateOpenSslModule(MprCtx ctx, bool lazy);
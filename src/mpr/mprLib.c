@@ -230,6 +230,48 @@
 #endif
 #endif
 
+#if EMBEDTHIS || 1
+#if BLD_FEATURE_MULTITHREAD
+/*
+    The Bigint free lists and the cached powers of 5 are shared by all threads. Lock 0 guards the free lists and
+    lock 1 the powers of 5. The locks are initialized by mprCreate via mprInitDtoa before other threads start.
+ */
+#define MULTIPLE_THREADS 1
+#define ACQUIRE_DTOA_LOCK(n) lockDtoa(n)
+#define FREE_DTOA_LOCK(n) unlockDtoa(n)
+
+static MprSpin dtoaLocks[2];
+static int dtoaLocksReady;
+
+static void lockDtoa(int n)
+{
+    if (dtoaLocksReady) {
+        mprSpinLock(&dtoaLocks[n]);
+    }
+}
+
+static void unlockDtoa(int n)
+{
+    if (dtoaLocksReady) {
+        mprSpinUnlock(&dtoaLocks[n]);
+    }
+}
+
+void mprInitDtoa(MprCtx ctx)
+{
+    if (!dtoaLocksReady) {
+        mprInitSpinLock(ctx, &dtoaLocks[0]);
+        mprInitSpinLock(ctx, &dtoaLocks[1]);
+        dtoaLocksReady = 1;
+    }
+}
+#else
+void mprInitDtoa(MprCtx ctx)
+{
+}
+#endif
+#endif
+
 #ifndef Long
 #define Long long
 #endif
@@ -4397,6 +4439,9 @@ Mpr *mprCreateEx(int argc, char **argv, MprAllocNotifier cback, void *shell)
     }
     mpr->mutex = mprCreateLock(mpr);
     mpr->spin = mprCreateSpinLock(mpr);
+#if BLD_FEATURE_FLOATING_POINT
+    mprInitDtoa(mpr);
+#endif
 #endif
 
     if ((fs = mprCreateFileSystem(mpr, "/")) == 0) {
@@ -11141,6 +11186,7 @@ static int getPathInfo(MprDiskFileSystem *fileSystem, cchar *path, MprPath *info
     info->ctime = s.st_ctime;
     info->mtime = s.st_mtime;
     info->inode = s.st_ino;
+    info->dev = s.st_dev;
     info->isDir = (s.st_mode & S_IFDIR) != 0;
     info->isReg = (s.st_mode & S_IFREG) != 0;
     info->isLink = 0;
@@ -11168,6 +11214,7 @@ static int getPathInfo(MprDiskFileSystem *fileSystem, cchar *path, MprPath *info
     info->ctime = s.st_ctime;
     info->mtime = s.st_mtime;
     info->inode = s.st_ino;
+    info->dev = s.st_dev;
     info->isDir = (s.st_mode & S_IFDIR) != 0;
     info->isReg = (s.st_mode & S_IFREG) != 0;
     info->isLink = 0;
@@ -11222,7 +11269,8 @@ static int getPathInfo(MprDiskFileSystem *fileSystem, cchar *path, MprPath *info
     info->atime = s.st_atime;
     info->ctime = s.st_ctime;
     info->mtime = s.st_mtime;
-    info->inode = (int) s.st_ino;
+    info->inode = s.st_ino;
+    info->dev = s.st_dev;
     info->isDir = S_ISDIR(s.st_mode);
     info->isReg = S_ISREG(s.st_mode);
     info->perms = s.st_mode & 07777;
@@ -11247,7 +11295,8 @@ static int getPathInfo(MprDiskFileSystem *fileSystem, cchar *path, MprPath *info
     info->atime = s.st_atime;
     info->ctime = s.st_ctime;
     info->mtime = s.st_mtime;
-    info->inode = (int) s.st_ino;
+    info->inode = s.st_ino;
+    info->dev = s.st_dev;
     info->isDir = S_ISDIR(s.st_mode);
     info->isReg = S_ISREG(s.st_mode);
     info->perms = s.st_mode & 07777;
@@ -12365,6 +12414,37 @@ void mprDisableFileBuffering(MprFile *file)
     file->buf = 0;
 }
 
+
+void *mprMapFile(MprFile *file, uint size)
+{
+#if BLD_CC_MMU && BLD_UNIX_LIKE && !BLD_FEATURE_ROMFS
+    void    *ptr;
+
+    mprAssert(file);
+
+    if (file == 0 || file->fd < 0 || size == 0) {
+        return 0;
+    }
+    ptr = mmap(0, size, PROT_READ, MAP_SHARED, file->fd, 0);
+    if (ptr == (void*) -1) {
+        return 0;
+    }
+    return ptr;
+#else
+    return 0;
+#endif
+}
+
+
+void mprUnmapFile(void *ptr, uint size)
+{
+#if BLD_CC_MMU && BLD_UNIX_LIKE && !BLD_FEATURE_ROMFS
+    if (ptr && munmap(ptr, size) != 0) {
+        mprAssert(0);
+    }
+#endif
+}
+
 /*
  *  @copy   default
  *  
@@ -12994,6 +13074,7 @@ static int hashIndex(MprHashTable *table, cchar *key, int size)
 #if BLD_FEATURE_HTTP_CLIENT
 static void cleanup(MprHttp *http);
 static void completeRequest(MprHttp *http);
+static void resetPipeline(MprHttp *http);
 static MprHttpRequest *createRequest(MprHttp *http);
 static void badRequest(MprHttp *http, cchar *fmt, ...);
 static bool parseChunk(MprHttp *http, MprBuf *buf);
@@ -13086,6 +13167,9 @@ MprHttpService *mprCreateHttpService(MprCtx ctx)
         return 0;
     }
     hs->connections = mprCreateList(hs);
+    hs->pool = mprCreateList(hs);
+    hs->poolMax = MPR_HTTP_POOL_MAX;
+    hs->poolTimeout = MPR_HTTP_POOL_TIMEOUT;
 
     hs->codes = mprCreateHash(hs, 41);
     for (ep = MprHttpCodes; ep->code; ep++) {
@@ -13093,6 +13177,7 @@ MprHttpService *mprCreateHttpService(MprCtx ctx)
     }
 #if BLD_FEATURE_MULTITHREAD
     hs->mutex = mprCreateLock(hs);
+    hs->poolMutex = mprCreateLock(hs);
 #endif
     return hs;
 }
@@ -13128,6 +13213,153 @@ int mprStopHttpService(MprHttpService *hs)
 
 
 #if BLD_FEATURE_HTTP_CLIENT
+/*
+ *  Idle keep-alive connection in the process-wide connection pool
+ */
+typedef struct HttpIdle {
+    MprSocket   *sock;                      /* Idle socket owned by this entry */
+    char        *host;                      /* Connected host */
+    int         port;                       /* Connected port */
+    int         secure;                     /* Socket uses SSL */
+    MprTime     timestamp;                  /* When the connection became idle */
+} HttpIdle;
+
+
+static void closeIdle(HttpIdle *ip)
+{
+    mprCloseSocket(ip->sock, 1);
+    mprFree(ip);
+}
+
+
+/*
+ *  Close pooled connections that have been idle longer than the pool timeout. Must hold the poolMutex.
+ */
+static void pruneIdle(MprHttpService *hs, MprTime now)
+{
+    HttpIdle    *ip;
+
+    while ((ip = mprGetFirstItem(hs->pool)) != 0 && (now - ip->timestamp) > hs->poolTimeout) {
+        mprRemoveItemAtPos(hs->pool, 0);
+        hs->stats.idle--;
+        hs->stats.expired++;
+        closeIdle(ip);
+    }
+}
+
+
+/*
+ *  Take a pooled connection to the given host. The most recently used connection is preferred. A connection that is
+ *  readable while idle has been closed by the server (or has stray data) and is discarded.
+ */
+static MprSocket *getPooledConnection(MprHttp *http, cchar *host, int port, int secure)
+{
+    MprHttpService  *hs;
+    MprSocket       *sock;
+    HttpIdle        *ip;
+    int             i;
+
+    hs = http->service;
+    sock = 0;
+    mprLock(hs->poolMutex);
+    pruneIdle(hs, mprGetTime(http));
+    for (i = mprGetListCount(hs->pool) - 1; i >= 0; i--) {
+        ip = mprGetItem(hs->pool, i);
+        if (ip->port != port || ip->secure != secure || strcmp(ip->host, host) != 0) {
+            continue;
+        }
+        mprRemoveItemAtPos(hs->pool, i);
+        hs->stats.idle--;
+        if (mprWaitForSingleIO(http, ip->sock->fd, MPR_READABLE, 0)) {
+            hs->stats.discarded++;
+            closeIdle(ip);
+            continue;
+        }
+        sock = ip->sock;
+        mprStealBlock(http, sock);
+        mprFree(ip);
+        hs->stats.reused++;
+        break;
+    }
+    mprUnlock(hs->poolMutex);
+    return sock;
+}
+
+
+/*
+ *  Return the connection of a completed request to the pool. If pooling is disabled, the connection stays with the 
+ *  http object for its next request.
+ */
+static void poolConnection(MprHttp *http)
+{
+    MprHttpService  *hs;
+    HttpIdle        *ip;
+    int             next, count;
+
+    hs = http->service;
+    if (hs->poolMax <= 0) {
+        return;
+    }
+    mprLock(hs->poolMutex);
+    for (count = 0, next = 0; (ip = mprGetNextItem(hs->pool, &next)) != 0; ) {
+        if (ip->port == http->currentPort && ip->secure == http->secure && strcmp(ip->host, http->currentHost) == 0) {
+            count++;
+        }
+    }
+    if (count >= hs->poolMax || (ip = mprAllocObjZeroed(hs, HttpIdle)) == 0) {
+        hs->stats.discarded++;
+        mprCloseSocket(http->sock, 1);
+        mprFree(http->sock);
+    } else {
+        ip->host = mprStrdup(ip, http->currentHost);
+        ip->port = http->currentPort;
+        ip->secure = http->secure;
+        ip->timestamp = mprGetTime(ip);
+        ip->sock = http->sock;
+        mprStealBlock(ip, ip->sock);
+        mprAddItem(hs->pool, ip);
+        hs->stats.idle++;
+    }
+    http->sock = 0;
+    mprUnlock(hs->poolMutex);
+}
+
+
+void mprGetHttpPoolStats(MprCtx ctx, MprHttpPoolStats *stats)
+{
+    MprHttpService  *hs;
+
+    hs = mprGetMpr(ctx)->httpService;
+    mprLock(hs->poolMutex);
+    *stats = hs->stats;
+    mprUnlock(hs->poolMutex);
+}
+
+
+void mprSetHttpPoolLimits(MprCtx ctx, int maxPerHost, int timeout)
+{
+    MprHttpService  *hs;
+    HttpIdle        *ip;
+
+    hs = mprGetMpr(ctx)->httpService;
+    mprLock(hs->poolMutex);
+    if (maxPerHost >= 0) {
+        hs->poolMax = maxPerHost;
+        if (maxPerHost == 0) {
+            while ((ip = mprGetFirstItem(hs->pool)) != 0) {
+                mprRemoveItemAtPos(hs->pool, 0);
+                hs->stats.idle--;
+                closeIdle(ip);
+            }
+        }
+    }
+    if (timeout >= 0) {
+        hs->poolTimeout = timeout;
+    }
+    mprUnlock(hs->poolMutex);
+}
+
+
 static void startHttpTimer(MprHttpService *hs)
 {
     mprLock(hs->mutex);
@@ -13173,6 +13405,10 @@ static void httpTimer(MprHttpService *hs, MprEvent *event)
             mprDisconnectHttp(http);
         }
     }
+    mprLock(hs->poolMutex);
+    pruneIdle(hs, now);
+    count += mprGetListCount(hs->pool);
+    mprUnlock(hs->poolMutex);
     if (count == 0) {
         mprFree(event);
         hs->timer = 0;
@@ -13224,6 +13460,8 @@ MprHttp *mprCreateHttp(MprCtx ctx)
     http->bufsize = MPR_HTTP_BUFSIZE;
     http->bufmax = -1;
     http->request = createRequest(http);
+    http->pipeline = mprCreateList(http);
+    http->pending = mprCreateBuf(http, MPR_HTTP_BUFSIZE, -1);
 #if BLD_FEATURE_MULTITHREAD
     http->mutex = mprCreateLock(http);
 #endif
@@ -13286,6 +13524,9 @@ static int openConnection(MprHttp *http, cchar *host, int port, bool secure)
         http->sock = 0;
         return MPR_ERR_CANT_OPEN;
     }
+    mprLock(http->service->poolMutex);
+    http->service->stats.opened++;
+    mprUnlock(http->service->poolMutex);
     mprFree(http->currentHost);
     http->currentHost = mprStrdup(http, host);
     http->currentPort = port;
@@ -13348,6 +13589,23 @@ static void conditionalReset(MprHttp *http)
 }
 
 
+/*
+ *  Discard outstanding pipelined requests. Their responses can't be read so the connection must be closed.
+ */
+static void resetPipeline(MprHttp *http)
+{
+    if (mprGetListCount(http->pipeline) > 0 || mprGetBufLength(http->pending) > 0) {
+        mprFree(http->pipeline);
+        http->pipeline = mprCreateList(http);
+        mprFlushBuf(http->pending);
+        if (http->sock) {
+            mprFree(http->sock);
+            http->sock = 0;
+        }
+    }
+}
+
+
 /*
  *  Cleanup called at the completion of a request to prepare for follow-on requests on the same http object.
  */
@@ -13457,6 +13715,7 @@ int mprStartHttpRequest(MprHttp *http, cchar *method, cchar *requestUrl)
     req = http->request;
     resp = http->response;
     conditionalReset(http);
+    resetPipeline(http);
 
     /*
      *  Prepare for a new request
@@ -13501,7 +13760,14 @@ int mprStartHttpRequest(MprHttp *http, cchar *method, cchar *requestUrl)
     }
     if (http->sock == 0) {
         http->secure = url->secure;
-        if (openConnection(http, host, port, url->secure) < 0) {
+        if (http->useKeepAlive && (http->sock = getPooledConnection(http, host, port, url->secure)) != 0) {
+            mprLog(http, 4, "Http: reusing pooled socket on: %s:%d", host, port);
+            mprFree(http->currentHost);
+            http->currentHost = mprStrdup(http, host);
+            http->currentPort = port;
+            http->keepAlive = 1;
+
+        } else if (openConnection(http, host, port, url->secure) < 0) {
             badRequest(http, "Can't open socket on %s:%d", host, port);
             return MPR_ERR_CANT_OPEN;
         }
@@ -13681,6 +13947,139 @@ int mprHttpRequest(MprHttp *http, cchar *method, cchar *requestUrl)
 }
 
 
+/*
+ *  Write a GET request ahead of the response to the current request. The request is written as a blocking write.
+ */
+int mprPipelineHttpRequest(MprHttp *http, cchar *requestUrl)
+{
+    MprHttpRequest  *req;
+    MprHashTable    *headers;
+    MprHash         *header;
+    MprUri          *url;
+    MprBuf          *buf;
+    cchar           *host;
+    char            abuf[MPR_MAX_STRING], encDetails[MPR_MAX_STRING];
+    int             len, written, port, secure;
+
+    mprAssert(requestUrl && *requestUrl);
+
+    lock(http);
+    req = http->request;
+    if (http->sock == 0 || !http->keepAlive || http->state < MPR_HTTP_STATE_WAIT || 
+            http->state >= MPR_HTTP_STATE_COMPLETE || http->proxyHost || req->chunked == 1 || 
+            strcmp(req->method, "GET") != 0) {
+        unlock(http);
+        return MPR_ERR_BAD_STATE;
+    }
+    buf = mprCreateBuf(http, MPR_HTTP_BUFSIZE, -1);
+    url = mprParseUri(buf, requestUrl);
+
+    /*
+     *  The request can only share the connection if it is for the same host, port and scheme
+     */
+    if (*requestUrl == '/') {
+        host = http->defaultHost;
+        port = http->defaultPort;
+        secure = http->secure;
+    } else {
+        host = url->host;
+        port = url->port;
+        secure = url->secure;
+    }
+    if (host == 0 || http->currentHost == 0 || port != http->currentPort || secure != http->secure || 
+            strcmp(host, http->currentHost) != 0) {
+        mprFree(buf);
+        unlock(http);
+        return MPR_ERR_BAD_STATE;
+    }
+    if (url->query && *url->query) {
+        mprPutFmtToBuf(buf, "GET %s?%s %s\r\n", url->url, url->query, http->protocol);
+    } else {
+        mprPutFmtToBuf(buf, "GET %s %s\r\n", url->url, http->protocol);
+    }
+    if (http->authType && strcmp(http->authType, "basic") == 0) {
+        mprSprintf(abuf, sizeof(abuf), "%s:%s", http->user, http->password);
+        mprEncode64(encDetails, sizeof(encDetails), abuf);
+        mprPutFmtToBuf(buf, "Authorization: basic %s\r\n", encDetails);
+    }
+    mprPutFmtToBuf(buf, "Host: %s\r\n", http->currentHost);
+    mprPutFmtToBuf(buf, "User-Agent: %s\r\n", MPR_HTTP_NAME);
+    mprPutFmtToBuf(buf, "Connection: Keep-Alive\r\n");
+    headers = req->headers;
+    for (header = 0; (header = mprGetNextHash(headers, header)) != 0; ) {
+        mprPutFmtToBuf(buf, "%s: %s\r\n", header->key, header->data);
+    }
+    mprPutStringToBuf(buf, "\r\n");
+
+    len = mprGetBufLength(buf);
+    mprSetSocketBlockingMode(http->sock, 1);
+    while (len > 0) {
+        if ((written = mprWriteSocket(http->sock, mprGetBufStart(buf), len)) <= 0) {
+            mprSetSocketBlockingMode(http->sock, 0);
+            mprFree(buf);
+            unlock(http);
+            return MPR_ERR_CANT_WRITE;
+        }
+        mprAdjustBufStart(buf, written);
+        len -= written;
+    }
+    mprSetSocketBlockingMode(http->sock, 0);
+    mprFree(buf);
+    mprAddItem(http->pipeline, mprStrdup(http->pipeline, requestUrl));
+
+    mprLock(http->service->poolMutex);
+    http->service->stats.pipelined++;
+    mprUnlock(http->service->poolMutex);
+    unlock(http);
+    return 0;
+}
+
+
+/*
+ *  Start reading the response to the next pipelined request. Any response data already read is parsed immediately.
+ */
+int mprNextHttpResponse(MprHttp *http)
+{
+    MprHttpRequest  *req;
+    MprBuf          *buf;
+    char            *uri;
+    int             len;
+
+    lock(http);
+    if (http->state != MPR_HTTP_STATE_COMPLETE || (uri = mprGetFirstItem(http->pipeline)) == 0) {
+        unlock(http);
+        return MPR_ERR_BAD_STATE;
+    }
+    if (http->sock == 0) {
+        /* The server closed the connection. The caller must reissue the remaining requests. */
+        resetPipeline(http);
+        unlock(http);
+        return MPR_ERR_BAD_STATE;
+    }
+    mprRemoveItemAtPos(http->pipeline, 0);
+    req = http->request;
+    mprFree(req->uri);
+    req->uri = mprParseUri(req, uri);
+    mprFree(uri);
+
+    http->timestamp = mprGetTime(req);
+    mprFree(http->error);
+    http->error = 0;
+    mprFree(http->response);
+    http->response = createResponse(http);
+    http->state = MPR_HTTP_STATE_WAIT;
+
+    if ((len = mprGetBufLength(http->pending)) > 0) {
+        buf = http->response->headerBuf;
+        mprPutBlockToBuf(buf, mprGetBufStart(http->pending), len);
+        mprFlushBuf(http->pending);
+        processResponse(http, buf, len);
+    }
+    unlock(http);
+    return 0;
+}
+
+
 int mprFinalizeHttpWriting(MprHttp *http)
 {
     MprHttpRequest  *req;
@@ -13949,6 +14348,10 @@ static void processResponse(MprHttp *http, MprBuf *buf, int nbytes)
     while (1) {
         switch(http->state) {
         case MPR_HTTP_STATE_WAIT:
+            /* Ignore any CRLF left over from a prior chunked response */
+            while (mprGetBufLength(buf) >= 2 && buf->start[0] == '\r' && buf->start[1] == '\n') {
+                mprAdjustBufStart(buf, 2);
+            }
             if (!parseFirstLine(http, buf) || !parseHeaders(http, buf)) {
                 return;
             }
@@ -13960,8 +14363,15 @@ static void processResponse(MprHttp *http, MprBuf *buf, int nbytes)
             }
             buf = (resp->flags & MPR_HTTP_RESP_CHUNKED) ? resp->chunkBuf : resp->dataBuf;
             if ((len = mprGetBufLength(resp->headerBuf)) > 0) {
-                /* Transfer remaining data to the chunk or data buffer */
+                /* 
+                 *  Transfer remaining data to the chunk or data buffer. Data beyond the content length belongs to
+                 *  the next pipelined response and stays in the header buffer.
+                 */
+                if (!(resp->flags & MPR_HTTP_RESP_CHUNKED) && len > resp->contentRemaining) {
+                    len = (int) resp->contentRemaining;
+                }
                 mprPutBlockToBuf(buf, mprGetBufStart(resp->headerBuf), len);
+                mprAdjustBufStart(resp->headerBuf, len);
             }
             nbytes = mprGetBufLength(buf);
             if (resp->flags & MPR_HTTP_RESP_CHUNKED) {
@@ -15041,17 +15451,50 @@ static void badRequest(MprHttp *http, cchar *fmt, ...)
 
 
 /*
- *  Complete a request. And prepare the http object for a new request.
+ *  Save response data read beyond the end of the current response. This belongs to pipelined requests.
+ *  Returns the number of bytes saved.
+ */
+static int saveSurplus(MprHttp *http)
+{
+    MprHttpResponse *resp;
+    MprBuf          *buf;
+    int             len;
+
+    resp = http->response;
+    if (resp == 0) {
+        return 0;
+    }
+    buf = (resp->flags & MPR_HTTP_RESP_CHUNKED) ? resp->chunkBuf : resp->headerBuf;
+    while (mprGetBufLength(buf) >= 2 && buf->start[0] == '\r' && buf->start[1] == '\n') {
+        mprAdjustBufStart(buf, 2);
+    }
+    if ((len = mprGetBufLength(buf)) > 0) {
+        mprPutBlockToBuf(http->pending, mprGetBufStart(buf), len);
+        mprAdjustBufStart(buf, len);
+    }
+    return mprGetBufLength(http->pending);
+}
+
+
+/*
+ *  Complete a request. And prepare the http object for a new request. Keep-alive connections without pipelined
+ *  requests are returned to the connection pool.
  */
 static void completeRequest(MprHttp *http)
 {
     if (http->sock) {
-        if (http->keepAlive) {
+        if (http->keepAlive && mprGetListCount(http->pipeline) > 0) {
+            saveSurplus(http);
+
+        } else if (http->keepAlive && saveSurplus(http) == 0) {
             mprLog(http, 4, "Http: completeRequest: Attempting keep-alive");
+            poolConnection(http);
+
         } else {
             mprCloseSocket(http->sock, 1);
             mprFree(http->sock);
             http->sock = 0;
+            mprFlushBuf(http->pending);
         }
     }
     http->state = MPR_HTTP_STATE_COMPLETE;
@@ -16139,6 +16582,31 @@ void mprSpinUnlock(MprSpin *lock)
 void __dummyMprLock() {}
 #endif /* BLD_FEATURE_MULTITHREAD */
 
+
+void mprAtomicBarrier()
+{
+#if BLD_FEATURE_MULTITHREAD
+    #if __GNUC__
+        __sync_synchronize();
+    #elif BLD_WIN_LIKE
+        MemoryBarrier();
+    #endif
+#endif
+}
+
+
+int mprAtomicAdd(volatile int *ptr, int value)
+{
+#if BLD_FEATURE_MULTITHREAD && __GNUC__
+    return __sync_add_and_fetch(ptr, value);
+#elif BLD_FEATURE_MULTITHREAD && BLD_WIN_LIKE
+    return InterlockedExchangeAdd((volatile LONG*) ptr, value) + value;
+#else
+    *ptr += value;
+    return *ptr;
+#endif
+}
+
 /*
  *  @copy   default
  *
@@ -16750,6 +17218,7 @@ MprModule *mprCreateModule(MprCtx ctx, cchar *name, cchar *version, void *data,
     mp->moduleData = data;
     mp->handle = 0;
     mp->timeout = 0;
+    mp->flags = 0;
     mp->lastActivity = mprGetTime(ctx);
 
     if (index < 0 || mp->name == 0 || mp->version == 0) {
@@ -20772,6 +21241,7 @@ static int  listenSocket(MprSocket *sp, cchar *host, int port, MprSocketAcceptPr
 static int  readSocket(MprSocket *sp, void *buf, int bufsize);
 static int  socketDestructor(MprSocket *sp);
 static int  writeSocket(MprSocket *sp, void *buf, int bufsize);
+static int  writeCoalesced(MprSocket *sp, MprIOVec *iovec, int count, int *index, char **start, int *len);
 
 /*
  *  Open the socket service
@@ -21661,29 +22131,77 @@ int mprWriteSocketVector(MprSocket *sp, MprIOVec *iovec, int count)
         mprAssert(len > 0);
 
         for (total = i = 0; i < count; ) {
-            written = mprWriteSocket(sp, start, len);
+            if (sp->sslSocket && len < MPR_SSL_RECORD_SIZE && (i + 1) < count) {
+                /*
+                 *  Coalesce small vectors so each SSL write emits a full sized record rather than one per vector
+                 */
+                written = writeCoalesced(sp, iovec, count, &i, &start, &len);
+            } else {
+                written = mprWriteSocket(sp, start, len);
+                if (written > 0) {
+                    len -= written;
+                    start += written;
+                    if (len <= 0 && ++i < count) {
+                        start = iovec[i].start;
+                        len = (int) iovec[i].len;
+                    }
+                }
+            }
             if (written < 0) {
                 return written;
-
             } else if (written == 0) {
                 break;
-
-            } else {
-                len -= written;
-                start += written;
-                total += written;
-                if (len <= 0) {
-                    i++;
-                    start = iovec[i].start;
-                    len = (int) iovec[i].len;
-                }
             }
+            total += written;
         }
         return total;
     }
 }
 
 
+/*
+ *  Copy vector data into a single record sized buffer and write it. On return, the vector position (index, start
+ *  and len) is advanced past the bytes actually written. The buffer is on the stack, so a retried write presents
+ *  the same data at a new address. The OpenSSL provider enables SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER for this.
+ */
+static int writeCoalesced(MprSocket *sp, MprIOVec *iovec, int count, int *index, char **start, int *len)
+{
+    char    buf[MPR_SSL_RECORD_SIZE], *cp;
+    int     i, pos, n, written, skip;
+
+    for (pos = 0, i = *index, cp = *start, n = *len; i < count && pos < (int) sizeof(buf); ) {
+        n = min(n, (int) sizeof(buf) - pos);
+        memcpy(&buf[pos], cp, n);
+        pos += n;
+        if (pos < (int) sizeof(buf) && ++i < count) {
+            cp = iovec[i].start;
+            n = (int) iovec[i].len;
+        }
+    }
+    if ((written = mprWriteSocket(sp, buf, pos)) <= 0) {
+        return written;
+    }
+    /*
+     *  Advance the vector position by the bytes written
+     */
+    for (skip = written; skip > 0 && *index < count; ) {
+        if (skip < *len) {
+            *start += skip;
+            *len -= skip;
+            break;
+        }
+        skip -= *len;
+        if (++(*index) < count) {
+            *start = iovec[*index].start;
+            *len = (int) iovec[*index].len;
+        } else {
+            *len = 0;
+        }
+    }
+    return written;
+}
+
+
 #if !BLD_FEATURE_ROMFS
 #if !LINUX || __UCLIBC__
 static int localSendfile(MprSocket *sp, MprFile *file, MprOffset offset, int len)
@@ -21791,6 +22309,38 @@ MprOffset mprSendFileToSocket(MprSocket *sock, MprFile *file, MprOffset offset,
 #endif /* !BLD_FEATURE_ROMFS */
 
 
+#if BLD_HAS_SPLICE
+#ifndef SPLICE_F_MOVE
+    #define SPLICE_F_MOVE 1
+    #define SPLICE_F_MORE 4
+    extern ssize_t splice(int fdIn, void *offIn, int fdOut, void *offOut, size_t len, unsigned int flags);
+#endif
+
+/*
+ *  Splice data from a pipe to a socket. The data is moved by the kernel and never enters user space.
+ */
+int mprSpliceToSocket(MprSocket *sp, int fd, int len)
+{
+    ssize_t     rc;
+
+    if (sp->sslSocket || sp->fd < 0 || fd < 0) {
+        return MPR_ERR_BAD_STATE;
+    }
+    while ((rc = splice(fd, NULL, sp->fd, NULL, len, SPLICE_F_MOVE | SPLICE_F_MORE)) < 0 && errno == EINTR) {
+        ;
+    }
+    if (rc < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return 0;
+        }
+        mprLog(sp, 7, "splice failed, errno %d", errno);
+        return -1;
+    }
+    return (int) rc;
+}
+#endif
+
+
 static int flushSocket(MprSocket *sp)
 {
     return 0;
@@ -21820,6 +22370,19 @@ bool mprIsSocketEof(MprSocket *sp)
 }
 
 
+/*
+ *  Return the events required to progress a secure socket handshake. The SSL provider sets the flags as the 
+ *  handshake progresses.
+ */
+int mprGetSocketHandshakeMask(MprSocket *sp)
+{
+    if (!(sp->flags & MPR_SOCKET_HANDSHAKING)) {
+        return 0;
+    }
+    return (sp->flags & MPR_SOCKET_WANT_WRITE) ? MPR_WRITABLE : MPR_READABLE;
+}
+
+
 /*
  *  Set the EOF condition
  */
@@ -22428,6 +22991,12 @@ bool mprIsSocketSecure(MprSocket *sp)
 }
 
 
+bool mprCanSocketSendFile(MprSocket *sp)
+{
+    return sp->sslSocket == 0 || (sp->flags & MPR_SOCKET_KERNEL_TLS);
+}
+
+
 void mprSetSocketPrebindCallback(MprCtx ctx, MprSocketPrebind callback)
 {
     mprGetMpr(ctx)->socketService->prebind = callback;
@@ -25612,6 +26181,23 @@ MprTime mprGetTime(MprCtx ctx)
 }
 
 
+/*
+    Returns a monotonic time in microseconds for measuring intervals
+ */
+MprTime mprGetHiResTime(MprCtx ctx)
+{
+#if (BLD_UNIX_LIKE || VXWORKS) && defined(CLOCK_MONOTONIC)
+    struct timespec  tv;
+    clock_gettime(CLOCK_MONOTONIC, &tv);
+    return (MprTime) (((MprTime) tv.tv_sec) * 1000000) + (tv.tv_nsec / 1000);
+#else
+    struct timeval  tv;
+    gettimeofday(&tv, NULL);
+    return (MprTime) (((MprTime) tv.tv_sec) * 1000000) + tv.tv_usec;
+#endif
+}
+
+
 /*
     Return the number of milliseconds until the given timeout has expired.
  */
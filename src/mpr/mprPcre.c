@@ -1152,6 +1152,7 @@ extern "C" {
     #define MPR_XML_BUFSIZE         4096        /**< XML read buffer size */
     #define MPR_HTTP_BUFSIZE        4096        /**< HTTP buffer size. Must fit complete HTTP headers */
     #define MPR_SSL_BUFSIZE         4096        /**< SSL has 16K max*/
+    #define MPR_SSL_RECORD_SIZE     4096        /**< Size to coalesce vectored writes into SSL records */
     #define MPR_LIST_INCR           8           /**< Default list growth inc */
     #define MPR_FILES_HASH_SIZE     29          /** Hash size for rom file system */
     #define MPR_TIME_HASH_SIZE      67          /** Hash size for time token lookup */
@@ -1179,6 +1180,7 @@ extern "C" {
     #define MPR_XML_BUFSIZE         4096
     #define MPR_HTTP_BUFSIZE        4096
     #define MPR_SSL_BUFSIZE         4096
+    #define MPR_SSL_RECORD_SIZE     (16 * 1024)
     #define MPR_LIST_INCR           16
     #define MPR_FILES_HASH_SIZE     61
     #define MPR_TIME_HASH_SIZE      89
@@ -1205,6 +1207,7 @@ extern "C" {
     #define MPR_XML_BUFSIZE         4096
     #define MPR_HTTP_BUFSIZE        8192
     #define MPR_SSL_BUFSIZE         8192
+    #define MPR_SSL_RECORD_SIZE     (16 * 1024)
     #define MPR_LIST_INCR           16
     #define MPR_BUF_INCR            1024
     #define MPR_FILES_HASH_SIZE     61
@@ -1303,6 +1306,10 @@ extern "C" {
  *  HTTP
  */
 #define MPR_HTTP_RETRIES        (2)
+/*
+ *  Regular expressions
+ */
+#define MPR_REGEX_CACHE_MAX     256         /* Max compiled patterns kept in the process-wide regex cache */
 
 #ifdef __cplusplus
 }
@@ -5624,6 +5631,9 @@ extern int mprSetMaxSocketClients(MprCtx ctx, int max);
 #define MPR_SOCKET_CLIENT       0x800       /**< Socket is a client */
 #define MPR_SOCKET_PENDING      0x1000      /**< Pending buffered read data */
 #define MPR_SOCKET_RUNNING      0x2000      /**< Socket is running callback */
+#define MPR_SOCKET_HANDSHAKING  0x4000      /**< Secure socket handshake in progress */
+#define MPR_SOCKET_WANT_WRITE   0x8000      /**< Secure socket needs a writable event to make progress */
+#define MPR_SOCKET_KERNEL_TLS   0x10000     /**< Secure socket record encryption is performed by the kernel */
 
 /**
  *  Socket Service
@@ -5847,6 +5857,16 @@ extern bool mprHasSocketPendingData(MprSocket *sp);
  */
 extern bool mprIsSocketEof(MprSocket *sp);
 
+/**
+ *  Get the I/O events required to progress a secure socket handshake
+ *  @description Secure sockets perform their handshake incrementally as the socket is read. While the handshake
+ *      is in progress, the socket should be waited on for the returned events and then read again.
+ *  @param sp Socket object returned from #mprCreateSocket
+ *  @return Zero if no handshake is in progress. Otherwise MPR_READABLE or MPR_WRITABLE.
+ *  @ingroup MprSocket
+ */
+extern int mprGetSocketHandshakeMask(MprSocket *sp);
+
 /**
  *  Get the socket file descriptor.
  *  @description Get the file descriptor associated with a socket.
@@ -5934,6 +5954,16 @@ extern void mprSetSocketEof(MprSocket *sp, bool eof);
  */
 extern bool mprIsSocketSecure(MprSocket *sp);
 
+/**
+ *  Determine if file data can be sent directly to the socket
+ *  @description Plain sockets and secure sockets whose encryption has been offloaded to the kernel can use 
+ *      #mprSendFileToSocket without passing the file data through user space.
+ *  @param sp Socket object returned from #mprCreateSocket
+ *  @return True if the socket can use sendfile.
+ *  @ingroup MprSocket
+ */
+extern bool mprCanSocketSendFile(MprSocket *sp);
+
 /**
  *  Write a vector to a socket
  *  @description Do scatter/gather I/O by writing a vector of buffers to a socket.
@@ -5988,6 +6018,14 @@ extern MprModule *mprLoadSsl(MprCtx ctx, bool lazy);
  *  @param ssl MprSsl configuration
  */
 extern void mprConfigureSsl(struct MprSsl *ssl);
+
+/**
+ *  Get SSL handshake statistics
+ *  @param ssl MprSsl configuration
+ *  @param fullHandshakes Set to the count of handshakes that negotiated a new session
+ *  @param resumedHandshakes Set to the count of handshakes that resumed a cached session or session ticket
+ */
+extern void mprGetSslStats(struct MprSsl *ssl, int64 *fullHandshakes, int64 *resumedHandshakes);
 #endif
 
 extern int mprGetSocketInfo(MprCtx ctx, cchar *host, int port, int *family, int *protocol, struct sockaddr **addr, 
@@ -7297,6 +7335,77 @@ extern int mprWriteCmdPipe(MprCmd *cmd, int channel, char *buf, int bufsize);
 extern int mprIsCmdComplete(MprCmd *cmd);
 
 #endif /* BLD_FEATURE_CMD */
+/* ******************************** MprRegex **********************************/
+#if BLD_FEATURE_REGEXP
+/**
+ *  Regular expression cache statistics
+ *  @ingroup MprRegex
+ */
+typedef struct MprRegexStats {
+    int             hits;                   /**< Compiles satisfied from the cache */
+    int             misses;                 /**< Patterns compiled by PCRE */
+    int             entries;                /**< Patterns currently held by the cache */
+    int             evicted;                /**< Idle patterns removed to make room for new patterns */
+} MprRegexStats;
+
+/**
+ *  Compiled regular expression
+ *  @description Compiled patterns are shared via a process-wide cache keyed by the pattern and PCRE options. 
+ *      A compiled pattern is read-only and may be used by pcre_exec in multiple threads at once.
+ *  @stability Evolving
+ *  @see mprCompileRegex, mprReleaseRegex, mprGetRegexStats, mprSetRegexCacheLimit
+ *  @defgroup MprRegex MprRegex
+ */
+typedef struct MprRegex {
+    struct real_pcre *compiled;             /**< Compiled pattern to pass to pcre_exec */
+    char            *key;                   /* Cache key */
+    int             refs;                   /* Count of users holding the pattern */
+    int             cached;                 /* Held by the cache. Otherwise freed when the last user releases it */
+    int             lastUsed;               /* Cache tick when last requested */
+} MprRegex;
+
+/**
+ *  Compile a regular expression
+ *  @description Return a compiled pattern from the process-wide regex cache, compiling and caching the pattern if
+ *      required. The caller holds a reference and must call #mprReleaseRegex when the pattern is no longer needed.
+ *      This routine is thread-safe.
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @param pattern Regular expression pattern
+ *  @param options PCRE compile options
+ *  @param errMsg Set to a static error message if the pattern can't be compiled. May be null.
+ *  @param column Set to the pattern offset of the error if the pattern can't be compiled. May be null.
+ *  @return A compiled regular expression or null if the pattern can't be compiled.
+ *  @ingroup MprRegex
+ */
+extern MprRegex *mprCompileRegex(MprCtx ctx, cchar *pattern, int options, cchar **errMsg, int *column);
+
+/**
+ *  Release a compiled regular expression
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @param rp Regular expression returned from #mprCompileRegex
+ *  @ingroup MprRegex
+ */
+extern void mprReleaseRegex(MprCtx ctx, MprRegex *rp);
+
+/**
+ *  Get the regular expression cache statistics
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @param stats Statistics structure to fill
+ *  @ingroup MprRegex
+ */
+extern void mprGetRegexStats(MprCtx ctx, MprRegexStats *stats);
+
+/**
+ *  Set the regular expression cache size
+ *  @description Idle patterns beyond the limit are freed. Patterns compiled while the cache is full of patterns 
+ *      in use are not cached. 
+ *  @param ctx Any memory context allocated by mprAlloc or mprCreate.
+ *  @param max Maximum number of cached patterns. Set to zero to disable caching. Defaults to MPR_REGEX_CACHE_MAX.
+ *  @ingroup MprRegex
+ */
+extern void mprSetRegexCacheLimit(MprCtx ctx, int max);
+
+#endif /* BLD_FEATURE_REGEXP */
 /* *********************************** Mpr ************************************/
 /*
  *  Mpr flags
@@ -7365,6 +7474,9 @@ typedef struct Mpr {
     struct MprModuleService *moduleService; /**< Module service object */
     void                    *ejsService;    /**< Ejscript service */
     void                    *appwebHttpService; /**< Appweb HTTP service object */
+#if BLD_FEATURE_REGEXP
+    struct MprRegexCache    *regexCache;    /**< Compiled regular expression cache */
+#endif
     MprIdleCallback         idleCallback;   /**< Invoked to determine if the process is idle */
 
 #if BLD_FEATURE_MULTITHREAD
@@ -26098,3 +26210,286 @@ return negated;   /* char did not match */
  */
 /************************************************************************/
 
+
+
+
+/************************************************************************/
+/*
+ *  Start of file "../src/regexp/mprRegex.c"
+ */
+/************************************************************************/
+
+/**
+ *  mprRegex.c - Process-wide cache of compiled regular expressions
+ *
+ *  Compiling a pattern is far more expensive than matching it. Compiled patterns are cached by pattern and options 
+ *  and shared by all users in the process, including separate Ejscript interpreters. PCRE compiled patterns are 
+ *  read-only, so pcre_exec may use a shared pattern in multiple threads at once. This module is thread-safe.
+ *
+ *  Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+
+
+#if BLD_FEATURE_REGEXP
+
+typedef struct MprRegexCache {
+    MprHashTable    *patterns;              /* Cached patterns indexed by options and pattern */
+    MprRegexStats   stats;                  /* Cache statistics */
+    int             max;                    /* Max cached patterns */
+    int             tick;                   /* Use counter for least recently used eviction */
+    MprMutex        *mutex;                 /* Multithread sync */
+} MprRegexCache;
+
+
+static int regexDestructor(MprRegex *rp)
+{
+    if (rp->compiled) {
+        (pcre_free)(rp->compiled);
+    }
+    return 0;
+}
+
+
+/*
+ *  Patterns still held by users (such as interpreters) at exit are freed with the cache heap
+ */
+static int regexCacheDestructor(MprHeap *heap)
+{
+    mprGetMpr(heap)->regexCache = 0;
+    return 0;
+}
+
+
+/*
+ *  Create the cache on first use. The cache has its own thread-safe heap as it is shared by all threads.
+ */
+static MprRegexCache *getRegexCache(MprCtx ctx)
+{
+    Mpr             *mpr;
+    MprRegexCache   *cache;
+    MprHeap         *heap;
+
+    mpr = mprGetMpr(ctx);
+    if (mpr->regexCache) {
+        return mpr->regexCache;
+    }
+    mprGlobalLock(mpr);
+    if (mpr->regexCache == 0 && (heap = mprAllocHeap(mpr, "regex", 1, 1, (MprDestructor) regexCacheDestructor)) != 0) {
+        if ((cache = mprAllocObjZeroed(heap, MprRegexCache)) == 0) {
+            mprFree(heap);
+        } else {
+            cache->patterns = mprCreateHash(cache, 61);
+            cache->mutex = mprCreateLock(cache);
+            cache->max = MPR_REGEX_CACHE_MAX;
+            mpr->regexCache = cache;
+        }
+    }
+    mprGlobalUnlock(mpr);
+    return mpr->regexCache;
+}
+
+
+/*
+ *  Remove the least recently used idle pattern. Return false if all cached patterns are in use. Must hold the mutex.
+ */
+static bool evictRegex(MprRegexCache *cache)
+{
+    MprHash     *hp;
+    MprRegex    *rp, *oldest;
+
+    oldest = 0;
+    for (hp = mprGetFirstHash(cache->patterns); hp; hp = mprGetNextHash(cache->patterns, hp)) {
+        rp = (MprRegex*) hp->data;
+        if (rp->refs == 0 && (oldest == 0 || rp->lastUsed < oldest->lastUsed)) {
+            oldest = rp;
+        }
+    }
+    if (oldest == 0) {
+        return 0;
+    }
+    mprRemoveHash(cache->patterns, oldest->key);
+    cache->stats.entries--;
+    cache->stats.evicted++;
+    mprFree(oldest);
+    return 1;
+}
+
+
+/*
+ *  Add a newly compiled pattern to the cache. If another thread cached the same pattern meanwhile, use that one. 
+ *  If the cache is full of patterns in use, the pattern is not cached and is freed when released.
+ */
+static MprRegex *cacheRegex(MprRegexCache *cache, MprRegex *rp)
+{
+    MprRegex    *prior;
+
+    mprLock(cache->mutex);
+    if ((prior = (MprRegex*) mprLookupHash(cache->patterns, rp->key)) != 0) {
+        prior->refs++;
+        prior->lastUsed = ++cache->tick;
+        cache->stats.hits++;
+        mprUnlock(cache->mutex);
+        mprFree(rp);
+        return prior;
+    }
+    cache->stats.misses++;
+    while (cache->stats.entries >= cache->max) {
+        if (!evictRegex(cache)) {
+            break;
+        }
+    }
+    if (cache->stats.entries < cache->max && mprAddHash(cache->patterns, rp->key, rp) != 0) {
+        rp->cached = 1;
+        rp->lastUsed = ++cache->tick;
+        cache->stats.entries++;
+    }
+    mprUnlock(cache->mutex);
+    return rp;
+}
+
+
+MprRegex *mprCompileRegex(MprCtx ctx, cchar *pattern, int options, cchar **errMsg, int *column)
+{
+    MprRegexCache   *cache;
+    MprRegex        *rp;
+    cchar           *msg;
+    char            *key;
+    int             errCode, col;
+
+    mprAssert(pattern);
+
+    rp = 0;
+    msg = "Memory allocation error";
+    col = 0;
+    if ((cache = getRegexCache(ctx)) != 0 && (key = mprAsprintf(ctx, -1, "%x/%s", options, pattern)) != 0) {
+        mprLock(cache->mutex);
+        if ((rp = (MprRegex*) mprLookupHash(cache->patterns, key)) != 0) {
+            rp->refs++;
+            rp->lastUsed = ++cache->tick;
+            cache->stats.hits++;
+            mprUnlock(cache->mutex);
+
+        } else {
+            /*
+             *  Compile outside the lock so other threads are not held up
+             */
+            mprUnlock(cache->mutex);
+            if ((rp = mprAllocObjWithDestructorZeroed(cache, MprRegex, regexDestructor)) != 0) {
+                if ((rp->compiled = pcre_compile2(pattern, options, &errCode, &msg, &col, NULL)) == 0) {
+                    mprFree(rp);
+                    rp = 0;
+                } else {
+                    rp->key = mprStrdup(rp, key);
+                    rp->refs = 1;
+                    rp = cacheRegex(cache, rp);
+                }
+            }
+        }
+        mprFree(key);
+    }
+    if (rp) {
+        msg = 0;
+    }
+    if (errMsg) {
+        *errMsg = msg;
+    }
+    if (column) {
+        *column = col;
+    }
+    return rp;
+}
+
+
+void mprReleaseRegex(MprCtx ctx, MprRegex *rp)
+{
+    MprRegexCache   *cache;
+
+    if (rp == 0 || (cache = mprGetMpr(ctx)->regexCache) == 0) {
+        return;
+    }
+    mprAssert(rp->refs > 0);
+
+    mprLock(cache->mutex);
+    if (--rp->refs == 0 && !rp->cached) {
+        mprFree(rp);
+    }
+    mprUnlock(cache->mutex);
+}
+
+
+void mprGetRegexStats(MprCtx ctx, MprRegexStats *stats)
+{
+    MprRegexCache   *cache;
+
+    if ((cache = getRegexCache(ctx)) == 0) {
+        memset(stats, 0, sizeof(MprRegexStats));
+        return;
+    }
+    mprLock(cache->mutex);
+    *stats = cache->stats;
+    mprUnlock(cache->mutex);
+}
+
+
+void mprSetRegexCacheLimit(MprCtx ctx, int max)
+{
+    MprRegexCache   *cache;
+
+    if ((cache = getRegexCache(ctx)) == 0) {
+        return;
+    }
+    mprLock(cache->mutex);
+    cache->max = max;
+    while (cache->stats.entries > max) {
+        if (!evictRegex(cache)) {
+            break;
+        }
+    }
+    mprUnlock(cache->mutex);
+}
+
+#else
+void __dummyRegex() {}
+#endif /* BLD_FEATURE_REGEXP */
+
+/*
+ *  @copy   default
+ *
+ *  Copyright (c) Embedthis Software LLC, 2003-2011. All Rights Reserved.
+ *  Copyright (c) Michael O'Brien, 1993-2011. All Rights Reserved.
+ *
+ *  This software is distributed under commercial and open source licenses.
+ *  You may use the GPL open source license described below or you may acquire
+ *  a commercial license from Embedthis Software. You agree to be fully bound
+ *  by the terms of either license. Consult the LICENSE.TXT distributed with
+ *  this software for full details.
+ *
+ *  This software is open source; you can redistribute it and/or modify it
+ *  under the terms of the GNU General Public License as published by the
+ *  Free Software Foundation; either version 2 of the License, or (at your
+ *  option) any later version. See the GNU General Public License for more
+ *  details at: http://www.embedthis.com/downloads/gplLicense.html
+ *
+ *  This program is distributed WITHOUT ANY WARRANTY; without even the
+ *  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ *  This GPL license does NOT permit incorporating this software into
+ *  proprietary programs. If you are unable to comply with the GPL, you must
+ *  acquire a commercial license to use this software. Commercial licenses
+ *  for this software and support services are available from Embedthis
+ *  Software at http://www.embedthis.com
+ *
+ *  Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
+/************************************************************************/
+/*
+ *  End of file "../src/regexp/mprRegex.c"
+ */
+/************************************************************************/
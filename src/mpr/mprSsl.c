@@ -1151,6 +1151,7 @@ extern "C" {
     #define MPR_XML_BUFSIZE         4096        /**< XML read buffer size */
     #define MPR_HTTP_BUFSIZE        4096        /**< HTTP buffer size. Must fit complete HTTP headers */
     #define MPR_SSL_BUFSIZE         4096        /**< SSL has 16K max*/
+    #define MPR_SSL_RECORD_SIZE     4096        /**< Size to coalesce vectored writes into SSL records */
     #define MPR_LIST_INCR           8           /**< Default list growth inc */
     #define MPR_FILES_HASH_SIZE     29          /** Hash size for rom file system */
     #define MPR_TIME_HASH_SIZE      67          /** Hash size for time token lookup */
@@ -1178,6 +1179,7 @@ extern "C" {
     #define MPR_XML_BUFSIZE         4096
     #define MPR_HTTP_BUFSIZE        4096
     #define MPR_SSL_BUFSIZE         4096
+    #define MPR_SSL_RECORD_SIZE     (16 * 1024)
     #define MPR_LIST_INCR           16
     #define MPR_FILES_HASH_SIZE     61
     #define MPR_TIME_HASH_SIZE      89
@@ -1204,6 +1206,7 @@ extern "C" {
     #define MPR_XML_BUFSIZE         4096
     #define MPR_HTTP_BUFSIZE        8192
     #define MPR_SSL_BUFSIZE         8192
+    #define MPR_SSL_RECORD_SIZE     (16 * 1024)
     #define MPR_LIST_INCR           16
     #define MPR_BUF_INCR            1024
     #define MPR_FILES_HASH_SIZE     61
@@ -5623,6 +5626,9 @@ extern int mprSetMaxSocketClients(MprCtx ctx, int max);
 #define MPR_SOCKET_CLIENT       0x800       /**< Socket is a client */
 #define MPR_SOCKET_PENDING      0x1000      /**< Pending buffered read data */
 #define MPR_SOCKET_RUNNING      0x2000      /**< Socket is running callback */
+#define MPR_SOCKET_HANDSHAKING  0x4000      /**< Secure socket handshake in progress */
+#define MPR_SOCKET_WANT_WRITE   0x8000      /**< Secure socket needs a writable event to make progress */
+#define MPR_SOCKET_KERNEL_TLS   0x10000     /**< Secure socket record encryption is performed by the kernel */
 
 /**
  *  Socket Service
@@ -5846,6 +5852,16 @@ extern bool mprHasSocketPendingData(MprSocket *sp);
  */
 extern bool mprIsSocketEof(MprSocket *sp);
 
+/**
+ *  Get the I/O events required to progress a secure socket handshake
+ *  @description Secure sockets perform their handshake incrementally as the socket is read. While the handshake
+ *      is in progress, the socket should be waited on for the returned events and then read again.
+ *  @param sp Socket object returned from #mprCreateSocket
+ *  @return Zero if no handshake is in progress. Otherwise MPR_READABLE or MPR_WRITABLE.
+ *  @ingroup MprSocket
+ */
+extern int mprGetSocketHandshakeMask(MprSocket *sp);
+
 /**
  *  Get the socket file descriptor.
  *  @description Get the file descriptor associated with a socket.
@@ -5933,6 +5949,16 @@ extern void mprSetSocketEof(MprSocket *sp, bool eof);
  */
 extern bool mprIsSocketSecure(MprSocket *sp);
 
+/**
+ *  Determine if file data can be sent directly to the socket
+ *  @description Plain sockets and secure sockets whose encryption has been offloaded to the kernel can use 
+ *      #mprSendFileToSocket without passing the file data through user space.
+ *  @param sp Socket object returned from #mprCreateSocket
+ *  @return True if the socket can use sendfile.
+ *  @ingroup MprSocket
+ */
+extern bool mprCanSocketSendFile(MprSocket *sp);
+
 /**
  *  Write a vector to a socket
  *  @description Do scatter/gather I/O by writing a vector of buffers to a socket.
@@ -5987,6 +6013,14 @@ extern MprModule *mprLoadSsl(MprCtx ctx, bool lazy);
  *  @param ssl MprSsl configuration
  */
 extern void mprConfigureSsl(struct MprSsl *ssl);
+
+/**
+ *  Get SSL handshake statistics
+ *  @param ssl MprSsl configuration
+ *  @param fullHandshakes Set to the count of handshakes that negotiated a new session
+ *  @param resumedHandshakes Set to the count of handshakes that resumed a cached session or session ticket
+ */
+extern void mprGetSslStats(struct MprSsl *ssl, int64 *fullHandshakes, int64 *resumedHandshakes);
 #endif
 
 extern int mprGetSocketInfo(MprCtx ctx, cchar *host, int port, int *family, int *protocol, struct sockaddr **addr, 
@@ -8270,6 +8304,7 @@ PCRE_EXP_DECL const char *pcre_version(void);
     #undef OCSP_RESPONSE
     #include    <openssl/ssl.h>
     #include    <openssl/evp.h>
+    #include    <openssl/hmac.h>
     #include    <openssl/rand.h>
     #include    <openssl/err.h>
 #endif
@@ -8299,6 +8334,22 @@ extern "C" {
 #define MPR_DEFAULT_SERVER_KEY_FILE     "server.key.pem"
 #define MPR_DEFAULT_CLIENT_CERT_FILE    "client.crt"
 #define MPR_DEFAULT_CLIENT_CERT_PATH    "certs"
+#define MPR_DEFAULT_SESSION_CACHE_SIZE  1024            /* Sessions held by the server session cache */
+#define MPR_DEFAULT_SESSION_TIMEOUT     300             /* Session lifespan in seconds */
+#define MPR_DEFAULT_TICKET_ROTATION     3600            /* Session ticket key rotation period in seconds */
+#define MPR_SSL_TICKET_NAME_SIZE        16
+#define MPR_SSL_TICKET_KEY_SIZE         32
+
+/*
+ *  Session ticket (RFC 5077) encryption keys. The current key encrypts new tickets. The previous key is retained 
+ *  after rotation so tickets issued before the rotation can still be decrypted (and are then renewed).
+ */
+typedef struct MprSslTicketKey {
+    uchar           name[MPR_SSL_TICKET_NAME_SIZE];
+    uchar           hmacKey[MPR_SSL_TICKET_KEY_SIZE];
+    uchar           aesKey[MPR_SSL_TICKET_KEY_SIZE];
+    bool            valid;
+} MprSslTicketKey;
 
 typedef struct MprSsl {
     /*
@@ -8320,6 +8371,27 @@ typedef struct MprSsl {
     bool            initialized;
     bool            connTraced;
 
+    /*
+     *  Session resumption. Set sessionCacheSize to zero to disable the server session cache.
+     */
+    int             sessionCacheSize;       /* Maximum number of cached server sessions */
+    int             sessionTimeout;         /* Session lifespan in seconds */
+    bool            sessionTickets;         /* Issue and accept RFC 5077 session tickets */
+    int             ticketRotation;         /* Ticket key rotation period in seconds. Zero for no rotation. */
+    char            *ticketKeyFile;         /* Shared ticket key file (for multiple processes or servers) */
+    MprSslTicketKey ticketKeys[2];          /* Current and previous ticket keys */
+    MprTime         ticketRotated;          /* When the ticket keys were last rotated */
+    MprHashTable    *clientSessions;        /* Client sessions for reuse, indexed by "host:port" */
+    MprMutex        *mutex;                 /* Multithread sync for keys, client sessions and statistics */
+
+    bool            kernelTls;              /* Offload record encryption to the kernel (Linux kTLS) if supported */
+
+    /*
+     *  Handshake statistics
+     */
+    int64           fullHandshakes;         /* Handshakes that negotiated a new session */
+    int64           resumedHandshakes;      /* Handshakes that resumed a cached session or ticket */
+
     /*
      *  Per-SSL provider context information
      */
@@ -8364,6 +8436,11 @@ extern void mprSetSslCaFile(MprSsl *ssl, cchar *caFile);
 extern void mprSetSslCaPath(MprSsl *ssl, cchar *caPath);
 extern void mprSetSslProtocols(MprSsl *ssl, int protocols);
 extern void mprVerifySslClients(MprSsl *ssl, bool on);
+extern void mprSetSslSessionCache(MprSsl *ssl, int size, int timeout);
+extern void mprSetSslSessionTickets(MprSsl *ssl, bool on, int rotation);
+extern void mprSetSslTicketKeyFile(MprSsl *ssl, cchar *path);
+extern void mprSetSslKernelTls(MprSsl *ssl, bool on);
+extern void mprGetSslStats(MprSsl *ssl, int64 *fullHandshakes, int64 *resumedHandshakes);
 
 #if BLD_FEATURE_OPENSSL
 extern int mprCreateOpenSslModule(MprCtx ctx, bool lazy);
@@ -8446,6 +8523,7 @@ static MprSocketProvider *createMatrixSslProvider(MprCtx ctx);
 static MprSocket *createMss(MprCtx ctx, MprSsl *ssl);
 static void     disconnectMss(MprSocket *sp);
 static int      doHandshake(MprSocket *sp, short cipherSuite);
+static bool     flushResponse(MprSocket *sp, MprSslSocket *msp);
 static int      flushMss(MprSocket *sp);
 static MprSsl   *getDefaultMatrixSsl(MprCtx ctx);
 static int      innerRead(MprSocket *sp, char *userBuf, int len);
@@ -8453,6 +8531,7 @@ static int      listenMss(MprSocket *sp, cchar *host, int port, MprSocketAcceptP
 static int      matrixSslDestructor(MprSsl *ssl);
 static int      matrixSslSocketDestructor(MprSslSocket *msp);
 static int      readMss(MprSocket *sp, void *buf, int len);
+static int      sendResponse(MprSocket *sp, sslBuf_t *response);
 static int      writeMss(MprSocket *sp, void *buf, int len);
 
 
@@ -8718,6 +8797,11 @@ static MprSocket *acceptMss(MprSocket *listen, bool invokeCallback)
     msp->inbuf.size = 0;
     msp->inbuf.start = msp->inbuf.end = msp->inbuf.buf = 0;
     msp->outBufferCount = 0;
+
+    /*
+     *  The handshake is performed incrementally by readMss as the socket becomes readable (or writable)
+     */
+    sp->flags |= MPR_SOCKET_HANDSHAKING;
     unlock(sp);
 
     /*
@@ -9050,18 +9134,8 @@ decodeMore:
      *  to the outgoing data buffer and flush it out.
      */
     case SSL_SEND_RESPONSE:
-        bytes = standard->writeSocket(sp, inbuf->start, (int) (inbuf->end - inbuf->start));
-        inbuf->start += bytes;
-        if (inbuf->start < inbuf->end) {
-            mprSetSocketBlockingMode(sp, 1);
-            while (inbuf->start < inbuf->end) {
-                bytes = standard->writeSocket(sp, inbuf->start, (int) (inbuf->end - inbuf->start));
-                if (bytes < 0) {
-                    goto readError;
-                }
-                inbuf->start += bytes;
-            }
-            mprSetSocketBlockingMode(sp, 0);
+        if (sendResponse(sp, inbuf) < 0) {
+            goto readError;
         }
         inbuf->start = inbuf->end = inbuf->buf;
         if (insock->end > insock->start) {
@@ -9138,6 +9212,71 @@ readError:
 }
 
 
+/*
+ *  Send a handshake response without blocking. Whatever can't be written now is appended to the outsock buffer 
+ *  and flushed by readMss when the socket becomes writable.
+ */
+static int sendResponse(MprSocket *sp, sslBuf_t *response)
+{
+    MprSslSocket    *msp;
+    sslBuf_t        *outsock;
+    int             bytes, pending, len;
+
+    msp = (MprSslSocket*) sp->sslSocket;
+    outsock = &msp->outsock;
+
+    if (outsock->start == outsock->end) {
+        bytes = sp->service->standardProvider->writeSocket(sp, response->start, (int) (response->end - response->start));
+        if (bytes < 0) {
+            return bytes;
+        }
+        response->start += bytes;
+    }
+    if ((len = (int) (response->end - response->start)) > 0) {
+        pending = (int) (outsock->end - outsock->start);
+        if (outsock->start > outsock->buf) {
+            memmove(outsock->buf, outsock->start, pending);
+            outsock->start = outsock->buf;
+            outsock->end = outsock->buf + pending;
+        }
+        if ((pending + len) > outsock->size) {
+            outsock->size = pending + len;
+            outsock->start = outsock->buf = (uchar*) mprRealloc(msp, outsock->buf, outsock->size);
+            outsock->end = outsock->buf + pending;
+        }
+        memcpy(outsock->end, response->start, len);
+        outsock->end += len;
+        response->start = response->end;
+        sp->flags |= MPR_SOCKET_WANT_WRITE;
+    }
+    return 0;
+}
+
+
+/*
+ *  Flush buffered handshake responses. Return true if all pending data has been written.
+ */
+static bool flushResponse(MprSocket *sp, MprSslSocket *msp)
+{
+    sslBuf_t    *outsock;
+    int         bytes;
+
+    outsock = &msp->outsock;
+    if (outsock->start < outsock->end && msp->outBufferCount == 0) {
+        bytes = sp->service->standardProvider->writeSocket(sp, outsock->start, (int) (outsock->end - outsock->start));
+        if (bytes > 0) {
+            outsock->start += bytes;
+        }
+        if (outsock->start < outsock->end) {
+            return 0;
+        }
+        outsock->start = outsock->end = outsock->buf;
+    }
+    sp->flags &= ~MPR_SOCKET_WANT_WRITE;
+    return 1;
+}
+
+
 static int readMss(MprSocket *sp, void *buf, int len)
 {
     MprSslSocket  *msp;
@@ -9150,9 +9289,18 @@ static int readMss(MprSocket *sp, void *buf, int len)
         unlock(sp);
         return -1;
     }
-
+    if ((sp->flags & MPR_SOCKET_WANT_WRITE) && !flushResponse(sp, msp)) {
+        unlock(sp);
+        return 0;
+    }
     bytes = innerRead(sp, buf, len);
 
+    if ((sp->flags & MPR_SOCKET_HANDSHAKING) && !(sp->flags & MPR_SOCKET_WANT_WRITE) && 
+            matrixSslHandshakeIsComplete(msp->mssl)) {
+        sp->flags &= ~MPR_SOCKET_HANDSHAKING;
+        mprLog(sp, 5, "MatrixSSL: Handshake complete for %s", sp->clientIpAddr);
+    }
+
     /*
      *  If there is more data buffered locally here, then ensure the select handler will recall us again even 
      *  if there is no more IO events
@@ -9381,15 +9529,24 @@ static int      connectOss(MprSocket *sp, cchar *host, int port, int flags);
 static MprSocketProvider *createOpenSslProvider(MprCtx ctx);
 static MprSocket *createOss(MprCtx ctx, MprSsl *ssl);
 static DH       *dhCallback(SSL *ssl, int isExport, int keyLength);
+static void     configureSessions(MprSsl *ssl, SSL_CTX *context);
+static void     infoCallback(const SSL *osslStruct, int where, int rc);
 static void     disconnectOss(MprSocket *sp);
 static int      flushOss(MprSocket *sp);
 static int      listenOss(MprSocket *sp, cchar *host, int port, MprSocketAcceptProc acceptFn, void *data, int flags);
 static int      openSslDestructor(MprSsl *ssl);
 static int      openSslSocketDestructor(MprSslSocket *ssp);
+static int      handshakeOss(MprSocket *sp, MprSslSocket *osp);
 static int      readOss(MprSocket *sp, void *buf, int len);
 static RSA      *rsaCallback(SSL *ssl, int isExport, int keyLength);
+static void     saveClientSession(MprSsl *ssl, cchar *host, int port, SSL *osslStruct);
+static void     setClientSession(MprSsl *ssl, cchar *host, int port, SSL *osslStruct);
 static int      verifyX509Certificate(int ok, X509_STORE_CTX *ctx);
 static int      writeOss(MprSocket *sp, void *buf, int len);
+#ifdef SSL_OP_NO_TICKET
+static int      initTicketKeys(MprSsl *ssl);
+static int      ticketCallback(SSL *osslStruct, uchar *name, uchar *iv, EVP_CIPHER_CTX *ectx, HMAC_CTX *hctx, int enc);
+#endif
 
 #if BLD_FEATURE_MULTITHREAD
 static int      lockDestructor(void *ptr);
@@ -9552,10 +9709,10 @@ static int configureOss(MprSsl *ssl)
 
     SSL_CTX_set_app_data(context, (void*) ssl);
     SSL_CTX_set_quiet_shutdown(context, 1);
-    SSL_CTX_sess_set_cache_size(context, 512);
 
     RAND_bytes(resume, sizeof(resume));
     SSL_CTX_set_session_id_context(context, resume, sizeof(resume));
+    configureSessions(ssl, context);
 
     /*
      *  Configure the certificates
@@ -9628,7 +9785,21 @@ static int configureOss(MprSsl *ssl)
      *  Enable all buggy client work-arounds 
      */
     SSL_CTX_set_options(context, SSL_OP_ALL);
-    SSL_CTX_set_mode(context, SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_AUTO_RETRY);
+
+    /*
+     *  Short writes are retried from the event loop and coalesced writes are retried from a fresh stack buffer, so
+     *  OpenSSL must accept the same unwritten data at a different address.
+     */
+    SSL_CTX_set_mode(context, SSL_MODE_ENABLE_PARTIAL_WRITE | SSL_MODE_AUTO_RETRY | SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER);
+
+#ifdef SSL_OP_ENABLE_KTLS
+    /*
+     *  Let the kernel encrypt records after the handshake (where the cipher permits) so files can be sent with sendfile
+     */
+    if (ssl->kernelTls) {
+        SSL_CTX_set_options(context, SSL_OP_ENABLE_KTLS);
+    }
+#endif
 
     /*
      *  Select the required protocols
@@ -9677,9 +9848,16 @@ static int configureOss(MprSsl *ssl)
  */
 static int openSslDestructor(MprSsl *ssl)
 {
+    MprHash     *hp;
+
     if (ssl->context != 0) {
         SSL_CTX_free(ssl->context);
     }
+    if (ssl->clientSessions) {
+        for (hp = mprGetFirstHash(ssl->clientSessions); hp; hp = mprGetNextHash(ssl->clientSessions, hp)) {
+            SSL_SESSION_free((SSL_SESSION*) hp->data);
+        }
+    }
     if (ssl->rsaKey512) {
         RSA_free(ssl->rsaKey512);
     }
@@ -9696,6 +9874,230 @@ static int openSslDestructor(MprSsl *ssl)
 }
 
 
+/*
+ *  Configure session resumption. The OpenSSL session cache is shared by all threads via the locking callbacks. 
+ *  Session tickets let clients resume without any server state and, with a shared ticket key file, across processes.
+ */
+static void configureSessions(MprSsl *ssl, SSL_CTX *context)
+{
+    if (ssl->sessionCacheSize > 0) {
+        SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_SERVER);
+        SSL_CTX_sess_set_cache_size(context, ssl->sessionCacheSize);
+        SSL_CTX_set_timeout(context, ssl->sessionTimeout);
+        mprLog(ssl, 4, "OpenSSL: Session cache size %d, timeout %d secs", ssl->sessionCacheSize, ssl->sessionTimeout);
+    } else {
+        SSL_CTX_set_session_cache_mode(context, SSL_SESS_CACHE_OFF);
+        mprLog(ssl, 4, "OpenSSL: Session cache disabled");
+    }
+#ifdef SSL_OP_NO_TICKET
+    if (ssl->sessionTickets && initTicketKeys(ssl) == 0) {
+        SSL_CTX_set_tlsext_ticket_key_cb(context, ticketCallback);
+        mprLog(ssl, 4, "OpenSSL: Session tickets enabled, key rotation %d secs", 
+            ssl->ticketKeyFile ? 0 : ssl->ticketRotation);
+    } else {
+        SSL_CTX_set_options(context, SSL_OP_NO_TICKET);
+    }
+#endif
+    SSL_CTX_set_info_callback(context, infoCallback);
+}
+
+
+/*
+ *  Count full and resumed handshakes
+ */
+static void infoCallback(const SSL *osslStruct, int where, int rc)
+{
+    MprSsl      *ssl;
+
+    if (!(where & SSL_CB_HANDSHAKE_DONE)) {
+        return;
+    }
+    if ((ssl = (MprSsl*) SSL_CTX_get_app_data(SSL_get_SSL_CTX(osslStruct))) == 0) {
+        return;
+    }
+    lock(ssl);
+    if (SSL_session_reused((SSL*) osslStruct)) {
+        ssl->resumedHandshakes++;
+    } else {
+        ssl->fullHandshakes++;
+    }
+    unlock(ssl);
+}
+
+
+#ifdef SSL_OP_NO_TICKET
+static int createTicketKey(MprSslTicketKey *key)
+{
+    if (RAND_bytes(key->name, sizeof(key->name)) <= 0 || RAND_bytes(key->hmacKey, sizeof(key->hmacKey)) <= 0 ||
+            RAND_bytes(key->aesKey, sizeof(key->aesKey)) <= 0) {
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    key->valid = 1;
+    return 0;
+}
+
+
+/*
+ *  Load the ticket key from the shared key file or generate a random key. The key file holds 80 bytes: 
+ *  a 16 byte key name, a 32 byte HMAC secret and a 32 byte AES key.
+ */
+static int initTicketKeys(MprSsl *ssl)
+{
+    MprFile     *file;
+    MprSslTicketKey *key;
+    uchar       buf[MPR_SSL_TICKET_NAME_SIZE + MPR_SSL_TICKET_KEY_SIZE * 2];
+    int         len;
+
+    key = &ssl->ticketKeys[0];
+    if (key->valid) {
+        return 0;
+    }
+    if (ssl->ticketKeyFile) {
+        if ((file = mprOpen(ssl, ssl->ticketKeyFile, O_RDONLY | O_BINARY, 0)) == 0) {
+            mprError(ssl, "OpenSSL: Can't open session ticket key file %s", ssl->ticketKeyFile);
+            return MPR_ERR_CANT_OPEN;
+        }
+        len = mprRead(file, buf, sizeof(buf));
+        mprFree(file);
+        if (len != sizeof(buf)) {
+            mprError(ssl, "OpenSSL: Session ticket key file %s must contain %d bytes", ssl->ticketKeyFile, 
+                (int) sizeof(buf));
+            return MPR_ERR_BAD_FORMAT;
+        }
+        memcpy(key->name, buf, MPR_SSL_TICKET_NAME_SIZE);
+        memcpy(key->hmacKey, &buf[MPR_SSL_TICKET_NAME_SIZE], MPR_SSL_TICKET_KEY_SIZE);
+        memcpy(key->aesKey, &buf[MPR_SSL_TICKET_NAME_SIZE + MPR_SSL_TICKET_KEY_SIZE], MPR_SSL_TICKET_KEY_SIZE);
+        key->valid = 1;
+        memset(buf, 0, sizeof(buf));
+
+    } else if (createTicketKey(key) < 0) {
+        mprError(ssl, "OpenSSL: Can't create session ticket key");
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    ssl->ticketRotated = mprGetTime(ssl);
+    return 0;
+}
+
+
+/*
+ *  Rotate the ticket keys. The previous key is kept to decrypt (and renew) tickets issued before the rotation.
+ *  Must be called locked.
+ */
+static void rotateTicketKeys(MprSsl *ssl)
+{
+    MprSslTicketKey     key;
+    MprTime             now;
+
+    if (ssl->ticketRotation <= 0 || ssl->ticketKeyFile) {
+        return;
+    }
+    now = mprGetTime(ssl);
+    if ((now - ssl->ticketRotated) < ((MprTime) ssl->ticketRotation * MPR_TICKS_PER_SEC)) {
+        return;
+    }
+    if (createTicketKey(&key) < 0) {
+        return;
+    }
+    ssl->ticketKeys[1] = ssl->ticketKeys[0];
+    ssl->ticketKeys[0] = key;
+    ssl->ticketRotated = now;
+    mprLog(ssl, 4, "OpenSSL: Rotated session ticket keys");
+}
+
+
+/*
+ *  Session ticket key callback (RFC 5077). When encrypting, select the current key. When decrypting, find the key 
+ *  by name. Return 1 to accept, 2 to accept and renew the ticket with the current key, 0 to fall back to a full 
+ *  handshake and -1 on errors.
+ */
+static int ticketCallback(SSL *osslStruct, uchar *name, uchar *iv, EVP_CIPHER_CTX *ectx, HMAC_CTX *hctx, int enc)
+{
+    MprSsl          *ssl;
+    MprSslTicketKey *key;
+    int             i, rc;
+
+    if ((ssl = (MprSsl*) SSL_CTX_get_app_data(SSL_get_SSL_CTX(osslStruct))) == 0) {
+        return -1;
+    }
+    lock(ssl);
+    if (enc) {
+        rotateTicketKeys(ssl);
+        key = &ssl->ticketKeys[0];
+        if (RAND_bytes(iv, EVP_MAX_IV_LENGTH) <= 0) {
+            unlock(ssl);
+            return -1;
+        }
+        memcpy(name, key->name, MPR_SSL_TICKET_NAME_SIZE);
+        EVP_EncryptInit_ex(ectx, EVP_aes_256_cbc(), NULL, key->aesKey, iv);
+        HMAC_Init_ex(hctx, key->hmacKey, MPR_SSL_TICKET_KEY_SIZE, EVP_sha256(), NULL);
+        rc = 1;
+
+    } else {
+        rc = 0;
+        for (i = 0; i < 2; i++) {
+            key = &ssl->ticketKeys[i];
+            if (key->valid && memcmp(name, key->name, MPR_SSL_TICKET_NAME_SIZE) == 0) {
+                HMAC_Init_ex(hctx, key->hmacKey, MPR_SSL_TICKET_KEY_SIZE, EVP_sha256(), NULL);
+                EVP_DecryptInit_ex(ectx, EVP_aes_256_cbc(), NULL, key->aesKey, iv);
+                rc = (i == 0) ? 1 : 2;
+                break;
+            }
+        }
+    }
+    unlock(ssl);
+    return rc;
+}
+#endif
+
+
+/*
+ *  Offer the last session negotiated with this host so the server can resume it
+ */
+static void setClientSession(MprSsl *ssl, cchar *host, int port, SSL *osslStruct)
+{
+    SSL_SESSION     *session;
+    char            key[MPR_MAX_STRING];
+
+    if (ssl->clientSessions == 0) {
+        return;
+    }
+    mprSprintf(key, sizeof(key), "%s:%d", host, port);
+    lock(ssl);
+    if ((session = (SSL_SESSION*) mprLookupHash(ssl->clientSessions, key)) != 0) {
+        SSL_set_session(osslStruct, session);
+    }
+    unlock(ssl);
+}
+
+
+/*
+ *  Remember the session negotiated with a host for use by the next connection
+ */
+static void saveClientSession(MprSsl *ssl, cchar *host, int port, SSL *osslStruct)
+{
+    SSL_SESSION     *session, *old;
+    char            key[MPR_MAX_STRING];
+
+    if (ssl->sessionCacheSize <= 0 || (session = SSL_get1_session(osslStruct)) == 0) {
+        return;
+    }
+    mprSprintf(key, sizeof(key), "%s:%d", host, port);
+    lock(ssl);
+    if (ssl->clientSessions == 0) {
+        ssl->clientSessions = mprCreateHash(ssl, 0);
+    }
+    old = (SSL_SESSION*) mprLookupHash(ssl->clientSessions, key);
+    if (old || mprGetHashCount(ssl->clientSessions) < ssl->sessionCacheSize) {
+        mprAddHash(ssl->clientSessions, key, session);
+        session = old;
+    }
+    unlock(ssl);
+    if (session) {
+        SSL_SESSION_free(session);
+    }
+}
+
+
 /*
  *  Configure the SSL certificate information configureOss
  */
@@ -9849,6 +10251,11 @@ static MprSocket *acceptOss(MprSocket *listen, bool invokeCallback)
     SSL_set_bio(osslStruct, bioSock, bioSock);
     SSL_set_accept_state(osslStruct);
     osp->bio = bioSock;
+
+    /*
+     *  The handshake is performed incrementally by readOss as the socket becomes readable (or writable)
+     */
+    sp->flags |= MPR_SOCKET_HANDSHAKING;
     unlock(sp);
 
     /*
@@ -9924,6 +10331,7 @@ static int connectOss(MprSocket *sp, cchar *host, int port, int flags)
     SSL_set_bio(osp->osslStruct, bioSock, bioSock);
 
     osp->bio = bioSock;
+    setClientSession(ssl, host, port, osp->osslStruct);
 
     /*
      *  Make the socket blocking while we connect
@@ -9941,6 +10349,7 @@ static int connectOss(MprSocket *sp, cchar *host, int port, int flags)
         unlock(sp);
         return MPR_ERR_CANT_CONNECT;
     }
+    saveClientSession(ssl, host, port, osp->osslStruct);
     mprSetSocketBlockingMode(sp, 0);
     unlock(sp);
     return 0;
@@ -9953,10 +10362,47 @@ static void disconnectOss(MprSocket *sp)
 }
 
 
+/*
+ *  Advance the server handshake without blocking. Return 1 when complete, 0 if more I/O is required 
+ *  and -1 on errors. Must be called locked.
+ */
+static int handshakeOss(MprSocket *sp, MprSslSocket *osp)
+{
+    int     rc, error;
+
+    rc = SSL_do_handshake(osp->osslStruct);
+    if (rc == 1) {
+        sp->flags &= ~(MPR_SOCKET_HANDSHAKING | MPR_SOCKET_WANT_WRITE);
+#ifdef SSL_OP_ENABLE_KTLS
+        if (BIO_get_ktls_send(SSL_get_wbio(osp->osslStruct))) {
+            sp->flags |= MPR_SOCKET_KERNEL_TLS;
+        }
+#endif
+        mprLog(sp, 5, "OpenSSL: Handshake complete for %s, %s session, cipher %s%s", sp->clientIpAddr,
+            SSL_session_reused(osp->osslStruct) ? "resumed" : "new", SSL_get_cipher(osp->osslStruct),
+            (sp->flags & MPR_SOCKET_KERNEL_TLS) ? ", kernel TLS" : "");
+        return 1;
+    }
+    error = SSL_get_error(osp->osslStruct, rc);
+    if (error == SSL_ERROR_WANT_READ) {
+        sp->flags &= ~MPR_SOCKET_WANT_WRITE;
+        return 0;
+
+    } else if (error == SSL_ERROR_WANT_WRITE) {
+        sp->flags |= MPR_SOCKET_WANT_WRITE;
+        return 0;
+    }
+    mprLog(sp, 4, "OpenSSL: Handshake failed for %s, error %d", sp->clientIpAddr, error);
+    sp->flags |= MPR_SOCKET_EOF;
+    sp->flags &= ~(MPR_SOCKET_HANDSHAKING | MPR_SOCKET_WANT_WRITE);
+    return -1;
+}
+
+
 static int readOss(MprSocket *sp, void *buf, int len)
 {
     MprSslSocket    *osp;
-    int             rc, error, retries, i;
+    int             rc, error;
 
     lock(sp);
     osp = (MprSslSocket*) sp->sslSocket;
@@ -9968,20 +10414,20 @@ static int readOss(MprSocket *sp, void *buf, int len)
         return -1;
     }
 
-    retries = 5;
-    for (i = 0; i < retries; i++) {
-        rc = SSL_read(osp->osslStruct, buf, len);
-        if (rc < 0) {
-            char    ebuf[MPR_MAX_STRING];
-            error = SSL_get_error(osp->osslStruct, rc);
-            if (error == SSL_ERROR_WANT_READ || error == SSL_ERROR_WANT_CONNECT || error == SSL_ERROR_WANT_ACCEPT) {
-                continue;
-            }
+    if (sp->flags & MPR_SOCKET_HANDSHAKING) {
+        if ((rc = handshakeOss(sp, osp)) <= 0) {
+            unlock(sp);
+            return rc;
+        }
+    }
+    rc = SSL_read(osp->osslStruct, buf, len);
+    if (rc < 0) {
+        char    ebuf[MPR_MAX_STRING];
+        error = SSL_get_error(osp->osslStruct, rc);
+        if (error != SSL_ERROR_WANT_READ && error != SSL_ERROR_WANT_WRITE) {
             ERR_error_string_n(error, ebuf, sizeof(ebuf) - 1);
             mprLog(sp, 4, "SSL_read error %d, %s", error, ebuf);
-
         }
-        break;
     }
 
 #if DEBUG
@@ -10016,7 +10462,8 @@ static int readOss(MprSocket *sp, void *buf, int len)
             rc = 0;
 
         } else if (error == SSL_ERROR_WANT_WRITE) {
-            mprSleep(sp, 10);
+            /* Renegotiation needs to write. Don't block the worker, wait for a writable event */
+            sp->flags |= MPR_SOCKET_HANDSHAKING | MPR_SOCKET_WANT_WRITE;
             rc = 0;
                 
         } else if (error == SSL_ERROR_ZERO_RETURN) {
@@ -10070,8 +10517,11 @@ static int writeOss(MprSocket *sp, void *buf, int len)
         if (rc <= 0) {
             rc = SSL_get_error(osp->osslStruct, rc);
             if (rc == SSL_ERROR_WANT_WRITE) {
-                mprSleep(sp, 10);
-                continue;
+                /*
+                 *  Return a short write rather than blocking. The caller waits for a writable event and then retries
+                 *  with the same unwritten data as OpenSSL requires.
+                 */
+                break;
                 
             } else if (rc == SSL_ERROR_WANT_READ) {
                 //  AUTO-RETRY should stop this
@@ -10494,6 +10944,12 @@ MprSsl *mprCreateSsl(MprCtx ctx)
     ssl->ciphers = mprStrdup(ssl, MPR_DEFAULT_CIPHER_SUITE);
     ssl->protocols = MPR_HTTP_PROTO_SSLV3 | MPR_HTTP_PROTO_TLSV1;
     ssl->verifyDepth = 6;
+    ssl->sessionCacheSize = MPR_DEFAULT_SESSION_CACHE_SIZE;
+    ssl->sessionTimeout = MPR_DEFAULT_SESSION_TIMEOUT;
+    ssl->sessionTickets = 1;
+    ssl->ticketRotation = MPR_DEFAULT_TICKET_ROTATION;
+    ssl->kernelTls = 1;
+    ssl->mutex = mprCreateLock(ssl);
     return ssl;
 }
 
@@ -10574,6 +11030,56 @@ void mprVerifySslClients(MprSsl *ssl, bool on)
 }
 
 
+/*
+ *  Define the server session cache size and session lifespan (secs). A size of zero disables the cache.
+ */
+void mprSetSslSessionCache(MprSsl *ssl, int size, int timeout)
+{
+    ssl->sessionCacheSize = max(size, 0);
+    if (timeout > 0) {
+        ssl->sessionTimeout = timeout;
+    }
+}
+
+
+/*
+ *  Enable or disable session tickets. The ticket keys are rotated every "rotation" seconds.
+ */
+void mprSetSslSessionTickets(MprSsl *ssl, bool on, int rotation)
+{
+    ssl->sessionTickets = on;
+    if (rotation >= 0) {
+        ssl->ticketRotation = rotation;
+    }
+}
+
+
+/*
+ *  Use ticket keys from a file so that all processes (or servers) sharing the file can resume each other's sessions.
+ *  The keys are not rotated. Replace the file and restart to rotate.
+ */
+void mprSetSslTicketKeyFile(MprSsl *ssl, cchar *path)
+{
+    mprFree(ssl->ticketKeyFile);
+    ssl->ticketKeyFile = mprStrdup(ssl, path);
+}
+
+
+void mprSetSslKernelTls(MprSsl *ssl, bool on)
+{
+    ssl->kernelTls = on;
+}
+
+
+void mprGetSslStats(MprSsl *ssl, int64 *fullHandshakes, int64 *resumedHandshakes)
+{
+    lock(ssl);
+    *fullHandshakes = ssl->fullHandshakes;
+    *resumedHandshakes = ssl->resumedHandshakes;
+    unlock(ssl);
+}
+
+
 #else /* SSL */
 
 /*
@@ -10641,6 +11147,32 @@ void mprVerifySslClients(MprSsl *ssl, bool on)
 }
 
 
+void mprSetSslSessionCache(MprSsl *ssl, int size, int timeout)
+{
+}
+
+
+void mprSetSslSessionTickets(MprSsl *ssl, bool on, int rotation)
+{
+}
+
+
+void mprSetSslTicketKeyFile(MprSsl *ssl, cchar *path)
+{
+}
+
+
+void mprSetSslKernelTls(MprSsl *ssl, bool on)
+{
+}
+
+
+void mprGetSslStats(MprSsl *ssl, int64 *fullHandshakes, int64 *resumedHandshakes)
+{
+    *fullHandshakes = *resumedHandshakes = 0;
+}
+
+
 #endif /* SSL */
 
 
@@ -152,6 +152,17 @@ function quoting() {
     assert(request.query == "a|b+c>d+e?f+g>h+i'j+k\"l+m%20n=1234")
 }
 
+//  Pooled interpreters must not carry module level or static state from one request to the next
+function pooledState() {
+    for (i in 4) {
+        http.get(HTTP + "/poolapp/state/index?id=" + i)
+        assert(http.code == 200)
+        let state = deserialize(http.response)
+        assert(state.count == 1)
+        assert(state.items.length == 1 && state.items[0] == i)
+    }
+}
+
 basic()
 forms()
 alias()
@@ -160,3 +171,4 @@ encoding()
 status()
 location()
 quoting()
+pooledState()
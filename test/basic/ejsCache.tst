@@ -0,0 +1,48 @@
+/*
+ *  ejsCache.tst - Shared EJS web cache
+ */
+
+const HTTP = session["main"]
+let http: Http = new Http
+
+function read(key: String): Object {
+    http.get(HTTP + "/cache.ejs?key=" + key)
+    assert(http.code == 200)
+    return deserialize(http.response).value
+}
+
+//  Strings are shared across requests
+http.get(HTTP + "/cache.ejs?op=write&key=s&value=hello")
+assert(http.code == 200)
+assert(read("s") == "hello")
+
+//  Objects are stored serialized
+http.get(HTTP + "/cache.ejs?op=writeObject&key=o&value=world")
+assert(http.code == 200)
+let o = read("o")
+assert(o.value == "world")
+assert(o.list.length == 3)
+
+//  Removed and missing items read as null
+http.get(HTTP + "/cache.ejs?op=remove&key=s")
+assert(http.code == 200)
+assert(read("s") == null)
+assert(read("missing") == null)
+
+//  Items expire after their lifetime
+http.get(HTTP + "/cache.ejs?op=write&key=t&value=brief&lifetime=1")
+assert(http.code == 200)
+assert(read("t") == "brief")
+App.sleep(1100)
+assert(read("t") == null)
+
+http.get(HTTP + "/cache.ejs?op=remove&key=o")
+assert(http.code == 200)
+
+//  Cache activity is reported with the metrics
+http.get(HTTP + "/metrics")
+assert(http.code == 200)
+let hits = http.response.match(/appweb_ejs_cache_total\{result="hit"\} [0-9]+/)
+assert(hits && hits.length == 1)
+assert(hits[0].split(" ")[1] != "0")
+http.close()
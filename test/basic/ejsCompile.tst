@@ -0,0 +1,61 @@
+/*
+ *  ejsCompile.tst - Compile stale ejs pages in-process
+ */
+
+const HTTP = session["main"]
+const PAGE = Path("web/compiled.ejs")
+const MOD = Path("web/compiled.mod")
+
+let http: Http = new Http
+
+PAGE.write('<p><%= "first" %> @@request.method</p>\n')
+http.get(HTTP + "/compiled.ejs")
+assert(http.code == 200)
+assert(http.response.contains("first GET"))
+assert(MOD.exists)
+assert(!Path("web/compiled.es").exists)
+
+//  Modify the page after the module's modification time so it must be recompiled
+App.sleep(1100)
+PAGE.write('<p><%= "second" %></p>\n')
+http.get(HTTP + "/compiled.ejs")
+assert(http.code == 200)
+assert(http.response.contains("second"))
+
+//  Compile errors are reported and do not leave a module behind
+App.sleep(1100)
+MOD.remove()
+PAGE.write('<% if ( %>\n')
+http.get(HTTP + "/compiled.ejs")
+assert(http.code != 200)
+assert(!MOD.exists)
+assert(!Path(MOD + ".tmp").exists)
+
+//  Pages compiled in-process render the same as pages compiled by ajsweb
+App.sleep(1100)
+PAGE.write('<%@ include "include.ejs" %>\n<p><%= 6 * 7 %> @@request.method</p>\n')
+http.get(HTTP + "/compiled.ejs")
+assert(http.code == 200)
+let inProcess = http.response
+assert(inProcess.contains("Hello from included text"))
+assert(inProcess.contains("42 GET"))
+
+MOD.remove()
+let dir = App.dir
+App.chdir(PAGE.dirname)
+try {
+    //  ajsweb names views relative to the current directory, so compile from the document root
+    Cmd.run("/usr/bin/env ajsweb --quiet compile " + PAGE.basename)
+} finally {
+    App.chdir(dir)
+}
+assert(MOD.exists)
+http.get(HTTP + "/compiled.ejs")
+assert(http.code == 200)
+assert(http.response == inProcess)
+http.close()
+
+PAGE.remove()
+if (MOD.exists) {
+    MOD.remove()
+}
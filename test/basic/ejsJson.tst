@@ -0,0 +1,25 @@
+/*
+ *  ejsJson.tst - JSON written directly to the response
+ */
+
+const HTTP = session["main"]
+let http: Http = new Http
+
+function get(op: String, count: Number): String {
+    http.get(HTTP + "/json.ejs?op=" + op + "&count=" + count)
+    assert(http.code == 200)
+    return http.response
+}
+
+//  Streamed output is identical to serialize() and spans several chunks
+let streamed = get("stream", 1000)
+assert(streamed == get("string", 1000))
+assert(streamed.length > 8192 * 4)
+let rows = deserialize(streamed)
+assert(rows.length == 1000)
+assert(rows[999].name == "row-999" && rows[999].tags[1] == 'b"c' && rows[998].nested.flag == true)
+
+//  Small and empty results
+assert(get("stream", 1) == get("string", 1))
+assert(deserialize(get("stream", 0)).length == 0)
+http.close()
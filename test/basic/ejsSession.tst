@@ -0,0 +1,48 @@
+/*
+ *  ejsSession.tst - EJS session state
+ */
+
+use namespace "ejs.db"
+
+const HTTP = session["main"]
+let http: Http = new Http
+
+function fetch(op: String, id: String = null): Object {
+    if (id) {
+        http.addHeader("Cookie", "-ejs-session-=" + id)
+    }
+    http.get(HTTP + "/session.ejs?op=" + op)
+    assert(http.code == 200)
+    return deserialize(http.response)
+}
+
+//  Create a session and update it over several requests
+let result = fetch("create")
+let id = result.id
+assert(id)
+assert(http.header("set-cookie").contains(id))
+assert(result.info.name == "ejs")
+
+for (i in 3) {
+    result = fetch("increment", id)
+    assert(result.id == id)
+}
+assert(result.count == "0111")
+assert(result.info.list.length == 3)
+assert(result.names.length == 2)
+
+//  Sessions are written behind to the session store
+App.sleep(2500)
+http.get(HTTP + "/metrics")
+assert(http.response.match(/appweb_ejs_sessions [1-9]/))
+let db = new Sqlite("web/tmp/sessions.db")
+let rows = db.query("SELECT name, value FROM sessionValues WHERE id = '" + id + "'")
+assert(rows.length == 2)
+db.close()
+
+//  Destroyed sessions are no longer available
+fetch("destroy", id)
+result = fetch("", id)
+assert(result.id == "")
+assert(result.count == null)
+http.close()
@@ -0,0 +1,104 @@
+/*
+ *  ejsSqlite.tst - SQLite bound parameters, cached statements and pooled connections
+ */
+
+use namespace "ejs.db"
+
+const HTTP = session["main"]
+const DB = "sqlite.tdat"
+const NASTY = "Bob's \"quoted\"'); DROP TABLE items; --"
+
+Path(DB).remove()
+let db = new Sqlite(DB)
+db.sql("CREATE TABLE items(id INTEGER PRIMARY KEY, name TEXT, price REAL, flag TINYINT, note TEXT)")
+for (i in 10) {
+    db.sql("INSERT INTO items(name, price, flag, note) VALUES(?, ?, ?, ?)", "item-" + i, i * 1.5, i % 2 == 0, null)
+}
+db.sql("INSERT INTO items(name) VALUES(?)", NASTY)
+
+//  Bound values are stored literally and are never interpreted as SQL
+let rows = db.sql("SELECT * FROM items WHERE name = ?", NASTY)
+assert(rows.length == 1 && rows[0].name == NASTY && rows[0].id == "11")
+assert(db.sql("SELECT COUNT(*) AS count FROM items")[0].count == "11")
+
+//  Numbers, booleans and nulls
+rows = db.sql("SELECT * FROM items WHERE price > ? AND flag = ? ORDER BY id", 5, true)
+assert(rows.length == 3 && rows[0].name == "item-4" && rows[0].price == "6.0")
+assert(db.sql("SELECT COUNT(*) AS count FROM items WHERE note IS NULL AND flag = ?", false)[0].count == "5")
+
+//  Cached statements rebind fresh values and survive schema changes
+for (i in 10) {
+    assert(db.sql("SELECT name FROM items WHERE id = ?", i + 1)[0].name == "item-" + i)
+}
+db.sql("ALTER TABLE items ADD extra TEXT")
+rows = db.sql("SELECT * FROM items WHERE id = ?", 1)
+assert(rows[0].extra == "" && rows[0].name == "item-0")
+
+//  Multiple commands take parameters in order
+db.sql("UPDATE items SET extra = ? WHERE id = ?; UPDATE items SET extra = ? WHERE id = ?", "a", 1, "b", 2)
+rows = db.sql("SELECT extra FROM items WHERE id <= 2 ORDER BY id")
+assert(rows[0].extra == "a" && rows[1].extra == "b")
+
+//  Missing parameters and bad SQL throw
+let caught = false
+try {
+    db.sql("SELECT * FROM items WHERE id = ? AND name = ?", 1)
+} catch {
+    caught = true
+}
+assert(caught)
+caught = false
+try {
+    db.sql("SELECT * FROM missing WHERE id = ?", 1)
+} catch {
+    caught = true
+}
+assert(caught)
+db.close()
+
+//  Pooled connections are reused and in-memory databases are never shared
+let database = new Database("sqlite", DB)
+assert(database.sql("SELECT name FROM items WHERE id = ?", 3)[0].name == "item-2")
+database.close()
+let memory = new Sqlite(":memory:")
+memory.sql("CREATE TABLE private(id)")
+memory.close()
+memory = new Sqlite(":memory:")
+assert(memory.sql("SELECT name FROM sqlite_master WHERE name = ?", "private").length == 0)
+memory.close()
+
+//  Writes by another connection keep the pooled connection. A replaced file is not served by it.
+const REPLACED = "sqlite-replaced.tdat"
+const REPLACEMENT = "sqlite-replacement.tdat"
+Path(REPLACED).remove()
+Path(REPLACEMENT).remove()
+let first = new Sqlite(REPLACED)
+first.sql("CREATE TABLE original(id)")
+first.close()
+let writer = new Sqlite(REPLACED)
+let other = new Sqlite(REPLACED)
+other.sql("INSERT INTO original(id) VALUES(?)", 1)
+other.close()
+assert(writer.sql("SELECT id FROM original").length == 1)
+writer.close()
+let replacement = new Sqlite(REPLACEMENT)
+replacement.sql("CREATE TABLE replacement(id)")
+replacement.close()
+Path(REPLACEMENT).rename(REPLACED)
+let replaced = new Sqlite(REPLACED)
+assert(replaced.sql("SELECT name FROM sqlite_master WHERE name = ?", "replacement").length == 1)
+assert(replaced.sql("SELECT name FROM sqlite_master WHERE name = ?", "original").length == 0)
+replaced.close()
+Path(REPLACED).remove()
+
+//  Web pages share pooled connections across interpreters
+let http: Http = new Http
+for (i in 5) {
+    http.get(HTTP + "/sqlite.ejs?id=" + (i + 1))
+    assert(http.code == 200)
+    assert(deserialize(http.response)[0].name == "item-" + i)
+}
+http.get(HTTP + "/sqlite.ejs?name=" + encodeURI(NASTY))
+assert(http.code == 200)
+assert(deserialize(http.response)[0].id == "11")
+http.close()
@@ -15,6 +15,14 @@ assert(http.codeString == "OK")
 assert(http.contentType == "text/html")
 assert(http.date != "")
 assert(http.lastModified != "")
+assert(http.header("Date").contains(" GMT"))
+assert(http.header("Server").contains("Appweb"))
+assert(http.header("Keep-Alive").contains("timeout="))
+let modified = http.header("Last-Modified")
+
+//  Last-Modified is served from the date cache and must be stable
+http.get(URL)
+assert(http.header("Last-Modified") == modified)
 
 http.post(URL)
 assert(http.code == 200)
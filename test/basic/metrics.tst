@@ -0,0 +1,52 @@
+/*
+ *  metrics.tst - Metrics handler tests
+ */
+
+const HTTP = session["main"]
+let http: Http = new Http
+
+//  Generate some traffic
+http.get(HTTP + "/index.html")
+assert(http.code == 200)
+http.close()
+
+//  Text format
+http.get(HTTP + "/metrics")
+assert(http.code == 200)
+assert(http.contentType.contains("text/plain"))
+assert(http.response.contains("appweb_requests_total{host="))
+assert(http.response.contains("appweb_responses_total{handler=\"fileHandler\",status=\"2xx\"}"))
+assert(http.response.contains("appweb_request_msec_bucket{"))
+assert(http.response.contains("appweb_memory_allocated_bytes"))
+assert(http.response.contains("appweb_request_phase_usec_total{host="))
+assert(http.response.contains("appweb_stage_service_calls_total{stage=\"netConnector\"}"))
+http.close()
+
+//  JSON format
+http.get(HTTP + "/metrics?format=json")
+assert(http.code == 200)
+assert(http.contentType.contains("application/json"))
+let metrics = deserialize(http.response)
+assert(metrics.hosts.length > 0)
+assert(metrics.hosts[0].requests > 0)
+assert(metrics.hosts[0].latency.p99 >= metrics.hosts[0].latency.p50)
+assert(metrics.memory.allocated > 0)
+assert(metrics.hosts[0].timing.timed > 0)
+assert(metrics.hosts[0].timing.parse >= 0)
+assert(metrics.stages.length > 0)
+http.close()
+
+//  Host names are escaped in label values and JSON strings
+http.get(HTTP + "/metrics")
+assert(http.response.contains('appweb_requests_total{host="metrics\\"odd\\\\name'))
+http.close()
+http.get(HTTP + "/metrics?format=json")
+metrics = deserialize(http.response)
+let found = false
+for each (host in metrics.hosts) {
+    if (host.name.startsWith('metrics"odd\\name')) {
+        found = true
+    }
+}
+assert(found)
+http.close()
@@ -4,3 +4,19 @@
 
 assert(Http.mimeType("a.txt") == "text/plain")
 assert(Http.mimeType("a.html") == "text/html")
+
+//  Access log formats may end in a literal percent. The localhost virtual host logs with "%>s %r 100%".
+const LOG = Path("access.tlog")
+let http: Http = new Http
+http.get("http://localhost:" + session["vhostPort"] + "/vhost1.html")
+assert(http.code == 200)
+http.close()
+let logged = false
+for (i in 50) {
+    if (LOG.exists && LOG.readString().contains("200 GET /vhost1.html HTTP/1.1 100%\n")) {
+        logged = true
+        break
+    }
+    App.sleep(100)
+}
+assert(logged)
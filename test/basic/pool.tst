@@ -0,0 +1,71 @@
+/*
+ *  pool.tst - Keep-alive connection pooling and pipelining in the Http client
+ */
+
+const HTTP = session["main"]
+const URL = HTTP + "/index.html"
+
+function fetch(uri: String): Http {
+    let http: Http = new Http
+    http.get(uri)
+    assert(http.code == 200)
+    return http
+}
+
+//  Separate Http objects share pooled connections
+fetch(URL).close()
+let before = Http.pool
+for (i in 10) {
+    fetch(URL).close()
+}
+let after = Http.pool
+assert(after.reused - before.reused == 10)
+assert(after.opened == before.opened)
+assert(after.idle >= 1)
+
+//  Chunked and dynamic responses leave the connection reusable
+before = Http.pool
+for (i in 5) {
+    let http = fetch(HTTP + "/json.ejs?op=stream&count=200")
+    assert(deserialize(http.response).length == 200)
+}
+assert(Http.pool.opened == before.opened)
+
+//  Pipelined requests return the same responses in order
+let uris = [ URL, HTTP + "/json.ejs?op=stream&count=100", HTTP + "/missing.html", HTTP + "/numbers.txt", URL ]
+let http: Http = new Http
+before = Http.pool
+let responses = http.pipeline(uris)
+assert(responses.length == uris.length)
+assert(Http.pool.pipelined - before.pipelined == uris.length - 1)
+for (i in uris) {
+    let single: Http = new Http
+    single.get(uris[i])
+    assert(responses[i].uri == uris[i])
+    assert(responses[i].code == single.code)
+    if (single.code == 200) {
+        assert(responses[i].response == single.response)
+    }
+}
+assert(responses[2].code == 404)
+assert(http.pipeline([]).length == 0)
+
+//  Requests for another host or port are not pipelined on the current connection
+const VHOST_PORT = session["vhostPort"]
+uris = [ URL, "http://127.0.0.1:" + VHOST_PORT + "/vhost2.html", "http://localhost:" + VHOST_PORT + "/vhost1.html", URL ]
+before = Http.pool
+responses = http.pipeline(uris)
+assert(responses.length == uris.length)
+assert(Http.pool.pipelined == before.pipelined)
+assert(responses[0].code == 200 && responses[3].code == 200)
+assert(responses[1].code == 200 && responses[1].response.contains("Welcome to Local2"))
+assert(responses[2].code == 200 && responses[2].response.contains("Welcome to Local1"))
+
+//  Pooling can be disabled
+Http.setPoolLimits(0)
+before = Http.pool
+fetch(URL).close()
+fetch(URL).close()
+assert(Http.pool.opened - before.opened == 2)
+assert(Http.pool.idle == 0)
+Http.setPoolLimits(8)
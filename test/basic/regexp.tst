@@ -0,0 +1,49 @@
+/*
+ *  regexp.tst - Compiled regular expression caching
+ */
+
+function words(s: String): Array {
+    return s.match(/[a-z]+/g)
+}
+
+//  Regex literals are evaluated each time but only compiled once
+words("warm the cache")
+let before = RegExp.cache
+for (i in 50) {
+    assert(words("one two three").length == 3)
+}
+let after = RegExp.cache
+assert(after.hits - before.hits >= 50)
+assert(after.misses == before.misses)
+
+//  Patterns are keyed by source and flags
+let plain = new RegExp("abc")
+let caseless = new RegExp("abc", "i")
+assert(plain.test("xabcx") && !plain.test("ABC"))
+assert(caseless.test("ABC") && caseless.ignoreCase)
+assert(!(new RegExp("abc")).test("ABC"))
+
+//  Shared patterns keep independent match state
+let a = /o/g
+let b = /o/g
+assert(a.exec("foo boo")[0] == "o" && a.lastIndex == 2)
+assert(b.lastIndex == 0)
+assert("foo boo".replace(/o/g, "0") == "f00 b00")
+assert("a,b;c".split(/[,;]/g).length == 3)
+
+//  Bad patterns are not cached and still throw
+let caught = false
+try {
+    new RegExp("(unclosed")
+} catch (e) {
+    caught = true
+}
+assert(caught)
+
+//  Patterns in use survive eviction and disabling the cache
+let held = new RegExp("held-[0-9]+")
+RegExp.setCacheLimit(0)
+assert(held.test("held-42") && (new RegExp("other-[0-9]+")).test("other-7"))
+assert(words("still works").length == 2)
+RegExp.setCacheLimit(256)
+assert(held.test("held-43"))
@@ -16,3 +16,11 @@ assert(http.code == 200)
 assert(http.response.contains('"clientFilename": "test.dat"'))
 assert(http.response.contains('Uploaded'))
 assert(http.response.contains('"address": "100 Mayfair"'))
+
+//  Form field larger than a packet so the boundary search must resume across packets
+let big = "x".times(100000)
+http.upload(HTTP + "/upload.ejs", { myfile: "basic/test.dat"}, {big: big, name: "John Smith"} )
+assert(http.code == 200)
+assert(http.response.contains('Uploaded'))
+assert(http.response.contains('"big": "' + big + '"'))
+assert(http.response.contains('"name": "John Smith"'))
@@ -0,0 +1,97 @@
+/*
+ *  worker.tst - Worker message cloning and transfer
+ */
+
+let received = []
+let w = new Worker
+w.onmessage = function (e) {
+    received.push(e.data)
+}
+w.eval('
+    postMessage("hello")
+    let o = { name: "x", when: new Date(1000), list: [1, "two", true, null] }
+    o.self = o
+    o.twin = o.list
+    postMessage(o)
+
+    let moved = new ByteArray(64)
+    moved.write("moved")
+    postMessage({ buf: moved }, [moved])
+    postMessage(moved.length)
+
+    let copied = new ByteArray(64)
+    copied.write("copied")
+    postMessage(copied)
+    postMessage(copied.available)
+', 0)
+assert(Worker.join(w, 10000))
+assert(received.length == 6)
+
+//  Values are received as values, not as serialized text
+assert(received[0] == "hello")
+let o = received[1]
+assert(o.name == "x" && o.when is Date && o.when.time == 1000)
+assert(o.list.length == 4 && o.list[1] == "two" && o.list[2] == true && o.list[3] == null)
+assert(o.self === o && o.twin === o.list)
+
+//  Transferred byte arrays are detached from the sender. Copies are not.
+assert(received[2].buf is ByteArray && received[2].buf.readString() == "moved")
+assert(received[3] == 0)
+assert(received[4].readString() == "copied")
+assert(received[5] == 6)
+
+//  Messages into a worker
+let reply
+w = new Worker
+w.onmessage = function (e) {
+    reply = e.data
+}
+w.eval('
+    onmessage = function (e) {
+        postMessage(e.data.a + e.data.b.length)
+    }
+    self.waitForMessage(10000)
+', 0)
+w.postMessage({ a: 1, b: [1, 2, 3] })
+assert(Worker.join(w, 10000))
+assert(reply == 4)
+
+//  More workers than pool threads are queued rather than refused
+let count = 0
+for (i in 40) {
+    let x = new Worker
+    x.onmessage = function (e) {
+        count++
+    }
+    x.eval('postMessage(1)', 0)
+}
+Worker.join(null, 20000)
+assert(count == 40)
+
+//  Workers nested deeper than the pool size don't deadlock while their parents wait in join
+const NEST = 30
+const NESTED = '
+    onmessage = function (e) {
+        let result = 1
+        if (e.data.depth > 1) {
+            let child = new Worker
+            child.onmessage = function (r) {
+                result = r.data + 1
+            }
+            child.eval(e.data.script, 0)
+            child.postMessage({ depth: e.data.depth - 1, script: e.data.script })
+            Worker.join(child, 30000)
+        }
+        postMessage(result)
+    }
+    self.waitForMessage(30000)
+'
+let depth = 0
+let nested = new Worker
+nested.onmessage = function (e) {
+    depth = e.data
+}
+nested.eval(NESTED, 0)
+nested.postMessage({ depth: NEST, script: NESTED })
+assert(Worker.join(nested, 60000))
+assert(depth == NEST)
@@ -0,0 +1,24 @@
+/*
+ *  cgi.tst - Stress test large CGI responses and report throughput
+ */
+
+const HTTP = session["main"]
+const SIZE = 500000
+
+let http: Http = new Http
+
+/* Depths:    0  1  2  3   4   5   6    7    8    9    */
+var iterations = [ 1, 2, 4, 8, 16, 32, 64, 128, 256, 512 ]
+
+let count = iterations[test.depth]
+let start = new Date
+for (i in count) {
+    http.get(HTTP + "/big.cgi")
+    assert(http.code == 200)
+    assert(http.response.length == SIZE)
+    http.close()
+}
+let elapsed = start.elapsed
+if (elapsed > 0) {
+    test.log(1, "[Bench]", "CGI " + (count * SIZE / 1024 / 1024 * 1000 / elapsed).toFixed(2) + " MB/sec")
+}
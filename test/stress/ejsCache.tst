@@ -0,0 +1,46 @@
+/*
+ *  ejsCache.tst - Shared EJS web cache throughput with concurrent clients
+ */
+
+const HTTP = session["main"]
+const CLIENTS = 4
+const COUNT = 10 * test.depth
+const OPS = 200
+
+/*
+ *  Each client uses its own keys so a read can only see that client's prior write
+ */
+function script(client: Number): String {
+    let code = '
+        let http = new Http
+        for (i in ' + COUNT + ') {
+            http.get("' + HTTP + '/cache.ejs?op=bench&count=' + OPS + '&key=' + client + '-" + i + "-")
+            if (http.code != 200) {
+                throw "Bad response code " + http.code
+            }
+        }
+        http.close()
+    '
+    return code
+}
+
+let workers = []
+let start = new Date
+for (i in CLIENTS) {
+    let w = new Worker
+    w.eval(script(i), 0)
+    workers.append(w)
+}
+assert(Worker.join(workers, 60000))
+let elapsed = start.elapsed
+let ops = CLIENTS * COUNT * OPS * 2
+test.log(1, "[Bench]", "EJS cache ops/sec: " + ((elapsed > 0) ? (ops * 1000 / elapsed) : 0).toFixed(1))
+
+//  Every bench read follows its write so no reads may miss
+let http = new Http
+http.get(HTTP + "/metrics")
+assert(http.code == 200)
+let hits = http.response.match(/appweb_ejs_cache_total\{result="hit"\} [0-9]+/)
+assert(hits && hits.length == 1)
+assert((hits[0].split(" ")[1] cast Number) >= ops / 2)
+http.close()
@@ -0,0 +1,51 @@
+/*
+ *  ejsPool.tst - EJS page throughput using pooled interpreters
+ */
+
+const HTTP = session["main"]
+const COUNT = 50 * test.depth
+
+//  Pages that sleep, update databases or expect form posts are not representative
+const SKIP = [ "sleep.ejs", "sqlite.ejs", "upload.ejs" ]
+
+let http = new Http
+let start = new Date
+for (i in COUNT) {
+    http.get(HTTP + "/ejsProgram.ejs?a=" + i)
+    assert(http.code == 200)
+    assert(deserialize(http.response).params.a == i)
+}
+let elapsed = start.elapsed
+test.log(1, "[Bench]", "EJS pages/sec: " + ((elapsed > 0) ? (COUNT * 1000 / elapsed) : 0).toFixed(1))
+
+//  Benchmark each of the test pages
+let total = 0
+let totalElapsed = 0
+for each (page in Path("web").find("*.ejs", false)) {
+    let name = page.basename.toString()
+    if (SKIP.contains(name)) {
+        continue
+    }
+    let failed = 0
+    start = new Date
+    for (i in COUNT) {
+        http.get(HTTP + "/" + name)
+        if (http.code != 200) {
+            failed++
+        }
+    }
+    elapsed = start.elapsed
+    assert(failed == 0)
+    total += COUNT
+    totalElapsed += elapsed
+    test.log(2, "[Bench]", name + " pages/sec: " + ((elapsed > 0) ? (COUNT * 1000 / elapsed) : 0).toFixed(1))
+}
+test.log(1, "[Bench]", "All EJS pages/sec: " + ((totalElapsed > 0) ? (total * 1000 / totalElapsed) : 0).toFixed(1))
+
+//  Requests after the first must reuse pooled interpreters
+http.get(HTTP + "/metrics")
+assert(http.code == 200)
+let hits = http.response.match(/appweb_ejs_interp_pool_total\{result="hit"\} [0-9]+/)
+assert(hits && hits.length == 1)
+assert(hits[0].split(" ")[1] != "0")
+http.close()
@@ -0,0 +1,34 @@
+/*
+ *  ejsSession.tst - EJS session creation throughput and timer expiry
+ */
+
+const HTTP = session["main"]
+const COUNT = 100 * test.depth
+
+let http = new Http
+
+function sessionCount(): Number {
+    http.get(HTTP + "/metrics")
+    assert(http.code == 200)
+    let count = http.response.match(/appweb_ejs_sessions [0-9]+/)
+    assert(count && count.length == 1)
+    return count[0].split(" ")[1] cast Number
+}
+
+let before = sessionCount()
+let start = new Date
+for (i in COUNT) {
+    http.get(HTTP + "/session.ejs?op=create&timeout=1")
+    assert(http.code == 200)
+}
+let elapsed = start.elapsed
+test.log(1, "[Bench]", "EJS sessions created/sec: " + ((elapsed > 0) ? (COUNT * 1000 / elapsed) : 0).toFixed(1))
+assert(sessionCount() >= before + COUNT)
+
+//  The session timer must expire idle sessions without them being accessed. Allow for the timer period.
+let deadline = new Date
+while (sessionCount() > before && deadline.elapsed < 5000) {
+    App.sleep(250)
+}
+assert(sessionCount() <= before)
+http.close()
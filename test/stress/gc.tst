@@ -0,0 +1,60 @@
+/*
+ *  gc.tst - Incremental garbage collection pauses and correctness
+ */
+
+const LIVE = 5000 * test.depth
+const CHURN = 20000 * test.depth
+
+/*
+ *  Churn garbage while replacing some long lived objects. Return the max GC pause so far in usec.
+ */
+function churn(budget: Number): Number {
+    GC.pauseBudget = budget
+    assert(GC.pauseBudget == budget)
+    let live = []
+    for (i in LIVE) {
+        live.push({index: i, items: [i, "item-" + i]})
+    }
+    let before = GC.pauses
+    for (i in CHURN) {
+        let garbage = {index: i, items: [i]}
+        if (i % 100 == 0) {
+            live[i / 100] = {index: -i, items: [garbage]}
+        }
+    }
+    let after = GC.pauses
+    assert(after.count > before.count)
+
+    //  Objects stored while an incremental mark was in progress must survive
+    for (i in LIVE) {
+        let item = live[i]
+        if (i < CHURN / 100) {
+            assert(item.index == -i * 100 && item.items[0].index == i * 100)
+        } else {
+            assert(item.index == i && item.items[1] == "item-" + i)
+        }
+    }
+    return after.max
+}
+
+let saved = GC.pauseBudget
+GC.resetPauses()
+let incremental = churn(1)
+GC.resetPauses()
+let full = churn(0)
+GC.pauseBudget = saved
+
+//  With a 1 msec budget, the longest incremental step must stay well under a stop the world collection
+const MAX_PAUSE = 25000
+assert(incremental < MAX_PAUSE)
+assert(incremental < full)
+
+let pauses = GC.pauses
+let count = 0
+for each (n in pauses.histogram) {
+    count += n
+}
+assert(count == pauses.count)
+assert(pauses.histogram.length == pauses.limits.length + 1)
+assert(pauses.steps > 0)
+test.log(1, "[Bench]", "GC max pause usec: full " + full + ", incremental " + incremental)
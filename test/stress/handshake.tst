@@ -0,0 +1,41 @@
+/*
+ *  handshake.tst - SSL handshake throughput with and without session resumption
+ */
+
+const COUNT = 20 * test.depth
+
+if (test.config["ssl"] == 1) {
+
+    /*
+     *  Issue requests on new connections so each request requires a handshake
+     */
+    function bench(url: String): Number {
+        let start = new Date
+        for (i in COUNT) {
+            let http = new Http
+            http.get(url)
+            assert(http.code == 200)
+            http.close()
+        }
+        let elapsed = start.elapsed
+        return (elapsed > 0) ? (COUNT * 1000 / elapsed) : 0
+    }
+
+    let full = bench(session["sslNoCache"] + "/index.html")
+    let resumed = bench(session["ssl"] + "/index.html")
+    test.log(1, "[Bench]", "SSL handshakes/sec: full " + full.toFixed(1) + ", resumed " + resumed.toFixed(1))
+
+    //  The resumption enabled host must report resumed handshakes
+    let http = new Http
+    http.get(session["main"] + "/metrics")
+    assert(http.code == 200)
+    let port = session["ssl"].split(":")[2]
+    let pattern = 'appweb_ssl_handshakes_total\\{host="[^"]*:' + port + '",type="resumed"\\} [0-9]+'
+    let counts = http.response.match(RegExp(pattern))
+    assert(counts && counts.length == 1)
+    assert(counts[0].split(" ")[1] != "0")
+    http.close()
+
+} else {
+    test.skip("SSL not enabled")
+}
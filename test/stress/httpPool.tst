@@ -0,0 +1,53 @@
+/*
+ *  httpPool.tst - Http client request rates with pooled connections and pipelining
+ */
+
+const HTTP = session["main"]
+const URL = HTTP + "/index.html"
+const COUNT = 200 * test.depth
+
+//  Return requests/sec using a new Http object per request
+function rate(): Number {
+    let start = new Date
+    for (i in COUNT) {
+        let http: Http = new Http
+        http.get(URL)
+        assert(http.code == 200)
+        http.close()
+    }
+    return COUNT * 1000 / Math.max(start.elapsed, 1)
+}
+
+Http.setPoolLimits(0)
+let unpooled = rate()
+Http.setPoolLimits(8)
+let before = Http.pool
+let pooled = rate()
+assert(Http.pool.opened - before.opened < COUNT / 10)
+test.log(1, "[Bench]", "Http requests/sec unpooled: " + unpooled.toFixed(0) + ", pooled: " + pooled.toFixed(0))
+
+//  Sequential versus pipelined requests on one connection
+let uris = []
+for (i in COUNT) {
+    uris.push(URL + "?" + i)
+}
+let http: Http = new Http
+let start = new Date
+for each (uri in uris) {
+    http.get(uri)
+    assert(http.code == 200)
+}
+let sequential = start.elapsed
+
+start = new Date
+let responses = []
+for (i = 0; i < COUNT; i += 20) {
+    responses = responses.concat(http.pipeline(uris.slice(i, i + 20)))
+}
+let pipelined = start.elapsed
+assert(responses.length == COUNT)
+for each (r in responses) {
+    assert(r.code == 200)
+}
+test.log(1, "[Bench]", "Http " + COUNT + " requests msec sequential: " + sequential + ", pipelined: " + pipelined)
+http.close()
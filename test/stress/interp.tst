@@ -0,0 +1,14 @@
+/*
+ *  interp.tst - Interpreter creation time. Each worker creates a full interpreter and loads the core modules.
+ */
+
+const COUNT = 20 * test.depth
+
+let start = new Date
+for (i in COUNT) {
+    let w = new Worker
+    assert(w.eval("6 * 7") == "42")
+    w.terminate()
+}
+let elapsed = start.elapsed
+test.log(1, "[Bench]", "Interpreter creation msec: " + (elapsed / COUNT).toFixed(2))
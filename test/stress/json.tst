@@ -0,0 +1,51 @@
+/*
+ *  json.tst - JSON serialize and deserialize throughput and streamed JSON responses
+ */
+
+const HTTP = session["main"]
+const ROWS = 5000 * test.depth
+const REQUESTS = 2 * test.depth
+
+let rows = []
+for (i in ROWS) {
+    rows.push({ id: i, name: "row-" + i, text: "Some \"quoted\" text with a \\ backslash " + i, 
+        tags: ["alpha", "beta", "gamma"], nested: { value: i * 1.5, flag: i % 2 == 0, missing: null } })
+}
+
+let start = new Date
+let json = serialize(rows)
+let serializeTime = start.elapsed
+
+start = new Date
+let copy = deserialize(json)
+let deserializeTime = start.elapsed
+
+assert(copy.length == ROWS)
+assert(copy[ROWS - 1].text == rows[ROWS - 1].text && copy[ROWS - 1].nested.missing == null)
+assert(serialize(copy) == json)
+
+function rate(msec: Number): String
+    ((msec > 0) ? (json.length / 1024 / 1024 * 1000 / msec) : 0).toFixed(1)
+
+test.log(1, "[Bench]", "JSON " + (json.length / 1024 / 1024).toFixed(1) + " MB, serialize MB/sec: " + 
+    rate(serializeTime) + ", deserialize MB/sec: " + rate(deserializeTime))
+
+/*
+ *  Compare write(serialize()) with streamed writeJSON() responses
+ */
+function fetch(op: String): Number {
+    let http = new Http
+    let start = new Date
+    for (i in REQUESTS) {
+        http.get(HTTP + "/json.ejs?op=" + op + "&count=" + ROWS)
+        assert(http.code == 200)
+        assert(http.response.length > ROWS * 10)
+    }
+    http.close()
+    return start.elapsed
+}
+if (test.depth >= 2) {
+    let stringTime = fetch("string")
+    let streamTime = fetch("stream")
+    test.log(1, "[Bench]", "JSON response msec: serialize " + stringTime + ", stream " + streamTime)
+}
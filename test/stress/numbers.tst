@@ -0,0 +1,29 @@
+/*
+ *  numbers.tst - Arithmetic on small integers should not allocate
+ */
+
+const COUNT = 200 * test.depth
+
+/*
+ *  Run an arithmetic loop with values offset by base. Return the GC pauses and elapsed time taken.
+ */
+function bench(base: Number): Object {
+    let sum = 0
+    let before = GC.pauses.count
+    let start = new Date
+    for (i in COUNT) {
+        for (let j = 0; j < 1000; j++) {
+            let v = j + base
+            sum = v - base - j + sum * 1
+        }
+    }
+    let elapsed = start.elapsed
+    assert(sum == 0)
+    return {pauses: GC.pauses.count - before, elapsed: elapsed}
+}
+
+let small = bench(10)
+let large = bench(1000000)
+assert(small.pauses < large.pauses)
+test.log(1, "[Bench]", "Number loop GC pauses: small " + small.pauses + " (" + small.elapsed + " msec), large " + 
+    large.pauses + " (" + large.elapsed + " msec)")
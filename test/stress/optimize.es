@@ -0,0 +1,89 @@
+/*
+ *  optimize.es - Byte code optimizer benchmark. Compiled by optimize.tst with and without the optimizer.
+ *
+ *  Usage: ajs optimize.mod iterations
+ */
+
+const DEBUG_ONLY: Boolean = false
+
+function classify(n: Number): String {
+    if (n < 0) {
+        return "negative"
+    } else if (n == 0) {
+        return "zero"
+    } else {
+        return "positive"
+    }
+    return "unreachable"
+}
+
+function pad(s: String, width: Number = 8, fill: String = " "): String {
+    while (s.length < width) {
+        s = fill + s
+    }
+    return s
+}
+
+function search(items: Array, value: Number): Number {
+    let found = -1
+    for (let i = 0; i < items.length; i++) {
+        if (!(items[i] != value)) {
+            found = i
+            break
+        }
+    }
+    return found
+}
+
+function loop(count: Number): Number {
+    let sum = 0
+    let i = 0
+    while (true) {
+        if (i >= count) {
+            break
+        }
+        if (DEBUG_ONLY) {
+            print("never")
+        }
+        if (false) {
+            sum = -1
+        }
+        sum = sum
+        sum += (i % 3 == 0) ? i : (!(i % 2) ? 1 : 2)
+        i++
+    }
+    return sum
+}
+
+function flags(a: Boolean, b: Boolean): Number {
+    let result = 0
+    if (!a) {
+        result += 1
+    }
+    if (!b) {
+        result += 2
+    }
+    if (!true) {
+        result += 4
+    }
+    if (a && !b || !a && b) {
+        result += 8
+    }
+    return result
+}
+
+let iterations = App.args[1] cast Number
+let items = []
+for (i in 50) {
+    items.push(i * 7 % 50)
+}
+let start = new Date
+let checksum = 0
+for (i in iterations) {
+    checksum += loop(100)
+    checksum += search(items, i % 60)
+    checksum += flags(i % 2 == 0, i % 3 == 0)
+    checksum += classify(i % 5 - 2).length
+    checksum += pad("" + i).length + pad("x", 3, "-").length + pad("y", 2).length
+}
+print(checksum + " " + start.elapsed)
@@ -0,0 +1,38 @@
+/*
+ *  optimize.tst - Byte code optimizer correctness, code size and speed
+ */
+
+const ITERATIONS = 200 * test.depth
+
+/*
+ *  Compile the benchmark script and return the module size
+ */
+function compile(options: String, file: String): Number {
+    sh(locate("ajsc") + " --debug " + options + " --out " + file + " stress/optimize.es")
+    let size = Path(file).size
+    assert(size > 0)
+    return size
+}
+
+/*
+ *  Run the compiled benchmark and return [checksum, elapsed msec]
+ */
+function bench(file: String): Array {
+    let result = sh(locate("ajs") + " " + file + " " + ITERATIONS).trim().split(" ")
+    assert(result.length == 2)
+    return result
+}
+
+let plainSize = compile("", "stress/optimize-plain.mod")
+let optimizedSize = compile("--optimize", "stress/optimize.mod")
+let plain = bench("stress/optimize-plain.mod")
+let optimized = bench("stress/optimize.mod")
+Path("stress/optimize-plain.mod").remove()
+Path("stress/optimize.mod").remove()
+
+//  The optimizer must shrink the code and not change results
+assert(optimizedSize < plainSize)
+assert(plain[0] == optimized[0])
+assert(optimized[0] == bench("stress/optimize.es")[0])
+test.log(1, "[Bench]", "Byte code optimizer module bytes: " + plainSize + " -> " + optimizedSize +
+    ", msec: " + plain[1] + " -> " + optimized[1])
@@ -0,0 +1,59 @@
+/*
+ *  props.es - Property access benchmark. Run by props.tst with and without inline caches.
+ *
+ *  Usage: ajs props.es iterations
+ */
+
+class Point {
+    var x: Number
+    var y: Number
+
+    function Point(x: Number, y: Number) {
+        this.x = x
+        this.y = y
+    }
+
+    function magnitude(): Number {
+        return x * x + y * y
+    }
+}
+
+class Point3 extends Point {
+    var z: Number
+
+    function Point3(x: Number, y: Number, z: Number) {
+        super(x, y)
+        this.z = z
+    }
+
+    override function magnitude(): Number {
+        return x * x + y * y + z * z
+    }
+}
+
+let iterations = App.args[1] cast Number
+let points = []
+for (i in 100) {
+    points.push((i % 2) ? new Point(i, i + 1) : new Point3(i, i + 1, i + 2))
+}
+
+let sum = 0
+let start = new Date
+for (n in iterations) {
+    for (i in 100) {
+        let p = points[i]
+        p.x = p.x + 1
+        sum += p.x + p.y + p.magnitude()
+        let o = {alpha: i, beta: n, gamma: p}
+        o.beta = o.alpha + o.gamma.y
+        sum += o.beta
+
+        //  Deleting properties of ordinary objects does not invalidate the caches but must not leave stale entries
+        if (i % 4 == 0) {
+            delete o.alpha
+            o.alpha = n
+        }
+        sum += o.alpha
+    }
+}
+print(sum + " " + start.elapsed)
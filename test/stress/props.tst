@@ -0,0 +1,21 @@
+/*
+ *  props.tst - Property access with and without inline caches
+ */
+
+const ITERATIONS = 500 * test.depth
+
+/*
+ *  Run the benchmark script and return [checksum, elapsed msec]
+ */
+function bench(options: String): Array {
+    let result = sh(locate("ajs") + " " + options + " stress/props.es " + ITERATIONS).trim().split(" ")
+    assert(result.length == 2)
+    return result
+}
+
+let cached = bench("")
+let uncached = bench("--noinline")
+
+//  Inline caches must not change results
+assert(cached[0] == uncached[0])
+test.log(1, "[Bench]", "Property access msec: inline caches " + cached[1] + ", no inline caches " + uncached[1])
@@ -0,0 +1,62 @@
+/*
+ *  regexp.tst - Regular expression compile caching and match throughput
+ */
+
+const COUNT = 20000 * test.depth
+const PATTERNS = 50
+
+let line = '192.168.1.20 - - [18/Oct/2009:10:24:17 -0700] "GET /images/logo.png HTTP/1.1" 200 4235'
+
+/*
+ *  Build the pattern for each iteration as a fresh interpreter would from a regex literal
+ */
+function compile(count: Number): Number {
+    let start = new Date
+    let re
+    for (i in count) {
+        re = new RegExp("^([0-9.]+) .* \"(GET|POST|PUT) ([^ ]+) HTTP/1.[01]\" ([0-9]+) " + (i % PATTERNS))
+    }
+    assert(re.test('10.0.0.1 - "GET / HTTP/1.0" 200 ' + ((count - 1) % PATTERNS)))
+    return start.elapsed
+}
+
+//  Compile throughput with and without the cache
+RegExp.setCacheLimit(0)
+let uncached = compile(COUNT)
+RegExp.setCacheLimit(256)
+compile(PATTERNS)
+let before = RegExp.cache
+let cached = compile(COUNT)
+let after = RegExp.cache
+assert(after.hits - before.hits == COUNT)
+assert(after.misses == before.misses)
+
+//  More patterns than the cache holds: least recently used idle patterns are evicted
+GC.run(true)
+RegExp.setCacheLimit(PATTERNS / 2)
+assert(RegExp.cache.evicted > before.evicted)
+compile(PATTERNS * 2)
+assert(RegExp.cache.entries <= PATTERNS / 2)
+RegExp.setCacheLimit(256)
+
+//  Match throughput on a shared compiled pattern
+let start = new Date
+let matched = 0
+for (i in COUNT) {
+    let m = line.match(/^([0-9.]+) .* "(GET|POST|PUT) ([^ ]+) HTTP\/1.[01]" ([0-9]+)/)
+    if (m && m[3] == "/images/logo.png") {
+        matched++
+    }
+}
+let matchTime = start.elapsed
+assert(matched == COUNT)
+
+function rate(count: Number, msec: Number): Number {
+    if (msec <= 0) {
+        return count
+    }
+    return Math.round(count * 1000 / msec)
+}
+
+test.log(1, "[Bench]", "RegExp compile x " + COUNT + ", msec uncached: " + uncached + ", cached: " + cached + 
+    ", matches/sec: " + rate(COUNT, matchTime))
@@ -0,0 +1,65 @@
+/*
+ *  sqlite.tst - SQLite query throughput with cached statements and pooled connections
+ */
+
+use namespace "ejs.db"
+
+const HTTP = session["main"]
+const DB = "sqlite.tdat"
+const ROWS = 200
+const QUERIES = 1000 * test.depth
+const OPENS = 100 * test.depth
+const REQUESTS = 50 * test.depth
+
+Path(DB).remove()
+let db = new Sqlite(DB)
+db.sql("CREATE TABLE items(id INTEGER PRIMARY KEY, name TEXT, price REAL)")
+db.sql("BEGIN TRANSACTION")
+for (i in ROWS) {
+    db.sql("INSERT INTO items(name, price) VALUES(?, ?)", "item-" + i, i)
+}
+db.sql("COMMIT")
+
+function rate(count: Number, msec: Number): String
+    ((msec > 0) ? (count * 1000 / msec) : 0).toFixed(1)
+
+//  Literal values make every command distinct so each must be prepared
+let start = new Date
+for (i in QUERIES) {
+    let rows = db.sql("SELECT * FROM items WHERE id = " + (i % ROWS + 1))
+    assert(rows[0].name == "item-" + (i % ROWS))
+}
+let literalTime = start.elapsed
+
+//  Bound parameters reuse one cached statement
+start = new Date
+for (i in QUERIES) {
+    let rows = db.sql("SELECT * FROM items WHERE id = ?", i % ROWS + 1)
+    assert(rows[0].name == "item-" + (i % ROWS))
+}
+let boundTime = start.elapsed
+db.close()
+
+//  Opening a database takes a pooled connection with its statement cache
+start = new Date
+for (i in OPENS) {
+    db = new Sqlite(DB)
+    assert(db.sql("SELECT name FROM items WHERE id = ?", i % ROWS + 1).length == 1)
+    db.close()
+}
+let openTime = start.elapsed
+
+test.log(1, "[Bench]", "SQLite queries/sec: literal " + rate(QUERIES, literalTime) + ", bound " + 
+    rate(QUERIES, boundTime) + ", open+query/sec: " + rate(OPENS, openTime))
+
+if (test.depth >= 2) {
+    let http = new Http
+    start = new Date
+    for (i in REQUESTS) {
+        http.get(HTTP + "/sqlite.ejs?id=" + (i % ROWS + 1))
+        assert(http.code == 200)
+        assert(deserialize(http.response)[0].name == "item-" + (i % ROWS))
+    }
+    test.log(1, "[Bench]", "SQLite EJS pages/sec: " + rate(REQUESTS, start.elapsed))
+    http.close()
+}
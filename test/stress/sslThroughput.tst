@@ -0,0 +1,32 @@
+/*
+ *  sslThroughput.tst - HTTPS static file throughput compared with plain HTTP
+ */
+
+const COUNT = 10 * test.depth
+const SIZE = Path("web/big.txt").size
+
+if (test.config["ssl"] == 1) {
+
+    /*
+     *  Fetch the file repeatedly on one connection and return the transfer rate in MB/sec
+     */
+    function bench(url: String): Number {
+        let http = new Http
+        let start = new Date
+        for (i in COUNT) {
+            http.get(url)
+            assert(http.code == 200)
+            assert(http.response.length == SIZE)
+        }
+        let elapsed = start.elapsed
+        http.close()
+        return (elapsed > 0) ? (COUNT * SIZE * 1000 / elapsed / (1024 * 1024)) : 0
+    }
+
+    let plain = bench(session["main"] + "/big.txt")
+    let secure = bench(session["ssl"] + "/big.txt")
+    test.log(1, "[Bench]", "Static file MB/sec: http " + plain.toFixed(1) + ", https " + secure.toFixed(1))
+
+} else {
+    test.skip("SSL not enabled")
+}
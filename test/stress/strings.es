@@ -0,0 +1,66 @@
+/*
+ *  strings.es - String concatenation benchmark. Renders a 500 row table the way EJS views do.
+ *
+ *  Usage: ajs strings.es iterations
+ */
+
+const ROWS = 500
+
+/*
+ *  Build rows from object literals and from JSON so the property names are created at run-time
+ */
+function getRows(): Array {
+    let rows = []
+    for (i in ROWS) {
+        let row = {id: i, name: "item-" + i, price: i * 3 % 97, status: (i % 3) ? "active" : "retired"}
+        row["column" + (i % 8)] = i
+        rows.push(row)
+    }
+    return deserialize(serialize(rows))
+}
+
+/*
+ *  Concatenate the table into one string as a view helper would
+ */
+function renderConcat(rows: Array): String {
+    let result = '<table class="-ejs-table">\r\n'
+    for each (row in rows) {
+        result += '    <tr class="' + ((row.id % 2) ? "-ejs-oddRow" : "-ejs-evenRow") + '">\r\n'
+        for (name in row) {
+            result += '        <td>' + row[name] + '</td>\r\n'
+        }
+        result += '    </tr>\r\n'
+    }
+    result += '</table>\r\n'
+    return result
+}
+
+/*
+ *  Collect the table parts and join them once
+ */
+function renderJoin(rows: Array): String {
+    let parts = ['<table class="-ejs-table">\r\n']
+    for each (row in rows) {
+        parts.push('    <tr class="' + ((row.id % 2) ? "-ejs-oddRow" : "-ejs-evenRow") + '">\r\n')
+        for (name in row) {
+            parts.push('        <td>' + row[name] + '</td>\r\n')
+        }
+        parts.push('    </tr>\r\n')
+    }
+    parts.push('</table>\r\n')
+    return parts.join("")
+}
+
+let iterations = App.args[1] cast Number
+let start = new Date
+let checksum = 0
+for (i in iterations) {
+    let rows = getRows()
+    let concat = renderConcat(rows)
+    let joined = renderJoin(rows)
+    if (concat != joined) {
+        throw new Error("Rendered tables differ")
+    }
+    checksum += concat.length + joined.length
+}
+print(checksum + " " + start.elapsed)
@@ -0,0 +1,72 @@
+/*
+ *  strings.tst - String concatenation, building and run-time property names
+ */
+
+const ITERATIONS = 5 * test.depth
+
+//  Empty operands and mixed types
+let s = "abc"
+assert(s + "" == "abc" && "" + s == "abc" && "" + "" == "")
+assert(s + 1 == "abc1" && 1 + s == "1abc" && s + null == "abcnull")
+assert(["a", "b", "c"].join("") == "abc" && ["a", "b", "c"].join("-") == "a-b-c")
+assert("a".concat("b", 1, "c") == "ab1c")
+
+//  Build a long string by repeated appends
+let built = ""
+let parts = []
+for (i in 5000) {
+    built += i + ","
+    parts.push(i)
+}
+assert(built.length == parts.join(",").length + 1)
+assert(built == parts.join(",") + ",")
+
+//  Appends to a local extend it in place. Copies taken along the way must not change.
+function append(v) {
+    v += "!"
+    return v
+}
+function appendLocals() {
+    let s = ""
+    let copy, pushed = [], passed
+    for (i in 200) {
+        s += i + ","
+        if (i == 50) {
+            copy = s
+        } else if (i == 60) {
+            pushed.push(s)
+        } else if (i == 70) {
+            passed = append(s)
+        }
+    }
+    let x = "a"
+    x += "b"
+    x = x + "c"
+    x += x
+    x += 1
+    x += null
+    return [s, copy, pushed[0], passed, x]
+}
+let result = appendLocals()
+assert(result[0] == parts.slice(0, 200).join(",") + ",")
+assert(result[1] == parts.slice(0, 51).join(",") + ",")
+assert(result[2] == parts.slice(0, 61).join(",") + ",")
+assert(result[3] == parts.slice(0, 71).join(",") + ",!")
+assert(result[4] == "abcabc1null")
+
+//  Run-time property names: identifier-like names are interned, others are copied
+for (i in 2000) {
+    let o = {}
+    o["name" + (i % 10)] = i
+    o["not an identifier " + i] = i
+    o["x".times(40) + i] = i
+    assert(o["name" + (i % 10)] == i && o["not an identifier " + i] == i && o["x".times(40) + i] == i)
+    let copy = deserialize(serialize(o))
+    assert(copy["name" + (i % 10)] == i && copy["not an identifier " + i] == i)
+}
+
+if (test.depth >= 2) {
+    let result = sh(locate("ajs") + " stress/strings.es " + ITERATIONS).trim().split(" ")
+    assert(result.length == 2 && result[0] > 0)
+    test.log(1, "[Bench]", "500 row table render x " + ITERATIONS + ", msec: " + result[1])
+}
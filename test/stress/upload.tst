@@ -44,3 +44,39 @@ if (test.threads == 1) {
     sh("diff " + uploaded + " " + TESTFILE)
 }
 rm(TESTFILE)
+
+//
+//  Upload throughput benchmark. Sizes are in MB and reach multiple GB at the highest depths.
+//
+/* Depths:      0  1   2   3   4    5    6     7     8     9    */
+var benchSizes = [ 0, 0, 16, 32, 64, 128, 512, 1024, 2048, 4096 ]
+
+if (test.threads == 1 && benchSizes[test.depth] > 0) {
+    const BENCHFILE = "stress/upload-bench-" + hashcode(self) + ".tdat"
+    let mb = new ByteArray(1024 * 1024)
+    for (i in (1024 * 1024 / buf.available)) {
+        mb.write(buf)
+        buf.readPosition = 0
+    }
+    f = File(BENCHFILE).open({mode: "w"})
+    for (i in benchSizes[test.depth]) {
+        f.write(mb)
+        mb.readPosition = 0
+    }
+    f.close()
+    size = Path(BENCHFILE).size
+
+    let start = new Date
+    http.upload(HTTP + "/upload.ejs", { file: BENCHFILE })
+    assert(http.code == 200)
+    let elapsed = start.elapsed
+    http.close()
+
+    let uploaded = Path("web/tmp").join(Path(BENCHFILE).basename)
+    assert(uploaded.size == size)
+    if (elapsed > 0) {
+        test.log(1, "[Bench]", "Upload " + (size / 1024 / 1024 * 1000 / elapsed).toFixed(2) + " MB/sec")
+    }
+    rm(uploaded)
+    rm(BENCHFILE)
+}
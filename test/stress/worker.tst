@@ -0,0 +1,33 @@
+/*
+ *  worker.tst - Worker creation and message passing throughput
+ */
+
+const COUNT = 50 * test.depth
+const MESSAGES = 5000 * test.depth
+
+let start = new Date
+for (i in COUNT) {
+    let w = new Worker
+    w.eval("1 + 2")
+}
+Worker.join()
+test.log(1, "[Bench]", "Worker creation msec: " + (start.elapsed / COUNT).toFixed(2))
+
+let count = 0
+let ordered = true
+let w = new Worker
+w.onmessage = function (e) {
+    if (e.data.id != count) {
+        ordered = false
+    }
+    count++
+}
+start = new Date
+w.eval('
+    for (i in ' + MESSAGES + ') {
+        postMessage({ id: i, name: "item", values: [1, 2, 3] })
+    }
+', 0)
+Worker.join()
+assert(count == MESSAGES && ordered)
+test.log(1, "[Bench]", "Worker messages per sec: " + (MESSAGES * 1000 / Math.max(start.elapsed, 1)).toFixed(0))
@@ -0,0 +1,16 @@
+/*
+ *  State.es - Mutate module level and static state. Each request must start with fresh state.
+ */
+
+public class StateController extends Controller {
+
+    static var items = []
+
+    use namespace action
+
+    action function index() {
+        appCache.count = (appCache.count || 0) + 1
+        items.push(params.id)
+        render(serialize({ count: appCache.count, items: items }))
+    }
+}
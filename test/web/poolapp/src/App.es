@@ -0,0 +1,5 @@
+/*
+ *  App.es - Application with module level state for the interpreter pool tests
+ */
+
+public var appCache = {}